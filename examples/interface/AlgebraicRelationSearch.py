@@ -26,16 +26,24 @@ NSqrt=100000.
 #       reductions and seem to reliably lead to an exception being thrown,
 #       so these tests will only use strong LLL reductions
 
+# NOTE: A basis of this size would form a single segment of the default
+#       size, so the segmented variant is run with several smaller sizes
+variants = [(variant,ctrl.segmentSize) for variant in \
+             (El.LLL_NORMAL,El.LLL_DEEP,El.LLL_DEEP_REDUCE)] + \
+           [(El.LLL_SEGMENTED,segmentSize) for segmentSize in (4,8,16)]
+
 B=El.Matrix()
 for presort, smallestFirst in (True,True), (True,False), (False,False):
   for deltaLower in 0.5, 0.75, 0.95, 0.98, 0.99:
-    for variant in El.LLL_NORMAL, El.LLL_DEEP, El.LLL_DEEP_REDUCE:
+    for variant, segmentSize in variants:
 
-      print('variant={}, presort={}, smallestFirst={}, deltaLower={}'.format( \
-        variant,presort,smallestFirst,deltaLower))
+      print('variant={}, segmentSize={}, presort={}, smallestFirst={}, ' \
+        'deltaLower={}'.format( \
+        variant,segmentSize,presort,smallestFirst,deltaLower))
 
       ctrl.delta = deltaLower
       ctrl.variant = variant
+      ctrl.segmentSize = segmentSize
       ctrl.presort = presort
       ctrl.smallestFirst = smallestFirst
 
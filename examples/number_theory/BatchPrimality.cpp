@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+int main( int argc, char* argv[] )
+{
+    typedef unsigned long long Word;
+
+    El::Environment env( argc, argv );
+    const Word start =
+      El::Input("--start","first candidate",Word(1000000000000000000ULL));
+    const Word numCandidates =
+      El::Input("--numCandidates","number of candidates",Word(10000000));
+    const Word trialDivisionLimit =
+      El::Input("--trialDivLimit","trial division limit",Word(256));
+    const bool parallel = El::Input("--parallel","run in parallel?",true);
+    El::ProcessInput();
+    El::PrintInputReport();
+
+    try
+    {
+        El::Timer timer;
+
+        std::vector<Word> candidates( numCandidates );
+        for( Word i=0; i<numCandidates; ++i )
+            candidates[i] = start + i;
+
+        El::BatchPrimalityCtrl ctrl;
+        ctrl.trialDivisionLimit = trialDivisionLimit;
+        ctrl.parallel = parallel;
+        timer.Start();
+        const auto primality = El::BatchPrimalityTest( candidates, ctrl );
+        const double batchTime = timer.Stop();
+        Word numPrimes = 0;
+        for( const auto& result : primality )
+            if( result == El::PRIME )
+                ++numPrimes;
+        El::Output
+        ("Screened ",numCandidates," candidates in ",batchTime," seconds");
+        El::Output("numPrimes=",numPrimes);
+
+        // Check the count against the wheel sieve
+        timer.Start();
+        const Word numSieved =
+          El::CountPrimesInRange( start, start+numCandidates );
+        El::Output
+        ("Sieved the same range in ",timer.Stop()," seconds, finding ",
+         numSieved," primes");
+        if( numSieved != numPrimes )
+            El::LogicError("Prime counts did not match");
+
+#ifdef EL_HAVE_MPC
+        std::vector<El::BigInt> bigCandidates( numCandidates );
+        for( Word i=0; i<numCandidates; ++i )
+        {
+            bigCandidates[i] = start + i;
+            bigCandidates[i] <<= 64u;
+            bigCandidates[i] += 1u;
+        }
+        timer.Start();
+        const auto bigPrimality = El::BatchPrimalityTest( bigCandidates, ctrl );
+        const double bigBatchTime = timer.Stop();
+        Word numBigPrimes = 0;
+        for( const auto& result : bigPrimality )
+            if( result != El::COMPOSITE )
+                ++numBigPrimes;
+        El::Output
+        ("Screened ",numCandidates," multi-word candidates in ",bigBatchTime,
+         " seconds, finding ",numBigPrimes," probable primes");
+#endif
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+    return 0;
+}
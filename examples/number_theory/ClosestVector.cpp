@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Approximately solve many closest vector problems against a single random
+// integer lattice, first with Babai's nearest plane algorithm alone and then
+// with a bounded enumeration around each Babai point
+int main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+
+    try
+    {
+        const El::Int m = El::Input("--m","height of basis",60);
+        const El::Int n = El::Input("--n","width of basis",50);
+        const El::Int numTargets =
+          El::Input("--numTargets","number of targets",10000);
+        const double entryBound =
+          El::Input("--entryBound","bound on basis entries",1000.);
+        const El::Int batchSize =
+          El::Input("--batchSize","number of targets per batch",64);
+        const El::Int blocksize =
+          El::Input("--blocksize","coordinates per GEMM update",32);
+        const El::Int maxEnumNodes =
+          El::Input("--maxEnumNodes","enumeration nodes per target",1000);
+        const bool parallel = El::Input("--parallel","run in parallel?",true);
+        El::ProcessInput();
+        El::PrintInputReport();
+
+        El::Matrix<double> B;
+        El::Uniform( B, m, n, 0., entryBound );
+        El::Round( B );
+
+        El::Matrix<double> T;
+        El::Gaussian( T, m, numTargets, 0., entryBound );
+
+        El::Timer timer;
+        timer.Start();
+        El::ClosestVectorSolver<double> solver( B );
+        El::Output
+        ("Reduced the basis (of rank ",solver.Rank(),") in ",timer.Stop(),
+         " seconds");
+
+        auto meanDistance = [&]( const El::Matrix<double>& Y )
+          {
+              El::Matrix<double> E( Y );
+              E -= T;
+              return El::FrobeniusNorm( E ) / El::Sqrt(double(numTargets));
+          };
+
+        El::CVPCtrl ctrl;
+        ctrl.batchSize = batchSize;
+        ctrl.blocksize = blocksize;
+        ctrl.parallel = parallel;
+        El::Matrix<double> Y;
+        timer.Start();
+        solver.Solve( T, Y, ctrl );
+        const double babaiTime = timer.Stop();
+        El::Output
+        ("Babai: ",babaiTime," seconds, RMS distance of ",meanDistance(Y));
+
+        ctrl.maxEnumNodes = maxEnumNodes;
+        timer.Start();
+        const El::Int numImproved = solver.Solve( T, Y, ctrl );
+        const double enumTime = timer.Stop();
+        El::Output
+        ("Babai with enumeration: ",enumTime," seconds, RMS distance of ",
+         meanDistance(Y),", ",numImproved," of ",numTargets," improved");
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
@@ -24,6 +24,10 @@ int main( int argc, char* argv[] )
           El::Input("--a0","a0 in Pollard rho",El::BigInt(0));
         const El::BigInt b0 =
           El::Input("--b0","b0 in Pollard rho",El::BigInt(0));
+        const bool distinguishedPoints =
+          El::Input("--distinguished","use distinguished points?",false);
+        const int distinguishedBits =
+          El::Input("--distinguishedBits","distinguished bits",-1);
         const int numReps = El::Input("--numReps","num Miller-Rabin reps,",30);
         const bool progress = El::Input("--progress","factor progress?",true);
         const bool time = El::Input("--time","time Pollard rho steps?",true);
@@ -37,6 +41,8 @@ int main( int argc, char* argv[] )
         rhoCtrl.b0 = b0;
         rhoCtrl.multistage = multistage;
         rhoCtrl.assumePrime = assumePrime;
+        rhoCtrl.distinguishedPoints = distinguishedPoints;
+        rhoCtrl.distinguishedBits = distinguishedBits;
         rhoCtrl.factorCtrl.numReps = numReps;
         rhoCtrl.factorCtrl.progress = progress;
         rhoCtrl.factorCtrl.time = time;
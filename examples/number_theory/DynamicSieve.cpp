@@ -51,6 +51,17 @@ int main( int argc, char* argv[] )
             }
         }
 
+        // Count the number of primes below the given bound with the
+        // (multithreaded, if OpenMP is available) wheel sieve
+        {
+            timer.Start();
+            const TSieve numPrimes =
+              El::CountPrimesInRange( TSieve(0), TSieve(B1+1) );
+            El::Output
+            ("Counted primes below ",B1," in ",timer.Stop()," seconds");
+            El::Output("numPrimes=",numPrimes);
+        }
+
         // Count the number of primes below the given bound by sequentially
         // generating each
         {
@@ -28,6 +28,17 @@ void FactorPM1
         El::Output("  ",factor);
     El::Output("");
 }
+
+template<typename TSieve>
+void FactorECM
+( const El::BigInt& n, const El::factor::ECMCtrl<TSieve>& ctrl )
+{
+    auto factors = El::factor::ECM( n, ctrl );
+    El::Output("factors:");
+    for( auto factor : factors )
+        El::Output("  ",factor);
+    El::Output("");
+}
 #endif
 
 int main( int argc, char* argv[] )
@@ -46,6 +57,8 @@ int main( int argc, char* argv[] )
           El::Input("--x0","x0 in Pollard rho",El::BigInt(2));
         const El::Int gcdDelayRho =
           El::Input("--gcdDelayRho","GCD delay in Pollard's rho",100);
+        const bool brent =
+          El::Input("--brent","Brent's cycle detection in Pollard's rho",false);
         const TSieve smooth1 =
           El::Input
           ("--smooth1","Stage one smoothness bound for (p-1)",1000000ULL);
@@ -59,6 +72,14 @@ int main( int argc, char* argv[] )
         const El::Int checkpointFreqPm1 =
           El::Input
           ("--checkpointFreqPm1","checkpoint frequency in p-1",1000000);
+        const TSieve smooth1ECM =
+          El::Input
+          ("--smooth1ECM","Stage one smoothness bound for ECM",50000ULL);
+        const TSieve smooth2ECM =
+          El::Input
+          ("--smooth2ECM","Stage two smoothness bound for ECM",5000000ULL);
+        const El::Int maxCurves =
+          El::Input("--maxCurves","maximum number of ECM curves",1000);
         const int numReps = El::Input("--numReps","num Miller-Rabin reps,",30);
         const bool progress = El::Input("--progress","factor progress?",true);
         const bool time = El::Input("--time","time Pollard rho steps?",true);
@@ -75,6 +96,7 @@ int main( int argc, char* argv[] )
         rhoCtrl.numSteps = numSteps;
         rhoCtrl.x0 = x0;
         rhoCtrl.gcdDelay = gcdDelayRho;
+        rhoCtrl.brent = brent;
         rhoCtrl.numReps = numReps;
         rhoCtrl.progress = progress;
         rhoCtrl.time = time;
@@ -89,12 +111,21 @@ int main( int argc, char* argv[] )
         pm1Ctrl.checkpoint = checkpointPm1;
         pm1Ctrl.checkpointFreq = checkpointFreqPm1;
 
+        El::factor::ECMCtrl<TSieve> ecmCtrl;
+        ecmCtrl.smooth1 = smooth1ECM;
+        ecmCtrl.smooth2 = smooth2ECM;
+        ecmCtrl.maxCurves = maxCurves;
+        ecmCtrl.numReps = numReps;
+        ecmCtrl.progress = progress;
+        ecmCtrl.time = time;
+
         // n = 2^77 - 3
         // We should find (1291,99432527,1177212722617)
         El::BigInt n = El::Pow(El::BigInt(2),unsigned(77)) - 3;
         El::Output("n=2^77-3=",n);
         FactorRho( n, rhoCtrl );
         FactorPM1( n, pm1Ctrl );
+        FactorECM( n, ecmCtrl );
 
         // n = 2^79 - 3
         // We should find (5,3414023,146481287,241741417)
@@ -102,18 +133,21 @@ int main( int argc, char* argv[] )
         El::Output("n=2^79-3=",n);
         FactorRho( n, rhoCtrl );
         FactorPM1( n, pm1Ctrl );
+        FactorECM( n, ecmCtrl );
 
         // n = 2^97 - 3
         n = El::Pow(El::BigInt(2),unsigned(97)) - 3;
         El::Output("n=2^97-3=",n);
         FactorRho( n, rhoCtrl );
         FactorPM1( n, pm1Ctrl );
+        FactorECM( n, ecmCtrl );
 
         // n = 3^100 + 2
         n = El::Pow(El::BigInt(3),unsigned(100)) + 2;
         El::Output("n=3^100+2=",n);
         FactorRho( n, rhoCtrl );
         FactorPM1( n, pm1Ctrl );
+        FactorECM( n, ecmCtrl );
 
         if( largeRho )
         {
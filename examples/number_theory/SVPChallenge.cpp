@@ -47,6 +47,12 @@ int main( int argc, char* argv[] )
           El::Input("--variableBsize","variable blocksize?",false);
         const bool variableEnumType =
           El::Input("--variableEnumType","variable enum type?",false);
+        const El::Int sieveMinBlocksize =
+          El::Input
+          ("--sieveMinBlocksize","sieve blocks at least this large (0=never)",
+           0);
+        const El::Int sieveMaxListSize =
+          El::Input("--sieveMaxListSize","max list size for sieving",1000000);
         const El::Int multiEnumWindow =
           El::Input("--multiEnumWindow","window for y-sparse enumeration",15);
         const El::Int phaseLength =
@@ -103,6 +109,15 @@ int main( int argc, char* argv[] )
         const bool probEnum =
           El::Input("--probEnum","probabalistic enumeration *after* BKZ?",true);
         const bool fullEnum = El::Input("--fullEnum","SVP via full enum?",false);
+        const bool prunedBKZ =
+          El::Input("--prunedBKZ","BKZ 2.0-style pruned enumeration?",false);
+        const std::string pruningCacheDir =
+          El::Input
+          ("--pruningCacheDir","directory for caching pruning profiles",
+           std::string(""));
+        const El::Int preprocessBlocksize =
+          El::Input
+          ("--preprocessBlocksize","BKZ blocksize for re-randomized bases",10);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec =
           El::Input("--prec","MPFR precision",mpfr_prec_t(1024));
@@ -162,20 +177,28 @@ int main( int argc, char* argv[] )
                   return 45;
               */
           };
+        const El::EnumType bkzEnumType =
+          ( prunedBKZ ? El::GNR_ENUM : El::FULL_ENUM );
         auto enumTypeLambda =
           [&]( El::Int j )
           {
-              if( j <= 3 )
+              const El::Int bsize =
+                ( variableBsize ? blocksizeLambda(j) : blocksize );
+              if( sieveMinBlocksize > 0 && bsize >= sieveMinBlocksize )
+                  return El::SIEVE_ENUM;
+              else if( !variableEnumType )
+                  return bkzEnumType;
+              else if( j <= 3 )
                   return El::YSPARSE_ENUM;
               else
-                  return El::FULL_ENUM;
+                  return bkzEnumType;
               //return El::FULL_ENUM;
           };
         El::BKZCtrl<Real> ctrl;
         ctrl.blocksize = blocksize;
         ctrl.variableBlocksize = variableBsize;
         ctrl.blocksizeFunc = El::MakeFunction(blocksizeLambda);
-        ctrl.variableEnumType = variableEnumType;
+        ctrl.variableEnumType = variableEnumType || sieveMinBlocksize > 0;
         ctrl.enumTypeFunc = El::MakeFunction(enumTypeLambda);
         ctrl.multiEnumWindow = multiEnumWindow;
         ctrl.time = timeBKZ;
@@ -183,12 +206,15 @@ int main( int argc, char* argv[] )
         ctrl.recursive = recursiveBKZ;
         ctrl.jumpstart = jumpstartBKZ;
         ctrl.startCol = startColBKZ;
-        ctrl.enumCtrl.enumType = El::FULL_ENUM;
+        ctrl.enumCtrl.enumType = bkzEnumType;
         ctrl.enumCtrl.time = timeEnum;
         ctrl.enumCtrl.innerProgress = innerEnumProgress;
         ctrl.enumCtrl.phaseLength = phaseLength;
         ctrl.enumCtrl.enqueueProb = enqueueProb;
         ctrl.enumCtrl.progressLevel = progressLevel;
+        ctrl.enumCtrl.sieveMaxListSize = sieveMaxListSize;
+        ctrl.enumCtrl.pruningCacheDir = pruningCacheDir;
+        ctrl.enumCtrl.preprocessBlocksize = preprocessBlocksize;
         ctrl.earlyAbort = earlyAbort;
         ctrl.numEnumsBeforeAbort = numEnumsBeforeAbort;
         ctrl.subBKZ = subBKZ;
@@ -308,6 +334,8 @@ int main( int argc, char* argv[] )
             El::Matrix<Real> v;
             El::EnumCtrl<Real> enumCtrl;
             enumCtrl.enumType = probEnum ? El::GNR_ENUM : El::FULL_ENUM;
+            enumCtrl.pruningCacheDir = pruningCacheDir;
+            enumCtrl.preprocessBlocksize = preprocessBlocksize;
             timer.Start();
             Real result;
             if( fullEnum )
@@ -48,6 +48,12 @@ main( int argc, char* argv[] )
         const Real relTol =
           El::Input("--relTol","relative tolerance",Real(1e-4));
         const bool inv = El::Input("--inv","use explicit inverse",true);
+        const bool adaptiveRho =
+          El::Input("--adaptiveRho","balance the residuals via rho?",false);
+        const El::Int andersonDepth =
+          El::Input("--andersonDepth","Anderson acceleration depth",0);
+        const bool consensus =
+          El::Input("--consensus","use row-block consensus?",false);
         const bool progress = El::Input("--progress","print progress?",true);
         const bool display = El::Input("--display","display matrices?",false);
         const bool useIPM = El::Input("--useIPM","use Interior Point?",true);
@@ -87,6 +93,9 @@ main( int argc, char* argv[] )
         ctrl.admmCtrl.relTol = relTol;
         ctrl.admmCtrl.inv = inv;
         ctrl.admmCtrl.progress = progress;
+        ctrl.admmCtrl.adaptiveRho = adaptiveRho;
+        ctrl.admmCtrl.andersonDepth = andersonDepth;
+        ctrl.admmCtrl.consensus = consensus;
 
         El::DistMatrix<Real> z;
         El::Timer timer;
@@ -37,6 +37,10 @@ int main( int argc, char* argv[] )
         const Real absTol = El::Input("--absTol","absolute tolerance",1e-6);
         const Real relTol = El::Input("--relTol","relative tolerance",1e-4);
         const bool inv = El::Input("--inv","form inv(LU) to avoid trsv?",true);
+        const bool adaptiveRho =
+          El::Input("--adaptiveRho","balance the residuals via rho?",false);
+        const El::Int andersonDepth =
+          El::Input("--andersonDepth","Anderson acceleration depth",0);
         const bool progress = El::Input("--progress","print progress?",true);
         const bool display = El::Input("--display","display matrices?",false);
         const bool print = El::Input("--print","print matrices",false);
@@ -51,6 +55,8 @@ int main( int argc, char* argv[] )
         ctrl.relTol = relTol;
         ctrl.inv = inv;
         ctrl.print = progress;
+        ctrl.adaptiveRho = adaptiveRho;
+        ctrl.andersonDepth = andersonDepth;
 
         El::DistMatrix<Real> Q, c, xTrue;
         El::HermitianUniformSpectrum( Q, n, lbEig, ubEig );
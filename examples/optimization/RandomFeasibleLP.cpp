@@ -9,7 +9,8 @@
 #include <El.hpp>
 
 template<typename Real>
-void RandomFeasibleLP( El::Int m, El::Int n, El::Int k )
+void RandomFeasibleLP
+( El::Int m, El::Int n, El::Int k, El::Int maxCentralityCorrectors )
 {
     El::Output("Testing with ",El::TypeName<Real>());
     // Create random (primal feasible) inputs for the primal/dual problem
@@ -30,11 +31,14 @@ void RandomFeasibleLP( El::Int m, El::Int n, El::Int k )
     h += sFeas;
     El::Uniform( c, n, 1 );
 
-    // Solve the primal/dual Linear Program with the default options
+    // Solve the primal/dual Linear Program with the default options (other
+    // than the number of Gondzio's centrality correctors)
+    El::lp::affine::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.maxCentralityCorrectors = maxCentralityCorrectors;
     El::Matrix<Real> x, y, z, s;
     El::Timer timer;
     timer.Start();
-    El::LP( A, G, b, c, h, x, y, z, s );
+    El::LP( A, G, b, c, h, x, y, z, s, ctrl );
     El::Output("Primal-dual LP took ",timer.Stop()," seconds");
 
     // Print the primal and dual objective values
@@ -78,19 +82,22 @@ int main( int argc, char* argv[] )
         const El::Int m = El::Input("--m","height of A",70);
         const El::Int n = El::Input("--n","width of A",80);
         const El::Int k = El::Input("--k","height of G",90);
+        const El::Int maxCentralityCorrectors =
+          El::Input
+          ("--maxCentralityCorrectors","max centrality correctors",0);
         El::ProcessInput();
 
-        RandomFeasibleLP<float>( m, n, k );
-        RandomFeasibleLP<double>( m, n, k );
+        RandomFeasibleLP<float>( m, n, k, maxCentralityCorrectors );
+        RandomFeasibleLP<double>( m, n, k, maxCentralityCorrectors );
 #ifdef EL_HAVE_QD
-        RandomFeasibleLP<El::DoubleDouble>( m, n, k );
-        RandomFeasibleLP<El::QuadDouble>( m, n, k );
+        RandomFeasibleLP<El::DoubleDouble>( m, n, k, maxCentralityCorrectors );
+        RandomFeasibleLP<El::QuadDouble>( m, n, k, maxCentralityCorrectors );
 #endif
 #ifdef EL_HAVE_QUAD
-        RandomFeasibleLP<El::Quad>( m, n, k );
+        RandomFeasibleLP<El::Quad>( m, n, k, maxCentralityCorrectors );
 #endif
 #ifdef EL_HAVE_MPC
-        RandomFeasibleLP<El::BigFloat>( m, n, k );
+        RandomFeasibleLP<El::BigFloat>( m, n, k, maxCentralityCorrectors );
 #endif
     }
     catch( std::exception& e ) { El::ReportException(e); }
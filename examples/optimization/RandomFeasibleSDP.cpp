@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+template<typename Real>
+void RandomFeasibleSDP( El::Int m, El::Int numBlocks, El::Int blockOrder )
+{
+    El::Output("Testing with ",El::TypeName<Real>());
+    // Create random (primal and dual feasible) inputs for the primal/dual
+    // problem
+    //    arginf_x { c^T x | A x = b, x in K }
+    //    argsup_{y,z} { -b^T y | A^T y - z + c = 0, z in K },
+    // where K is a product of numBlocks positive semidefinite cones of order
+    // blockOrder.
+    El::Matrix<El::Int> orders;
+    El::Zeros( orders, numBlocks, 1 );
+    for( El::Int block=0; block<numBlocks; ++block )
+        orders(block) = blockOrder;
+    const El::Int n = El::psd::Height( orders );
+
+    // xFeas, yFeas, and zFeas are only used for problem generation
+    El::Matrix<Real> xFeas, yFeas, zFeas;
+    El::psd::Identity( xFeas, orders );
+    El::psd::Identity( zFeas, orders );
+    El::Uniform( yFeas, m, 1 );
+
+    El::Matrix<Real> A, b, c;
+    El::Uniform( A, m, n );
+    El::Gemv( El::NORMAL, Real(1), A, xFeas, b );
+    c = zFeas;
+    El::Gemv( El::TRANSPOSE, Real(-1), A, yFeas, Real(1), c );
+
+    // Solve the primal/dual Semidefinite Program with the default options
+    El::Matrix<Real> x, y, z;
+    El::Timer timer;
+    timer.Start();
+    El::SDP( A, b, c, orders, x, y, z );
+    El::Output("Primal-dual SDP took ",timer.Stop()," seconds");
+
+    // Print the primal and dual objective values
+    const Real primal = El::Dot(c,x);
+    const Real dual = -El::Dot(b,y);
+    const Real relGap = El::Abs(primal-dual) / El::Max(El::Abs(dual),Real(1));
+    El::Output("c^T x = ",primal);
+    El::Output("-b^T y = ",dual);
+    El::Output("|gap| / max( |dual|, 1 ) = ",relGap);
+
+    // Print the relative primal feasibility residual,
+    //   || A x - b ||_2 / max( || b ||_2, 1 ).
+    El::Matrix<Real> rPrimal;
+    El::Gemv( El::NORMAL, Real(1), A, x, rPrimal );
+    rPrimal -= b;
+    const Real bFrob = El::FrobeniusNorm( b );
+    const Real rPrimalFrob = El::FrobeniusNorm( rPrimal );
+    const Real primalRelResid = rPrimalFrob / El::Max( bFrob, Real(1) );
+    El::Output("|| A x - b ||_2 / || b ||_2 = ",primalRelResid);
+    El::Output("");
+}
+
+int main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+
+    try
+    {
+        const El::Int m = El::Input("--m","number of constraints",20);
+        const El::Int numBlocks = El::Input("--numBlocks","number of blocks",4);
+        const El::Int blockOrder = El::Input("--blockOrder","block order",5);
+        El::ProcessInput();
+
+        RandomFeasibleSDP<float>( m, numBlocks, blockOrder );
+        RandomFeasibleSDP<double>( m, numBlocks, blockOrder );
+#ifdef EL_HAVE_QD
+        RandomFeasibleSDP<El::DoubleDouble>( m, numBlocks, blockOrder );
+        RandomFeasibleSDP<El::QuadDouble>( m, numBlocks, blockOrder );
+#endif
+#ifdef EL_HAVE_QUAD
+        RandomFeasibleSDP<El::Quad>( m, numBlocks, blockOrder );
+#endif
+#ifdef EL_HAVE_MPC
+        RandomFeasibleSDP<El::BigFloat>( m, numBlocks, blockOrder );
+#endif
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
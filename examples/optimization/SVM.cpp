@@ -21,6 +21,9 @@ main( int argc, char* argv[] )
         const El::Int m = El::Input("--numExamples","number of examples",200);
         const El::Int n = El::Input("--numFeatures","number of features",100);
         const double gamma = El::Input("--gamma","hinge-loss penalty",1.0);
+        const El::Int approachInt =
+          El::Input("--approach","0: IPM, 1: dual coord. descent, 2: APG",0);
+        const bool progress = El::Input("--progress","print progress?",false);
         const bool display = El::Input("--display","display matrices?",false);
         const bool print = El::Input("--print","print matrices",false);
         El::ProcessInput();
@@ -68,6 +71,9 @@ main( int argc, char* argv[] )
             El::Display( G, "G" );
 
         El::SVMCtrl<Real> ctrl;
+        ctrl.approach = static_cast<El::SVMApproach>(approachInt);
+        ctrl.dcdCtrl.progress = progress;
+        ctrl.apgCtrl.print = progress;
         // TODO(poulson): Add support for configuring the IPM
 
         El::Timer timer;
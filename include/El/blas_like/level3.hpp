@@ -651,4 +651,6 @@ void NormalFromEVD
 
 } // namespace El
 
+#include <El/blas_like/level3/batched.hpp>
+
 #endif // ifndef EL_BLAS3_HPP
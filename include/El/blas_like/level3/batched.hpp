@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS3_BATCHED_HPP
+#define EL_BLAS3_BATCHED_HPP
+
+namespace El {
+
+// Batches of small matrices
+// =========================
+// Many applications require the same operation to be performed on a large
+// number of independent small matrices (e.g., 8 x 8 through 128 x 128), in
+// which case the per-call overhead of the Matrix interface dominates. The
+// routines below instead operate on an entire batch at once, using kernels
+// which are specialized at compile-time for several small dimensions and
+// which (in hybrid builds) are parallelized with OpenMP over the batch.
+//
+// Two storage schemes are supported:
+//
+//  BATCH_STRIDED:     entry (i,j) of matrix b is stored at
+//                     buffer[i + j*ldim + b*batchStride],
+//                     i.e., each matrix is stored contiguously in
+//                     column-major order;
+//
+//  BATCH_INTERLEAVED: entry (i,j) of matrix b is stored at
+//                     buffer[b + (i + j*ldim)*batchStride],
+//                     i.e., the same entry of consecutive matrices is stored
+//                     contiguously so that the innermost loops of the kernels
+//                     run across the batch (and can be vectorized).
+//
+// Batches of independently-allocated matrices (i.e., pointer arrays) are
+// supported through overloads accepting a vector of (possibly viewing)
+// Matrix instances.
+
+namespace BatchLayoutNS {
+enum BatchLayout
+{
+  BATCH_STRIDED,
+  BATCH_INTERLEAVED
+};
+}
+using namespace BatchLayoutNS;
+
+template<typename T>
+class BatchMatrix
+{
+public:
+    BatchMatrix( BatchLayout layout=BATCH_STRIDED );
+    BatchMatrix
+    ( Int height, Int width, Int batchSize,
+      BatchLayout layout=BATCH_STRIDED );
+
+    BatchMatrix( const BatchMatrix<T>& A );
+    BatchMatrix( BatchMatrix<T>&& A ) = default;
+    const BatchMatrix<T>& operator=( const BatchMatrix<T>& A );
+    BatchMatrix<T>& operator=( BatchMatrix<T>&& A ) = default;
+
+    void Empty();
+    // Resizing reallocates the batch with the canonical strides for the
+    // current layout (i.e., ldim=height and a batch stride of either
+    // height*width or batchSize)
+    void Resize( Int height, Int width, Int batchSize );
+    void SetLayout( BatchLayout layout );
+
+    void Attach
+    ( BatchLayout layout, Int height, Int width, Int batchSize,
+      T* buffer, Int ldim, Int batchStride );
+    void LockedAttach
+    ( BatchLayout layout, Int height, Int width, Int batchSize,
+      const T* buffer, Int ldim, Int batchStride );
+
+    BatchLayout Layout() const;
+    Int Height() const;
+    Int Width() const;
+    Int BatchSize() const;
+    Int LDim() const;
+    Int BatchStride() const;
+    bool Viewing() const;
+    bool Locked() const;
+
+          T* Buffer();
+    const T* LockedBuffer() const;
+
+          T& operator()( Int i, Int j, Int b );
+    const T& operator()( Int i, Int j, Int b ) const;
+
+    // Copy a single member of the batch into, or out of, a Matrix
+    void GetBatch( Int b, Matrix<T>& A ) const;
+    void SetBatch( Int b, const Matrix<T>& A );
+
+private:
+    BatchLayout layout_;
+    Int height_=0, width_=0, batchSize_=0;
+    Int ldim_=1, batchStride_=0;
+    bool viewing_=false, locked_=false;
+
+    vector<T> memory_;
+    T* buffer_=nullptr;
+};
+
+// Gemm
+// ====
+// C[b] := alpha op(A[b]) op(B[b]) + beta C[b] for each member b of the batch.
+// The three batches must share a layout.
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const BatchMatrix<T>& A, const BatchMatrix<T>& B,
+  T beta,        BatchMatrix<T>& C );
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C );
+
+// Trsm
+// ====
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const BatchMatrix<F>& A, BatchMatrix<F>& B );
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const vector<Matrix<F>>& A, vector<Matrix<F>>& B );
+
+} // namespace El
+
+#endif // ifndef EL_BLAS3_BATCHED_HPP
@@ -9,6 +9,7 @@
 #ifndef EL_FACTOR_HPP
 #define EL_FACTOR_HPP
 
+#include <El/blas_like/level3/batched.hpp>
 #include <El/lapack_like/perm.hpp>
 #include <El/lapack_like/util.hpp>
 #include <El/lapack_like/factor/ldl/sparse/symbolic.hpp>
@@ -950,5 +951,7 @@ void Skeleton
 } // namespace El
 
 #include <El/lapack_like/factor/qr/ProxyHouseholder.hpp>
+#include <El/lapack_like/factor/tiled.hpp>
+#include <El/lapack_like/factor/batched.hpp>
 
 #endif // ifndef EL_FACTOR_HPP
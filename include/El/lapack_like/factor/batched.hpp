@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_BATCHED_HPP
+#define EL_FACTOR_BATCHED_HPP
+
+namespace El {
+
+// Batched factorizations of small matrices
+// ========================================
+// See El/blas_like/level3/batched.hpp for a description of the BatchMatrix
+// storage schemes. The factorizations overwrite each member of the batch in
+// the same manner as their Matrix counterparts. If any member of the batch
+// could not be factored, the appropriate exception (e.g.,
+// SingularMatrixException) is thrown after the entire batch has been
+// processed, with the index of the first such member in its message.
+
+// Cholesky
+// --------
+template<typename Field>
+void Cholesky( UpperOrLower uplo, BatchMatrix<Field>& A );
+template<typename Field>
+void Cholesky( UpperOrLower uplo, vector<Matrix<Field>>& A );
+
+namespace cholesky {
+
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const BatchMatrix<Field>& A,
+        BatchMatrix<Field>& B );
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B );
+
+} // namespace cholesky
+
+// LU with partial pivoting
+// ------------------------
+// Column b of 'swapDests' holds the sequence of row swaps (in the sense of
+// Permutation::SwapDestinations) for the b'th member of the batch; that is,
+// row k was swapped with row swapDests(k,b) during the k'th step.
+template<typename Field>
+void LU( BatchMatrix<Field>& A, Matrix<Int>& swapDests );
+template<typename Field>
+void LU( vector<Matrix<Field>>& A, Matrix<Int>& swapDests );
+
+namespace lu {
+
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const BatchMatrix<Field>& A,
+  const Matrix<Int>& swapDests,
+        BatchMatrix<Field>& B );
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const vector<Matrix<Field>>& A,
+  const Matrix<Int>& swapDests,
+        vector<Matrix<Field>>& B );
+
+} // namespace lu
+
+// Householder QR
+// --------------
+// Column b of 'householderScalars' and 'signature' corresponds to the
+// b'th member of the batch and follows the conventions of QR( A, t, d ).
+template<typename Field>
+void QR
+( BatchMatrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature );
+template<typename Field>
+void QR
+( vector<Matrix<Field>>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature );
+
+namespace qr {
+
+// Solve the least-squares problems min || A[b] X[b] - B[b] ||_F, where each
+// A[b] has at least as many rows as columns
+template<typename Field>
+void SolveAfter
+( const BatchMatrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+  const BatchMatrix<Field>& B,
+        BatchMatrix<Field>& X );
+template<typename Field>
+void SolveAfter
+( const vector<Matrix<Field>>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+  const vector<Matrix<Field>>& B,
+        vector<Matrix<Field>>& X );
+
+} // namespace qr
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_BATCHED_HPP
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_TILED_HPP
+#define EL_FACTOR_TILED_HPP
+
+namespace El {
+
+// Tiled shared-memory factorizations
+// ==================================
+// The following routines convert a sequential matrix into a tile-major layout
+// (each tileSize x tileSize tile is stored contiguously) and express the
+// factorization as a directed acyclic graph of per-tile kernels. In hybrid
+// builds the graph is dynamically scheduled over the OpenMP threads; since
+// each kernel is itself a sequential BLAS/LAPACK-like call, the BLAS library
+// should then be run with a single thread (e.g., OPENBLAS_NUM_THREADS=1).
+// Without EL_HYBRID, the kernels are executed in their sequential order.
+
+struct TiledCtrl
+{
+    // The tile size used when converting a column-major Matrix
+    Int tileSize=192;
+
+    // Whether the task graph should be dynamically scheduled over the OpenMP
+    // threads (only meaningful if EL_HYBRID is defined)
+    bool parallel=true;
+
+    bool time=false;
+};
+
+// A matrix stored as a (row-major) grid of contiguous column-major tiles
+// ----------------------------------------------------------------------
+template<typename Field>
+class TileMatrix
+{
+public:
+    TileMatrix( Int tileSize=192 );
+    TileMatrix( const Matrix<Field>& A, Int tileSize=192 );
+
+    TileMatrix( const TileMatrix<Field>& A ) = delete;
+    TileMatrix( TileMatrix<Field>&& A ) = default;
+    const TileMatrix<Field>& operator=( const TileMatrix<Field>& A ) = delete;
+    TileMatrix<Field>& operator=( TileMatrix<Field>&& A ) = default;
+
+    void Empty();
+    void SetTileSize( Int tileSize );
+    void Resize( Int height, Int width );
+
+    // Convert to and from the usual column-major storage
+    void CopyFrom( const Matrix<Field>& A );
+    void CopyTo( Matrix<Field>& A ) const;
+
+    Int Height() const;
+    Int Width() const;
+    Int TileSize() const;
+    Int NumTileRows() const;
+    Int NumTileCols() const;
+    Int TileHeight( Int i ) const;
+    Int TileWidth( Int j ) const;
+
+          Matrix<Field>& Tile( Int i, Int j );
+    const Matrix<Field>& Tile( Int i, Int j ) const;
+
+private:
+    Int height_=0, width_=0;
+    Int tileSize_;
+    Int numTileRows_=0, numTileCols_=0;
+
+    vector<Field> buffer_;
+    vector<Matrix<Field>> tiles_;
+};
+
+namespace cholesky {
+
+// Overwrite the 'uplo' triangle of A with its Cholesky factor
+template<typename Field>
+void Tiled
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  const TiledCtrl& ctrl=TiledCtrl() );
+template<typename Field>
+void Tiled
+( UpperOrLower uplo,
+  TileMatrix<Field>& A,
+  const TiledCtrl& ctrl=TiledCtrl() );
+
+} // namespace cholesky
+
+namespace lu {
+
+// The result is equivalent to that of LU( A, P ) and can therefore be used
+// with lu::SolveAfter
+template<typename Field>
+void Tiled
+( Matrix<Field>& A,
+  Permutation& P,
+  const TiledCtrl& ctrl=TiledCtrl() );
+template<typename Field>
+void Tiled
+( TileMatrix<Field>& A,
+  Permutation& P,
+  const TiledCtrl& ctrl=TiledCtrl() );
+
+} // namespace lu
+
+namespace qr {
+
+// The Householder scalars and signatures from the factorization of the
+// diagonal tile (i=k) or of the stacked triangle/tile pair (i > k) are stored
+// in entry i + k*numTileRows. The Householder vectors themselves overwrite the
+// strictly lower portion of the diagonal tiles and the sub-diagonal tiles.
+template<typename Field>
+struct TiledData
+{
+    Int tileSize=0;
+    Int numTileRows=0, numTileCols=0;
+    vector<Matrix<Field>> householderScalars;
+    vector<Matrix<Base<Field>>> signature;
+};
+
+// Overwrite the upper triangle of A with R and the remainder with the
+// Householder vectors of a flat-tree tiled QR factorization
+template<typename Field>
+void Tiled
+( Matrix<Field>& A,
+  TiledData<Field>& data,
+  const TiledCtrl& ctrl=TiledCtrl() );
+template<typename Field>
+void Tiled
+( TileMatrix<Field>& A,
+  TiledData<Field>& data,
+  const TiledCtrl& ctrl=TiledCtrl() );
+
+namespace tiled {
+
+// Apply Q or Q^H from the left using the implicit tiled representation
+template<typename Field>
+void ApplyQ
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const TiledData<Field>& data,
+        Matrix<Field>& B );
+
+// Solve the least squares problem min || A X - B ||_F (with A of full column
+// rank and at least as many rows as columns)
+template<typename Field>
+void SolveAfter
+( const Matrix<Field>& A,
+  const TiledData<Field>& data,
+  const Matrix<Field>& B,
+        Matrix<Field>& X );
+
+} // namespace tiled
+
+} // namespace qr
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_TILED_HPP
@@ -227,6 +227,75 @@ void Overwrite
 
 } // namespace hpd_solve
 
+// Mixed-precision solves
+// ======================
+// Factor A in a lower precision (see Demote; e.g., float for double systems
+// and double for DoubleDouble and QuadDouble systems) and recover the
+// working-precision solution using either classical iterative refinement or
+// GMRES-based iterative refinement (GMRES-IR), where each correction equation
+// is solved with FGMRES preconditioned by the low-precision factorization.
+// The latter converges for significantly more ill-conditioned systems.
+//
+// Each routine overwrites B with the solution and returns the number of
+// refinement iterations that were performed.
+enum MixedPrecisionAlg
+{
+  MIXED_PRECISION_REFINE,
+  MIXED_PRECISION_GMRES_REFINE
+};
+
+template<typename Real>
+struct MixedPrecisionCtrl
+{
+    MixedPrecisionAlg alg=MIXED_PRECISION_REFINE;
+
+    // The target for || B - A X ||_max / || B ||_max
+    Real relTol;
+    Int maxRefineIts=20;
+
+    // Only used by GMRES-IR
+    Real relTolGMRES;
+    Int restart=10;
+    Int maxGMRESIts=100;
+
+    bool progress=false;
+
+    MixedPrecisionCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        relTol = Pow(eps,Real(0.9));
+        relTolGMRES = Pow(eps,Real(0.25));
+    }
+};
+
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl=
+        MixedPrecisionCtrl<Base<Field>>() );
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl=
+        MixedPrecisionCtrl<Base<Field>>() );
+
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl=
+        MixedPrecisionCtrl<Base<Field>>() );
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl=
+        MixedPrecisionCtrl<Base<Field>>() );
+
 // Multi-shift Hessenberg
 // ======================
 template<typename Field>
@@ -250,6 +319,7 @@ void MultiShiftHessSolve
 
 #include <El/lapack_like/solve/FGMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
+#include <El/lapack_like/solve/PCG.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
 
 #endif // ifndef EL_SOLVE_HPP
@@ -32,6 +32,10 @@ namespace fgmres {
 //
 // and overwrite b with an approximation of inv(A) b.
 //
+// If the relative tolerance is not met within 'maxIts' iterations, the
+// right-hand side is overwritten with the last iterate before a RuntimeError
+// is thrown, so that callers may fall back to it.
+//
 
 // TODO(poulson): Add support for an initial guess
 template<typename Field,class ApplyAType,class PrecondType>
@@ -278,7 +282,10 @@ Int Single
             }
             ++iter;
             if( iter == maxIts )
+            {
+                b = x;
                 RuntimeError("FGMRES did not converge");
+            }
             SetIndent( innerIndent );
         }
         SetIndent( indent );
@@ -574,7 +581,10 @@ Int Single
             }
             ++iter;
             if( iter == maxIts )
+            {
+                b = x;
                 RuntimeError("FGMRES did not converge");
+            }
             SetIndent( innerIndent );
         }
         SetIndent( indent );
@@ -609,9 +619,18 @@ Int FGMRES
     {
         auto bLoc = BLoc( ALL, IR(j) );
         uLoc = bLoc;
-        const Int its =
-          fgmres::Single
-          ( applyA, precond, u, relTol, restart, maxIts, progress );
+        Int its;
+        try
+        {
+            its =
+              fgmres::Single
+              ( applyA, precond, u, relTol, restart, maxIts, progress );
+        }
+        catch( ... )
+        {
+            bLoc = uLoc;
+            throw;
+        }
         bLoc = uLoc;
         mostIts = Max(mostIts,its);
     }
@@ -0,0 +1,238 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_PCG_HPP
+#define EL_SOLVE_PCG_HPP
+
+// The Preconditioned Conjugate Gradient method, e.g., Algorithm 9.1 of
+//   Yousef Saad
+//   "Iterative Methods for Sparse Linear Systems", 2nd edition, SIAM, 2003.
+
+namespace El {
+
+namespace pcg {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const VectorType& x, Field beta, VectorType& y )
+//
+// and overwrite y := alpha A x + beta y. However, 'precond' should have the
+// form
+//
+//   void precond( VectorType& b )
+//
+// and overwrite b with an approximation of inv(A) b. Both A and the
+// preconditioner must be Hermitian positive-definite. VectorType is either
+// Matrix<Field> or DistMultiVec<Field>.
+//
+
+// Overwrite x, which should contain an initial guess, with an approximate
+// solution of A x = b whose residual norm is at most 'relTol' times that of b
+template<typename Field,class VectorType,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const VectorType& b,
+        VectorType& x,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 || x.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+      if( b.Height() != x.Height() )
+          LogicError("Initial guess was of the wrong height");
+    )
+    typedef Base<Field> Real;
+    const Real bNorm = Nrm2( b );
+    if( bNorm == Real(0) )
+    {
+        Zero( x );
+        return 0;
+    }
+
+    // r := b - A x_0
+    // ==============
+    auto r = b;
+    applyA( Field(-1), x, Field(1), r );
+    const Real origResidNorm = Nrm2( r );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm/bNorm < relTol )
+        return 0;
+
+    // p := z := inv(M) r
+    // ==================
+    auto z = r;
+    precond( z );
+    auto p = z;
+    Real rho = RealPart(Dot(r,z));
+
+    auto q = b;
+    Int iter=0;
+    while( true )
+    {
+        // q := A p
+        // ========
+        applyA( Field(1), p, Field(0), q );
+        const Real pq = RealPart(Dot(p,q));
+        if( !limits::IsFinite(pq) || pq <= Real(0) )
+            RuntimeError("PCG encountered a non-positive curvature of ",pq);
+        const Real alpha = rho / pq;
+
+        // x := x + alpha p, r := r - alpha q
+        // ==================================
+        Axpy( Field(alpha), p, x );
+        Axpy( Field(-alpha), q, r );
+        ++iter;
+
+        // Residual checks
+        // ---------------
+        const Real residNorm = Nrm2( r );
+        if( !limits::IsFinite(residNorm) )
+            RuntimeError("Residual norm was not finite");
+        const Real relResidNorm = residNorm/bNorm;
+        if( relResidNorm < relTol )
+        {
+            if( progress )
+                Output("converged with relative tolerance: ",relResidNorm);
+            break;
+        }
+        if( progress )
+            Output
+            ("finished iteration ",iter," with relResidNorm=",relResidNorm);
+        if( iter == maxIts )
+            RuntimeError("PCG did not converge");
+
+        // p := inv(M) r + (rhoNew/rho) p
+        // ==============================
+        z = r;
+        precond( z );
+        const Real rhoNew = RealPart(Dot(r,z));
+        p *= Field(rhoNew/rho);
+        p += z;
+        rho = rhoNew;
+    }
+    return iter;
+}
+
+} // namespace pcg
+
+// Overwrite X, which should contain an initial guess, with the solution of
+// A X = B. The largest number of iterations over the columns is returned.
+template<typename Field,class ApplyAType,class PrecondType>
+Int PCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    if( X.Height() != B.Height() || X.Width() != B.Width() )
+        LogicError("Initial guess was of the wrong size");
+    Int mostIts = 0;
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        auto x = X( ALL, IR(j) );
+        const Int its =
+          pcg::Single<Field>
+          ( applyA, precond, b, x, relTol, maxIts, progress );
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    if( X.Height() != B.Height() || X.Width() != B.Width() )
+        LogicError("Initial guess was of the wrong size");
+    if( !mpi::Congruent( B.Grid().Comm(), X.Grid().Comm() ) )
+        LogicError("Communicators of B and X must match");
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMultiVec<Field> b(B.Grid()), x(B.Grid());
+    Zeros( b, height, 1 );
+    Zeros( x, height, 1 );
+    const auto& BLoc = B.LockedMatrix();
+    auto& XLoc = X.Matrix();
+    auto& bLoc = b.Matrix();
+    auto& xLoc = x.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        bLoc = BLoc( ALL, IR(j) );
+        xLoc = XLoc( ALL, IR(j) );
+        const Int its =
+          pcg::Single<Field>
+          ( applyA, precond, b, x, relTol, maxIts, progress );
+        auto XLocCol = XLoc( ALL, IR(j) );
+        XLocCol = xLoc;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+// Overwrite B with the solution of A X = B, starting from a zero initial
+// guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int PCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> X;
+    Zeros( X, B.Height(), B.Width() );
+    const Int mostIts =
+      PCG( applyA, precond, B, X, relTol, maxIts, progress );
+    B = X;
+    return mostIts;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Field> X(B.Grid());
+    Zeros( X, B.Height(), B.Width() );
+    const Int mostIts =
+      PCG( applyA, precond, B, X, relTol, maxIts, progress );
+    B = X;
+    return mostIts;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_PCG_HPP
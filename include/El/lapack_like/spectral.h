@@ -619,6 +619,7 @@ typedef struct {
 
   bool scalapack;
   ElInt blockHeight;
+  ElInt minDistAEDSize;
   ElInt (*numBulgesPerBlock)(ElInt);
 } ElHessenbergSchurCtrl;
 EL_EXPORT ElError ElHessenbergSchurCtrlDefault( ElHessenbergSchurCtrl* ctrl );
@@ -9,6 +9,7 @@
 #ifndef EL_SPECTRAL_HPP
 #define EL_SPECTRAL_HPP
 
+#include <El/blas_like/level3/batched.hpp>
 #include <El/lapack_like/condense.hpp>
 
 namespace El {
@@ -460,6 +461,37 @@ HermitianEig
         AbstractDistMatrix<Field>& Q,
   const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
 
+// Solve each member of a batch of small eigenproblems
+// ---------------------------------------------------
+// Column b of w holds the eigenvalues of the b'th member of the batch.
+// Subsets of the spectrum are not supported.
+template<typename Field>
+void HermitianEig
+(       UpperOrLower uplo,
+        BatchMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+template<typename Field>
+void HermitianEig
+(       UpperOrLower uplo,
+        BatchMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        BatchMatrix<Field>& Q,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+template<typename Field>
+void HermitianEig
+(       UpperOrLower uplo,
+        vector<Matrix<Field>>& A,
+        vector<Matrix<Base<Field>>>& w,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+template<typename Field>
+void HermitianEig
+(       UpperOrLower uplo,
+        vector<Matrix<Field>>& A,
+        vector<Matrix<Base<Field>>>& w,
+        vector<Matrix<Field>>& Q,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+
 namespace herm_eig {
 
 template<typename Real,
@@ -759,6 +791,11 @@ struct HessenbergSchurCtrl
     // TODO(poulson): Move this into a substructure?
     bool scalapack=false;
     Int blockHeight=DefaultBlockHeight();
+    // The minimum deflation window size for which the distributed AED
+    // computes the Schur decomposition of the window on a subgrid of
+    // processes rather than redundantly on a single process. (The spike
+    // deflation and re-Hessenberg reduction remain on a single process.)
+    Int minDistAEDSize = 1000;
     // A map from the block height to the number of bulges per diagonal block in
     // the distributed multibulge algorithm.
     function<Int(Int)> numBulgesPerBlock =
@@ -1549,6 +1586,102 @@ pair<Base<Field>,Base<Field>>
 HermitianExtremalSingValEst
 ( const DistSparseMatrix<Field>& A, Int basisSize=20 );
 
+// Randomized SVD
+// ==============
+// Compute an approximate orthonormal basis Q for the range of A, with
+// Q.Width() >= rank, and approximations of the 'rank' dominant singular
+// triplets of A from random sketches of its range (see
+// El/lapack_like/spectral/RandomizedSVD.hpp for versions which accept
+// black-box applications of A and A^H).
+//
+// The range is either approximated via (optional) subspace iteration with
+// 'numPower' steps or by the block Krylov space of the same degree. The
+// resulting factors satisfy A ~= U diag(s) V^H, with U and V each having
+// 'rank' orthonormal columns.
+
+enum RandomizedSketch
+{
+  // Omega is i.i.d. standard normal
+  RANDOMIZED_GAUSSIAN_SKETCH,
+  // Each row of Omega has 'numSparseSignNonzeros' randomly-placed entries of
+  // +-1/sqrt(numSparseSignNonzeros)
+  RANDOMIZED_SPARSE_SIGN_SKETCH
+};
+
+struct RandomizedSVDCtrl
+{
+    RandomizedSketch sketch=RANDOMIZED_GAUSSIAN_SKETCH;
+    Int numSparseSignNonzeros=8;
+
+    // The number of extra columns to sample beyond the requested rank
+    Int oversample=10;
+
+    // The number of applications of (A A^H) applied to the initial sketch
+    Int numPower=2;
+
+    // Rather than only keeping the last subspace iterate, keep an
+    // orthonormal basis for all of them
+    bool blockKrylov=false;
+};
+
+template<typename Field>
+void RangeFinder
+( const Matrix<Field>& A,
+        Matrix<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename Field>
+void RangeFinder
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename Field>
+void RangeFinder
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename Field>
+void RangeFinder
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+
+template<typename Field>
+void RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename Field>
+void RandomizedSVD
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename Field>
+void RandomizedSVD
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename Field>
+void RandomizedSVD
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        DistMultiVec<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+
 // Pseudospectra
 // =============
 enum PseudospecNorm {
@@ -2014,5 +2147,6 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 #include <El/lapack_like/spectral/SVD.hpp>
 #include <El/lapack_like/spectral/Lanczos.hpp>
 #include <El/lapack_like/spectral/ProductLanczos.hpp>
+#include <El/lapack_like/spectral/RandomizedSVD.hpp>
 
 #endif // ifndef EL_SPECTRAL_HPP
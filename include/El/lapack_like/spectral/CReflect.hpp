@@ -776,6 +776,7 @@ inline ElHessenbergSchurCtrl CReflect( const HessenbergSchurCtrl& ctrl )
 
     ctrlC.scalapack = ctrl.scalapack;
     ctrlC.blockHeight = ctrl.blockHeight;
+    ctrlC.minDistAEDSize = ctrl.minDistAEDSize;
     auto numBulgesPerBlockRes =
       ctrl.numBulgesPerBlock.target<ElInt(*)(ElInt)>();
     if( numBulgesPerBlockRes )
@@ -812,6 +813,7 @@ inline HessenbergSchurCtrl CReflect( const ElHessenbergSchurCtrl& ctrlC )
 
     ctrl.scalapack = ctrlC.scalapack;
     ctrl.blockHeight = ctrlC.blockHeight;
+    ctrl.minDistAEDSize = ctrlC.minDistAEDSize;
     ctrl.numBulgesPerBlock = ctrlC.numBulgesPerBlock;
 
     return ctrl;
@@ -0,0 +1,273 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_RANDOMIZEDSVD_HPP
+#define EL_SPECTRAL_RANDOMIZEDSVD_HPP
+
+namespace El {
+
+// The following implementations follow Algorithms 4.4 and 5.1 of
+//
+//   N. Halko, P.G. Martinsson, and J.A. Tropp,
+//   "Finding structure with randomness: Probabilistic algorithms for
+//    constructing approximate matrix decompositions",
+//   SIAM Review, Vol. 53, No. 2, pp. 217--288, 2011,
+//
+// with the block Krylov variant being that of
+//
+//   C. Musco and C. Musco,
+//   "Randomized block Krylov methods for stronger and faster approximate
+//    singular value decomposition", NIPS, 2015.
+//
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA( const BlockType& X, BlockType& Y )
+//
+// and overwrite the (already appropriately sized) Y with A X, whereas
+// 'applyAAdj' should have the same form and overwrite Y with A^H X. BlockType
+// is either Matrix<Field> or DistMatrix<Field>.
+//
+
+namespace randomized {
+
+template<typename Field>
+Matrix<Field> NewBlock( const Matrix<Field>& )
+{ return Matrix<Field>(); }
+
+template<typename Field>
+DistMatrix<Field> NewBlock( const DistMatrix<Field>& A )
+{ return DistMatrix<Field>( A.Grid() ); }
+
+// Fill each row of the n x width matrix with 'numNonzeros' entries of
+// +-1/sqrt(numNonzeros) in randomly chosen columns (i.e., form the transpose
+// of a sparse sign embedding)
+template<typename Field>
+void SparseSignRows( Matrix<Field>& Omega, Int numNonzeros )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int height = Omega.Height();
+    const Int width = Omega.Width();
+    numNonzeros = Max( Min( numNonzeros, width ), Int(1) );
+    const Real scale = Real(1)/Sqrt(Real(numNonzeros));
+
+    vector<Int> columns(width);
+    for( Int j=0; j<width; ++j )
+        columns[j] = j;
+    for( Int i=0; i<height; ++i )
+    {
+        // Draw the column indices with a partial Fisher-Yates shuffle
+        for( Int k=0; k<numNonzeros; ++k )
+        {
+            const Int swapInd = SampleUniform<Int>( k, width );
+            std::swap( columns[k], columns[swapInd] );
+            const bool negate = ( SampleUniform<Int>( 0, 2 ) == 0 );
+            Omega(i,columns[k]) = ( negate ? -scale : scale );
+        }
+    }
+}
+
+template<typename Field>
+void Sketch
+( Matrix<Field>& Omega, Int n, Int width, const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.sketch == RANDOMIZED_SPARSE_SIGN_SKETCH )
+    {
+        Zeros( Omega, n, width );
+        SparseSignRows( Omega, ctrl.numSparseSignNonzeros );
+    }
+    else
+        Gaussian( Omega, n, width );
+}
+
+template<typename Field>
+void Sketch
+( DistMatrix<Field>& Omega, Int n, Int width, const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.sketch == RANDOMIZED_SPARSE_SIGN_SKETCH )
+    {
+        // Each row of a [VC,STAR] matrix is owned by a single process
+        DistMatrix<Field,VC,STAR> Omega_VC_STAR( Omega.Grid() );
+        Zeros( Omega_VC_STAR, n, width );
+        SparseSignRows( Omega_VC_STAR.Matrix(), ctrl.numSparseSignNonzeros );
+        Omega = Omega_VC_STAR;
+    }
+    else
+        Gaussian( Omega, n, width );
+}
+
+template<typename Field,class BlockType,class ApplyAType,class ApplyAAdjType>
+void RangeFinder
+(       Int m,
+        Int n,
+  const ApplyAType& applyA,
+  const ApplyAAdjType& applyAAdj,
+        BlockType& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int minDim = Min(m,n);
+    const Int numSamples = Min( rank+ctrl.oversample, minDim );
+    auto Omega = NewBlock( Q );
+    auto Y = NewBlock( Q );
+    auto Z = NewBlock( Q );
+
+    // Y := A Omega
+    // ============
+    Sketch( Omega, n, numSamples, ctrl );
+    Zeros( Y, m, numSamples );
+    applyA( Omega, Y );
+    Omega.Empty();
+    qr::ExplicitUnitary( Y );
+
+    if( ctrl.blockKrylov )
+    {
+        // Q := orth([Y, (A A^H) Y, ..., (A A^H)^q Y]), where each block is
+        // orthonormalized as it is formed
+        const Int numBlocks =
+          Min( ctrl.numPower+1, Max( minDim/numSamples, Int(1) ) );
+        Zeros( Q, m, numBlocks*numSamples );
+        for( Int block=0; block<numBlocks; ++block )
+        {
+            if( block > 0 )
+            {
+                Zeros( Z, n, numSamples );
+                applyAAdj( Y, Z );
+                qr::ExplicitUnitary( Z );
+                Zeros( Y, m, numSamples );
+                applyA( Z, Y );
+                qr::ExplicitUnitary( Y );
+            }
+            auto QBlock =
+              Q( ALL, IR(block*numSamples,(block+1)*numSamples) );
+            QBlock = Y;
+        }
+        qr::ExplicitUnitary( Q );
+    }
+    else
+    {
+        // Subspace iteration, Q := orth((A A^H)^q A Omega)
+        for( Int powerIt=0; powerIt<ctrl.numPower; ++powerIt )
+        {
+            Zeros( Z, n, numSamples );
+            applyAAdj( Y, Z );
+            qr::ExplicitUnitary( Z );
+            Zeros( Y, m, numSamples );
+            applyA( Z, Y );
+            qr::ExplicitUnitary( Y );
+        }
+        Q = Y;
+    }
+}
+
+template<typename Field,class BlockType,class RealBlockType,
+         class ApplyAType,class ApplyAAdjType>
+void SVD
+(       Int m,
+        Int n,
+  const ApplyAType& applyA,
+  const ApplyAAdjType& applyAAdj,
+        BlockType& U,
+        RealBlockType& s,
+        BlockType& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    auto Q = NewBlock( U );
+    RangeFinder<Field>( m, n, applyA, applyAAdj, Q, rank, ctrl );
+    const Int numSamples = Q.Width();
+
+    // Since A ~= Q Q^H A = Q (A^H Q)^H, the SVD A^H Q = UHat diag(s) VHat^H
+    // yields A ~= (Q VHat) diag(s) UHat^H
+    auto Z = NewBlock( U );
+    Zeros( Z, n, numSamples );
+    applyAAdj( Q, Z );
+
+    auto UHat = NewBlock( U );
+    auto VHat = NewBlock( U );
+    SVDCtrl<Base<Field>> svdCtrl;
+    svdCtrl.overwrite = true;
+    svdCtrl.bidiagSVDCtrl.approach = THIN_SVD;
+    El::SVD( Z, UHat, s, VHat, svdCtrl );
+
+    const Int k = Min( rank, numSamples );
+    s.Resize( k, 1 );
+    auto VHatL = VHat( ALL, IR(0,k) );
+    Gemm( NORMAL, NORMAL, Field(1), Q, VHatL, U );
+    V = UHat( ALL, IR(0,k) );
+}
+
+} // namespace randomized
+
+template<typename Field,class ApplyAType,class ApplyAAdjType>
+void RangeFinder
+(       Int m,
+        Int n,
+  const ApplyAType& applyA,
+  const ApplyAAdjType& applyAAdj,
+        Matrix<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() )
+{
+    EL_DEBUG_CSE
+    randomized::RangeFinder<Field>( m, n, applyA, applyAAdj, Q, rank, ctrl );
+}
+
+template<typename Field,class ApplyAType,class ApplyAAdjType>
+void RangeFinder
+(       Int m,
+        Int n,
+  const ApplyAType& applyA,
+  const ApplyAAdjType& applyAAdj,
+        DistMatrix<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() )
+{
+    EL_DEBUG_CSE
+    randomized::RangeFinder<Field>( m, n, applyA, applyAAdj, Q, rank, ctrl );
+}
+
+template<typename Field,class ApplyAType,class ApplyAAdjType>
+void RandomizedSVD
+(       Int m,
+        Int n,
+  const ApplyAType& applyA,
+  const ApplyAAdjType& applyAAdj,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() )
+{
+    EL_DEBUG_CSE
+    randomized::SVD<Field>( m, n, applyA, applyAAdj, U, s, V, rank, ctrl );
+}
+
+template<typename Field,class ApplyAType,class ApplyAAdjType>
+void RandomizedSVD
+(       Int m,
+        Int n,
+  const ApplyAType& applyA,
+  const ApplyAAdjType& applyAAdj,
+        DistMatrix<Field>& U,
+        DistMatrix<Base<Field>,STAR,STAR>& s,
+        DistMatrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() )
+{
+    EL_DEBUG_CSE
+    randomized::SVD<Field>( m, n, applyA, applyAAdj, U, s, V, rank, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_RANDOMIZEDSVD_HPP
@@ -11,6 +11,64 @@
 
 namespace El {
 
+struct PrimeSieveCtrl
+{
+    // The number of bytes in each bit-packed segment, where each byte
+    // represents the eight integers coprime to 30 in a block of 30 integers.
+    // The default keeps each segment within a typical L1 cache.
+    Int segmentBytes=32768;
+
+    // Split the range into contiguous chunks of segments which are sieved
+    // concurrently (with OpenMP, if available)
+    bool parallel=true;
+    Int tasksPerThread=4;
+};
+
+namespace prime_sieve {
+
+// Sieves consecutive bit-packed segments modulo a wheel of size 30: bit i of
+// byte j of a segment beginning at byte 'firstByte' represents the integer
+// 30 (firstByte+j) + {1,7,11,13,17,19,23,29}[i].
+template<typename T>
+class WheelSieve
+{
+public:
+    // Begin sieving at the integer 30*firstByte
+    void Reset( T firstByte );
+
+    T NextByte() const { return nextByte_; }
+
+    // Sieve the next bits.size() bytes using the ascending list of primes,
+    // which must contain every prime p >= 17 such that p^2 is less than the
+    // end of the segment (smaller primes are ignored)
+    void Sieve( const vector<T>& primes, vector<unsigned char>& bits );
+
+private:
+    T nextByte_=0;
+
+    // The byte containing the next multiple, p q, of each active prime that
+    // is to be crossed out (with q coprime to 30) and the position of q mod 30
+    // within the wheel
+    vector<T> multiples_;
+    vector<unsigned char> wheelIndices_;
+};
+
+} // namespace prime_sieve
+
+// Return the primes in [lowerBound,upperBound)
+template<typename T>
+vector<T> PrimesInRange
+( T lowerBound, T upperBound, const PrimeSieveCtrl& ctrl=PrimeSieveCtrl() );
+
+// Return the number of primes in [lowerBound,upperBound)
+template<typename T>
+T CountPrimesInRange
+( T lowerBound, T upperBound, const PrimeSieveCtrl& ctrl=PrimeSieveCtrl() );
+
+// An incremental sieve built on top of the wheel sieve, which returns the
+// successive odd primes starting from a given lower bound. As before the
+// sieve was bit-packed, 'segmentSize' is the number of odd integers covered
+// by each segment.
 template<typename T=unsigned long long,
          typename TSmall=unsigned>
 struct DynamicSieve
@@ -33,26 +91,27 @@ public:
 private:
     bool keepAll_;
     T lowerBound_; // always return the first prime >= lowerBound_
-    T oddPrimeBound_;
-    vector<TSmall> oddPrimeStarts_;
 
-    // The segment offset will be odd (>=3) and the associated numbers are
-    // the offset plus twice the index.
-    vector<char> segmentTable_;
-    TSmall segmentSize_;
-    T segmentOffset_;
-    TSmall segmentIndex_;
-    // Attempt to update 'halvedIndex' until oddOffset + 2*halvedIndex is 
-    // corresponds to a precomputed prime (i.e., table[halvedIndex] is one)
-    bool SeekSegmentPrime();
-    TSmall ComputeSegmentStart( const TSmall& p ) const;
+    // The number of bytes of each (bit-packed) segment, each of which covers
+    // 30 integers
+    TSmall segmentBytes_;
 
-    void AugmentPrimes( T numPrimes );
-    void MoveSegmentOffset( T segmentOffset );
+    // The current segment represents [segmentOffset_,segmentEnd_), where
+    // both bounds are multiples of 30, and contains the primes (of at least
+    // 7) in 'segmentPrimes_'
+    prime_sieve::WheelSieve<T> wheel_;
+    vector<unsigned char> segmentTable_;
+    vector<T> segmentPrimes_;
+    T segmentOffset_;
+    T segmentEnd_;
+    // The position of the first segment prime that might not yet have been
+    // returned
+    size_t segmentIndex_;
 
-    T PrimeCountingEstimate( T n ) const;
+    // Ensure that 'oddPrimes' contains every prime up to 'upperBound'
+    void ExtendPrimes( T upperBound );
 
-    void SieveSegment();
+    void MoveSegmentOffset( T segmentOffset );
     void FormNewSegment();
 };
 
@@ -73,6 +132,43 @@ bool HasTinyFactor( unsigned long long n, unsigned long long limit=53 );
 bool HasTinyFactor( const BigInt& n, unsigned long long limit=53 );
 #endif
 
+enum Primality
+{
+  PRIME,
+  PROBABLY_PRIME,
+  PROBABLY_COMPOSITE,
+  COMPOSITE
+};
+
+struct BatchPrimalityCtrl
+{
+    // Single-word candidates are trial divided by the primes up to this
+    // bound before running Miller-Rabin
+    unsigned long long trialDivisionLimit=256;
+
+    // Multi-word candidates are trial divided, via remainder trees, by the
+    // primes up to this bound
+    unsigned long long bigTrialDivisionLimit=65536;
+
+    // The number of Miller-Rabin representatives for multi-word candidates
+    // (single-word candidates use a deterministic set of bases)
+    Int numReps=30;
+
+    bool parallel=true;
+};
+
+// Screen a batch of candidates: trial division followed by Miller-Rabin,
+// using 64-bit Montgomery arithmetic for the candidates which fit in a word.
+// Candidates less than two are reported as composite.
+vector<Primality> BatchPrimalityTest
+( const vector<unsigned long long>& candidates,
+  const BatchPrimalityCtrl& ctrl=BatchPrimalityCtrl() );
+#ifdef EL_HAVE_MPC
+vector<Primality> BatchPrimalityTest
+( const vector<BigInt>& candidates,
+  const BatchPrimalityCtrl& ctrl=BatchPrimalityCtrl() );
+#endif
+
 #ifdef EL_HAVE_MPC
 
 unsigned long PowerDecomp
@@ -86,14 +182,6 @@ void SqrtModPrime( const BigInt& n, const BigInt& p, BigInt& nSqrt );
 int LegendreSymbol( const BigInt& n, const BigInt& p );
 int JacobiSymbol( const BigInt& m, const BigInt& n );
 
-enum Primality
-{
-  PRIME,
-  PROBABLY_PRIME,
-  PROBABLY_COMPOSITE,
-  COMPOSITE
-};
-
 Primality MillerRabin( const BigInt& n, const BigInt& a=BigIntTwo() );
 Primality MillerRabinSequence( const BigInt& n, Int numReps=30 );
 
@@ -115,6 +203,10 @@ struct PollardRhoCtrl
     BigInt x0=BigIntTwo();
     Int gcdDelay=100;
 
+    // Use Brent's cycle detection rather than Floyd's (which is still the
+    // default so that the sequence of GCDs is unchanged)
+    bool brent=false;
+
     // For trial division
     bool avoidTrialDiv=false;
     unsigned long long trialDivLimit=53ULL;
@@ -218,6 +310,65 @@ BigInt StageTwo
 
 } // namespace pollard_pm1
 
+template<typename TSieve=unsigned long long>
+struct ECMCtrl
+{
+    // Stage one
+    TSieve smooth1=TSieve(50000ULL);
+
+    // Stage two
+    TSieve smooth2=TSieve(5000000ULL);
+
+    // Curve i uses Suyama's parametrization with sigma=sigma0+i
+    unsigned long long sigma0=6ULL;
+
+    // Give up after this many curves (unless it is non-positive)
+    Int maxCurves=1000;
+
+    // Run one curve per thread
+    bool parallel=true;
+
+    // For trial division
+    bool avoidTrialDiv=false;
+    unsigned long long trialDivLimit=53ULL;
+
+    // For Miller-Rabin primality testing
+    Int numReps=30;
+
+    bool progress=false;
+    bool time=false;
+};
+
+template<typename TSieve=unsigned long long,
+         typename TSieveSmall=unsigned>
+vector<BigInt> ECM
+( const BigInt& n,
+  const ECMCtrl<TSieve>& ctrl=ECMCtrl<TSieve>() );
+
+template<typename TSieve=unsigned long long,
+         typename TSieveSmall=unsigned>
+vector<BigInt> ECM
+( const BigInt& n,
+        DynamicSieve<TSieve,TSieveSmall>& sieve,
+  const ECMCtrl<TSieve>& ctrl=ECMCtrl<TSieve>() );
+
+namespace ecm {
+
+template<typename TSieve=unsigned long long,
+         typename TSieveSmall=unsigned>
+BigInt FindFactor
+( const BigInt& n,
+  const ECMCtrl<TSieve>& ctrl=ECMCtrl<TSieve>() );
+
+template<typename TSieve=unsigned long long,
+         typename TSieveSmall=unsigned>
+BigInt FindFactor
+( const BigInt& n,
+        DynamicSieve<TSieve,TSieveSmall>& sieve,
+  const ECMCtrl<TSieve>& ctrl=ECMCtrl<TSieve>() );
+
+} // namespace ecm
+
 } // namespace factor
 
 bool IsPrimitiveRoot
@@ -245,6 +396,17 @@ struct PollardRhoCtrl
     bool assumePrime=false;
     factor::PollardRhoCtrl factorCtrl;
 
+    // Run many independent walks and detect collisions between their
+    // distinguished points rather than running a single cyclic walk. Since
+    // the walks start from random points, this is opt-in so that the
+    // default search remains deterministic.
+    bool distinguishedPoints=false;
+    // The number of trailing zero bits of a distinguished point (if negative,
+    // a quarter of the bit-length of the subgroup order, capped at 24)
+    Int distinguishedBits=-1;
+    // Run one distinguished-point walk per OpenMP thread
+    bool parallel=true;
+
     bool progress=false;
     bool time=false;
 };
@@ -262,6 +424,7 @@ BigInt PollardRho
 
 } // namespace El
 
+#include <El/number_theory/PrimeSieve.hpp>
 #include <El/number_theory/DynamicSieve.hpp>
 #include <El/number_theory/TrialDivision.hpp>
 
@@ -271,9 +434,11 @@ BigInt PollardRho
 #include <El/number_theory/JacobiSymbol.hpp>
 #include <El/number_theory/MillerRabin.hpp>
 #include <El/number_theory/PrimalityTest.hpp>
+#include <El/number_theory/BatchPrimality.hpp>
 #include <El/number_theory/NextProbablePrime.hpp>
 #include <El/number_theory/factor/PollardRho.hpp>
 #include <El/number_theory/factor/PollardPMinusOne.hpp>
+#include <El/number_theory/factor/ECM.hpp>
 #include <El/number_theory/PrimitiveRoot.hpp>
 #include <El/number_theory/dlog/PollardRho.hpp>
 
@@ -0,0 +1,405 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NUMBER_THEORY_BATCH_PRIMALITY_HPP
+#define EL_NUMBER_THEORY_BATCH_PRIMALITY_HPP
+
+namespace El {
+
+namespace batch_primality {
+
+typedef unsigned long long Word;
+
+// Form the double-word product a b = hi 2^64 + lo
+inline void Multiply( Word a, Word b, Word& hi, Word& lo )
+{
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 product = (unsigned __int128)(a)*b;
+    hi = Word(product >> 64);
+    lo = Word(product);
+#else
+    const Word mask = 0xFFFFFFFFULL;
+    const Word a0=a&mask, a1=a>>32, b0=b&mask, b1=b>>32;
+    const Word p00=a0*b0, p01=a0*b1, p10=a1*b0, p11=a1*b1;
+    const Word middle = (p00>>32) + (p01&mask) + (p10&mask);
+    lo = (middle<<32) | (p00&mask);
+    hi = p11 + (p01>>32) + (p10>>32) + (middle>>32);
+#endif
+}
+
+// The inverse of an odd integer modulo 2^64. Since every odd n satisfies
+// n n = 1 (mod 8), and each Newton step doubles the number of correct bits,
+// five steps suffice.
+inline Word InverseModWord( Word n )
+{
+    Word nInv = n;
+    for( Int step=0; step<5; ++step )
+        nInv *= 2 - n*nInv;
+    return nInv;
+}
+
+// Montgomery arithmetic modulo an odd n, with R = 2^64, which replaces each
+// modular reduction with two multiplications
+struct Montgomery
+{
+    Word n;
+    Word nInv; // n^{-1} (mod 2^64)
+    Word one;  // R (mod n)
+    Word rSquared; // R^2 (mod n)
+
+    explicit Montgomery( Word modulus )
+    : n(modulus), nInv(InverseModWord(modulus))
+    {
+        one = (0-n) % n;
+        rSquared = one;
+        for( Int j=0; j<64; ++j )
+            rSquared = Add( rSquared, rSquared );
+    }
+
+    Word Add( Word a, Word b ) const
+    {
+        const Word sum = a + b;
+        return ( sum < a || sum >= n ) ? sum-n : sum;
+    }
+
+    // Return (hi 2^64 + lo) / R (mod n) for hi < n. Since m n = lo
+    // (mod 2^64), the low words cancel and only the high words remain.
+    Word Reduce( Word hi, Word lo ) const
+    {
+        Word mnHi, mnLo;
+        batch_primality::Multiply( lo*nInv, n, mnHi, mnLo );
+        return hi >= mnHi ? hi-mnHi : hi-mnHi+n;
+    }
+
+    Word Multiply( Word a, Word b ) const
+    {
+        Word hi, lo;
+        batch_primality::Multiply( a, b, hi, lo );
+        return Reduce( hi, lo );
+    }
+
+    Word ToMontgomery( Word a ) const
+    { return Multiply( a % n, rSquared ); }
+
+    Word Pow( Word a, Word e ) const
+    {
+        Word result = one;
+        while( e != 0 )
+        {
+            if( e & 1 )
+                result = Multiply( result, a );
+            a = Multiply( a, a );
+            e >>= 1;
+        }
+        return result;
+    }
+};
+
+// Whether an odd n > 2, with n - 1 = 2^t q, is a strong probable prime to
+// the base a
+inline bool StrongProbablePrime
+( const Montgomery& mont, Word a, Word q, Int t )
+{
+    if( a % mont.n == 0 )
+        return true;
+    const Word minusOne = mont.n - mont.one;
+    Word b = mont.Pow( mont.ToMontgomery(a), q );
+    if( b == mont.one || b == minusOne )
+        return true;
+    for( Int e=1; e<t; ++e )
+    {
+        b = mont.Multiply( b, b );
+        if( b == minusOne )
+            return true;
+        if( b == mont.one )
+            return false;
+    }
+    return false;
+}
+
+// A deterministic Miller-Rabin test for odd n > 2, using the base sets of
+// Jaeschke (for n < 4759123141) and of Jim Sinclair (for n < 2^64)
+inline Primality MillerRabin( Word n )
+{
+    static const Word smallBases[3] = { 2, 7, 61 };
+    static const Word bases[7] =
+      { 2, 325, 9375, 28178, 450775, 9780504, 1795265022 };
+    const bool small = ( n < 4759123141ULL );
+    const Word* basesBeg = ( small ? smallBases : bases );
+    const Word* basesEnd = ( small ? smallBases+3 : bases+7 );
+
+    Word q = n - 1;
+    Int t = 0;
+    while( (q & 1) == 0 )
+    {
+        q >>= 1;
+        ++t;
+    }
+    const Montgomery mont( n );
+    for( const Word* a=basesBeg; a<basesEnd; ++a )
+        if( !StrongProbablePrime( mont, *a, q, t ) )
+            return COMPOSITE;
+    return PRIME;
+}
+
+// Testing an odd n for divisibility by an odd p only requires a single
+// multiplication, as p | n if and only if n p^{-1} (mod 2^64) <= (2^64-1)/p
+struct TrialDivisor
+{
+    Word p;
+    Word pInv;
+    Word bound;
+};
+
+inline vector<TrialDivisor> TrialDivisors( Word limit )
+{
+    vector<TrialDivisor> divisors;
+    if( limit < 3 )
+        return divisors;
+    const vector<Word> primes = PrimesInRange( Word(3), limit+1 );
+    divisors.resize( primes.size() );
+    for( size_t j=0; j<primes.size(); ++j )
+    {
+        divisors[j].p = primes[j];
+        divisors[j].pInv = InverseModWord( primes[j] );
+        divisors[j].bound = Word(-1) / primes[j];
+    }
+    return divisors;
+}
+
+// 'divisors' must contain each odd prime up to 'limit'
+inline Primality TestWord
+( Word n, const vector<TrialDivisor>& divisors, Word limit )
+{
+    if( n < 2 )
+        return COMPOSITE;
+    if( (n & 1) == 0 )
+        return ( n == 2 ? PRIME : COMPOSITE );
+    for( const auto& divisor : divisors )
+        if( n*divisor.pInv <= divisor.bound )
+            return ( n == divisor.p ? PRIME : COMPOSITE );
+    // Every composite n has a prime factor of at most sqrt(n)
+    if( limit >= 2 && n/limit < limit )
+        return PRIME;
+    return MillerRabin( n );
+}
+
+// Run f(i) for i in [0,n), concurrently if requested and possible
+template<typename Function>
+void ParallelFor( Int n, bool parallel, Function f )
+{
+#ifdef EL_HYBRID
+    if( parallel && n > 1 && omp_get_max_threads() > 1 )
+    {
+        bool failed = false;
+        std::exception_ptr error;
+        #pragma omp parallel for schedule(dynamic)
+        for( Int i=0; i<n; ++i )
+        {
+            try { f( i ); }
+            catch( ... )
+            {
+                #pragma omp critical(El_batch_primality_ParallelFor)
+                {
+                    if( !failed )
+                    {
+                        failed = true;
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+        if( failed )
+            std::rethrow_exception( error );
+        return;
+    }
+#endif
+    for( Int i=0; i<n; ++i )
+        f( i );
+}
+
+#ifdef EL_HAVE_MPC
+
+// The levels of the product tree of the given leaves, from the leaves to
+// the root
+inline vector<vector<BigInt>> ProductTree( const vector<BigInt>& leaves )
+{
+    vector<vector<BigInt>> tree( 1, leaves );
+    while( tree.back().size() > 1 )
+    {
+        const vector<BigInt>& children = tree.back();
+        vector<BigInt> parents( (children.size()+1)/2 );
+        for( size_t j=0; j<parents.size(); ++j )
+        {
+            parents[j] = children[2*j];
+            if( 2*j+1 < children.size() )
+                parents[j] *= children[2*j+1];
+        }
+        tree.push_back( std::move(parents) );
+    }
+    return tree;
+}
+
+// Return P mod each leaf of the product tree by descending from its root,
+// which replaces one division of P per leaf with divisions of remainders
+// whose sizes shrink along with the nodes
+inline vector<BigInt>
+RemainderTree( const BigInt& P, const vector<vector<BigInt>>& tree )
+{
+    vector<BigInt> remainders( 1, P % tree.back()[0] );
+    for( Int level=Int(tree.size())-2; level>=0; --level )
+    {
+        const vector<BigInt>& nodes = tree[level];
+        vector<BigInt> children( nodes.size() );
+        for( size_t j=0; j<nodes.size(); ++j )
+            children[j] = remainders[j/2] % nodes[j];
+        remainders = std::move(children);
+    }
+    return remainders;
+}
+
+inline Int NumBits( const BigInt& n )
+{ return Int(mpz_sizeinbase(n.LockedPointer(),2)); }
+
+#endif // ifdef EL_HAVE_MPC
+
+} // namespace batch_primality
+
+inline vector<Primality> BatchPrimalityTest
+( const vector<unsigned long long>& candidates,
+  const BatchPrimalityCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef unsigned long long Word;
+    // Every composite single-word integer has a prime factor below 2^32
+    const Word limit = Min( ctrl.trialDivisionLimit, Word(1) << 32 );
+    const auto divisors = batch_primality::TrialDivisors( limit );
+
+    const Int numCandidates = candidates.size();
+    vector<Primality> results( numCandidates );
+    const Int blockSize = 1024;
+    const Int numBlocks = (numCandidates+blockSize-1) / blockSize;
+    batch_primality::ParallelFor( numBlocks, ctrl.parallel,
+      [&]( Int block )
+      {
+          const Int beg = block*blockSize;
+          const Int end = Min( beg+blockSize, numCandidates );
+          for( Int i=beg; i<end; ++i )
+              results[i] =
+                batch_primality::TestWord( candidates[i], divisors, limit );
+      } );
+    return results;
+}
+
+#ifdef EL_HAVE_MPC
+
+inline vector<Primality> BatchPrimalityTest
+( const vector<BigInt>& candidates,
+  const BatchPrimalityCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef unsigned long long Word;
+    const Int numCandidates = candidates.size();
+    vector<Primality> results( numCandidates, COMPOSITE );
+
+    // Hand the single-word candidates to the Montgomery-based test
+    vector<Word> words;
+    vector<Int> wordIndices, bigIndices;
+    for( Int i=0; i<numCandidates; ++i )
+    {
+        const BigInt& n = candidates[i];
+        if( mpz_cmp_ui(n.LockedPointer(),1) <= 0 )
+            continue;
+        if( batch_primality::NumBits(n) <= 64 )
+        {
+            words.push_back( Word(n) );
+            wordIndices.push_back( i );
+        }
+        else
+            bigIndices.push_back( i );
+    }
+    if( !words.empty() )
+    {
+        const auto wordResults = BatchPrimalityTest( words, ctrl );
+        for( size_t j=0; j<words.size(); ++j )
+            results[wordIndices[j]] = wordResults[j];
+    }
+    if( bigIndices.empty() )
+        return results;
+
+    // Form the product of the primes up to the trial division limit
+    BigInt primeProduct(1);
+    if( ctrl.bigTrialDivisionLimit >= 2 )
+    {
+        const Word limit = Min( ctrl.bigTrialDivisionLimit, Word(1) << 32 );
+        const vector<Word> primes = PrimesInRange( Word(2), limit+1 );
+        vector<BigInt> primeLeaves( primes.size() );
+        for( size_t j=0; j<primes.size(); ++j )
+            primeLeaves[j] = primes[j];
+        primeProduct = batch_primality::ProductTree( primeLeaves ).back()[0];
+    }
+
+    // Group the candidates into batches whose products are about as large
+    // as the prime product, so that each remainder tree starts by reducing
+    // the prime product by a modulus of similar size
+    const Int productBits = batch_primality::NumBits( primeProduct );
+    vector<Int> batchOffsets( 1, 0 );
+    Int batchBits = 0;
+    for( size_t j=0; j<bigIndices.size(); ++j )
+    {
+        batchBits += batch_primality::NumBits( candidates[bigIndices[j]] );
+        if( batchBits >= productBits || j+1 == bigIndices.size() )
+        {
+            batchOffsets.push_back( j+1 );
+            batchBits = 0;
+        }
+    }
+
+    // Candidates sharing a factor with the prime product are composite, as
+    // each exceeds the trial division limit
+    vector<char> survived( bigIndices.size(), 1 );
+    const Int numBatches = batchOffsets.size()-1;
+    batch_primality::ParallelFor( numBatches, ctrl.parallel,
+      [&]( Int batch )
+      {
+          const Int beg = batchOffsets[batch];
+          const Int end = batchOffsets[batch+1];
+          vector<BigInt> leaves( end-beg );
+          for( Int j=beg; j<end; ++j )
+              leaves[j-beg] = candidates[bigIndices[j]];
+          const auto remainders = batch_primality::RemainderTree
+            ( primeProduct, batch_primality::ProductTree(leaves) );
+          BigInt gcd;
+          for( Int j=beg; j<end; ++j )
+          {
+              GCD( remainders[j-beg], leaves[j-beg], gcd );
+              if( gcd != BigIntOne() )
+                  survived[j] = 0;
+          }
+      } );
+
+    // Run Miller-Rabin on the survivors
+    vector<Int> survivors;
+    for( size_t j=0; j<bigIndices.size(); ++j )
+        if( survived[j] )
+            survivors.push_back( bigIndices[j] );
+    batch_primality::ParallelFor( survivors.size(), ctrl.parallel,
+      [&]( Int j )
+      {
+          const Int i = survivors[j];
+          results[i] = PrimalityTest( candidates[i], ctrl.numReps );
+      } );
+
+    return results;
+}
+
+#endif // ifdef EL_HAVE_MPC
+
+} // namespace El
+
+#endif // ifndef EL_NUMBER_THEORY_BATCH_PRIMALITY_HPP
@@ -18,16 +18,11 @@ DynamicSieve<T,TSmall>::DynamicSieve
   TSmall segmentSize )
 {
     keepAll_ = false;
-    oddPrimeBound_ = 0;
 
     // Ensure that the lower bound is odd
     if( lowerBound % 2 == 0 )
         ++lowerBound;
 
-    // Ensure that the segment size is even
-    if( segmentSize % 2 == 1 )
-        ++segmentSize;
-
     // This could be an arbitrary number of the first several odd primes,
     // but testing up to 53 being a good default for trial division is common
     // folklore
@@ -48,274 +43,80 @@ DynamicSieve<T,TSmall>::DynamicSieve
     oddPrimes[13] = 47;
     oddPrimes[14] = 53;
 
-    segmentOffset_ = lowerBound_ = ( keepAll ? 3 : lowerBound );
-    segmentOffset_ = std::max( segmentOffset_, oddPrimes.back()+2 );
-    segmentSize_ = segmentSize;
-    segmentTable_.resize( segmentSize );
-
-    // Initialize the sieve table
-    T largestCandidate = segmentOffset_ + 2*(segmentSize-1);
-    while( oddPrimes.back()*oddPrimes.back() < largestCandidate )
-    {
-        AugmentPrimes( 2*oddPrimes.size() );
-    }
-    SieveSegment();
+    // The segment is formed upon the first request for a prime beyond the
+    // stored primes. Since each byte of the wheel covers 15 odd integers,
+    // round the requested number of odd integers up to a whole byte.
+    segmentBytes_ = segmentSize/15 + ( segmentSize % 15 != 0 );
+    segmentBytes_ = std::max( segmentBytes_, TSmall(1) );
+    segmentOffset_ = segmentEnd_ = 0;
+    segmentIndex_ = 0;
 
-    if( keepAll )
-    {
-        // Since it has been requested that we start generating primes at
-        // 'lowerBound', to keep all primes, we should now generate all
-        // primes before 'lowerBound'
-        Generate( lowerBound );
-        lowerBound_ = lowerBound;
-    }
+    lowerBound_ = lowerBound;
+    SetStorage( keepAll );
 }
 
-template<typename T,typename TSmall>
-T DynamicSieve<T,TSmall>::PrimeCountingEstimate( T n ) const
-{ return 2*(n/T(Log(double(n)))); }
-
 template<typename T,typename TSmall>
 void DynamicSieve<T,TSmall>::SetLowerBound( T lowerBound )
 {
     // Ensure that the lower bound is odd
     if( lowerBound % 2 == 0 )
         ++lowerBound;
-    if( lowerBound != lowerBound_ )
-    {
-        lowerBound_ = lowerBound;
-        // TODO: Decide if we always need to pay this price
-        MoveSegmentOffset( lowerBound_ );
-    }
+    // The segment is lazily moved by NextPrime, but the stored primes must
+    // remain contiguous
+    lowerBound_ = lowerBound;
+    if( keepAll_ )
+        ExtendPrimes( lowerBound_-1 );
 }
 
 template<typename T,typename TSmall>
-void DynamicSieve<T,TSmall>::MoveSegmentOffset( T segmentOffset )
+void DynamicSieve<T,TSmall>::ExtendPrimes( T upperBound )
 {
-    // TODO: Decide if this should only be enabled in debug mode
-    if( segmentOffset % 2 == 0 )
-        LogicError("Cannot choose an even segment offset");
+    if( oddPrimes.back() >= upperBound )
+        return;
+    prime_sieve::AppendPrimesInRange
+    ( oddPrimes.back()+2, upperBound+1, oddPrimes, PrimeSieveCtrl() );
+}
 
-    if( segmentOffset_ != segmentOffset )
-    {
-        segmentOffset_ = segmentOffset;
-        for( TSmall i=0; i<oddPrimeBound_; ++i )
-            oddPrimeStarts_[i] = ComputeSegmentStart( oddPrimes[i] );
-    }
+template<typename T,typename TSmall>
+void DynamicSieve<T,TSmall>::MoveSegmentOffset( T segmentOffset )
+{
+    wheel_.Reset( segmentOffset / 30 );
+    FormNewSegment();
 }
 
 template<typename T,typename TSmall>
 void DynamicSieve<T,TSmall>::SetStorage( bool keepAll )
 {
+    // Ensure that we have all of the primes below lowerBound_ stored
     if( keepAll && !keepAll_ )
-    {
-        // Ensure that we have all of the primes below lowerBound_ stored
-        if( lowerBound_ > oddPrimes.back()+2 )
-        {
-            T lowerBoundSave = lowerBound_;
-            lowerBound_ = oddPrimes.back()+2;
-            MoveSegmentOffset( lowerBound_ );
-
-            keepAll_ = true;
-            while( lowerBound_ < lowerBoundSave )
-                NextPrime(); 
-        }
-    }
+        ExtendPrimes( lowerBound_-1 );
     keepAll_ = keepAll;
 }
 
 template<typename T,typename TSmall>
 void DynamicSieve<T,TSmall>::Generate( T upperBound )
 {
-    SetStorage( true );
-
-    // Compute all of the needed "small" odd primes for testing candidates
-    // up to a (loose) upper bound of upperBound + 2*(segmentSize-1)
-    T largestCandidate = upperBound + 2*(segmentSize_-1);
-    oddPrimes.reserve( PrimeCountingEstimate(largestCandidate) );
-    while( oddPrimes.back()*oddPrimes.back() < largestCandidate )
-    {
-        AugmentPrimes( 2*oddPrimes.size() );
-    }
-
-    if( segmentOffset_ < oddPrimes.back()+2 )
-    {
-        MoveSegmentOffset( oddPrimes.back()+2 );
-    }
-
-    for( ; segmentOffset_<upperBound; segmentOffset_+=2*segmentSize_ )
-    {
-        SieveSegment();
-        for( TSmall k=0; k<segmentSize_; ++k )
-        {
-            if( segmentTable_[k] )
-            {
-                T p = segmentOffset_ + 2*k;
-                oddPrimes.push_back( p );
-            }
-        }
-    }
-
-    SetStorage( false );
-}
-
-template<typename T,typename TSmall>
-bool DynamicSieve<T,TSmall>::SeekSegmentPrime()
-{
-    // Set segmentIndex_ to the first location greater than or equal to the
-    // current location that is marked prime
-    const TSmall start =
-      ( segmentOffset_ >= lowerBound_ ?
-        0 :
-        (lowerBound_-segmentOffset_+1) / 2 );
-    for( TSmall i=start; i<segmentSize_; ++i )
-    {
-        if( segmentTable_[i] != 0 )
-        {
-            segmentIndex_ = i;
-            return true;
-        }
-    }
-    return false;
-}
-
-// Find the integer k such that segmentOffset_ + 2*k is the first odd 
-// multiple of p that is greater than or equal to Max(segmentOffset_,p^2)
-template<typename T,typename TSmall>
-TSmall DynamicSieve<T,TSmall>::ComputeSegmentStart
-( const TSmall& p ) const
-{
-    if( p*p >= segmentOffset_ )
-    {
-        return (p*p - segmentOffset_) / 2;
-    }
-    else
-    {
-        auto complement = (p - (segmentOffset_ % p)) % p;
-        if( complement % 2 == 0 )
-        {
-            return complement / 2;
-        }
-        else
-        {
-            return (complement + p) / 2;
-        }
-    }
-}
-
-template<typename T,typename TSmall>
-void DynamicSieve<T,TSmall>::AugmentPrimes
-( T numPrimes )
-{
-    T pIndex = oddPrimes.size();
-    oddPrimes.resize( numPrimes );
-
-    // TODO:
-    // Consider switching to another scheme if a sufficient number of primes
-    // are to be kept
-    T p = oddPrimes[pIndex-1];
-    for( ; pIndex<numPrimes; ++pIndex )
-    {
-        // Find the next prime after p using trial division.
-        auto begIter = oddPrimes.begin();
-        auto boundIter = begIter;
-        while( true )
-        {
-            p += 2;
-
-            T factorBound = T(std::sqrt(p)) + 1;
-            auto endIter = begIter;
-            endIter += pIndex;
-            boundIter = std::lower_bound( boundIter, endIter, factorBound );
-            const T indexEnd = T(boundIter-begIter);
-
-            T remainder = 1; // this could be an arbitrary nonzero
-            for( T j=0; j<indexEnd; ++j )
-            {
-                remainder = p % oddPrimes[j];
-                if( remainder == 0 )
-                {
-                    // p is composite with factor oddPrimes[j]
-                    break;
-                }
-            }
-            if( remainder )
-            {
-                // None of the stored oddPrimes factored p
-                break;
-            }
-        }
-        oddPrimes[pIndex] = p;
-    }
-}
-
-template<typename T,typename TSmall>
-void DynamicSieve<T,TSmall>::SieveSegment()
-{
-    std::fill( segmentTable_.begin(), segmentTable_.end(), char(1) );
-
-    // Since sqrt(n) is an upper-bound on the smallest prime factor of 
-    // a number n, we can a priori compute which of our stored primes is
-    // the last that we need to sieve with in this segment
-    T largestCandidate = segmentOffset_ + 2*(segmentSize_-1);
-    auto factorBound = TSmall(std::sqrt(largestCandidate)) + 1;
-    auto boundIter =
-      std::lower_bound( oddPrimes.begin(), oddPrimes.end(), factorBound );
-    auto indexEnd = TSmall(boundIter-oddPrimes.begin());
-
-    // Compute the starting index in this segment of all of the newly
-    // incorporated small primes 
-    while( oddPrimeBound_ < indexEnd )
-    {
-        oddPrimeStarts_.push_back
-        ( ComputeSegmentStart(oddPrimes[oddPrimeBound_]) );
-        ++oddPrimeBound_;
-    }
-
-    for( TSmall j=0; j<indexEnd; ++j )
-    {
-        TSmall p = oddPrimes[j];
-
-        // Iterate over the indices corresponding to odd multiples of p that
-        // are at least as large as Max(segmentOffset_,p^2)
-        auto k = oddPrimeStarts_[j];
-        for( ; k<segmentSize_; k+=p )
-        {
-            segmentTable_[k] = 0;
-        }
-
-        // Store the next starting index of the j'th small prime
-        // (under the assumption that the next segment will begin where the
-        // current one ends)
-        oddPrimeStarts_[j] = k - segmentSize_;
-    }
+    // Since the primes are appended in bulk, the segment does not need to
+    // be advanced
+    ExtendPrimes( upperBound );
 }
 
 template<typename T,typename TSmall>
 void DynamicSieve<T,TSmall>::FormNewSegment()
 {
-    // The current table handles the odd integers in the inclusive interval
-    // [segmentOffset,segmentOffset+2*(segmentSize-1)], so the next table
-    // should begin at 2*segmentSize (unless lowerBound_ is larger).
-    segmentOffset_ += 2*segmentSize_;
-
-    // Ensure that every prime factor of a number in the range covered by the
-    // table, [segmentOffset_,segmentOffset_+2*segmentSize), is in our list of
-    //  primes
-    const T largestCandidate = segmentOffset_ + 2*(segmentSize_-1);
-    if( keepAll_ )
-    {
-        oddPrimes.reserve( PrimeCountingEstimate(largestCandidate) );
-    }
-    else
-    {
-        while( oddPrimes.back()*oddPrimes.back() < largestCandidate )
-        {
-            AugmentPrimes( 2*oddPrimes.size() );
-        }
-    }
-
-    SieveSegment();
+    // Sieve the segment beginning where the wheel left off, after ensuring
+    // that every prime factor of a number in the range covered by the
+    // table is in our list of primes
+    segmentOffset_ = 30*wheel_.NextByte();
+    segmentEnd_ = segmentOffset_ + 30*T(segmentBytes_);
+    ExtendPrimes( prime_sieve::FloorSqrt(segmentEnd_-1) );
+
+    segmentTable_.resize( segmentBytes_ );
+    wheel_.Sieve( oddPrimes, segmentTable_ );
+    segmentPrimes_.clear();
+    prime_sieve::AppendPrimes
+    ( segmentOffset_/30, segmentTable_, T(7), segmentEnd_, segmentPrimes_ );
+    segmentIndex_ = 0;
 }
 
 template<typename T,typename TSmall>
@@ -332,25 +133,46 @@ T DynamicSieve<T,TSmall>::NextPrime()
     }
 
     // Fall back to the segment table
-    while( !SeekSegmentPrime() )
+    while( true )
     {
-        FormNewSegment();
-    }
+        if( lowerBound_ < segmentOffset_ || lowerBound_ >= segmentEnd_ )
+        {
+            // Continue the wheel if the lower bound is within the next
+            // segment, otherwise restart it
+            const bool adjacent =
+              segmentEnd_ > 0 && lowerBound_ >= segmentEnd_ &&
+              lowerBound_ < segmentEnd_ + 30*T(segmentBytes_);
+            if( adjacent )
+                FormNewSegment();
+            else
+                MoveSegmentOffset( lowerBound_ );
+        }
 
-    // We have guaranteed that we are currently pointing to a prime
-    T currentPrime = segmentOffset_ + 2*segmentIndex_;
-    if( keepAll_ && currentPrime > oddPrimes.back() )
-    {
-        oddPrimes.push_back( currentPrime );
+        // Successive calls simply advance through the segment primes, but the
+        // lower bound may have been moved backwards
+        const size_t numSegmentPrimes = segmentPrimes_.size();
+        if( segmentIndex_ > 0 &&
+            segmentPrimes_[segmentIndex_-1] >= lowerBound_ )
+            segmentIndex_ =
+              std::lower_bound
+              ( segmentPrimes_.begin(), segmentPrimes_.end(), lowerBound_ ) -
+              segmentPrimes_.begin();
+        while( segmentIndex_ < numSegmentPrimes &&
+               segmentPrimes_[segmentIndex_] < lowerBound_ )
+            ++segmentIndex_;
+        if( segmentIndex_ < numSegmentPrimes )
+        {
+            T currentPrime = segmentPrimes_[segmentIndex_++];
+            if( keepAll_ && currentPrime > oddPrimes.back() )
+            {
+                oddPrimes.push_back( currentPrime );
+            }
+            lowerBound_ = currentPrime + 2;
+            return currentPrime;
+        }
+        // The next candidate is the first odd integer of the next segment
+        lowerBound_ = segmentEnd_ + 1;
     }
-    EL_DEBUG_ONLY(
-      if( currentPrime < lowerBound_ )
-          Output
-          ("Current prime, ",currentPrime,
-           ", smaller than lower bound of ",lowerBound_);
-    )
-    lowerBound_ = currentPrime + 2;
-    return currentPrime;
 }
 
 } // namespace El
@@ -0,0 +1,405 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NUMBER_THEORY_PRIME_SIEVE_HPP
+#define EL_NUMBER_THEORY_PRIME_SIEVE_HPP
+
+namespace El {
+
+namespace prime_sieve {
+
+// The integers in [0,30) which are coprime to 30
+const unsigned char wheelResidues[8] = { 1, 7, 11, 13, 17, 19, 23, 29 };
+
+// The distance from each wheel residue to the next one
+const unsigned char wheelGaps[8] = { 6, 4, 2, 4, 2, 4, 6, 2 };
+
+// The position of each residue modulo 30 within the wheel (or -1)
+const signed char wheelIndex[30] =
+{ -1,  0, -1, -1, -1, -1, -1,  1, -1, -1,
+  -1,  2, -1,  3, -1, -1, -1,  4, -1,  5,
+  -1, -1, -1,  6, -1, -1, -1, -1, -1,  7 };
+
+// Crossing out the successive multiples p q, with q coprime to 30, of a prime
+// p = 30 a + b only requires the wheel positions, i and j, of q and b: the
+// multiple lies in the byte that, relative to that of the previous multiple,
+// is advanced by a wheelGaps[i] + wheelByteSteps[j][i], and is represented
+// by the bit cleared by wheelMasks[j][i].
+const unsigned char wheelMasks[8][8] =
+{ { 0xFE, 0xFD, 0xFB, 0xF7, 0xEF, 0xDF, 0xBF, 0x7F },
+  { 0xFD, 0xDF, 0xEF, 0xFE, 0x7F, 0xF7, 0xFB, 0xBF },
+  { 0xFB, 0xEF, 0xFE, 0xBF, 0xFD, 0x7F, 0xF7, 0xDF },
+  { 0xF7, 0xFE, 0xBF, 0xDF, 0xFB, 0xFD, 0x7F, 0xEF },
+  { 0xEF, 0x7F, 0xFD, 0xFB, 0xDF, 0xBF, 0xFE, 0xF7 },
+  { 0xDF, 0xF7, 0x7F, 0xFD, 0xBF, 0xFE, 0xEF, 0xFB },
+  { 0xBF, 0xFB, 0xF7, 0x7F, 0xFE, 0xEF, 0xDF, 0xFD },
+  { 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE } };
+const unsigned char wheelByteSteps[8][8] =
+{ { 0, 0, 0, 0, 0, 0, 0, 1 },
+  { 1, 1, 1, 0, 1, 1, 1, 1 },
+  { 2, 2, 0, 2, 0, 2, 2, 1 },
+  { 3, 1, 1, 2, 1, 1, 3, 1 },
+  { 3, 3, 1, 2, 1, 3, 3, 1 },
+  { 4, 2, 2, 2, 2, 2, 4, 1 },
+  { 5, 3, 1, 4, 1, 3, 5, 1 },
+  { 6, 4, 2, 4, 2, 4, 6, 1 } };
+
+template<typename T>
+T FloorSqrt( T n )
+{
+    T root = T(std::sqrt(double(n)));
+    while( root > 0 && root*root > n )
+        --root;
+    while( (root+1)*(root+1) <= n )
+        ++root;
+    return root;
+}
+
+// The primes 7, 11, and 13 cross out a pattern which repeats every
+// 7*11*13 = 1001 bytes, and so each segment is initialized by copying it
+const unsigned presieveBytes = 1001;
+
+inline const vector<unsigned char>& PresievePattern()
+{
+    static const vector<unsigned char> pattern = []()
+      {
+          vector<unsigned char> bits( presieveBytes, 0xFF );
+          for( const unsigned p : { 7u, 11u, 13u } )
+              for( unsigned n=p; n<30*presieveBytes; n+=2*p )
+                  if( wheelIndex[n % 30] >= 0 )
+                      bits[n/30] &= ~(1u << wheelIndex[n % 30]);
+          return bits;
+      }();
+    return pattern;
+}
+
+template<typename T>
+void WheelSieve<T>::Reset( T firstByte )
+{
+    nextByte_ = firstByte;
+    multiples_.clear();
+    wheelIndices_.clear();
+}
+
+template<typename T>
+void WheelSieve<T>::Sieve
+( const vector<T>& primes, vector<unsigned char>& bits )
+{
+    const T numBytes = bits.size();
+    const T segmentBeg = 30*nextByte_;
+    const T segmentEnd = segmentBeg + 30*numBytes;
+    const T byteEnd = nextByte_ + numBytes;
+
+    // Copy in the multiples of 7, 11, and 13 (but not the primes themselves)
+    const auto& pattern = PresievePattern();
+    for( T j=0, k=nextByte_%presieveBytes; j<numBytes; )
+    {
+        const T numCopy = Min( numBytes-j, T(presieveBytes-k) );
+        std::copy( &pattern[k], &pattern[k]+numCopy, &bits[j] );
+        j += numCopy;
+        k = 0;
+    }
+    if( nextByte_ == 0 )
+        bits[0] |= 0x0E;
+
+    // Activate the primes whose squares lie before the end of the segment
+    size_t primeOffset = 0;
+    while( primeOffset < primes.size() && primes[primeOffset] < 17 )
+        ++primeOffset;
+    while( primeOffset+multiples_.size() < primes.size() )
+    {
+        const T p = primes[primeOffset+multiples_.size()];
+        if( p*p >= segmentEnd )
+            break;
+        // Start from the first multiple p q >= Max(p^2,segmentBeg) with q
+        // coprime to 30
+        T q = ( p*p >= segmentBeg ? p : (segmentBeg+p-1)/p );
+        while( wheelIndex[q % 30] < 0 )
+            ++q;
+        multiples_.push_back( (p*q) / 30 );
+        wheelIndices_.push_back( wheelIndex[q % 30] );
+    }
+
+    const Int numActive = multiples_.size();
+    for( Int j=0; j<numActive; ++j )
+    {
+        const T p = primes[primeOffset+j];
+        const T a = p / 30;
+        const unsigned char* masks = wheelMasks[wheelIndex[p % 30]];
+        const unsigned char* byteSteps = wheelByteSteps[wheelIndex[p % 30]];
+        T byte = multiples_[j];
+        unsigned index = wheelIndices_[j];
+        while( byte < byteEnd )
+        {
+            bits[byte-nextByte_] &= masks[index];
+            byte += a*wheelGaps[index] + byteSteps[index];
+            index = (index+1) & 7;
+        }
+        multiples_[j] = byte;
+        wheelIndices_[j] = index;
+    }
+    nextByte_ += numBytes;
+}
+
+// Append the integers in [lowerBound,upperBound) which are marked in the
+// segment beginning at byte 'firstByte'
+template<typename T>
+void AppendPrimes
+( T firstByte,
+  const vector<unsigned char>& bits,
+  T lowerBound,
+  T upperBound,
+  vector<T>& primes )
+{
+    const T numBytes = bits.size();
+    for( T j=0; j<numBytes; ++j )
+    {
+        const unsigned char byte = bits[j];
+        if( byte == 0 )
+            continue;
+        const T blockOffset = 30*(firstByte+j);
+        for( Int i=0; i<8; ++i )
+        {
+            if( byte & (1u << i) )
+            {
+                const T n = blockOffset + wheelResidues[i];
+                if( n >= lowerBound && n < upperBound )
+                    primes.push_back( n );
+            }
+        }
+    }
+}
+
+// Count the integers in [lowerBound,upperBound) which are marked in the
+// segment beginning at byte 'firstByte'
+template<typename T>
+T CountPrimes
+( T firstByte,
+  const vector<unsigned char>& bits,
+  T lowerBound,
+  T upperBound )
+{
+    const T numBytes = bits.size();
+    const T blockBeg = 30*firstByte;
+    const T blockEnd = blockBeg + 30*numBytes;
+    T count = 0;
+    for( T j=0; j<numBytes; ++j )
+    {
+        unsigned byte = bits[j];
+        const bool boundary =
+          ( j == 0 && blockBeg < lowerBound ) ||
+          ( j == numBytes-1 && blockEnd > upperBound );
+        if( boundary )
+        {
+            const T blockOffset = 30*(firstByte+j);
+            for( Int i=0; i<8; ++i )
+            {
+                const T n = blockOffset + wheelResidues[i];
+                if( n < lowerBound || n >= upperBound )
+                    byte &= ~(1u << i);
+            }
+        }
+        for( ; byte; byte &= byte-1 )
+            ++count;
+    }
+    return count;
+}
+
+inline Int NumTasks( double numBytes, const PrimeSieveCtrl& ctrl )
+{
+#ifdef EL_HYBRID
+    if( ctrl.parallel )
+    {
+        const Int segmentBytes = Max( ctrl.segmentBytes, Int(1) );
+        const Int numSegments = Int(std::ceil(numBytes/segmentBytes));
+        return Max
+          ( Min(numSegments,ctrl.tasksPerThread*omp_get_max_threads()),
+            Int(1) );
+    }
+#endif
+    return 1;
+}
+
+// Return every prime p with 7 <= p <= upperBound
+template<typename T>
+vector<T> BasePrimes( T upperBound, const PrimeSieveCtrl& ctrl )
+{
+    if( upperBound >= T(1048576) )
+        return PrimesInRange( T(7), upperBound+1, ctrl );
+
+    // A simple sieve over the odd integers, 2 i + 1, for small bounds
+    vector<T> primes;
+    const T numOdd = upperBound/2 + 1;
+    vector<char> composite( numOdd, 0 );
+    for( T i=1; (2*i+1)*(2*i+1) <= upperBound; ++i )
+        if( !composite[i] )
+            for( T j=(2*i+1)*(2*i+1)/2; j<numOdd; j+=2*i+1 )
+                composite[j] = 1;
+    for( T i=3; i<numOdd; ++i )
+        if( !composite[i] && 2*i+1 <= upperBound )
+            primes.push_back( 2*i+1 );
+    return primes;
+}
+
+// Sieve [lowerBound,upperBound) (for lowerBound >= 7) by splitting it into
+// 'numTasks' contiguous chunks of segments, which are each handled by a
+// single thread, and call 'process(task,firstByte,bits)' on each segment
+template<typename T,typename Function>
+void SieveSegments
+( T lowerBound,
+  T upperBound,
+  Int numTasks,
+  const PrimeSieveCtrl& ctrl,
+  Function process )
+{
+    EL_DEBUG_CSE
+    const T segmentBytes = Max( ctrl.segmentBytes, Int(1) );
+    const T firstByte = lowerBound / 30;
+    const T lastByte = (upperBound+29) / 30;
+    const T bytesPerTask = (lastByte-firstByte+numTasks-1) / numTasks;
+    const vector<T> primes = BasePrimes( FloorSqrt(upperBound-1), ctrl );
+
+    auto runTask = [&]( Int task )
+      {
+          const T taskBeg = Min( firstByte+T(task)*bytesPerTask, lastByte );
+          const T taskEnd = Min( taskBeg+bytesPerTask, lastByte );
+          WheelSieve<T> wheel;
+          wheel.Reset( taskBeg );
+          vector<unsigned char> bits;
+          for( T byte=taskBeg; byte<taskEnd; byte+=segmentBytes )
+          {
+              bits.resize( Min(segmentBytes,taskEnd-byte) );
+              wheel.Sieve( primes, bits );
+              process( task, byte, bits );
+          }
+      };
+
+#ifdef EL_HYBRID
+    if( numTasks > 1 )
+    {
+        bool failed = false;
+        std::exception_ptr error;
+        #pragma omp parallel for schedule(dynamic)
+        for( Int task=0; task<numTasks; ++task )
+        {
+            try { runTask( task ); }
+            catch( ... )
+            {
+                #pragma omp critical(El_prime_sieve_SieveSegments)
+                {
+                    if( !failed )
+                    {
+                        failed = true;
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+        if( failed )
+            std::rethrow_exception( error );
+        return;
+    }
+#endif
+    for( Int task=0; task<numTasks; ++task )
+        runTask( task );
+}
+
+// Append the primes in [lowerBound,upperBound) to 'primes'
+template<typename T>
+void AppendPrimesInRange
+( T lowerBound,
+  T upperBound,
+  vector<T>& primes,
+  const PrimeSieveCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    for( const T p : { T(2), T(3), T(5) } )
+        if( p >= lowerBound && p < upperBound )
+            primes.push_back( p );
+    lowerBound = Max( lowerBound, T(7) );
+    if( upperBound <= lowerBound )
+        return;
+
+    const Int numTasks = NumTasks( double(upperBound-lowerBound)/30, ctrl );
+    if( numTasks == 1 )
+    {
+        // Reserve an upper bound on the number of primes, since
+        // x / log(x) < pi(x) < 1.25506 x / log(x) for x >= 17
+        const double upper = double(upperBound);
+        const double lower = double(Max(lowerBound,T(17)));
+        const double estimate =
+          1.25506*upper/std::log(upper) - lower/std::log(lower) + 8;
+        primes.reserve( primes.size()+size_t(Max(estimate,0.)) );
+        SieveSegments
+        ( lowerBound, upperBound, numTasks, ctrl,
+          [&]( Int task, T firstByte, const vector<unsigned char>& bits )
+          { AppendPrimes( firstByte, bits, lowerBound, upperBound, primes ); }
+        );
+        return;
+    }
+
+    vector<vector<T>> taskPrimes( numTasks );
+    SieveSegments
+    ( lowerBound, upperBound, numTasks, ctrl,
+      [&]( Int task, T firstByte, const vector<unsigned char>& bits )
+      {
+          AppendPrimes
+          ( firstByte, bits, lowerBound, upperBound, taskPrimes[task] );
+      } );
+
+    size_t numPrimes = primes.size();
+    for( const auto& chunk : taskPrimes )
+        numPrimes += chunk.size();
+    primes.reserve( numPrimes );
+    for( const auto& chunk : taskPrimes )
+        primes.insert( primes.end(), chunk.begin(), chunk.end() );
+}
+
+} // namespace prime_sieve
+
+template<typename T>
+vector<T> PrimesInRange
+( T lowerBound, T upperBound, const PrimeSieveCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    vector<T> primes;
+    prime_sieve::AppendPrimesInRange( lowerBound, upperBound, primes, ctrl );
+    return primes;
+}
+
+template<typename T>
+T CountPrimesInRange
+( T lowerBound, T upperBound, const PrimeSieveCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    T count = 0;
+    for( const T p : { T(2), T(3), T(5) } )
+        if( p >= lowerBound && p < upperBound )
+            ++count;
+    lowerBound = Max( lowerBound, T(7) );
+    if( upperBound <= lowerBound )
+        return count;
+
+    const Int numTasks =
+      prime_sieve::NumTasks( double(upperBound-lowerBound)/30, ctrl );
+    vector<T> taskCounts( numTasks, 0 );
+    prime_sieve::SieveSegments
+    ( lowerBound, upperBound, numTasks, ctrl,
+      [&]( Int task, T firstByte, const vector<unsigned char>& bits )
+      {
+          taskCounts[task] += prime_sieve::CountPrimes
+            ( firstByte, bits, lowerBound, upperBound );
+      } );
+    for( const T& taskCount : taskCounts )
+        count += taskCount;
+    return count;
+}
+
+} // namespace El
+
+#endif // ifndef EL_NUMBER_THEORY_PRIME_SIEVE_HPP
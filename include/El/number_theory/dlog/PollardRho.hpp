@@ -11,12 +11,104 @@
 
 #ifdef EL_HAVE_MPC
 
+#include <unordered_map>
+
 namespace El {
 
 namespace dlog {
 
 namespace pollard_rho {
 
+// Given the collision q^(a_1) r^(b_1) = q^(a_2) r^(b_2), with
+// aDiff = a_1 - a_2 and bDiff = b_2 - b_1, solve for the discrete log
+inline BigInt ResolveCollision
+( const BigInt& q,
+  const BigInt& r,
+  const BigInt& n,
+  const BigInt& subgroupOrder,
+  const BigInt& aDiff,
+  const BigInt& bDiff,
+  const PollardRhoCtrl& ctrl )
+{
+    const BigInt& one = BigIntOne();
+
+    // NOTE:
+    // We should not necessarily throw an exception if bDiff=0;
+    // consider the problem 1 = (n-1)^x (mod n), which will converge
+    // at iteration 1 since (n-1)^2 = 1 (mod n) for any n. We will
+    // instead attempt to detect degeneracy below.
+
+    BigInt d, lambda, mu;
+    ExtendedGCD( aDiff, subgroupOrder, d, lambda, mu );
+    if( ctrl.progress )
+        Output("GCD(",aDiff,",",subgroupOrder,")=",d);
+
+    // Solve for k in lambda*bDiff = d*k.
+    // Note that such a relationship of r^(lambda*bDiff) = r^(d*k)
+    // need not exist if r does not generate q.
+    BigInt k = (lambda*bDiff) / d;
+    k %= subgroupOrder;
+
+    // Q := q r^{-k}
+    BigInt Q = PowMod( r, -k, n );
+    Q *= q;
+    Q %= n;
+
+    // theta := pow( r, subgroupOrder/d ) 
+    BigInt exponent(subgroupOrder);
+    exponent /= d;
+    BigInt theta = PowMod( r, exponent, n );
+
+    // Test theta^i = Q for each i
+    // (Also test theta^i = -Q, which implies theta^{i+d/2} = Q
+    //  if r was a primitive root)
+    BigInt thetaPow(one);
+    BigInt negQ(Q);
+    negQ *= -1;
+    negQ %= n;
+    for( BigInt thetaExp=0; thetaExp<d; ++thetaExp )
+    {
+        if( thetaPow == Q )
+        {
+            BigInt discLog = k + thetaExp*exponent;
+            if( ctrl.progress )
+                Output("Returning ",discLog," at thetaExp=",thetaExp);
+            return discLog;
+        }
+        else if( thetaPow == negQ )
+        {
+            BigInt dHalf(d);
+            dHalf /= 2;
+            BigInt theta_dHalf = PowMod( theta, dHalf, n );
+            if( Mod(thetaPow*theta_dHalf,n) == Q )
+            {
+                BigInt discLog = k + (thetaExp+dHalf)*exponent;
+                if( ctrl.progress )
+                    Output
+                    ("Took -Q shortcut at thetaExp=",thetaExp,
+                     " and found discLog=",discLog);
+                return discLog; 
+            }
+            else if( ctrl.progress )
+                Output("-Q shortcut failed at thetaExp=",thetaExp);
+        } 
+        thetaPow *= theta;
+        thetaPow %= n;
+        if( thetaPow == one && thetaExp+1 < d )
+        {
+            LogicError
+            ("theta=r^(",subgroupOrder,"/",d,")=",theta,
+             " was a degenerate ",d,"'th root, as theta^",
+             thetaExp+1,"=1, and r does not generate q");
+        }
+    }
+
+    LogicError("This should not be possible");
+
+    // This should never occur and is to prevent compiler warnings
+    return BigInt(-1);
+}
+
 // For use within a Pohlig-Hellman decomposition
 // NOTE: This implementation is meant to support subgroups of (Z/nZ)*, such
 //       as the n=5 case with r=4 implies the subgroup {4,4^2=16=1} of order 2.
@@ -115,84 +207,228 @@ inline BigInt Subproblem
 
             BigInt aDiff = (ai - a2i) % subgroupOrder;
             BigInt bDiff = (b2i - bi) % subgroupOrder;
-            // NOTE:
-            // We should not necessarily throw an exception if bDiff=0;
-            // consider the problem 1 = (n-1)^x (mod n), which will converge
-            // at iteration 1 since (n-1)^2 = 1 (mod n) for any n. We will
-            // instead attempt to detect degeneracy below.
-
-            BigInt d, lambda, mu;
-            ExtendedGCD( aDiff, subgroupOrder, d, lambda, mu );
-            if( ctrl.progress )
-                Output("GCD(",aDiff,",",subgroupOrder,")=",d);
-
-            // Solve for k in lambda*bDiff = d*k.
-            // Note that such a relationship of r^(lambda*bDiff) = r^(d*k)
-            // need not exist if r does not generate q.
-            BigInt k = (lambda*bDiff) / d;
-            k %= subgroupOrder;
-
-            // Q := q r^{-k}
-            BigInt Q = PowMod( r, -k, n );
-            Q *= q;
-            Q %= n;
-
-            // theta := pow( r, subgroupOrder/d ) 
-            BigInt exponent(subgroupOrder);
-            exponent /= d;
-            BigInt theta = PowMod( r, exponent, n );
-
-            // Test theta^i = Q for each i
-            // (Also test theta^i = -Q, which implies theta^{i+d/2} = Q
-            //  if r was a primitive root)
-            BigInt thetaPow(theta);
-            BigInt negQ(Q);
-            negQ *= -1;
-            negQ %= n;
-            for( BigInt thetaExp=0; thetaExp<d; ++thetaExp )
+            return ResolveCollision
+            ( q, r, n, subgroupOrder, aDiff, bDiff, ctrl );
+        }
+        ++i;
+    }
+
+    // This should never occur and is to prevent compiler warnings
+    return BigInt(-1);
+}
+
+// A parallel collision search in the spirit of
+//
+//   Paul C. van Oorschot and Michael J. Wiener,
+//   "Parallel collision search with cryptanalytic applications",
+//   Journal of Cryptology, 12(1), pp. 1--28, 1999.
+//
+// Each thread runs independent r-adding walks (using a fixed set of
+// multipliers q^(c_s) r^(d_s), as advocated by Teske) from random starting
+// points and only reports the "distinguished" points, whose low
+// 'distinguishedBits' bits are all zero, to a shared hash table. Two walks
+// which reach the same distinguished point with different exponents yield
+// the same linear relation as the cycle detected by Subproblem.
+inline BigInt DistinguishedSubproblem
+( const BigInt& q,
+  const BigInt& r,
+  const BigInt& n,
+  const BigInt& subgroupOrder,
+  const PollardRhoCtrl& ctrl )
+{
+    typedef unsigned long long Word;
+    const BigInt& zero = BigIntZero();
+    const BigInt& one = BigIntOne();
+
+    // Ensure that q lives in (Z/nZ)*
+    if( q < one || q >= n )
+        LogicError(q," was not in [1,",n,")");
+    if( GCD(q,n) != one )
+        LogicError("GCD(",q,",",n,")=",GCD(q,n));
+
+    // Ensure that r lives in (Z/nZ)*
+    if( r < one || r >= n )
+        LogicError(r," was not in [1,",n,")");
+    if( GCD(r,n) != one )
+        LogicError("GCD(",r,",",n,")=",GCD(r,n));
+
+    // Check the (unlikely) case that r is one
+    if( r == one )
+    {
+        if( q == one )
+            return zero;
+        else
+            LogicError("One does not generate ",q);
+    }
+
+    // The bookkeeping is not worthwhile for tiny subgroups
+    if( subgroupOrder < BigInt(1024) )
+        return Subproblem( q, r, n, subgroupOrder, ctrl );
+
+    const Int orderBits =
+      Int(mpz_sizeinbase( subgroupOrder.LockedPointer(), 2 ));
+    const Int distBits =
+      ( ctrl.distinguishedBits >= 0 ? ctrl.distinguishedBits
+                                    : Min(orderBits/4,Int(24)) );
+    if( distBits > 48 )
+        LogicError("distinguishedBits=",distBits," was too large");
+    const Word distMask = (Word(1) << distBits) - 1;
+    // Walks which have not found a distinguished point after twenty times
+    // the expected number of steps are assumed to be trapped in a cycle
+    const Int maxWalkLength = Int(20) << distBits;
+
+    const Int numMultipliers = 32;
+    vector<BigInt> multipliers(numMultipliers),
+                   multA(numMultipliers), multB(numMultipliers);
+    for( Int s=0; s<numMultipliers; ++s )
+    {
+        multA[s] = SampleUniform( zero, subgroupOrder );
+        multB[s] = SampleUniform( zero, subgroupOrder );
+        multipliers[s] = PowMod( q, multA[s], n );
+        multipliers[s] *= PowMod( r, multB[s], n );
+        multipliers[s] %= n;
+    }
+    // Distinguished points have zeros in their low bits, so the partition
+    // is chosen from a (Fibonacci) hash of the remaining bits
+    auto lowWord = []( const BigInt& x )
+      { return Word(mpz_getlimbn( x.LockedPointer(), 0 )); };
+    auto partition = [&]( Word word )
+      { return Int(((word >> distBits)*0x9E3779B97F4A7C15ULL) >> 59); };
+
+    // Draw an exponent (almost) uniformly from [0,subgroupOrder)
+    const Int numExponentWords = orderBits/64 + 2;
+    auto sampleExponent = [&]( std::mt19937_64& gen, BigInt& exponent )
+      {
+          exponent = zero;
+          for( Int k=0; k<numExponentWords; ++k )
+          {
+              exponent <<= 64u;
+              exponent += Word(gen());
+          }
+          exponent %= subgroupOrder;
+      };
+
+    struct DistinguishedPoint { BigInt x, a, b; };
+    std::unordered_multimap<Word,DistinguishedPoint> table;
+    Int numDistinguished = 0;
+    bool found = false;
+    BigInt aDiff, bDiff;
+    // Add a distinguished point to the table and check for a collision.
+    // This must be called from within the critical section.
+    auto insert = [&]( Word word, const BigInt& x, const BigInt& a,
+                       const BigInt& b )
+      {
+          ++numDistinguished;
+          auto range = table.equal_range( word );
+          for( auto it=range.first; it!=range.second; ++it )
+          {
+              const DistinguishedPoint& point = it->second;
+              if( point.x != x )
+                  continue;
+              BigInt aDiffCand = (a - point.a) % subgroupOrder;
+              BigInt bDiffCand = (point.b - b) % subgroupOrder;
+              // Identical representations are useless
+              if( aDiffCand == zero && bDiffCand == zero )
+                  return;
+              aDiff = aDiffCand;
+              bDiff = bDiffCand;
+              found = true;
+              if( ctrl.progress )
+                  Output
+                  ("Detected collision after ",numDistinguished,
+                   " distinguished points");
+              return;
+          }
+          table.emplace( word, DistinguishedPoint{x,a,b} );
+      };
+
+    auto walk = [&]( Word seed )
+      {
+          std::mt19937_64 gen( seed );
+          BigInt x, a, b, tmp;
+          while( true )
+          {
+              // Start from x = q^a r^b for random a and b
+              sampleExponent( gen, a );
+              sampleExponent( gen, b );
+              PowMod( q, a, n, x );
+              PowMod( r, b, n, tmp );
+              x *= tmp;
+              x %= n;
+
+              bool distinguished = false;
+              Word word = 0;
+              for( Int step=0; step<maxWalkLength; ++step )
+              {
+                  word = lowWord( x );
+                  if( (word & distMask) == 0 )
+                  {
+                      distinguished = true;
+                      break;
+                  }
+                  const Int s = partition( word );
+                  x *= multipliers[s];
+                  x %= n;
+                  a += multA[s];
+                  if( a >= subgroupOrder )
+                      a -= subgroupOrder;
+                  b += multB[s];
+                  if( b >= subgroupOrder )
+                      b -= subgroupOrder;
+              }
+
+              bool done;
+#ifdef EL_HYBRID
+              #pragma omp critical(El_dlog_DistinguishedSubproblem)
+#endif
+              {
+                  if( distinguished && !found )
+                      insert( word, x, a, b );
+                  done = found;
+              }
+              if( done )
+                  return;
+          }
+      };
+
+    Int numWalkers = 1;
+#ifdef EL_HYBRID
+    if( ctrl.parallel )
+        numWalkers = omp_get_max_threads();
+#endif
+    vector<Word> seeds(numWalkers);
+    std::mt19937& baseGen = Generator();
+    for( auto& seed : seeds )
+        seed = (Word(baseGen()) << 32) | Word(baseGen());
+
+#ifdef EL_HYBRID
+    bool failed = false;
+    std::exception_ptr error;
+    #pragma omp parallel for schedule(static,1) if(numWalkers > 1)
+    for( Int w=0; w<numWalkers; ++w )
+    {
+        try { walk( seeds[w] ); }
+        catch( ... )
+        {
+            // Also stop the remaining walkers
+            #pragma omp critical(El_dlog_DistinguishedSubproblem)
             {
-                if( thetaPow == Q )
-                {
-                    BigInt discLog = k + thetaExp*exponent;
-                    if( ctrl.progress )
-                        Output("Returning ",discLog," at thetaExp=",thetaExp);
-                    return discLog;
-                }
-                else if( thetaPow == negQ )
+                found = true;
+                if( !failed )
                 {
-                    BigInt dHalf(d);
-                    dHalf /= 2;
-                    BigInt theta_dHalf = PowMod( theta, dHalf, n );
-                    if( Mod(thetaPow*theta_dHalf,n) == Q )
-                    {
-                        BigInt discLog = k + (thetaExp+dHalf)*exponent;
-                        if( ctrl.progress )
-                            Output
-                            ("Took -Q shortcut at thetaExp=",thetaExp,
-                             " and found discLog=",discLog);
-                        return discLog; 
-                    }
-                    else if( ctrl.progress )
-                        Output("-Q shortcut failed at thetaExp=",thetaExp);
-                } 
-                if( thetaPow == one )
-                {
-                    LogicError
-                    ("theta=r^(",subgroupOrder,"/",d,")=",theta,
-                     " was a degenerate ",d,"'th root, as theta^",
-                     thetaExp,"=1, and r does not generate q");
+                    failed = true;
+                    error = std::current_exception();
                 }
-                thetaPow *= theta;
-                thetaPow %= n;
             }
-
-            LogicError("This should not be possible");
         }
-        ++i;
     }
+    if( failed )
+        std::rethrow_exception( error );
+#else
+    walk( seeds[0] );
+#endif
 
-    // This should never occur and is to prevent compiler warnings
-    return BigInt(-1);
+    return ResolveCollision( q, r, n, subgroupOrder, aDiff, bDiff, ctrl );
 }
 
 } // namespace pollard_rho
@@ -208,6 +444,18 @@ inline BigInt PollardRho
 {
     const BigInt& one = BigIntOne();
 
+    auto solveSubproblem =
+      [&]( const BigInt& qSub, const BigInt& rSub, const BigInt& nSub,
+           const BigInt& subgroupOrder )
+      {
+          if( ctrl.distinguishedPoints )
+              return pollard_rho::DistinguishedSubproblem
+                     ( qSub, rSub, nSub, subgroupOrder, ctrl );
+          else
+              return pollard_rho::Subproblem
+                     ( qSub, rSub, nSub, subgroupOrder, ctrl );
+      };
+
     // Ensure that q lives in (Z/nZ)*
     if( q < one || q >= n )
         LogicError(q," was not in [1,",n,")");
@@ -236,7 +484,7 @@ inline BigInt PollardRho
         BigInt nTotient = n-1;
         if( ctrl.progress )
             Output("Assuming ",n," is prime");
-        return pollard_rho::Subproblem( q, r, n, nTotient, ctrl );
+        return solveSubproblem( q, r, n, nTotient );
     }
 
     // Since we are implicitly working within (Z/nZ)*, which has group order
@@ -288,7 +536,7 @@ inline BigInt PollardRho
         // We are now ready to call the one-shot Pollard rho algorithm
         if( ctrl.progress )
             Output("Running single-stage Pollard rho");
-        return pollard_rho::Subproblem( q, r, n, nTotient, ctrl );
+        return solveSubproblem( q, r, n, nTotient );
     }
 
     // Translate the list of unique prime powers factoring n into a list of
@@ -370,7 +618,7 @@ inline BigInt PollardRho
                  "^x (mod ",n,") with subgroup order ",p);
             PushIndent();
             radixDecomp[i] =
-              pollard_rho::Subproblem( qPrime, rPrime, n, p, ctrl );
+              solveSubproblem( qPrime, rPrime, n, p );
             PopIndent();
             if( ctrl.progress )
                 Output("  Subproblem index was ",radixDecomp[i]);
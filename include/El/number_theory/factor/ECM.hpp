@@ -0,0 +1,607 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NUMBER_THEORY_FACTOR_ECM_HPP
+#define EL_NUMBER_THEORY_FACTOR_ECM_HPP
+
+#ifdef EL_HAVE_MPC
+namespace El {
+
+namespace factor {
+
+// Lenstra's elliptic curve method replaces the group (Z/(p))* of Pollard's
+// p-1 with the group of points of a random elliptic curve modulo p, whose
+// order varies over [p+1-2 sqrt(p),p+1+2 sqrt(p)] from curve to curve, so
+// that a factor is found as soon as a single curve has a smooth order.
+//
+// We use Montgomery curves, B y^2 = x^3 + A x^2 + x, with Suyama's
+// parametrization (which guarantees that the group order is divisible by
+// 12) and the Montgomery ladder on (X:Z) coordinates. The second stage is
+// the standard baby-step giant-step continuation: each prime q in
+// (smooth1,smooth2] is written as q = m D +- j, with |j| <= D/2, so that
+// q Q being the identity modulo p implies that x(m D Q) = x(j Q) (mod p).
+//
+// See, for example, Section 7.4 of Crandall and Pomerance's
+// "Prime numbers: A computational perspective".
+
+namespace ecm {
+
+// A point in projective (X:Z) coordinates; the identity is (1:0)
+struct Point
+{
+    BigInt X, Z;
+};
+
+// The arithmetic on a Montgomery curve modulo n, where a24 = (A+2)/4. The
+// temporaries are kept as members in order to avoid memory allocations.
+struct Curve
+{
+    const BigInt& n;
+    BigInt a24;
+    BigInt t0, t1, t2, t3;
+    Point R0, R1;
+
+    explicit Curve( const BigInt& modulus ) : n(modulus) { }
+
+    // Initialize the curve and the starting point P from Suyama's
+    // parametrization, u = sigma^2 - 5 and v = 4 sigma, with
+    //
+    //   P = (u^3 : v^3) and a24 = (v-u)^3 (3u+v) / (16 u^3 v).
+    //
+    // The GCD of the denominator and n is returned, so that a result other
+    // than one is either a factor or a failed curve.
+    BigInt Initialize( unsigned long long sigma, Point& P )
+    {
+        BigInt u(sigma), v(sigma), gcd, s, t;
+        u *= u;
+        u -= 5;
+        u %= n;
+        v *= 4;
+        v %= n;
+
+        P.X = u;
+        P.X *= u;
+        P.X %= n;
+        P.X *= u;
+        P.X %= n;
+        P.Z = v;
+        P.Z *= v;
+        P.Z %= n;
+        P.Z *= v;
+        P.Z %= n;
+
+        // t0 := (v-u)^3 (3u+v)
+        t1 = v;
+        t1 -= u;
+        t0 = t1;
+        t0 *= t1;
+        t0 %= n;
+        t0 *= t1;
+        t0 %= n;
+        t1 = u;
+        t1 *= 3;
+        t1 += v;
+        t0 *= t1;
+        t0 %= n;
+
+        // t1 := 16 u^3 v
+        t1 = P.X;
+        t1 *= v;
+        t1 *= 16;
+        t1 %= n;
+
+        ExtendedGCD( t1, n, gcd, s, t );
+        if( gcd != BigIntOne() )
+            return gcd;
+        a24 = t0;
+        a24 *= s;
+        a24 %= n;
+        return gcd;
+    }
+
+    // R := 2 P
+    void Double( const Point& P, Point& R )
+    {
+        // t0 := (X+Z)^2, t1 := (X-Z)^2, t2 := t0 - t1 = 4 X Z
+        t0 = P.X;
+        t0 += P.Z;
+        t0 *= t0;
+        t0 %= n;
+        t1 = P.X;
+        t1 -= P.Z;
+        t1 *= t1;
+        t1 %= n;
+        t2 = t0;
+        t2 -= t1;
+
+        // R := (t0 t1 : t2 (t1 + a24 t2))
+        R.X = t0;
+        R.X *= t1;
+        R.X %= n;
+        t3 = a24;
+        t3 *= t2;
+        t3 += t1;
+        t3 %= n;
+        t3 *= t2;
+        t3 %= n;
+        R.Z = t3;
+    }
+
+    // R := P + Q, given PMinusQ = P - Q
+    void Add( const Point& P, const Point& Q, const Point& PMinusQ, Point& R )
+    {
+        // t0 := (X_P - Z_P) (X_Q + Z_Q), t1 := (X_P + Z_P) (X_Q - Z_Q)
+        t0 = P.X;
+        t0 -= P.Z;
+        t2 = Q.X;
+        t2 += Q.Z;
+        t0 *= t2;
+        t0 %= n;
+        t1 = P.X;
+        t1 += P.Z;
+        t2 = Q.X;
+        t2 -= Q.Z;
+        t1 *= t2;
+        t1 %= n;
+
+        // R := (Z_{P-Q} (t0+t1)^2 : X_{P-Q} (t0-t1)^2)
+        t2 = t0;
+        t2 += t1;
+        t2 *= t2;
+        t2 %= n;
+        t2 *= PMinusQ.Z;
+        t3 = t0;
+        t3 -= t1;
+        t3 *= t3;
+        t3 %= n;
+        t3 *= PMinusQ.X;
+        R.X = t2;
+        R.X %= n;
+        R.Z = t3;
+        R.Z %= n;
+    }
+
+    // R := k P via the Montgomery ladder, which maintains R1 - R0 = P
+    void Multiply( unsigned long long k, const Point& P, Point& R )
+    {
+        if( k == 0 )
+        {
+            R.X = 1;
+            R.Z = 0;
+            return;
+        }
+        Int bit = 63;
+        while( !((k >> bit) & 1ULL) )
+            --bit;
+        R0 = P;
+        Double( P, R1 );
+        for( --bit; bit>=0; --bit )
+        {
+            if( (k >> bit) & 1ULL )
+            {
+                Add( R1, R0, P, R0 );
+                Double( R1, R1 );
+            }
+            else
+            {
+                Add( R1, R0, P, R1 );
+                Double( R0, R0 );
+            }
+        }
+        R = R0;
+    }
+};
+
+// The stage-one multiplier, the product of the maximal powers of the primes
+// which are at most smooth1, as a sequence of word-sized products of
+// consecutive primes (where each prime is repeated as many times as its
+// exponent). The products are shared by all of the curves.
+struct StageOnePlan
+{
+    vector<unsigned long long> primes;
+    vector<unsigned long long> products;
+    // products[c] is the product of primes[offsets[c]:offsets[c+1])
+    vector<Int> offsets;
+};
+
+template<typename TSieve,typename TSieveSmall>
+StageOnePlan FormStageOnePlan
+( const DynamicSieve<TSieve,TSieveSmall>& sieve, TSieve smooth1 )
+{
+    typedef unsigned long long Word;
+    StageOnePlan plan;
+    auto addPrime = [&]( Word p )
+      {
+          Word power = p;
+          plan.primes.push_back( p );
+          while( power <= Word(smooth1)/p )
+          {
+              power *= p;
+              plan.primes.push_back( p );
+          }
+      };
+    if( smooth1 >= 2 )
+        addPrime( 2 );
+    for( const auto& p : sieve.oddPrimes )
+    {
+        if( p > smooth1 )
+            break;
+        addPrime( p );
+    }
+
+    Word product = 1;
+    plan.offsets.push_back( 0 );
+    for( size_t j=0; j<plan.primes.size(); ++j )
+    {
+        const Word p = plan.primes[j];
+        if( product > Word(-1)/p )
+        {
+            plan.products.push_back( product );
+            plan.offsets.push_back( j );
+            product = 1;
+        }
+        product *= p;
+    }
+    if( product > 1 )
+    {
+        plan.products.push_back( product );
+        plan.offsets.push_back( plan.primes.size() );
+    }
+    return plan;
+}
+
+// Overwrite P with the stage-one multiple of P and return the GCD of its Z
+// coordinate with n. The GCD is periodically checked so that, should every
+// factor of n be found within the same interval, the interval can be
+// repeated one prime at a time in order to separate them.
+template<typename Aborted>
+BigInt StageOne
+( Curve& curve,
+  Point& P,
+  const StageOnePlan& plan,
+  Aborted aborted )
+{
+    const BigInt& one = BigIntOne();
+    const BigInt& n = curve.n;
+    const Int checkInterval = 16;
+    const Int numProducts = plan.products.size();
+
+    Point saved = P;
+    Int savedIndex = 0;
+    BigInt gcd(1);
+    for( Int c=0; c<numProducts; ++c )
+    {
+        curve.Multiply( plan.products[c], P, P );
+        if( (c+1) % checkInterval != 0 && c+1 != numProducts )
+            continue;
+        if( aborted() )
+            return one;
+
+        GCD( P.Z, n, gcd );
+        if( gcd == one )
+        {
+            saved = P;
+            savedIndex = c+1;
+            continue;
+        }
+        if( gcd != n )
+            return gcd;
+
+        P = saved;
+        for( Int j=plan.offsets[savedIndex]; j<plan.offsets[c+1]; ++j )
+        {
+            curve.Multiply( plan.primes[j], P, P );
+            GCD( P.Z, n, gcd );
+            if( gcd != one )
+                return gcd;
+        }
+    }
+    return gcd;
+}
+
+// Return the GCD of n with the product of X(m D Q) Z(j Q) - X(j Q) Z(m D Q)
+// over the primes q = m D +- j in [primeBeg,primeEnd)
+template<typename Iterator,typename Aborted>
+BigInt StageTwo
+( Curve& curve,
+  const Point& Q,
+  Iterator primeBeg,
+  Iterator primeEnd,
+  Aborted aborted )
+{
+    typedef unsigned long long Word;
+    const BigInt& one = BigIntOne();
+    const BigInt& n = curve.n;
+    if( primeBeg == primeEnd )
+        return one;
+
+    // The baby steps j Q for the odd j in [1,D/2]
+    const Word D = 2310;
+    const Int numBabySteps = D/4 + 1;
+    vector<Point> babySteps( numBabySteps );
+    Point Q2;
+    curve.Double( Q, Q2 );
+    babySteps[0] = Q;
+    curve.Add( Q2, Q, Q, babySteps[1] );
+    for( Int i=2; i<numBabySteps; ++i )
+        curve.Add( babySteps[i-1], Q2, babySteps[i-2], babySteps[i] );
+
+    // The giant steps m D Q, along with (m-1) D Q
+    Point DQ, giant, giantPrev;
+    curve.Multiply( D, Q, DQ );
+    Word m = (Word(*primeBeg)+D/2) / D;
+    curve.Multiply( m*D, Q, giant );
+    if( m > 0 )
+        curve.Multiply( (m-1)*D, Q, giantPrev );
+
+    const Int abortInterval = 4096;
+    Int counter = 0;
+    BigInt product(1), tmp0, tmp1;
+    for( Iterator qIter=primeBeg; qIter!=primeEnd; ++qIter )
+    {
+        const Word q = *qIter;
+        while( m < (q+D/2)/D )
+        {
+            if( m == 0 )
+            {
+                giantPrev = giant;
+                giant = DQ;
+            }
+            else if( m == 1 )
+            {
+                giantPrev = giant;
+                curve.Double( giantPrev, giant );
+            }
+            else
+            {
+                curve.Add( giant, DQ, giantPrev, giantPrev );
+                std::swap( giant, giantPrev );
+            }
+            ++m;
+        }
+        const Word j = ( q >= m*D ? q-m*D : m*D-q );
+        const Point& baby = babySteps[(j-1)/2];
+        tmp0 = giant.X;
+        tmp0 *= baby.Z;
+        tmp1 = baby.X;
+        tmp1 *= giant.Z;
+        tmp0 -= tmp1;
+        product *= tmp0;
+        product %= n;
+
+        if( ++counter == abortInterval )
+        {
+            if( aborted() )
+                return one;
+            counter = 0;
+        }
+    }
+    BigInt gcd;
+    GCD( product, n, gcd );
+    return gcd;
+}
+
+template<typename TSieve,typename TSieveSmall>
+BigInt FindFactor
+( const BigInt& n,
+        DynamicSieve<TSieve,TSieveSmall>& sieve,
+  const ECMCtrl<TSieve>& ctrl )
+{
+    const BigInt& one = BigIntOne();
+    const TSieve smooth1 = ctrl.smooth1;
+    const TSieve smooth2 = Max( ctrl.smooth1, ctrl.smooth2 );
+
+    // Ensure that we have sieved at least up until the stage-two bound
+    bool neededSieving = ( sieve.oddPrimes.empty() ||
+                           sieve.oddPrimes.back() < smooth2 );
+    if( ctrl.progress && neededSieving )
+        Output("Updating sieve to ",smooth2);
+    sieve.Generate( smooth2 );
+
+    const StageOnePlan plan = FormStageOnePlan( sieve, smooth1 );
+    auto stageTwoBeg =
+      std::upper_bound( sieve.oddPrimes.begin(), sieve.oddPrimes.end(),
+                        smooth1 );
+    auto stageTwoEnd =
+      std::upper_bound( stageTwoBeg, sieve.oddPrimes.end(), smooth2 );
+
+    Int curvesPerRound = 1;
+#ifdef EL_HYBRID
+    if( ctrl.parallel )
+        curvesPerRound = omp_get_max_threads();
+#endif
+
+    // Once any curve succeeds, the remaining curves abandon their work at
+    // their next checkpoint
+    bool found = false;
+    BigInt factor;
+    unsigned long long factorSigma = 0;
+    auto aborted = [&]()
+      {
+          bool result;
+#ifdef EL_HYBRID
+          #pragma omp critical(El_ecm_FindFactor)
+#endif
+          result = found;
+          return result;
+      };
+    auto runCurve = [&]( unsigned long long sigma )
+      {
+          Curve curve( n );
+          Point P;
+          BigInt gcd = curve.Initialize( sigma, P );
+          if( gcd == one )
+              gcd = StageOne( curve, P, plan, aborted );
+          if( gcd == one && !aborted() )
+              gcd = StageTwo( curve, P, stageTwoBeg, stageTwoEnd, aborted );
+          if( gcd > one && gcd < n )
+          {
+#ifdef EL_HYBRID
+              #pragma omp critical(El_ecm_FindFactor)
+#endif
+              if( !found )
+              {
+                  found = true;
+                  factor = gcd;
+                  factorSigma = sigma;
+              }
+          }
+      };
+
+    for( Int curve=0; ctrl.maxCurves <= 0 || curve < ctrl.maxCurves;
+         curve+=curvesPerRound )
+    {
+        const Int numCurves =
+          ( ctrl.maxCurves <= 0 ? curvesPerRound
+                                : Min(curvesPerRound,ctrl.maxCurves-curve) );
+#ifdef EL_HYBRID
+        bool failed = false;
+        std::exception_ptr error;
+        #pragma omp parallel for schedule(dynamic) if(numCurves > 1)
+        for( Int c=0; c<numCurves; ++c )
+        {
+            try { runCurve( ctrl.sigma0+curve+c ); }
+            catch( ... )
+            {
+                #pragma omp critical(El_ecm_FindFactor_error)
+                {
+                    if( !failed )
+                    {
+                        failed = true;
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+        if( failed )
+            std::rethrow_exception( error );
+#else
+        for( Int c=0; c<numCurves; ++c )
+            runCurve( ctrl.sigma0+curve+c );
+#endif
+        if( found )
+        {
+            if( ctrl.progress )
+                Output
+                ("Found factor ",factor," with sigma=",factorSigma," after ",
+                 curve+numCurves," curves");
+            return factor;
+        }
+    }
+    RuntimeError("No factor found after ",ctrl.maxCurves," curves");
+    return n;
+}
+
+template<typename TSieve,typename TSieveSmall>
+BigInt FindFactor
+( const BigInt& n,
+  const ECMCtrl<TSieve>& ctrl )
+{
+    DynamicSieve<TSieve,TSieveSmall> sieve;
+    return FindFactor( n, sieve, ctrl );
+}
+
+} // namespace ecm
+
+template<typename TSieve,typename TSieveSmall>
+vector<BigInt> ECM
+( const BigInt& n,
+        DynamicSieve<TSieve,TSieveSmall>& sieve,
+  const ECMCtrl<TSieve>& ctrl )
+{
+    vector<BigInt> factors;
+    BigInt nRem = n;
+
+    if( !ctrl.avoidTrialDiv )
+    {
+        // Start with trial division
+        auto tinyFactors = TrialDivision( n, ctrl.trialDivLimit );
+        for( auto tinyFactor : tinyFactors )
+        {
+            factors.push_back( tinyFactor );
+            nRem /= tinyFactor;
+            if( ctrl.progress )
+                Output("Removed tiny factor of ",tinyFactor);
+        }
+    }
+    if( nRem <= BigInt(1) )
+        return factors;
+
+    Timer timer;
+    PushIndent();
+    while( true )
+    {
+        // Try Miller-Rabin first
+        if( ctrl.time )
+            timer.Start();
+        Primality primality = PrimalityTest( nRem, ctrl.numReps );
+        if( primality == PRIME )
+        {
+            if( ctrl.time )
+                Output(nRem," is prime (",timer.Stop()," seconds)");
+            else if( ctrl.progress )
+                Output(nRem," is prime");
+            factors.push_back( nRem );
+            break;
+        }
+        else if( primality == PROBABLY_PRIME )
+        {
+            if( ctrl.time )
+                Output(nRem," is probably prime (",timer.Stop()," seconds)");
+            else if( ctrl.progress )
+                Output(nRem," is probably prime");
+            factors.push_back( nRem );
+            break;
+        }
+        else
+        {
+            if( ctrl.time )
+                Output(nRem," is composite (",timer.Stop()," seconds)");
+            else if( ctrl.progress )
+                Output(nRem," is composite");
+        }
+
+        if( ctrl.progress )
+            Output("Attempting to factor ",nRem);
+        if( ctrl.time )
+            timer.Start();
+        PushIndent();
+        BigInt factor = ecm::FindFactor( nRem, sieve, ctrl );
+        PopIndent();
+        if( ctrl.time )
+            Output("ECM: ",timer.Stop()," seconds");
+
+        // The factor might be composite, so attempt to factor it
+        PushIndent();
+        auto subfactors = ECM( factor, sieve, ctrl );
+        PopIndent();
+        for( const auto& subfactor : subfactors )
+            factors.push_back( subfactor );
+        nRem /= factor;
+    }
+    PopIndent();
+    sort( factors.begin(), factors.end() );
+    return factors;
+}
+
+template<typename TSieve,typename TSieveSmall>
+vector<BigInt> ECM
+( const BigInt& n,
+  const ECMCtrl<TSieve>& ctrl )
+{
+    DynamicSieve<TSieve,TSieveSmall> sieve;
+    return ECM( n, sieve, ctrl );
+}
+
+} // namespace factor
+
+} // namespace El
+
+#endif // ifdef EL_HAVE_MPC
+
+#endif // ifndef EL_NUMBER_THEORY_FACTOR_ECM_HPP
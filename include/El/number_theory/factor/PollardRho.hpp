@@ -18,12 +18,19 @@ namespace factor {
 namespace pollard_rho {
 
 // TODO: Add the ability to set a maximum number of iterations
+inline BigInt BrentFindFactor
+( const BigInt& n,
+  Int a,
+  const PollardRhoCtrl& ctrl );
+
 inline BigInt FindFactor
 ( const BigInt& n,
   Int a,
   const PollardRhoCtrl& ctrl )
 {
     const BigInt& one = BigIntOne();
+    if( ctrl.brent )
+        return BrentFindFactor( n, a, ctrl );
 
     if( a == 0 || a == -2 )
         Output("WARNING: Problematic choice of Pollard rho shift");
@@ -112,6 +119,100 @@ inline BigInt FindFactor
     }
 }
 
+// Brent's variant, which replaces Floyd's cycle detection with comparisons
+// of x_i against the saved iterates x_{2^k - 1} and so requires only one
+// evaluation of the iteration function per step (rather than three). The
+// differences are accumulated into a product modulo n, and the GCD is only
+// formed every ctrl.gcdDelay steps; should the GCD be n, the last batch is
+// replayed one step at a time. See
+//
+//   Richard P. Brent, "An improved Monte Carlo factorization algorithm",
+//   BIT Numerical Mathematics, 20(2), pp. 176--184, 1980.
+//
+inline BigInt BrentFindFactor
+( const BigInt& n,
+  Int a,
+  const PollardRhoCtrl& ctrl )
+{
+    const BigInt& one = BigIntOne();
+
+    if( a == 0 || a == -2 )
+        Output("WARNING: Problematic choice of Pollard rho shift");
+    const Int gcdDelay = Max( ctrl.gcdDelay, Int(1) );
+
+    auto xAdvance =
+      [&]( BigInt& x )
+      {
+        if( ctrl.numSteps == 1 )
+        {
+            x *= x;
+            x += a;
+            x %= n;
+        }
+        else
+        {
+            PowMod( x, 2*ctrl.numSteps, n, x );
+            x += a;
+            x %= n;
+        }
+      };
+
+    // y runs ahead of the saved iterate x by between r and 2r steps
+    BigInt x, y=ctrl.x0, ySave, Q(1), tmp, gcd(1);
+    Int r=1, i=0;
+    while( gcd == one )
+    {
+        x = y;
+        for( Int j=0; j<r; ++j )
+            xAdvance( y );
+        i += r;
+
+        for( Int k=0; k<r && gcd == one; k+=gcdDelay )
+        {
+            ySave = y;
+            const Int batchSize = Min( gcdDelay, r-k );
+            for( Int j=0; j<batchSize; ++j )
+            {
+                xAdvance( y );
+                tmp = x;
+                tmp -= y;
+                Q *= tmp;
+                Q %= n;
+            }
+            i += batchSize;
+            GCD( Q, n, gcd );
+        }
+        r *= 2;
+    }
+
+    if( gcd == n )
+    {
+        // Replay the last batch one step at a time
+        if( ctrl.progress )
+            Output("Backtracking at i=",i);
+        do
+        {
+            xAdvance( ySave );
+            tmp = x;
+            tmp -= ySave;
+            GCD( tmp, n, gcd );
+        } while( gcd == one );
+        if( gcd == n )
+        {
+            // Floyd's cycle detection visits different pairs of iterates
+            // and may still succeed with the same shift
+            if( ctrl.progress )
+                Output("Falling back to Floyd's cycle detection at i=",i);
+            PollardRhoCtrl floydCtrl( ctrl );
+            floydCtrl.brent = false;
+            return FindFactor( n, a, floydCtrl );
+        }
+    }
+    if( ctrl.progress )
+        Output("Found factor ",gcd," at i=",i);
+    return gcd;
+}
+
 } // namespace pollard_rho
 
 inline vector<BigInt> PollardRho
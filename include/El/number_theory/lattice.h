@@ -28,6 +28,8 @@ typedef struct
     ElInt numSwaps;
     ElInt firstSwap;
     float logVol;
+    double segmentTime;
+    double mergeTime;
 } ElLLLInfo_s;
 
 typedef struct
@@ -39,13 +41,16 @@ typedef struct
     ElInt numSwaps;
     ElInt firstSwap;
     double logVol;
+    double segmentTime;
+    double mergeTime;
 } ElLLLInfo_d;
 
 typedef enum {
   EL_LLL_WEAK,
   EL_LLL_NORMAL,
   EL_LLL_DEEP,
-  EL_LLL_DEEP_REDUCE
+  EL_LLL_DEEP_REDUCE,
+  EL_LLL_SEGMENTED
 } ElLLLVariant;
 
 typedef struct
@@ -55,6 +60,7 @@ typedef struct
     ElLLLVariant variant;
     bool recursive;
     ElInt cutoff;
+    ElInt segmentSize;
     float precisionFudge;
     ElInt minColThresh;
     bool unsafeSizeReduct;
@@ -78,6 +84,7 @@ typedef struct
     ElLLLVariant variant;
     bool recursive;
     ElInt cutoff;
+    ElInt segmentSize;
     double precisionFudge;
     ElInt minColThresh;
     bool unsafeSizeReduct;
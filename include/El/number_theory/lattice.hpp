@@ -148,6 +148,69 @@ void NearestPlane
         Matrix<F>& X,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+struct CVPCtrl
+{
+    // The number of targets in each batch; the batches are spread over the
+    // OpenMP threads (if 'parallel' is true). A nonpositive value places all
+    // of the targets in a single batch.
+    Int batchSize=64;
+
+    // The number of coordinates which are rounded (one target at a time)
+    // between the matrix-matrix updates of the remaining coordinates
+    Int blocksize=32;
+
+    bool parallel=true;
+
+    // If positive, search for a lattice vector strictly closer than each
+    // Babai point with a Schnorr-Euchner enumeration of at most this many
+    // nodes (only real fields are supported)
+    Int maxEnumNodes=0;
+
+    bool progress=false;
+    bool time=false;
+};
+
+// Solve closest vector problems for many targets against a single lattice by
+// LLL-reducing its basis once and caching the QR factorization of the
+// reduced basis
+template<typename F>
+class ClosestVectorSolver
+{
+public:
+    ClosestVectorSolver
+    ( const Matrix<F>& B,
+      const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+    // For a basis which has already been reduced
+    ClosestVectorSolver
+    ( const Matrix<F>& BRed,
+      const Matrix<F>& QR,
+      const Matrix<F>& t,
+      const Matrix<Base<F>>& d );
+
+    Int Rank() const { return B_.Width(); }
+    const Matrix<F>& ReducedBasis() const { return B_; }
+
+    // Fill the columns of Y with the Babai points of the columns of T (which
+    // are refined if ctrl.maxEnumNodes > 0) and the columns of X with their
+    // coordinates with respect to the reduced basis, i.e., Y = BRed X.
+    //
+    // The number of Babai points improved by the enumeration is returned.
+    Int Solve
+    ( const Matrix<F>& T,
+            Matrix<F>& Y,
+            Matrix<F>& X,
+      const CVPCtrl& ctrl=CVPCtrl() ) const;
+    Int Solve
+    ( const Matrix<F>& T,
+            Matrix<F>& Y,
+      const CVPCtrl& ctrl=CVPCtrl() ) const;
+
+private:
+    Matrix<F> B_, QR_, t_;
+    Matrix<Base<F>> d_;
+};
+
 } // namespace El
 
 #include <El/number_theory/lattice/NearestPlane.hpp>
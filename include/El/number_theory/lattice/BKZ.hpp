@@ -72,6 +72,16 @@ struct BKZCtrl
 
     EnumCtrl<Real> enumCtrl;
 
+    // BKZ only requires the shortest vector of each block, so, unlike
+    // ShortVectorEnumeration, it defaults to searching the subtrees of blocks
+    // of at least 'enumCtrl.parallelMinDim' vectors in parallel over the
+    // threads (and the processes of 'enumCtrl.comm'). It also defaults to
+    // optimizing the pruning profile of each GNR_ENUM block for its
+    // Gram-Schmidt norms, as in BKZ 2.0. Each of these overrides the
+    // corresponding member of 'enumCtrl'.
+    bool parallelEnum=true;
+    bool optimizePruning=true;
+
     // Rather than running LLL after a productive enumeration, one could run
     // BKZ with a smaller blocksize (perhaps with early abort)
     bool subBKZ=true;
@@ -132,6 +142,8 @@ struct BKZCtrl
         startCol = ctrl.startCol;
 
         enumCtrl = ctrl.enumCtrl;
+        parallelEnum = ctrl.parallelEnum;
+        optimizePruning = ctrl.optimizePruning;
 
         subBKZ = ctrl.subBKZ;
         subBlocksizeFunc = ctrl.subBlocksizeFunc;
@@ -554,6 +566,8 @@ BKZInfo<Base<F>> BKZWithQ
 
     auto enumCtrl = ctrl.enumCtrl;
     enumCtrl.disablePrecDrop = true;
+    enumCtrl.parallel = ctrl.parallelEnum;
+    enumCtrl.optimizePruning = ctrl.optimizePruning;
 
     Int z=0;
     Int j = ( ctrl.jumpstart ? ctrl.startCol : 0 ) - 1;
@@ -916,6 +930,8 @@ BKZInfo<Base<F>> BKZWithQ
 
     auto enumCtrl = ctrl.enumCtrl;
     enumCtrl.disablePrecDrop = true;
+    enumCtrl.parallel = ctrl.parallelEnum;
+    enumCtrl.optimizePruning = ctrl.optimizePruning;
 
     Int z=0;
     Int j = ( ctrl.jumpstart ? ctrl.startCol : 0 ) - 1;
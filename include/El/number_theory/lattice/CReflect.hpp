@@ -28,6 +28,8 @@ inline LLLInfo<float> CReflect( const ElLLLInfo_s& infoC )
     info.numSwaps = infoC.numSwaps;
     info.firstSwap = infoC.firstSwap;
     info.logVol = infoC.logVol;
+    info.segmentTime = infoC.segmentTime;
+    info.mergeTime = infoC.mergeTime;
     return info;
 }
 
@@ -41,6 +43,8 @@ inline LLLInfo<double> CReflect( const ElLLLInfo_d& infoC )
     info.numSwaps = infoC.numSwaps;
     info.firstSwap = infoC.firstSwap;
     info.logVol = infoC.logVol;
+    info.segmentTime = infoC.segmentTime;
+    info.mergeTime = infoC.mergeTime;
     return info;
 }
 
@@ -54,6 +58,8 @@ inline ElLLLInfo_s CReflect( const LLLInfo<float>& info )
     infoC.numSwaps = info.numSwaps;
     infoC.firstSwap = info.firstSwap;
     infoC.logVol = info.logVol;
+    infoC.segmentTime = info.segmentTime;
+    infoC.mergeTime = info.mergeTime;
     return infoC;
 }
 
@@ -67,6 +73,8 @@ inline ElLLLInfo_d CReflect( const LLLInfo<double>& info )
     infoC.numSwaps = info.numSwaps;
     infoC.firstSwap = info.firstSwap;
     infoC.logVol = info.logVol;
+    infoC.segmentTime = info.segmentTime;
+    infoC.mergeTime = info.mergeTime;
     return infoC;
 }
 
@@ -78,6 +86,7 @@ inline LLLCtrl<float> CReflect( const ElLLLCtrl_s& ctrlC )
     ctrl.variant = CReflect(ctrlC.variant);
     ctrl.recursive = ctrlC.recursive;
     ctrl.cutoff = ctrlC.cutoff;
+    ctrl.segmentSize = ctrlC.segmentSize;
     ctrl.presort = ctrlC.presort;
     ctrl.smallestFirst = ctrlC.smallestFirst;
     ctrl.reorthogTol = ctrlC.reorthogTol;
@@ -99,6 +108,7 @@ inline LLLCtrl<double> CReflect( const ElLLLCtrl_d& ctrlC )
     ctrl.variant = CReflect(ctrlC.variant);
     ctrl.recursive = ctrlC.recursive;
     ctrl.cutoff = ctrlC.cutoff;
+    ctrl.segmentSize = ctrlC.segmentSize;
     ctrl.presort = ctrlC.presort;
     ctrl.smallestFirst = ctrlC.smallestFirst;
     ctrl.reorthogTol = ctrlC.reorthogTol;
@@ -120,6 +130,7 @@ inline ElLLLCtrl_s CReflect( const LLLCtrl<float>& ctrl )
     ctrlC.variant = CReflect(ctrl.variant);
     ctrlC.recursive = ctrl.recursive;
     ctrlC.cutoff = ctrl.cutoff;
+    ctrlC.segmentSize = ctrl.segmentSize;
     ctrlC.presort = ctrl.presort;
     ctrlC.smallestFirst = ctrl.smallestFirst;
     ctrlC.reorthogTol = ctrl.reorthogTol;
@@ -141,6 +152,7 @@ inline ElLLLCtrl_d CReflect( const LLLCtrl<double>& ctrl )
     ctrlC.variant = CReflect(ctrl.variant);
     ctrlC.recursive = ctrl.recursive;
     ctrlC.cutoff = ctrl.cutoff;
+    ctrlC.segmentSize = ctrl.segmentSize;
     ctrlC.presort = ctrl.presort;
     ctrlC.smallestFirst = ctrl.smallestFirst;
     ctrlC.reorthogTol = ctrl.reorthogTol;
@@ -14,7 +14,8 @@ namespace El {
 enum EnumType {
   FULL_ENUM,
   GNR_ENUM,
-  YSPARSE_ENUM
+  YSPARSE_ENUM,
+  SIEVE_ENUM
 };
 
 template<typename Real>
@@ -40,6 +41,27 @@ struct EnumCtrl
     bool linearBounding=false;
     Int numTrials=1000;
 
+    // Rather than interpolating a fixed pruning profile, optimize the profile
+    // for the Gram-Schmidt norms of each block (as in BKZ 2.0) so as to
+    // minimize the expected number of nodes, plus 'preprocessCost' nodes for
+    // each randomized trial (a negative value selects n^3), needed to find a
+    // vector. Only as many trials are then run as are needed to succeed with
+    // probability 'targetSuccessProb'. The optimized profiles are cached per
+    // dimension, both in memory and, if it is nonempty, in 'pruningCacheDir',
+    // and are used to initialize subsequent optimizations. (Only the root
+    // process writes profiles which were in neither cache.) Since the
+    // optimization is not free, it must be explicitly requested (though BKZ
+    // requests it by default; see BKZCtrl::optimizePruning).
+    bool optimizePruning=false;
+    double targetSuccessProb=0.9;
+    double preprocessCost=-1;
+    std::string pruningCacheDir="";
+
+    // The blocksize of the BKZ applied to each randomized basis. Larger
+    // blocksizes are themselves enumerated with (recursively) optimized
+    // pruning.
+    Int preprocessBlocksize=10;
+
     // YSPARSE_ENUM
     // ------------
     Int phaseLength=10;
@@ -60,8 +82,43 @@ struct EnumCtrl
     bool customMaxOneNorms=false;
     vector<Int> maxOneNorms;
 
+    // SIEVE_ENUM
+    // ----------
+    // The Gauss sieve stops once the number of samples which reduced to zero
+    // exceeds 'sieveCollisionRatio' times the list size plus
+    // 'sieveMinCollisions', or once the list (whose memory usage is roughly
+    // proportional to its size times the dimension) reaches
+    // 'sieveMaxListSize'. The list is bucketed using 'sieveNumHashTables'
+    // hash tables, each with 2^'sieveHashLength' buckets; negative values
+    // select the defaults of Laarhoven's HashSieve (which only hashes in
+    // dimensions of at least 30).
+    double sieveCollisionRatio=0.1;
+    Int sieveMinCollisions=200;
+    Int sieveMaxListSize=1000000;
+    Int sieveNumHashTables=-1;
+    Int sieveHashLength=-1;
+
     Int progressLevel=0;
 
+    // Parallel enumeration
+    // --------------------
+    // FULL_ENUM and GNR_ENUM searches over at least 'parallelMinDim'
+    // dimensions are split into the subtrees rooted at the shallowest depth
+    // with at least 'jobsPerWorker' subtrees per worker. These are then
+    // spread over the OpenMP threads (with work stealing) and the processes
+    // of 'comm', and the radius of the shortest vector found so far is shared
+    // so that every subtree is pruned with it. The parallel search therefore
+    // returns the shortest vector satisfying the bounds rather than the first
+    // one found. Every process in 'comm' must call with the same input, and
+    // the probabilistic trials of GNR_ENUM only make use of the threads.
+    // Since it changes the semantics of ShortVectorEnumeration, the parallel
+    // search must be explicitly requested (though BKZ requests it by
+    // default; see BKZCtrl::parallelEnum).
+    bool parallel=false;
+    Int parallelMinDim=30;
+    Int jobsPerWorker=8;
+    mpi::Comm comm=mpi::COMM_SELF;
+
     template<typename OtherReal>
     EnumCtrl<Real>& operator=( const EnumCtrl<OtherReal>& ctrl )
     {
@@ -77,6 +134,11 @@ struct EnumCtrl
         // --------
         linearBounding = ctrl.linearBounding;
         numTrials = ctrl.numTrials;
+        optimizePruning = ctrl.optimizePruning;
+        targetSuccessProb = ctrl.targetSuccessProb;
+        preprocessCost = ctrl.preprocessCost;
+        pruningCacheDir = ctrl.pruningCacheDir;
+        preprocessBlocksize = ctrl.preprocessBlocksize;
 
         // YSPARSE_ENUM
         // ------------
@@ -95,8 +157,21 @@ struct EnumCtrl
         customMaxOneNorms = ctrl.customMaxOneNorms;
         maxOneNorms = ctrl.maxOneNorms;
 
+        // SIEVE_ENUM
+        // ----------
+        sieveCollisionRatio = ctrl.sieveCollisionRatio;
+        sieveMinCollisions = ctrl.sieveMinCollisions;
+        sieveMaxListSize = ctrl.sieveMaxListSize;
+        sieveNumHashTables = ctrl.sieveNumHashTables;
+        sieveHashLength = ctrl.sieveHashLength;
+
         progressLevel = ctrl.progressLevel;
 
+        parallel = ctrl.parallel;
+        parallelMinDim = ctrl.parallelMinDim;
+        jobsPerWorker = ctrl.jobsPerWorker;
+        comm = ctrl.comm;
+
         return *this;
     }
 
@@ -386,6 +461,55 @@ Base<F> GNREnumeration
         Matrix<F>& v,
   const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
 
+// Whether the above enumeration should be split into subtrees which are
+// searched in parallel (see EnumCtrl)
+template<typename Real>
+bool UseParallelEnumeration( Int n, const EnumCtrl<Real>& ctrl )
+{
+    if( !ctrl.parallel || n < Max(ctrl.parallelMinDim,Int(2)) )
+        return false;
+    if( mpi::Size(ctrl.comm) > 1 )
+        return true;
+#ifdef EL_HYBRID
+    return omp_get_max_threads() > 1;
+#else
+    return false;
+#endif
+}
+
+// Search the subtrees of the enumeration tree in parallel for the shortest
+// vector satisfying the bounds (with the same conventions as GNREnumeration,
+// which calls this routine when UseParallelEnumeration is true)
+template<typename F>
+Base<F> ParallelEnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& u,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
+
+// Optimize the pruned upper bounds of an enumeration with the given radius
+// over a lattice with the given Gram-Schmidt norms (see EnumCtrl), returning
+// the estimated probability of success of each trial in 'successProb'
+template<typename Real>
+Matrix<Real> OptimizedPruning
+( const Matrix<Real>& gsNorms,
+        Real normUpperBound,
+        Real& successProb,
+  const EnumCtrl<Real>& ctrl=EnumCtrl<Real>() );
+
+// Heuristically search for the shortest nonzero member of the lattice spanned
+// by the columns of the upper-triangular matrix R using a Gauss sieve. If its
+// norm is less than 'normUpperBound', its coordinates are returned in 'v'
+// along with the norm, otherwise a value greater than 'normUpperBound' is
+// returned.
+template<typename F>
+Base<F> GaussSieve
+( const Matrix<F>& R,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
+
 // Convert to/from the so-called "y-sparse" representation of
 //
 //   Dan Ding, Guizhen Zhu, Yang Yu, and Zhongxiang Zheng,
@@ -110,6 +110,11 @@ struct LLLInfo
     Int firstSwap;
     Real logVol;
 
+    // The wall-clock seconds spent concurrently reducing (and merging) the
+    // segments and in the final outer pass of LLL_SEGMENTED
+    double segmentTime=0;
+    double mergeTime=0;
+
     template<typename OtherReal>
     LLLInfo<Real>& operator=( const LLLInfo<OtherReal>& info )
     {
@@ -120,6 +125,8 @@ struct LLLInfo
         numSwaps = info.numSwaps;
         firstSwap = info.firstSwap;
         logVol = Real(info.logVol);
+        segmentTime = info.segmentTime;
+        mergeTime = info.mergeTime;
         return *this;
     }
 
@@ -156,7 +163,11 @@ enum LLLVariant {
   // checking each deep insertion condition. See Schnorr's article
   // "Progress on LLL and Lattice Reduction" in the book "The LLL Algorithm",
   // edited by Nguyen and Vallee.
-  LLL_DEEP_REDUCE
+  LLL_DEEP_REDUCE,
+  // Independently (and, with OpenMP, concurrently) reduce contiguous
+  // segments of columns before merging adjacent segments and finishing with
+  // an outer pass of normal LLL over the entire basis.
+  LLL_SEGMENTED
 };
 
 template<typename Real>
@@ -169,6 +180,9 @@ struct LLLCtrl
     bool recursive=false;
     Int cutoff=10;
 
+    // The number of columns in each of the initial segments of LLL_SEGMENTED
+    Int segmentSize=64;
+
     // Fudge factor for determining whether to drop precision
     Real precisionFudge=Real(2);
 
@@ -198,6 +212,13 @@ struct LLLCtrl
     // following percentage of reductions were non-trivial
     float blockingThresh = 0.5f;
 
+    // Reduce (normal or weak) integer bases whose entries fit in 53 bits with
+    // an L^2-style algorithm which keeps the basis in 64-bit integers and
+    // only raises the precision of the Gram-Schmidt coefficients when a
+    // stability check fails. As in said algorithm, the size reduction is only
+    // with respect to Max(eta,0.51).
+    bool integerFastPath=true;
+
     bool progress=false;
     bool time=false;
 
@@ -225,6 +246,7 @@ struct LLLCtrl
         variant = ctrl.variant;
         recursive = ctrl.recursive;
         cutoff = ctrl.cutoff;
+        segmentSize = ctrl.segmentSize;
         presort = ctrl.presort;
         smallestFirst = ctrl.smallestFirst;
         reorthogTol = Real(ctrl.reorthogTol);
@@ -235,6 +257,7 @@ struct LLLCtrl
         if( zeroTol < zeroTolMin )
             zeroTol = zeroTolMin;
         blockingThresh = ctrl.blockingThresh;
+        integerFastPath = ctrl.integerFastPath;
         progress = ctrl.progress;
         time = ctrl.time;
         jumpstart = ctrl.jumpstart;
@@ -258,12 +281,14 @@ struct LLLCtrl
         variant = ctrl.variant;
         recursive = ctrl.recursive;
         cutoff = ctrl.cutoff;
+        segmentSize = ctrl.segmentSize;
         presort = ctrl.presort;
         smallestFirst = ctrl.smallestFirst;
         reorthogTol = Real(ctrl.reorthogTol);
         numOrthog = ctrl.numOrthog;
         zeroTol = Max(zeroTolMin,Real(ctrl.zeroTol));
         blockingThresh = ctrl.blockingThresh;
+        integerFastPath = ctrl.integerFastPath;
         progress = ctrl.progress;
         time = ctrl.time;
         jumpstart = ctrl.jumpstart;
@@ -423,6 +448,8 @@ Base<F> LogVolume( const Matrix<F>& R )
 } // namespace El
 
 #include <El/number_theory/lattice/LLL/Left.hpp>
+#include <El/number_theory/lattice/LLL/L2.hpp>
+#include <El/number_theory/lattice/LLL/Segmented.hpp>
 
 namespace El {
 
@@ -485,6 +512,10 @@ LLLInfo<Base<F>> LLLWithQ
         info = lll::LeftDeepReduceAlg( B, U, QR, t, d, formU, ctrl );
     else if( ctrl.variant == LLL_DEEP )
         return lll::LeftDeepAlg( B, U, QR, t, d, formU, ctrl );
+    else if( ctrl.variant == LLL_SEGMENTED )
+        info = lll::SegmentedAlg( B, U, QR, t, d, formU, ctrl );
+    else if( lll::UseL2( B, ctrl ) )
+        info = lll::L2Alg( B, U, QR, t, d, formU, ctrl );
     else
         info = lll::LeftAlg( B, U, QR, t, d, formU, ctrl );
 
@@ -594,6 +625,14 @@ LLLWithQ
         infoDeep.firstSwap = firstSwap;
         return infoDeep;
     }
+    else if( ctrl.variant == LLL_SEGMENTED )
+    {
+        auto info = lll::SegmentedAlg( B, U, QR, t, d, formU, ctrl );
+        info.firstSwap = Min(info.firstSwap,firstSwap);
+        return info;
+    }
+    else if( lll::UseL2( B, ctrl ) )
+        return lll::L2Alg( B, U, QR, t, d, formU, ctrl );
     else
         return lll::LeftAlg( B, U, QR, t, d, formU, ctrl );
 }
@@ -0,0 +1,407 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_L2_HPP
+#define EL_LATTICE_LLL_L2_HPP
+
+// A floating-point LLL in the spirit of the L^2 algorithm of
+//
+//   Phong Q. Nguyen and Damien Stehle, "An LLL algorithm with quadratic
+//   complexity", SIAM Journal on Computing, Vol. 39, No. 3, 2009.
+//
+// The basis (and the unimodular transformation) are kept exactly as 64-bit
+// integers, while the Cholesky-style Gram-Schmidt coefficients
+//
+//   r(i,j) = <b_i,b*_j>,  mu(i,j) = r(i,j) / r(j,j),
+//
+// are lazily recomputed in floating-point. The computation starts in double
+// precision and only moves to a higher precision (DoubleDouble, then
+// QuadDouble or Quad) when a size reduction fails to converge within a small
+// number of sweeps or a nonzero vector has a non-positive squared
+// Gram-Schmidt norm. If an integer update could overflow, or if every
+// precision has been exhausted, the partially reduced basis is handed to the
+// Householder-based LLL.
+
+namespace El {
+namespace lll {
+
+enum L2Status {
+  L2_SUCCESS,
+  L2_UNSTABLE,
+  L2_OVERFLOW
+};
+
+namespace l2 {
+
+// Integer updates are only performed if their results are guaranteed to be
+// bounded in magnitude by 2^62
+const double overflowBound = 4611686018427387904.;
+
+// Bases are only converted if their entries are exactly representable in
+// double-precision
+const double entryBound = 4503599627370496.;
+
+const double splitFactor = 4294967296.;
+
+// Since the Gram-Schmidt coefficients are only approximate, the size
+// reduction only enforces |mu(k,j)| <= Max(eta,relaxedEta); insisting upon an
+// eta arbitrarily close to 1/2 would cause the rounding of the coefficients
+// to oscillate until the precision is needlessly escalated
+const double relaxedEta = 0.51;
+
+// Convert a 64-bit integer into Real by splitting it into two halves which
+// are each exactly representable in double-precision
+template<typename Real>
+Real ToReal( long long alpha )
+{
+    const long long lower = alpha & 0xFFFFFFFFLL;
+    const long long upper = (alpha-lower) / 4294967296LL;
+    return Real(double(upper))*Real(splitFactor) + Real(double(lower));
+}
+
+// Convert an integer-valued Real (of magnitude less than 2^62) into a 64-bit
+// integer
+template<typename Real>
+long long ToInteger( const Real& alpha )
+{
+    long long result = static_cast<long long>(double(alpha));
+    const Real residual = alpha - ToReal<Real>(result);
+    result += static_cast<long long>(double(residual));
+    return result;
+}
+
+struct State
+{
+    Int m=0, n=0;
+
+    // The number of leading columns which have not been found to be zero
+    Int rank=0;
+
+    // The columns before 'k' are LLL-reduced
+    Int k=0;
+
+    Int numSwaps=0;
+    Int firstSwap=0;
+
+    bool formU=false;
+
+    // Column-major copies of the m x n basis and n x n transformation
+    vector<long long> B, U;
+
+    // Upper bounds on the absolute values of the entries of each column
+    vector<double> BMax, UMax;
+};
+
+inline double ColumnMax( const long long* x, Int height )
+{
+    double maxAbs = 0;
+    for( Int i=0; i<height; ++i )
+        maxAbs = Max( maxAbs, double(std::llabs(x[i])) );
+    return maxAbs;
+}
+
+inline bool CanAxpy( long long chi, double xMax, double yMax )
+{ return std::fabs(double(chi))*xMax + yMax < overflowBound; }
+
+inline void IntegerAxpy
+( long long chi, const long long* x, long long* y, Int height )
+{
+    for( Int i=0; i<height; ++i )
+        y[i] -= chi*x[i];
+}
+
+inline void SwapColumns( State& state, Int j0, Int j1 )
+{
+    const Int m = state.m;
+    const Int n = state.n;
+    std::swap_ranges
+    ( &state.B[j0*m], &state.B[j0*m]+m, &state.B[j1*m] );
+    std::swap( state.BMax[j0], state.BMax[j1] );
+    if( state.formU )
+    {
+        std::swap_ranges
+        ( &state.U[j0*n], &state.U[j0*n]+n, &state.U[j1*n] );
+        std::swap( state.UMax[j0], state.UMax[j1] );
+    }
+}
+
+// Continue reducing the basis from column 'state.k' with the Gram-Schmidt
+// coefficients computed in the precision 'Real'
+template<typename Real>
+L2Status Run( State& state, const LLLCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = state.m;
+    const Int n = state.n;
+    const bool weak = ( ctrl.variant == LLL_WEAK );
+    const Int maxSizeReductions = 20;
+    const Real eta = Max( ctrl.eta, Real(relaxedEta) );
+
+    vector<Real> BFloat(m*n), r(n*n), mu(n*n);
+    auto updateFloat = [&]( Int j )
+      {
+          for( Int i=0; i<m; ++i )
+              BFloat[i+j*m] = ToReal<Real>( state.B[i+j*m] );
+      };
+    auto dot = [&]( Int i, Int j )
+      {
+          const Real* bi = &BFloat[i*m];
+          const Real* bj = &BFloat[j*m];
+          Real sum = 0;
+          for( Int l=0; l<m; ++l )
+              sum += bi[l]*bj[l];
+          return sum;
+      };
+    // Form the i'th rows of r and mu from those of the previous columns
+    auto computeRow = [&]( Int i )
+      {
+          for( Int j=0; j<i; ++j )
+          {
+              Real rho = dot( i, j );
+              for( Int l=0; l<j; ++l )
+                  rho -= mu[j+l*n]*r[i+l*n];
+              r[i+j*n] = rho;
+              mu[i+j*n] = rho / r[j+j*n];
+          }
+          Real rho = dot( i, i );
+          for( Int l=0; l<i; ++l )
+              rho -= mu[i+l*n]*r[i+l*n];
+          r[i+i*n] = rho;
+      };
+
+    for( Int j=0; j<state.rank; ++j )
+        updateFloat( j );
+    for( Int i=0; i<state.k; ++i )
+    {
+        computeRow( i );
+        if( r[i+i*n] <= Real(0) )
+            return L2_UNSTABLE;
+    }
+
+    while( state.k < state.rank )
+    {
+        const Int k = state.k;
+        const Int jBeg = ( weak ? Max(k-1,Int(0)) : Int(0) );
+
+        // Size reduce b_k until its Gram-Schmidt coefficients stabilize
+        for( Int iter=0; ; ++iter )
+        {
+            computeRow( k );
+            bool reduced = true;
+            for( Int j=jBeg; j<k; ++j )
+                if( Abs(mu[k+j*n]) > eta )
+                    reduced = false;
+            if( reduced )
+                break;
+            if( iter == maxSizeReductions )
+                return L2_UNSTABLE;
+
+            for( Int j=k-1; j>=jBeg; --j )
+            {
+                const Real chi = Round( mu[k+j*n] );
+                if( chi == Real(0) )
+                    continue;
+                if( Abs(chi) >= Real(overflowBound) )
+                    return L2_OVERFLOW;
+                const long long chiInt = ToInteger( chi );
+                if( !CanAxpy( chiInt, state.BMax[j], state.BMax[k] ) ||
+                    (state.formU &&
+                     !CanAxpy( chiInt, state.UMax[j], state.UMax[k] )) )
+                    return L2_OVERFLOW;
+
+                IntegerAxpy( chiInt, &state.B[j*m], &state.B[k*m], m );
+                state.BMax[k] = ColumnMax( &state.B[k*m], m );
+                if( state.formU )
+                {
+                    IntegerAxpy( chiInt, &state.U[j*n], &state.U[k*n], n );
+                    state.UMax[k] = ColumnMax( &state.U[k*n], n );
+                }
+                for( Int l=0; l<j; ++l )
+                    mu[k+l*n] -= chi*mu[j+l*n];
+                mu[k+j*n] -= chi;
+            }
+            updateFloat( k );
+        }
+
+        if( state.BMax[k] == 0. )
+        {
+            // Move the zero vector to the end of the active columns
+            SwapColumns( state, k, state.rank-1 );
+            --state.rank;
+            ++state.numSwaps;
+            state.firstSwap = Min(state.firstSwap,k);
+            if( k < state.rank )
+                updateFloat( k );
+            continue;
+        }
+
+        const Real rho_k_k = r[k+k*n];
+        if( rho_k_k <= Real(0) )
+            return L2_UNSTABLE;
+        if( k > 0 )
+        {
+            const Real rho_km1_km1 = r[(k-1)+(k-1)*n];
+            const Real mu_k_km1 = mu[k+(k-1)*n];
+            if( ctrl.delta*rho_km1_km1 >
+                rho_k_k + mu_k_km1*mu_k_km1*rho_km1_km1 )
+            {
+                SwapColumns( state, k-1, k );
+                updateFloat( k-1 );
+                updateFloat( k );
+                ++state.numSwaps;
+                state.firstSwap = Min(state.firstSwap,k-1);
+                state.k = k-1;
+                continue;
+            }
+        }
+        ++state.k;
+    }
+    return L2_SUCCESS;
+}
+
+template<typename Real,typename RealCtrl>
+L2Status Continue
+( State& state, L2Status status, const LLLCtrl<RealCtrl>& ctrl )
+{
+    if( status != L2_UNSTABLE )
+        return status;
+    if( ctrl.progress )
+        Output
+        ("Escalating L2 precision to ",TypeName<Real>()," at k=",state.k);
+    LLLCtrl<Real> ctrlReal( ctrl );
+    return Run( state, ctrlReal );
+}
+
+} // namespace l2
+
+// Only real integer bases whose entries are exactly representable in
+// double-precision are run through the floating-point algorithm
+template<typename Z,typename Real,typename=EnableIf<IsReal<Z>>>
+bool UseL2( const Matrix<Z>& B, const LLLCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.integerFastPath || ctrl.jumpstart || ctrl.presort )
+        return false;
+    if( ctrl.variant != LLL_NORMAL && ctrl.variant != LLL_WEAK )
+        return false;
+    if( B.Width() == 0 || B.Height() == 0 )
+        return false;
+    if( MaxNorm(B) >= Z(l2::entryBound) )
+        return false;
+    return IsInteger( B );
+}
+
+template<typename Z,typename Real,typename=DisableIf<IsReal<Z>>,
+         typename=void>
+bool UseL2( const Matrix<Z>& B, const LLLCtrl<Real>& ctrl )
+{ return false; }
+
+template<typename Z,typename F,typename=EnableIf<IsReal<Z>>>
+LLLInfo<Base<F>> L2Alg
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool formU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = B.Height();
+    const Int n = B.Width();
+
+    l2::State state;
+    state.m = m;
+    state.n = n;
+    state.rank = n;
+    state.firstSwap = n;
+    state.formU = formU;
+    state.B.resize( m*n );
+    state.BMax.resize( n );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+            state.B[i+j*m] = static_cast<long long>(double(B(i,j)));
+        state.BMax[j] = l2::ColumnMax( &state.B[j*m], m );
+    }
+    if( formU )
+    {
+        state.U.resize( n*n );
+        state.UMax.resize( n );
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=0; i<n; ++i )
+                state.U[i+j*n] = static_cast<long long>(double(U(i,j)));
+            state.UMax[j] = l2::ColumnMax( &state.U[j*n], n );
+        }
+    }
+
+    LLLCtrl<double> ctrlDouble( ctrl );
+    L2Status status = l2::Run( state, ctrlDouble );
+#ifdef EL_HAVE_QD
+    status = l2::Continue<DoubleDouble>( state, status, ctrl );
+    status = l2::Continue<QuadDouble>( state, status, ctrl );
+#elif defined(EL_HAVE_QUAD)
+    status = l2::Continue<Quad>( state, status, ctrl );
+#endif
+
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            B(i,j) = l2::ToReal<Z>( state.B[i+j*m] );
+    if( formU )
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                U(i,j) = l2::ToReal<Z>( state.U[i+j*n] );
+
+    if( status != L2_SUCCESS )
+    {
+        if( ctrl.progress )
+            Output
+            ("Falling back to Householder LLL at k=",state.k," due to ",
+             status == L2_OVERFLOW ? "potential integer overflow" :
+                                     "exhausting the available precisions");
+        auto info = LeftAlg( B, U, QR, t, d, formU, ctrl );
+        info.numSwaps += state.numSwaps;
+        info.firstSwap = Min(info.firstSwap,state.firstSwap);
+        return info;
+    }
+
+    Copy( B, QR );
+    El::QR( QR, t, d );
+
+    std::pair<Real,Real> achieved = lll::Achieved(QR,ctrl);
+    Real logVol = lll::LogVolume(QR);
+
+    LLLInfo<Base<F>> info;
+    info.delta = achieved.first;
+    info.eta = achieved.second;
+    info.rank = state.rank;
+    info.nullity = n-state.rank;
+    info.numSwaps = state.numSwaps;
+    info.firstSwap = state.firstSwap;
+    info.logVol = logVol;
+
+    return info;
+}
+
+template<typename Z,typename F,typename=DisableIf<IsReal<Z>>,typename=void>
+LLLInfo<Base<F>> L2Alg
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool formU,
+  const LLLCtrl<Base<F>>& ctrl )
+{ return LeftAlg( B, U, QR, t, d, formU, ctrl ); }
+
+} // namespace lll
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_L2_HPP
@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_SEGMENTED_HPP
+#define EL_LATTICE_LLL_SEGMENTED_HPP
+
+// A segmented variant of LLL in the spirit of the segment reduction of Koy
+// and Schnorr: the columns are split into contiguous segments of (at most)
+// 'ctrl.segmentSize' vectors, each segment is independently LLL-reduced
+// (concurrently, with one OpenMP thread per segment, in hybrid builds), and
+// then adjacent pairs of segments are repeatedly merged (again concurrently)
+// until a single outer LLL pass over the entire basis remains. Since each
+// merge starts from two reduced halves, the outer passes tend to require far
+// fewer swaps than reducing the original basis from left to right; this is a
+// parallel, bottom-up analogue of RecursiveLLL.
+
+namespace El {
+namespace lll {
+
+// LLL-reduce the columns [beg,end) of B as an independent lattice and, if
+// requested, apply the resulting transformation to the same columns of U
+template<typename Z,typename F>
+LLLInfo<Base<F>> ReduceSegment
+( Int beg,
+  Int end,
+  Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool formU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto BSeg = B( ALL, IR(beg,end) );
+    if( formU )
+    {
+        Matrix<Z> USeg;
+        auto info = LLLWithQ( BSeg, USeg, QR, t, d, ctrl );
+        auto UCols = U( ALL, IR(beg,end) );
+        Matrix<Z> UProd;
+        Gemm( NORMAL, NORMAL, Z(1), UCols, USeg, UProd );
+        UCols = UProd;
+        return info;
+    }
+    else
+        return LLLWithQ( BSeg, QR, t, d, ctrl );
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>> SegmentedAlg
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool formU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    const Int segmentSize = Max( ctrl.segmentSize, Int(2) );
+
+    // The segments (and the outer pass) are reduced with standard LLL
+    LLLCtrl<Real> ctrlOuter( ctrl );
+    ctrlOuter.variant = LLL_NORMAL;
+    ctrlOuter.recursive = false;
+    ctrlOuter.presort = false;
+    ctrlOuter.jumpstart = false;
+    ctrlOuter.startCol = 0;
+    // The LLL timers are shared and so cannot be used by concurrent segments
+    LLLCtrl<Real> ctrlSeg( ctrlOuter );
+    ctrlSeg.progress = false;
+    ctrlSeg.time = false;
+
+    Int numSwaps = 0;
+    Int firstSwap = n;
+    Timer timer;
+    double segmentTime = 0;
+    for( Int width=segmentSize; width<n; width*=2 )
+    {
+        timer.Start();
+        const Int numSegments = (n+width-1) / width;
+        vector<Int> segSwaps(numSegments,0), segFirstSwaps(numSegments,n);
+        auto reduce = [&]( Int s )
+          {
+              const Int beg = s*width;
+              const Int end = Min( beg+width, n );
+              Matrix<F> QRSeg, tSeg;
+              Matrix<Real> dSeg;
+              auto info =
+                ReduceSegment
+                ( beg, end, B, U, QRSeg, tSeg, dSeg, formU, ctrlSeg );
+              segSwaps[s] = info.numSwaps;
+              segFirstSwaps[s] = Min( beg+info.firstSwap, n );
+          };
+#ifdef EL_HYBRID
+        bool failed = false;
+        std::exception_ptr error;
+        #pragma omp parallel for schedule(dynamic)
+        for( Int s=0; s<numSegments; ++s )
+        {
+            try { reduce( s ); }
+            catch( ... )
+            {
+                #pragma omp critical(El_lll_SegmentedAlg)
+                {
+                    if( !failed )
+                    {
+                        failed = true;
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+        if( failed )
+            std::rethrow_exception( error );
+#else
+        for( Int s=0; s<numSegments; ++s )
+            reduce( s );
+#endif
+        for( Int s=0; s<numSegments; ++s )
+        {
+            numSwaps += segSwaps[s];
+            firstSwap = Min( firstSwap, segFirstSwaps[s] );
+        }
+        const double levelTime = timer.Stop();
+        segmentTime += levelTime;
+        if( ctrl.progress )
+            Output
+            ("Reduced ",numSegments," segments of width ",width," in ",
+             levelTime," seconds");
+    }
+
+    // Merge the segments with an outer pass over the entire basis
+    timer.Start();
+    LLLInfo<Real> info;
+    if( formU )
+    {
+        Matrix<Z> UOuter;
+        info = LLLWithQ( B, UOuter, QR, t, d, ctrlOuter );
+        Matrix<Z> UProd;
+        Gemm( NORMAL, NORMAL, Z(1), U, UOuter, UProd );
+        U = UProd;
+    }
+    else
+        info = LLLWithQ( B, QR, t, d, ctrlOuter );
+    const double mergeTime = timer.Stop();
+    if( ctrl.progress )
+        Output("Outer LLL pass took ",mergeTime," seconds");
+
+    info.numSwaps += numSwaps;
+    info.firstSwap = Min( info.firstSwap, firstSwap );
+    info.segmentTime = segmentTime;
+    info.mergeTime = mergeTime;
+    return info;
+}
+
+} // namespace lll
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_SEGMENTED_HPP
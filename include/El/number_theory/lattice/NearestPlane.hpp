@@ -11,7 +11,6 @@
 
 namespace El {
 
-// TODO: Add correctness tests for this routine
 template<typename F>
 void NearestPlane
 ( const Matrix<F>& B,
@@ -65,7 +64,7 @@ void NearestPlane
         {
             blas::Gemv
             ( 'N', m, n,
-              F(-1), B.Buffer(), B.LDim(),
+              F(-1), B.LockedBuffer(), B.LDim(),
                      &xBuf[0],   1,
               F(+1), yBuf,       1 );
         }
@@ -110,6 +109,271 @@ void NearestPlane
     NearestPlane( BRedLeft, QRLeft, tLeft, dLeft, T, Y, ctrl );
 }
 
+namespace cvp {
+
+// Search for integer coordinates x such that || R x - c ||_2 is strictly
+// smaller than for the given (Babai) coordinates, where R is upper-triangular,
+// using a depth-first Schnorr-Euchner enumeration which is abandoned after
+// 'maxNodes' nodes. The radius of the search is that of the best point found
+// so far, so that the result is never worse than the input.
+//
+// Return 'true' if x was improved.
+template<typename F,typename=EnableIf<IsReal<F>>>
+bool BoundedRefinement
+( const Matrix<F>& R, const F* c, F* x, Int maxNodes )
+{
+    EL_DEBUG_CSE
+    const Int n = R.Height();
+
+    F bestDist = 0;
+    for( Int k=0; k<n; ++k )
+    {
+        F residual = -c[k];
+        for( Int j=k; j<n; ++j )
+            residual += R(k,j)*x[j];
+        bestDist += residual*residual;
+    }
+
+    vector<F> xBest(x,x+n), xCand(n), center(n), dx(n), ddx(n), rho(n+1,F(0));
+    auto descend = [&]( Int k )
+      {
+          F sum = c[k];
+          for( Int j=k+1; j<n; ++j )
+              sum -= R(k,j)*xCand[j];
+          center[k] = sum / R(k,k);
+          xCand[k] = Round(center[k]);
+          dx[k] = ddx[k] = ( center[k] < xCand[k] ? F(-1) : F(1) );
+      };
+    // Step to the next closest integer to the center (in a zig-zag)
+    auto nextSibling = [&]( Int k )
+      {
+          xCand[k] += dx[k];
+          ddx[k] = -ddx[k];
+          dx[k] = ddx[k] - dx[k];
+      };
+
+    bool improved = false;
+    Int k = n-1;
+    descend( k );
+    for( Int numNodes=0; numNodes<maxNodes; ++numNodes )
+    {
+        const F diff = R(k,k)*(xCand[k]-center[k]);
+        rho[k] = rho[k+1] + diff*diff;
+        if( rho[k] < bestDist )
+        {
+            if( k > 0 )
+            {
+                descend( --k );
+                continue;
+            }
+            bestDist = rho[0];
+            xBest = xCand;
+            improved = true;
+        }
+        // The siblings are visited in order of increasing distance, so the
+        // remainder of this level can be skipped
+        if( ++k == n )
+            break;
+        nextSibling( k );
+    }
+    if( improved )
+    {
+        // Rounding errors can make the Babai point appear closer than itself
+        improved = false;
+        for( Int j=0; j<n; ++j )
+        {
+            if( xBest[j] != x[j] )
+            {
+                improved = true;
+                x[j] = xBest[j];
+            }
+        }
+    }
+    return improved;
+}
+
+template<typename F,typename=DisableIf<IsReal<F>>,typename=void>
+bool BoundedRefinement
+( const Matrix<F>& R, const F* c, F* x, Int maxNodes )
+{
+    LogicError("Bounded CVP refinement is not yet supported for complex F");
+    return false;
+}
+
+} // namespace cvp
+
+template<typename F>
+ClosestVectorSolver<F>::ClosestVectorSolver
+( const Matrix<F>& B, const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> BRed( B ), QR, t;
+    Matrix<Base<F>> d;
+    auto info = LLLWithQ( BRed, QR, t, d, ctrl );
+
+    B_ = BRed( ALL, IR(0,info.rank) );
+    QR_ = QR( ALL, IR(0,info.rank) );
+    t_ = t( IR(0,info.rank), ALL );
+    d_ = d( IR(0,info.rank), ALL );
+}
+
+template<typename F>
+ClosestVectorSolver<F>::ClosestVectorSolver
+( const Matrix<F>& BRed,
+  const Matrix<F>& QR,
+  const Matrix<F>& t,
+  const Matrix<Base<F>>& d )
+: B_(BRed), QR_(QR), t_(t), d_(d)
+{ }
+
+template<typename F>
+Int ClosestVectorSolver<F>::Solve
+( const Matrix<F>& T,
+        Matrix<F>& Y,
+  const CVPCtrl& ctrl ) const
+{
+    EL_DEBUG_CSE
+    Matrix<F> X;
+    return Solve( T, Y, X, ctrl );
+}
+
+template<typename F>
+Int ClosestVectorSolver<F>::Solve
+( const Matrix<F>& T,
+        Matrix<F>& Y,
+        Matrix<F>& X,
+  const CVPCtrl& ctrl ) const
+{
+    EL_DEBUG_CSE
+    const Int m = B_.Height();
+    const Int n = B_.Width();
+    const Int numRHS = T.Width();
+    if( T.Height() != m )
+        LogicError
+        ("Targets were of height ",T.Height()," rather than ",m);
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    Zeros( Y, m, numRHS );
+    Zeros( X, n, numRHS );
+    if( n == 0 || numRHS == 0 )
+        return 0;
+
+    const Int batchSize =
+      ( ctrl.batchSize > 0 ? Min(ctrl.batchSize,numRHS) : numRHS );
+    const Int blocksize = Max( ctrl.blocksize, Int(1) );
+    const Int numBatches = (numRHS+batchSize-1) / batchSize;
+    const auto R = QR_( IR(0,n), IR(0,n) );
+
+    vector<Int> batchImprovements(numBatches,0);
+    auto solveBatch = [&]( Int batch )
+      {
+          const Int jBeg = batch*batchSize;
+          const Int jEnd = Min( jBeg+batchSize, numRHS );
+          const Int width = jEnd - jBeg;
+
+          // Compute the components of the targets in the directions of the
+          // columns of Q
+          Matrix<F> RT;
+          RT = T( ALL, IR(jBeg,jEnd) );
+          qr::ApplyQ( LEFT, ADJOINT, QR_, t_, d_, RT );
+          auto RTTop = RT( IR(0,n), ALL );
+          Matrix<F> C;
+          if( ctrl.maxEnumNodes > 0 )
+              C = RTTop;
+
+          // Run Babai's nearest plane algorithm on the batch, rounding one
+          // block of coordinates at a time and then removing their
+          // contributions from the remaining coordinates with a single GEMM
+          auto XBatch = X( ALL, IR(jBeg,jEnd) );
+          for( Int kEnd=n; kEnd>0; kEnd-=blocksize )
+          {
+              const Int kBeg = Max( kEnd-blocksize, Int(0) );
+              for( Int j=0; j<width; ++j )
+              {
+                  F* rTBuf = &RTTop(0,j);
+                  F* xBuf = &XBatch(0,j);
+                  for( Int i=kEnd-1; i>=kBeg; --i )
+                  {
+                      const F chi = Round( rTBuf[i] / R(i,i) );
+                      xBuf[i] = chi;
+                      if( chi == F(0) )
+                          continue;
+                      blas::Axpy
+                      ( i-kBeg+1, -chi,
+                        &R(kBeg,i),    1,
+                        &rTBuf[kBeg],  1 );
+                  }
+              }
+              if( kBeg > 0 )
+              {
+                  auto RTAbove = RTTop( IR(0,kBeg), ALL );
+                  Gemm
+                  ( NORMAL, NORMAL,
+                    F(-1), R( IR(0,kBeg), IR(kBeg,kEnd) ),
+                           XBatch( IR(kBeg,kEnd), ALL ),
+                    F(1),  RTAbove );
+              }
+          }
+
+          if( ctrl.maxEnumNodes > 0 )
+          {
+              for( Int j=0; j<width; ++j )
+                  if( cvp::BoundedRefinement
+                      ( R, C.LockedBuffer(0,j), XBatch.Buffer(0,j),
+                        ctrl.maxEnumNodes ) )
+                      ++batchImprovements[batch];
+          }
+
+          auto YBatch = Y( ALL, IR(jBeg,jEnd) );
+          Gemm( NORMAL, NORMAL, F(1), B_, XBatch, F(0), YBatch );
+      };
+
+#ifdef EL_HYBRID
+    if( ctrl.parallel && numBatches > 1 )
+    {
+        bool failed = false;
+        std::exception_ptr error;
+        #pragma omp parallel for schedule(dynamic)
+        for( Int batch=0; batch<numBatches; ++batch )
+        {
+            try { solveBatch( batch ); }
+            catch( ... )
+            {
+                #pragma omp critical(El_ClosestVectorSolver_Solve)
+                {
+                    if( !failed )
+                    {
+                        failed = true;
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+        if( failed )
+            std::rethrow_exception( error );
+    }
+    else
+#endif
+    {
+        for( Int batch=0; batch<numBatches; ++batch )
+            solveBatch( batch );
+    }
+
+    Int numImproved = 0;
+    for( Int batch=0; batch<numBatches; ++batch )
+        numImproved += batchImprovements[batch];
+    if( ctrl.time )
+        Output
+        ("Solved ",numRHS," CVP instances in ",numBatches," batches in ",
+         timer.Stop()," seconds");
+    if( ctrl.progress && ctrl.maxEnumNodes > 0 )
+        Output
+        ("Enumeration improved ",numImproved," of ",numRHS," Babai points");
+    return numImproved;
+}
+
 } // namespace El
 
 #endif // ifndef EL_LATTICE_NEAREST_PLANE_HPP
@@ -30,7 +30,17 @@ inline ElMehrotraCtrl_s CReflect( const MehrotraCtrl<float>& ctrl )
     ctrlC.maxIts        = ctrl.maxIts;
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
+    ctrlC.denseColumnRatio       = ctrl.denseColumnRatio;
+    ctrlC.denseColumnMinNonzeros = ctrl.denseColumnMinNonzeros;
+    ctrlC.krylovForcingFactor    = ctrl.krylovForcingFactor;
+    ctrlC.maxKrylovIts           = ctrl.maxKrylovIts;
+    ctrlC.krylovPrecondRank      = ctrl.krylovPrecondRank;
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.maxCentralityCorrectors = ctrl.maxCentralityCorrectors;
+    ctrlC.centralityLowerRatio    = ctrl.centralityLowerRatio;
+    ctrlC.centralityUpperRatio    = ctrl.centralityUpperRatio;
+    ctrlC.centralityStepIncrease  = ctrl.centralityStepIncrease;
+    ctrlC.centralityMinAcceptance = ctrl.centralityMinAcceptance;
    
     auto centralityRuleRes =
       ctrl.centralityRule.target<float(*)(float,float,float,float)>();
@@ -74,7 +84,17 @@ inline ElMehrotraCtrl_d CReflect( const MehrotraCtrl<double>& ctrl )
     ctrlC.maxIts        = ctrl.maxIts;
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
+    ctrlC.denseColumnRatio       = ctrl.denseColumnRatio;
+    ctrlC.denseColumnMinNonzeros = ctrl.denseColumnMinNonzeros;
+    ctrlC.krylovForcingFactor    = ctrl.krylovForcingFactor;
+    ctrlC.maxKrylovIts           = ctrl.maxKrylovIts;
+    ctrlC.krylovPrecondRank      = ctrl.krylovPrecondRank;
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.maxCentralityCorrectors = ctrl.maxCentralityCorrectors;
+    ctrlC.centralityLowerRatio    = ctrl.centralityLowerRatio;
+    ctrlC.centralityUpperRatio    = ctrl.centralityUpperRatio;
+    ctrlC.centralityStepIncrease  = ctrl.centralityStepIncrease;
+    ctrlC.centralityMinAcceptance = ctrl.centralityMinAcceptance;
 
     auto centralityRuleRes =
       ctrl.centralityRule.target<double(*)(double,double,double,double)>();
@@ -118,7 +138,17 @@ inline MehrotraCtrl<float> CReflect( const ElMehrotraCtrl_s& ctrlC )
     ctrl.maxIts            = ctrlC.maxIts;
     ctrl.maxStepRatio      = ctrlC.maxStepRatio;
     ctrl.system            = CReflect(ctrlC.system);
+    ctrl.denseColumnRatio       = ctrlC.denseColumnRatio;
+    ctrl.denseColumnMinNonzeros = ctrlC.denseColumnMinNonzeros;
+    ctrl.krylovForcingFactor    = ctrlC.krylovForcingFactor;
+    ctrl.maxKrylovIts           = ctrlC.maxKrylovIts;
+    ctrl.krylovPrecondRank      = ctrlC.krylovPrecondRank;
     ctrl.mehrotra          = ctrlC.mehrotra;
+    ctrl.maxCentralityCorrectors = ctrlC.maxCentralityCorrectors;
+    ctrl.centralityLowerRatio    = ctrlC.centralityLowerRatio;
+    ctrl.centralityUpperRatio    = ctrlC.centralityUpperRatio;
+    ctrl.centralityStepIncrease  = ctrlC.centralityStepIncrease;
+    ctrl.centralityMinAcceptance = ctrlC.centralityMinAcceptance;
     ctrl.centralityRule    = ctrlC.centralityRule;
     ctrl.standardInitShift = ctrlC.standardInitShift;
     ctrl.balanceTol        = ctrlC.balanceTol;
@@ -155,7 +185,17 @@ inline MehrotraCtrl<double> CReflect( const ElMehrotraCtrl_d& ctrlC )
     ctrl.maxIts            = ctrlC.maxIts;
     ctrl.maxStepRatio      = ctrlC.maxStepRatio;
     ctrl.system            = CReflect(ctrlC.system);
+    ctrl.denseColumnRatio       = ctrlC.denseColumnRatio;
+    ctrl.denseColumnMinNonzeros = ctrlC.denseColumnMinNonzeros;
+    ctrl.krylovForcingFactor    = ctrlC.krylovForcingFactor;
+    ctrl.maxKrylovIts           = ctrlC.maxKrylovIts;
+    ctrl.krylovPrecondRank      = ctrlC.krylovPrecondRank;
     ctrl.mehrotra          = ctrlC.mehrotra;
+    ctrl.maxCentralityCorrectors = ctrlC.maxCentralityCorrectors;
+    ctrl.centralityLowerRatio    = ctrlC.centralityLowerRatio;
+    ctrl.centralityUpperRatio    = ctrlC.centralityUpperRatio;
+    ctrl.centralityStepIncrease  = ctrlC.centralityStepIncrease;
+    ctrl.centralityMinAcceptance = ctrlC.centralityMinAcceptance;
     ctrl.centralityRule    = ctrlC.centralityRule;
     ctrl.standardInitShift = ctrlC.standardInitShift;
     ctrl.balanceTol        = ctrlC.balanceTol;
@@ -195,6 +235,10 @@ inline ElADMMCtrl_s CReflect( const ADMMCtrl<float>& ctrl )
     ctrlC.relTol  = ctrl.relTol;
     ctrlC.inv     = ctrl.inv;
     ctrlC.print   = ctrl.print;
+    ctrlC.adaptiveRho   = ctrl.adaptiveRho;
+    ctrlC.rhoBalance    = ctrl.rhoBalance;
+    ctrlC.rhoScale      = ctrl.rhoScale;
+    ctrlC.andersonDepth = ctrl.andersonDepth;
     return ctrlC;
 }
 inline ElADMMCtrl_d CReflect( const ADMMCtrl<double>& ctrl )
@@ -207,6 +251,10 @@ inline ElADMMCtrl_d CReflect( const ADMMCtrl<double>& ctrl )
     ctrlC.relTol  = ctrl.relTol;
     ctrlC.inv     = ctrl.inv;
     ctrlC.print   = ctrl.print;
+    ctrlC.adaptiveRho   = ctrl.adaptiveRho;
+    ctrlC.rhoBalance    = ctrl.rhoBalance;
+    ctrlC.rhoScale      = ctrl.rhoScale;
+    ctrlC.andersonDepth = ctrl.andersonDepth;
     return ctrlC;
 }
 inline ADMMCtrl<float> CReflect( const ElADMMCtrl_s& ctrlC )
@@ -219,6 +267,10 @@ inline ADMMCtrl<float> CReflect( const ElADMMCtrl_s& ctrlC )
     ctrl.relTol  = ctrlC.relTol;
     ctrl.inv     = ctrlC.inv;
     ctrl.print   = ctrlC.print;
+    ctrl.adaptiveRho   = ctrlC.adaptiveRho;
+    ctrl.rhoBalance    = ctrlC.rhoBalance;
+    ctrl.rhoScale      = ctrlC.rhoScale;
+    ctrl.andersonDepth = ctrlC.andersonDepth;
     return ctrl;
 }
 inline ADMMCtrl<double> CReflect( const ElADMMCtrl_d& ctrlC )
@@ -231,6 +283,110 @@ inline ADMMCtrl<double> CReflect( const ElADMMCtrl_d& ctrlC )
     ctrl.relTol  = ctrlC.relTol;
     ctrl.inv     = ctrlC.inv;
     ctrl.print   = ctrlC.print;
+    ctrl.adaptiveRho   = ctrlC.adaptiveRho;
+    ctrl.rhoBalance    = ctrlC.rhoBalance;
+    ctrl.rhoScale      = ctrlC.rhoScale;
+    ctrl.andersonDepth = ctrlC.andersonDepth;
+    return ctrl;
+}
+
+inline ElAPGCtrl_s CReflect( const APGCtrl<float>& ctrl )
+{
+    ElAPGCtrl_s ctrlC;
+    ctrlC.maxIter         = ctrl.maxIter;
+    ctrlC.relTol          = ctrl.relTol;
+    ctrlC.lipschitz       = ctrl.lipschitz;
+    ctrlC.backtrackFactor = ctrl.backtrackFactor;
+    ctrlC.restart         = ctrl.restart;
+    ctrlC.print           = ctrl.print;
+    return ctrlC;
+}
+inline ElAPGCtrl_d CReflect( const APGCtrl<double>& ctrl )
+{
+    ElAPGCtrl_d ctrlC;
+    ctrlC.maxIter         = ctrl.maxIter;
+    ctrlC.relTol          = ctrl.relTol;
+    ctrlC.lipschitz       = ctrl.lipschitz;
+    ctrlC.backtrackFactor = ctrl.backtrackFactor;
+    ctrlC.restart         = ctrl.restart;
+    ctrlC.print           = ctrl.print;
+    return ctrlC;
+}
+inline APGCtrl<float> CReflect( const ElAPGCtrl_s& ctrlC )
+{
+    APGCtrl<float> ctrl;
+    ctrl.maxIter         = ctrlC.maxIter;
+    ctrl.relTol          = ctrlC.relTol;
+    ctrl.lipschitz       = ctrlC.lipschitz;
+    ctrl.backtrackFactor = ctrlC.backtrackFactor;
+    ctrl.restart         = ctrlC.restart;
+    ctrl.print           = ctrlC.print;
+    return ctrl;
+}
+inline APGCtrl<double> CReflect( const ElAPGCtrl_d& ctrlC )
+{
+    APGCtrl<double> ctrl;
+    ctrl.maxIter         = ctrlC.maxIter;
+    ctrl.relTol          = ctrlC.relTol;
+    ctrl.lipschitz       = ctrlC.lipschitz;
+    ctrl.backtrackFactor = ctrlC.backtrackFactor;
+    ctrl.restart         = ctrlC.restart;
+    ctrl.print           = ctrlC.print;
+    return ctrl;
+}
+
+/* Presolve
+   ^^^^^^^^ */
+inline ElPresolveCtrl_s CReflect( const PresolveCtrl<float>& ctrl )
+{
+    ElPresolveCtrl_s ctrlC;
+    ctrlC.removeEmptyRows     = ctrl.removeEmptyRows;
+    ctrlC.removeEmptyColumns  = ctrl.removeEmptyColumns;
+    ctrlC.removeSingletonRows = ctrl.removeSingletonRows;
+    ctrlC.removeForcingRows   = ctrl.removeForcingRows;
+    ctrlC.removeDuplicateRows = ctrl.removeDuplicateRows;
+    ctrlC.maxPasses           = ctrl.maxPasses;
+    ctrlC.tol                 = ctrl.tol;
+    ctrlC.progress            = ctrl.progress;
+    return ctrlC;
+}
+inline ElPresolveCtrl_d CReflect( const PresolveCtrl<double>& ctrl )
+{
+    ElPresolveCtrl_d ctrlC;
+    ctrlC.removeEmptyRows     = ctrl.removeEmptyRows;
+    ctrlC.removeEmptyColumns  = ctrl.removeEmptyColumns;
+    ctrlC.removeSingletonRows = ctrl.removeSingletonRows;
+    ctrlC.removeForcingRows   = ctrl.removeForcingRows;
+    ctrlC.removeDuplicateRows = ctrl.removeDuplicateRows;
+    ctrlC.maxPasses           = ctrl.maxPasses;
+    ctrlC.tol                 = ctrl.tol;
+    ctrlC.progress            = ctrl.progress;
+    return ctrlC;
+}
+inline PresolveCtrl<float> CReflect( const ElPresolveCtrl_s& ctrlC )
+{
+    PresolveCtrl<float> ctrl;
+    ctrl.removeEmptyRows     = ctrlC.removeEmptyRows;
+    ctrl.removeEmptyColumns  = ctrlC.removeEmptyColumns;
+    ctrl.removeSingletonRows = ctrlC.removeSingletonRows;
+    ctrl.removeForcingRows   = ctrlC.removeForcingRows;
+    ctrl.removeDuplicateRows = ctrlC.removeDuplicateRows;
+    ctrl.maxPasses           = ctrlC.maxPasses;
+    ctrl.tol                 = ctrlC.tol;
+    ctrl.progress            = ctrlC.progress;
+    return ctrl;
+}
+inline PresolveCtrl<double> CReflect( const ElPresolveCtrl_d& ctrlC )
+{
+    PresolveCtrl<double> ctrl;
+    ctrl.removeEmptyRows     = ctrlC.removeEmptyRows;
+    ctrl.removeEmptyColumns  = ctrlC.removeEmptyColumns;
+    ctrl.removeSingletonRows = ctrlC.removeSingletonRows;
+    ctrl.removeForcingRows   = ctrlC.removeForcingRows;
+    ctrl.removeDuplicateRows = ctrlC.removeDuplicateRows;
+    ctrl.maxPasses           = ctrlC.maxPasses;
+    ctrl.tol                 = ctrlC.tol;
+    ctrl.progress            = ctrlC.progress;
     return ctrl;
 }
 
@@ -249,6 +405,8 @@ inline ElLPDirectCtrl_s CReflect( const lp::direct::Ctrl<float>& ctrl )
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.admmCtrl     = CReflect(ctrl.admmCtrl);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline ElLPDirectCtrl_d CReflect( const lp::direct::Ctrl<double>& ctrl )
@@ -257,6 +415,8 @@ inline ElLPDirectCtrl_d CReflect( const lp::direct::Ctrl<double>& ctrl )
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.admmCtrl     = CReflect(ctrl.admmCtrl);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline lp::direct::Ctrl<float> CReflect( const ElLPDirectCtrl_s& ctrlC )
@@ -265,6 +425,8 @@ inline lp::direct::Ctrl<float> CReflect( const ElLPDirectCtrl_s& ctrlC )
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.admmCtrl     = CReflect(ctrlC.admmCtrl);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 inline lp::direct::Ctrl<double> CReflect( const ElLPDirectCtrl_d& ctrlC )
@@ -273,6 +435,8 @@ inline lp::direct::Ctrl<double> CReflect( const ElLPDirectCtrl_d& ctrlC )
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.admmCtrl     = CReflect(ctrlC.admmCtrl);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 
@@ -283,6 +447,8 @@ inline ElLPAffineCtrl_s CReflect( const lp::affine::Ctrl<float>& ctrl )
     ElLPAffineCtrl_s ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline ElLPAffineCtrl_d CReflect( const lp::affine::Ctrl<double>& ctrl )
@@ -290,6 +456,8 @@ inline ElLPAffineCtrl_d CReflect( const lp::affine::Ctrl<double>& ctrl )
     ElLPAffineCtrl_d ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline lp::affine::Ctrl<float> CReflect( const ElLPAffineCtrl_s& ctrlC )
@@ -297,6 +465,8 @@ inline lp::affine::Ctrl<float> CReflect( const ElLPAffineCtrl_s& ctrlC )
     lp::affine::Ctrl<float> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 inline lp::affine::Ctrl<double> CReflect( const ElLPAffineCtrl_d& ctrlC )
@@ -304,6 +474,8 @@ inline lp::affine::Ctrl<double> CReflect( const ElLPAffineCtrl_d& ctrlC )
     lp::affine::Ctrl<double> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 
@@ -321,6 +493,8 @@ inline ElQPDirectCtrl_s CReflect( const qp::direct::Ctrl<float>& ctrl )
     ElQPDirectCtrl_s ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline ElQPDirectCtrl_d CReflect( const qp::direct::Ctrl<double>& ctrl )
@@ -328,6 +502,8 @@ inline ElQPDirectCtrl_d CReflect( const qp::direct::Ctrl<double>& ctrl )
     ElQPDirectCtrl_d ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline qp::direct::Ctrl<float> CReflect( const ElQPDirectCtrl_s& ctrlC )
@@ -335,6 +511,8 @@ inline qp::direct::Ctrl<float> CReflect( const ElQPDirectCtrl_s& ctrlC )
     qp::direct::Ctrl<float> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 inline qp::direct::Ctrl<double> CReflect( const ElQPDirectCtrl_d& ctrlC )
@@ -342,6 +520,8 @@ inline qp::direct::Ctrl<double> CReflect( const ElQPDirectCtrl_d& ctrlC )
     qp::direct::Ctrl<double> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 
@@ -352,6 +532,8 @@ inline ElQPAffineCtrl_s CReflect( const qp::affine::Ctrl<float>& ctrl )
     ElQPAffineCtrl_s ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline ElQPAffineCtrl_d CReflect( const qp::affine::Ctrl<double>& ctrl )
@@ -359,6 +541,8 @@ inline ElQPAffineCtrl_d CReflect( const qp::affine::Ctrl<double>& ctrl )
     ElQPAffineCtrl_d ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline qp::affine::Ctrl<float> CReflect( const ElQPAffineCtrl_s& ctrlC )
@@ -366,6 +550,8 @@ inline qp::affine::Ctrl<float> CReflect( const ElQPAffineCtrl_s& ctrlC )
     qp::affine::Ctrl<float> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 inline qp::affine::Ctrl<double> CReflect( const ElQPAffineCtrl_d& ctrlC )
@@ -373,6 +559,8 @@ inline qp::affine::Ctrl<double> CReflect( const ElQPAffineCtrl_d& ctrlC )
     qp::affine::Ctrl<double> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 
@@ -592,6 +780,11 @@ inline ElBPDNADMMCtrl_s CReflect( const bpdn::ADMMCtrl<float>& ctrl )
     ctrlC.relTol   = ctrl.relTol;
     ctrlC.inv      = ctrl.inv;
     ctrlC.progress = ctrl.progress;
+    ctrlC.adaptiveRho   = ctrl.adaptiveRho;
+    ctrlC.rhoBalance    = ctrl.rhoBalance;
+    ctrlC.rhoScale      = ctrl.rhoScale;
+    ctrlC.andersonDepth = ctrl.andersonDepth;
+    ctrlC.consensus     = ctrl.consensus;
     return ctrlC;
 }
 
@@ -605,6 +798,11 @@ inline ElBPDNADMMCtrl_d CReflect( const bpdn::ADMMCtrl<double>& ctrl )
     ctrlC.relTol   = ctrl.relTol;
     ctrlC.inv      = ctrl.inv;
     ctrlC.progress = ctrl.progress;
+    ctrlC.adaptiveRho   = ctrl.adaptiveRho;
+    ctrlC.rhoBalance    = ctrl.rhoBalance;
+    ctrlC.rhoScale      = ctrl.rhoScale;
+    ctrlC.andersonDepth = ctrl.andersonDepth;
+    ctrlC.consensus     = ctrl.consensus;
     return ctrlC;
 }
 
@@ -618,6 +816,11 @@ inline bpdn::ADMMCtrl<float> CReflect( const ElBPDNADMMCtrl_s& ctrlC )
     ctrl.relTol   = ctrlC.relTol;
     ctrl.inv      = ctrlC.inv;
     ctrl.progress = ctrlC.progress;
+    ctrl.adaptiveRho   = ctrlC.adaptiveRho;
+    ctrl.rhoBalance    = ctrlC.rhoBalance;
+    ctrl.rhoScale      = ctrlC.rhoScale;
+    ctrl.andersonDepth = ctrlC.andersonDepth;
+    ctrl.consensus     = ctrlC.consensus;
     return ctrl;
 }
 
@@ -631,6 +834,11 @@ inline bpdn::ADMMCtrl<double> CReflect( const ElBPDNADMMCtrl_d& ctrlC )
     ctrl.relTol   = ctrlC.relTol;
     ctrl.inv      = ctrlC.inv;
     ctrl.progress = ctrlC.progress;
+    ctrl.adaptiveRho   = ctrlC.adaptiveRho;
+    ctrl.rhoBalance    = ctrlC.rhoBalance;
+    ctrl.rhoScale      = ctrlC.rhoScale;
+    ctrl.andersonDepth = ctrlC.andersonDepth;
+    ctrl.consensus     = ctrlC.consensus;
     return ctrl;
 }
 
@@ -720,35 +928,52 @@ inline NNLSCtrl<double> CReflect( const ElNNLSCtrl_d& ctrlC )
 
 // Non-negative Matrix Factorization
 // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+inline NMFApproach CReflect( ElNMFApproach approach )
+{ return static_cast<NMFApproach>(approach); }
+inline ElNMFApproach CReflect( NMFApproach approach )
+{ return static_cast<ElNMFApproach>(approach); }
+
 inline ElNMFCtrl_s CReflect( const NMFCtrl<float>& ctrl )
 {
     ElNMFCtrl_s ctrlC;
+    ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.nnlsCtrl = CReflect(ctrl.nnlsCtrl);
     ctrlC.maxIter = ctrl.maxIter;
+    ctrlC.relTol = ctrl.relTol;
+    ctrlC.progress = ctrl.progress;
     return ctrlC;
 }
 
 inline ElNMFCtrl_d CReflect( const NMFCtrl<double>& ctrl )
 {
     ElNMFCtrl_d ctrlC;
+    ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.nnlsCtrl = CReflect(ctrl.nnlsCtrl);
     ctrlC.maxIter = ctrl.maxIter;
+    ctrlC.relTol = ctrl.relTol;
+    ctrlC.progress = ctrl.progress;
     return ctrlC;
 }
 
 inline NMFCtrl<float> CReflect( const ElNMFCtrl_s& ctrlC )
 {
     NMFCtrl<float> ctrl;
+    ctrl.approach = CReflect(ctrlC.approach);
     ctrl.nnlsCtrl = CReflect(ctrlC.nnlsCtrl);
     ctrl.maxIter = ctrlC.maxIter;
+    ctrl.relTol = ctrlC.relTol;
+    ctrl.progress = ctrlC.progress;
     return ctrl;
 }
 
 inline NMFCtrl<double> CReflect( const ElNMFCtrl_d& ctrlC )
 {
     NMFCtrl<double> ctrl;
+    ctrl.approach = CReflect(ctrlC.approach);
     ctrl.nnlsCtrl = CReflect(ctrlC.nnlsCtrl);
     ctrl.maxIter = ctrlC.maxIter;
+    ctrl.relTol = ctrlC.relTol;
+    ctrl.progress = ctrlC.progress;
     return ctrl;
 }
 
@@ -760,6 +985,7 @@ inline ElRPCACtrl_s CReflect( const RPCACtrl<float>& ctrl )
     ElRPCACtrl_s ctrlC;
     ctrlC.useALM      = ctrl.useALM;
     ctrlC.usePivQR    = ctrl.usePivQR;
+    ctrlC.usePartialSVT = ctrl.usePartialSVT;
     ctrlC.progress    = ctrl.progress;
     ctrlC.numPivSteps = ctrl.numPivSteps;
     ctrlC.maxIts      = ctrl.maxIts;
@@ -775,6 +1001,7 @@ inline ElRPCACtrl_d CReflect( const RPCACtrl<double>& ctrl )
     ElRPCACtrl_d ctrlC;
     ctrlC.useALM      = ctrl.useALM;
     ctrlC.usePivQR    = ctrl.usePivQR;
+    ctrlC.usePartialSVT = ctrl.usePartialSVT;
     ctrlC.progress    = ctrl.progress;
     ctrlC.numPivSteps = ctrl.numPivSteps;
     ctrlC.maxIts      = ctrl.maxIts;
@@ -790,6 +1017,7 @@ inline RPCACtrl<float> CReflect( const ElRPCACtrl_s& ctrlC )
     RPCACtrl<float> ctrl;
     ctrl.useALM      = ctrlC.useALM;
     ctrl.usePivQR    = ctrlC.usePivQR;
+    ctrl.usePartialSVT = ctrlC.usePartialSVT;
     ctrl.progress    = ctrlC.progress;
     ctrl.numPivSteps = ctrlC.numPivSteps;
     ctrl.maxIts      = ctrlC.maxIts;
@@ -805,6 +1033,7 @@ inline RPCACtrl<double> CReflect( const ElRPCACtrl_d& ctrlC )
     RPCACtrl<double> ctrl;
     ctrl.useALM      = ctrlC.useALM;
     ctrl.usePivQR    = ctrlC.usePivQR;
+    ctrl.usePartialSVT = ctrlC.usePartialSVT;
     ctrl.progress    = ctrlC.progress;
     ctrl.numPivSteps = ctrlC.numPivSteps;
     ctrl.maxIts      = ctrlC.maxIts;
@@ -868,31 +1097,127 @@ inline SparseInvCovCtrl<double> CReflect( const ElSparseInvCovCtrl_d& ctrlC )
 
 /* Support Vector Machine
    """""""""""""""""""""" */
+inline ElSVMApproach CReflect( SVMApproach approach )
+{ return static_cast<ElSVMApproach>(approach); }
+inline SVMApproach CReflect( ElSVMApproach approach )
+{ return static_cast<SVMApproach>(approach); }
+
+inline ElSVMDCDCtrl_s CReflect( const svm::DCDCtrl<float>& ctrl )
+{
+    ElSVMDCDCtrl_s ctrlC;
+    ctrlC.maxIter  = ctrl.maxIter;
+    ctrlC.relTol   = ctrl.relTol;
+    ctrlC.progress = ctrl.progress;
+    return ctrlC;
+}
+
+inline ElSVMDCDCtrl_d CReflect( const svm::DCDCtrl<double>& ctrl )
+{
+    ElSVMDCDCtrl_d ctrlC;
+    ctrlC.maxIter  = ctrl.maxIter;
+    ctrlC.relTol   = ctrl.relTol;
+    ctrlC.progress = ctrl.progress;
+    return ctrlC;
+}
+
+inline svm::DCDCtrl<float> CReflect( const ElSVMDCDCtrl_s& ctrlC )
+{
+    svm::DCDCtrl<float> ctrl;
+    ctrl.maxIter  = ctrlC.maxIter;
+    ctrl.relTol   = ctrlC.relTol;
+    ctrl.progress = ctrlC.progress;
+    return ctrl;
+}
+
+inline svm::DCDCtrl<double> CReflect( const ElSVMDCDCtrl_d& ctrlC )
+{
+    svm::DCDCtrl<double> ctrl;
+    ctrl.maxIter  = ctrlC.maxIter;
+    ctrl.relTol   = ctrlC.relTol;
+    ctrl.progress = ctrlC.progress;
+    return ctrl;
+}
+
 inline ElSVMCtrl_s CReflect( const SVMCtrl<float>& ctrl )
 {
     ElSVMCtrl_s ctrlC;
+    ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.ipmCtrl = CReflect(ctrl.ipmCtrl);
+    ctrlC.dcdCtrl = CReflect(ctrl.dcdCtrl);
+    ctrlC.apgCtrl = CReflect(ctrl.apgCtrl);
     return ctrlC;
 }
 
 inline ElSVMCtrl_d CReflect( const SVMCtrl<double>& ctrl )
 {
     ElSVMCtrl_d ctrlC;
+    ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.ipmCtrl = CReflect(ctrl.ipmCtrl);
+    ctrlC.dcdCtrl = CReflect(ctrl.dcdCtrl);
+    ctrlC.apgCtrl = CReflect(ctrl.apgCtrl);
     return ctrlC;
 }
 
 inline SVMCtrl<float> CReflect( const ElSVMCtrl_s& ctrlC )
 {
     SVMCtrl<float> ctrl;
+    ctrl.approach = CReflect(ctrlC.approach);
     ctrl.ipmCtrl = CReflect(ctrlC.ipmCtrl);
+    ctrl.dcdCtrl = CReflect(ctrlC.dcdCtrl);
+    ctrl.apgCtrl = CReflect(ctrlC.apgCtrl);
     return ctrl;
 }
 
 inline SVMCtrl<double> CReflect( const ElSVMCtrl_d& ctrlC )
 {
     SVMCtrl<double> ctrl;
+    ctrl.approach = CReflect(ctrlC.approach);
     ctrl.ipmCtrl = CReflect(ctrlC.ipmCtrl);
+    ctrl.dcdCtrl = CReflect(ctrlC.dcdCtrl);
+    ctrl.apgCtrl = CReflect(ctrlC.apgCtrl);
+    return ctrl;
+}
+
+/* Logistic regression
+   """"""""""""""""""" */
+inline ElRegularization CReflect( Regularization penalty )
+{ return static_cast<ElRegularization>(penalty); }
+inline Regularization CReflect( ElRegularization penalty )
+{ return static_cast<Regularization>(penalty); }
+
+inline ElLogisticRegressionCtrl_s
+CReflect( const LogisticRegressionCtrl<float>& ctrl )
+{
+    ElLogisticRegressionCtrl_s ctrlC;
+    ctrlC.penalty = CReflect(ctrl.penalty);
+    ctrlC.apgCtrl = CReflect(ctrl.apgCtrl);
+    return ctrlC;
+}
+
+inline ElLogisticRegressionCtrl_d
+CReflect( const LogisticRegressionCtrl<double>& ctrl )
+{
+    ElLogisticRegressionCtrl_d ctrlC;
+    ctrlC.penalty = CReflect(ctrl.penalty);
+    ctrlC.apgCtrl = CReflect(ctrl.apgCtrl);
+    return ctrlC;
+}
+
+inline LogisticRegressionCtrl<float>
+CReflect( const ElLogisticRegressionCtrl_s& ctrlC )
+{
+    LogisticRegressionCtrl<float> ctrl;
+    ctrl.penalty = CReflect(ctrlC.penalty);
+    ctrl.apgCtrl = CReflect(ctrlC.apgCtrl);
+    return ctrl;
+}
+
+inline LogisticRegressionCtrl<double>
+CReflect( const ElLogisticRegressionCtrl_d& ctrlC )
+{
+    LogisticRegressionCtrl<double> ctrl;
+    ctrl.penalty = CReflect(ctrlC.penalty);
+    ctrl.apgCtrl = CReflect(ctrlC.apgCtrl);
     return ctrl;
 }
 
@@ -13,6 +13,12 @@
 extern "C" {
 #endif
 
+typedef enum {
+  EL_NO_PENALTY,
+  EL_L1_PENALTY,
+  EL_L2_PENALTY
+} ElRegularization;
+
 /* Basis pursuit
    ============= */
 EL_EXPORT ElError ElBP_s
@@ -645,14 +651,26 @@ EL_EXPORT ElError ElNMFDist_d
   ElDistMatrix_d Y );
 
 /* Expert versions */
+typedef enum {
+  EL_NMF_ALTERNATING_NNLS,
+  EL_NMF_HALS,
+  EL_NMF_BLOCK_PRINCIPAL_PIVOTING
+} ElNMFApproach;
+
 typedef struct {
+  ElNMFApproach approach;
   ElNNLSCtrl_s nnlsCtrl;
   ElInt maxIter;
+  float relTol;
+  bool progress;
 } ElNMFCtrl_s;
 
 typedef struct {
+  ElNMFApproach approach;
   ElNNLSCtrl_d nnlsCtrl;
   ElInt maxIter;
+  double relTol;
+  bool progress;
 } ElNMFCtrl_d;
 
 EL_EXPORT ElError ElNMFCtrlDefault_s( ElNMFCtrl_s* ctrl );
@@ -736,6 +754,11 @@ typedef struct {
   float relTol;
   bool inv;
   bool progress;
+  bool adaptiveRho;
+  float rhoBalance;
+  float rhoScale;
+  ElInt andersonDepth;
+  bool consensus;
 } ElBPDNADMMCtrl_s;
 
 typedef struct {
@@ -746,6 +769,11 @@ typedef struct {
   double relTol;
   bool inv;
   bool progress;
+  bool adaptiveRho;
+  double rhoBalance;
+  double rhoScale;
+  ElInt andersonDepth;
+  bool consensus;
 } ElBPDNADMMCtrl_d;
 
 EL_EXPORT ElError ElBPDNADMMCtrlDefault_s( ElBPDNADMMCtrl_s* ctrl );
@@ -916,6 +944,7 @@ EL_EXPORT ElError ElRPCADist_z
 typedef struct {
   bool useALM;
   bool usePivQR;
+  bool usePartialSVT;
   bool progress;
   ElInt numPivSteps;
   ElInt maxIts;
@@ -928,6 +957,7 @@ typedef struct {
 typedef struct {
   bool useALM;
   bool usePivQR;
+  bool usePartialSVT;
   bool progress;
   ElInt numPivSteps;
   ElInt maxIts;
@@ -1063,14 +1093,40 @@ EL_EXPORT ElError ElSVMDistSparse_d
 
 /* Expert verions
    -------------- */
+typedef enum {
+  EL_SVM_IPM,
+  EL_SVM_DUAL_COORDINATE_DESCENT,
+  EL_SVM_ACCELERATED_PROXIMAL_GRADIENT
+} ElSVMApproach;
+
+typedef struct
+{
+  ElInt maxIter;
+  float relTol;
+  bool progress;
+} ElSVMDCDCtrl_s;
+
+typedef struct
+{
+  ElInt maxIter;
+  double relTol;
+  bool progress;
+} ElSVMDCDCtrl_d;
+
 typedef struct
 {
+  ElSVMApproach approach;
   ElQPAffineCtrl_s ipmCtrl;
+  ElSVMDCDCtrl_s dcdCtrl;
+  ElAPGCtrl_s apgCtrl;
 } ElSVMCtrl_s;
 
 typedef struct
 {
+  ElSVMApproach approach;
   ElQPAffineCtrl_d ipmCtrl;
+  ElSVMDCDCtrl_d dcdCtrl;
+  ElAPGCtrl_d apgCtrl;
 } ElSVMCtrl_d;
 
 EL_EXPORT ElError ElSVMCtrlDefault_s( ElSVMCtrl_s* ctrl );
@@ -1104,6 +1160,83 @@ EL_EXPORT ElError ElSVMXDistSparse_d
 ( ElConstDistSparseMatrix_d A, ElConstDistMultiVec_d d, double lambda,
   ElDistMultiVec_d x, ElSVMCtrl_d ctrl );
 
+/* Logistic regression
+   =================== */
+EL_EXPORT ElError ElLogisticRegression_s
+( ElConstMatrix_s A, ElConstMatrix_s d, float lambda,
+  ElMatrix_s x, ElInt* numIts );
+EL_EXPORT ElError ElLogisticRegression_d
+( ElConstMatrix_d A, ElConstMatrix_d d, double lambda,
+  ElMatrix_d x, ElInt* numIts );
+
+EL_EXPORT ElError ElLogisticRegressionDist_s
+( ElConstDistMatrix_s A, ElConstDistMatrix_s d, float lambda,
+  ElDistMatrix_s x, ElInt* numIts );
+EL_EXPORT ElError ElLogisticRegressionDist_d
+( ElConstDistMatrix_d A, ElConstDistMatrix_d d, double lambda,
+  ElDistMatrix_d x, ElInt* numIts );
+
+EL_EXPORT ElError ElLogisticRegressionSparse_s
+( ElConstSparseMatrix_s A, ElConstMatrix_s d, float lambda,
+  ElMatrix_s x, ElInt* numIts );
+EL_EXPORT ElError ElLogisticRegressionSparse_d
+( ElConstSparseMatrix_d A, ElConstMatrix_d d, double lambda,
+  ElMatrix_d x, ElInt* numIts );
+
+EL_EXPORT ElError ElLogisticRegressionDistSparse_s
+( ElConstDistSparseMatrix_s A, ElConstDistMultiVec_s d, float lambda,
+  ElDistMultiVec_s x, ElInt* numIts );
+EL_EXPORT ElError ElLogisticRegressionDistSparse_d
+( ElConstDistSparseMatrix_d A, ElConstDistMultiVec_d d, double lambda,
+  ElDistMultiVec_d x, ElInt* numIts );
+
+/* Expert versions
+   --------------- */
+typedef struct
+{
+  ElRegularization penalty;
+  ElAPGCtrl_s apgCtrl;
+} ElLogisticRegressionCtrl_s;
+
+typedef struct
+{
+  ElRegularization penalty;
+  ElAPGCtrl_d apgCtrl;
+} ElLogisticRegressionCtrl_d;
+
+EL_EXPORT ElError ElLogisticRegressionCtrlDefault_s
+( ElLogisticRegressionCtrl_s* ctrl );
+EL_EXPORT ElError ElLogisticRegressionCtrlDefault_d
+( ElLogisticRegressionCtrl_d* ctrl );
+
+EL_EXPORT ElError ElLogisticRegressionX_s
+( ElConstMatrix_s A, ElConstMatrix_s d, float lambda,
+  ElMatrix_s x, ElLogisticRegressionCtrl_s ctrl, ElInt* numIts );
+EL_EXPORT ElError ElLogisticRegressionX_d
+( ElConstMatrix_d A, ElConstMatrix_d d, double lambda,
+  ElMatrix_d x, ElLogisticRegressionCtrl_d ctrl, ElInt* numIts );
+
+EL_EXPORT ElError ElLogisticRegressionXDist_s
+( ElConstDistMatrix_s A, ElConstDistMatrix_s d, float lambda,
+  ElDistMatrix_s x, ElLogisticRegressionCtrl_s ctrl, ElInt* numIts );
+EL_EXPORT ElError ElLogisticRegressionXDist_d
+( ElConstDistMatrix_d A, ElConstDistMatrix_d d, double lambda,
+  ElDistMatrix_d x, ElLogisticRegressionCtrl_d ctrl, ElInt* numIts );
+
+EL_EXPORT ElError ElLogisticRegressionXSparse_s
+( ElConstSparseMatrix_s A, ElConstMatrix_s d, float lambda,
+  ElMatrix_s x, ElLogisticRegressionCtrl_s ctrl, ElInt* numIts );
+EL_EXPORT ElError ElLogisticRegressionXSparse_d
+( ElConstSparseMatrix_d A, ElConstMatrix_d d, double lambda,
+  ElMatrix_d x, ElLogisticRegressionCtrl_d ctrl, ElInt* numIts );
+
+EL_EXPORT ElError ElLogisticRegressionXDistSparse_s
+( ElConstDistSparseMatrix_s A, ElConstDistMultiVec_s d, float lambda,
+  ElDistMultiVec_s x, ElLogisticRegressionCtrl_s ctrl, ElInt* numIts );
+EL_EXPORT ElError ElLogisticRegressionXDistSparse_d
+( ElConstDistSparseMatrix_d A, ElConstDistMultiVec_d d, double lambda,
+  ElDistMultiVec_d x, ElLogisticRegressionCtrl_d ctrl, ElInt* numIts );
+
 /* Total variation denoising
    ========================= */
 EL_EXPORT ElError ElTV_s
@@ -350,10 +350,33 @@ void RNNLS
 
 // Non-negative matrix factorization
 // =================================
+// Approximate A ~= X Y^H, where X and Y have non-negative entries and X is
+// used as the initial guess.
+
+namespace NMFApproachNS {
+enum NMFApproach {
+    // Alternate between general-purpose NNLS solves (see nnlsCtrl)
+    NMF_ALTERNATING_NNLS,
+    // Hierarchical Alternating Least Squares, i.e., exact coordinate descent
+    // over the columns of each factor
+    NMF_HALS,
+    // Alternate between NNLS solves via Block Principal Pivoting, which is
+    // an active-set method that exchanges many variables per step
+    NMF_BLOCK_PRINCIPAL_PIVOTING
+};
+} // namespace NMFApproachNS
+using namespace NMFApproachNS;
+
 template<typename Real>
 struct NMFCtrl {
+  NMFApproach approach=NMF_ALTERNATING_NNLS;
   NNLSCtrl<Real> nnlsCtrl;
   Int maxIter=20;
+  // The HALS and Block Principal Pivoting approaches stop early once the
+  // relative residual, || A - X Y^H ||_F / || A ||_F, decreases by less than
+  // relTol over a sweep
+  Real relTol=Real(1e-6);
+  bool progress=false;
 };
 
 template<typename Real>
@@ -368,7 +391,14 @@ void NMF
         AbstractDistMatrix<Real>& X,
         AbstractDistMatrix<Real>& Y,
   const NMFCtrl<Real>& ctrl=NMFCtrl<Real>() );
-// TODO(poulson): Sparse versions
+// NOTE: NMF_ALTERNATING_NNLS forms a dense copy of a sparse A
+template<typename Real>
+void NMF
+( const SparseMatrix<Real>& A,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl=NMFCtrl<Real>() );
+// TODO(poulson): Distributed sparse version
 
 // Basis pursuit denoising (BPDN), a.k.a.,
 // Least absolute selection and shrinkage operator (Lasso):
@@ -387,6 +417,18 @@ struct ADMMCtrl {
   Real relTol=Real(1e-4);
   bool inv=true;
   bool progress=true;
+
+  // See the residual balancing and Anderson acceleration options of
+  // El::ADMMCtrl
+  bool adaptiveRho=false;
+  Real rhoBalance=Real(10);
+  Real rhoScale=Real(2);
+  Int andersonDepth=0;
+
+  // Whether the distributed implementation should solve the global-variable
+  // consensus form of the problem, where each process only forms products
+  // with its own block of rows of A
+  bool consensus=false;
 };
 
 } // namespace bpdn
@@ -479,6 +521,11 @@ struct RPCACtrl
     Int numPivSteps=75;
     Int maxIts=1000;
 
+    // Warm-start a partial SVT (see svt::Partial) with the dominant singular
+    // subspace from the previous iteration rather than computing a full SVD
+    bool usePartialSVT=false;
+    svt::PartialCtrl partialSVTCtrl;
+
     Real tau=Real(0);
     Real beta=Real(1);
     Real rho=Real(6);
@@ -538,11 +585,45 @@ Int SparseInvCov
 //
 // The output, x, is set to the concatenation of w and beta, x := [w; beta].
 //
+// The first-order approaches instead work with the dual of the problem in
+// which beta is treated as the weight of an additional constant feature
+// (as in LIBLINEAR), which slightly regularizes it, but avoids both the
+// equality constraint of the dual and storage proportional to the square
+// of the number of samples.
+//
+
+enum SVMApproach {
+  // Solve the above QP with an Interior Point Method
+  SVM_IPM,
+  // Dual coordinate descent over the samples, where each process sweeps over
+  // its own samples before the updates are combined
+  SVM_DUAL_COORDINATE_DESCENT,
+  // Accelerated projected gradient on the box-constrained dual
+  SVM_ACCELERATED_PROXIMAL_GRADIENT
+};
+
+namespace svm {
+
+template<typename Real>
+struct DCDCtrl
+{
+    // The maximum number of sweeps over the samples
+    Int maxIter=1000;
+    // Stop once the duality gap is at most relTol max(|primal|,1). Note that
+    // the primal objective typically converges much faster than the gap.
+    Real relTol=Real(1e-2);
+    bool progress=false;
+};
+
+} // namespace svm
 
 template<typename Real>
 struct SVMCtrl
 {
+    SVMApproach approach=SVM_IPM;
     qp::affine::Ctrl<Real> ipmCtrl;
+    svm::DCDCtrl<Real> dcdCtrl;
+    APGCtrl<Real> apgCtrl;
 };
 
 // TODO(poulson): Switch to explicitly returning w, beta, and z, as it is
@@ -576,6 +657,53 @@ void SVM
         DistMultiVec<Real>& x,
   const SVMCtrl<Real>& ctrl=SVMCtrl<Real>() );
 
+// Regularized logistic regression
+// ===============================
+// Given a feature matrix A whose rows are samples with labels d_i in {-1,1},
+// solve
+//
+//   min_{w,beta} sum_i log(1+exp(-d_i (a_i^T w + beta))) + lambda r(w),
+//
+// where r(w) is zero, || w ||_1, or (1/2) || w ||_2^2 depending upon the
+// choice of penalty. As with SVM, the output x is set to [w; beta].
+//
+
+template<typename Real>
+struct LogisticRegressionCtrl
+{
+    Regularization penalty=L1_PENALTY;
+    APGCtrl<Real> apgCtrl;
+};
+
+template<typename Real>
+Int LogisticRegression
+( const Matrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const LogisticRegressionCtrl<Real>& ctrl=LogisticRegressionCtrl<Real>() );
+template<typename Real>
+Int LogisticRegression
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& d,
+        Real lambda,
+        AbstractDistMatrix<Real>& x,
+  const LogisticRegressionCtrl<Real>& ctrl=LogisticRegressionCtrl<Real>() );
+template<typename Real>
+Int LogisticRegression
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const LogisticRegressionCtrl<Real>& ctrl=LogisticRegressionCtrl<Real>() );
+template<typename Real>
+Int LogisticRegression
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& d,
+        Real lambda,
+        DistMultiVec<Real>& x,
+  const LogisticRegressionCtrl<Real>& ctrl=LogisticRegressionCtrl<Real>() );
+
 // 1D total variation denoising (TV):
 //
 //   min (1/2) || b - x ||_2^2 + lambda || D x ||_1,
@@ -158,6 +158,39 @@ Int TSQR
   const Base<Field>& rho,
   bool relative=false );
 
+// Partial SVT
+// -----------
+// Only the singular triplets above the threshold are computed, via subspace
+// iteration with the (approximate) dominant right singular subspace spanned
+// by the columns of V. On exit, V holds an estimate of the dominant subspace
+// whose width is the resulting rank plus 'oversample', so that repeated
+// calls on slowly-changing matrices (e.g., from the iterations of an ADMM
+// method) are warm-started. An empty V is replaced by a Gaussian sketch of
+// width 'initialRank' plus 'oversample'.
+struct PartialCtrl
+{
+    Int initialRank=10;
+    Int oversample=10;
+
+    // The number of applications of A^H A per subspace iteration
+    Int numPower=1;
+};
+
+template<typename Field>
+Int Partial
+( Matrix<Field>& A,
+  const Base<Field>& rho,
+  Matrix<Field>& V,
+  const PartialCtrl& ctrl=PartialCtrl(),
+  bool relative=false );
+template<typename Field>
+Int Partial
+( AbstractDistMatrix<Field>& A,
+  const Base<Field>& rho,
+  DistMatrix<Field>& V,
+  const PartialCtrl& ctrl=PartialCtrl(),
+  bool relative=false );
+
 } // namespace svt
 
 // Soft-thresholding
@@ -16,7 +16,9 @@ extern "C" {
 typedef enum {
   EL_FULL_KKT,
   EL_AUGMENTED_KKT,
-  EL_NORMAL_KKT
+  EL_NORMAL_KKT,
+  EL_SPLIT_NORMAL_KKT,
+  EL_MATRIX_FREE_NORMAL_KKT
 } ElKKTSystem;
 
 /* Mehrotra Predictor-Corrector IPM
@@ -29,7 +31,17 @@ typedef struct {
   ElInt maxIts;
   float maxStepRatio;
   ElKKTSystem system;
+  float denseColumnRatio;
+  ElInt denseColumnMinNonzeros;
+  float krylovForcingFactor;
+  ElInt maxKrylovIts;
+  ElInt krylovPrecondRank;
   bool mehrotra;
+  ElInt maxCentralityCorrectors;
+  float centralityLowerRatio;
+  float centralityUpperRatio;
+  float centralityStepIncrease;
+  float centralityMinAcceptance;
   float (*centralityRule)(float,float,float,float);
   bool standardInitShift;
   float balanceTol;
@@ -62,7 +74,17 @@ typedef struct {
   ElInt maxIts;
   double maxStepRatio;
   ElKKTSystem system;
+  double denseColumnRatio;
+  ElInt denseColumnMinNonzeros;
+  double krylovForcingFactor;
+  ElInt maxKrylovIts;
+  ElInt krylovPrecondRank;
   bool mehrotra;
+  ElInt maxCentralityCorrectors;
+  double centralityLowerRatio;
+  double centralityUpperRatio;
+  double centralityStepIncrease;
+  double centralityMinAcceptance;
   double (*centralityRule)(double,double,double,double);
   bool standardInitShift;
   double balanceTol;
@@ -101,6 +123,10 @@ typedef struct {
   float relTol;
   bool inv;
   bool print;
+  bool adaptiveRho;
+  float rhoBalance;
+  float rhoScale;
+  ElInt andersonDepth;
 } ElADMMCtrl_s;
 
 typedef struct {
@@ -111,11 +137,66 @@ typedef struct {
   double relTol;
   bool inv;
   bool print;
+  bool adaptiveRho;
+  double rhoBalance;
+  double rhoScale;
+  ElInt andersonDepth;
 } ElADMMCtrl_d;
 
 EL_EXPORT ElError ElADMMCtrlDefault_s( ElADMMCtrl_s* ctrl );
 EL_EXPORT ElError ElADMMCtrlDefault_d( ElADMMCtrl_d* ctrl );
 
+/* Accelerated Proximal Gradient
+   ============================= */
+typedef struct {
+  ElInt maxIter;
+  float relTol;
+  float lipschitz;
+  float backtrackFactor;
+  bool restart;
+  bool print;
+} ElAPGCtrl_s;
+
+typedef struct {
+  ElInt maxIter;
+  double relTol;
+  double lipschitz;
+  double backtrackFactor;
+  bool restart;
+  bool print;
+} ElAPGCtrl_d;
+
+EL_EXPORT ElError ElAPGCtrlDefault_s( ElAPGCtrl_s* ctrl );
+EL_EXPORT ElError ElAPGCtrlDefault_d( ElAPGCtrl_d* ctrl );
+
+/* Presolve
+   ======== */
+/* See the C++ structure for documentation of the members */
+typedef struct {
+  bool removeEmptyRows;
+  bool removeEmptyColumns;
+  bool removeSingletonRows;
+  bool removeForcingRows;
+  bool removeDuplicateRows;
+  ElInt maxPasses;
+  float tol;
+  bool progress;
+} ElPresolveCtrl_s;
+
+typedef struct {
+  bool removeEmptyRows;
+  bool removeEmptyColumns;
+  bool removeSingletonRows;
+  bool removeForcingRows;
+  bool removeDuplicateRows;
+  ElInt maxPasses;
+  double tol;
+  bool progress;
+} ElPresolveCtrl_d;
+
+EL_EXPORT ElError ElPresolveCtrlDefault_s( ElPresolveCtrl_s* ctrl );
+EL_EXPORT ElError ElPresolveCtrlDefault_d( ElPresolveCtrl_d* ctrl );
+
 /* Linear programs
    =============== */
 typedef enum {
@@ -191,11 +272,15 @@ typedef struct {
   ElLPApproach approach; 
   ElADMMCtrl_s admmCtrl;
   ElMehrotraCtrl_s mehrotraCtrl;
+  bool presolve;
+  ElPresolveCtrl_s presolveCtrl;
 } ElLPDirectCtrl_s;
 typedef struct {
   ElLPApproach approach; 
   ElADMMCtrl_d admmCtrl;
   ElMehrotraCtrl_d mehrotraCtrl;
+  bool presolve;
+  ElPresolveCtrl_d presolveCtrl;
 } ElLPDirectCtrl_d;
 
 EL_EXPORT ElError ElLPDirectCtrlDefault_s
@@ -362,10 +447,14 @@ EL_EXPORT ElError ElLPAffineDistSparse_d
 typedef struct {
   ElLPApproach approach; 
   ElMehrotraCtrl_s mehrotraCtrl;
+  bool presolve;
+  ElPresolveCtrl_s presolveCtrl;
 } ElLPAffineCtrl_s;
 typedef struct {
   ElLPApproach approach; 
   ElMehrotraCtrl_d mehrotraCtrl;
+  bool presolve;
+  ElPresolveCtrl_d presolveCtrl;
 } ElLPAffineCtrl_d;
 
 EL_EXPORT ElError ElLPAffineCtrlDefault_s( ElLPAffineCtrl_s* ctrl );
@@ -545,10 +634,14 @@ EL_EXPORT ElError ElQPDirectDistSparse_d
 typedef struct {
   ElQPApproach approach; 
   ElMehrotraCtrl_s mehrotraCtrl;
+  bool presolve;
+  ElPresolveCtrl_s presolveCtrl;
 } ElQPDirectCtrl_s;
 typedef struct {
   ElQPApproach approach; 
   ElMehrotraCtrl_d mehrotraCtrl;
+  bool presolve;
+  ElPresolveCtrl_d presolveCtrl;
 } ElQPDirectCtrl_d;
 
 EL_EXPORT ElError ElQPDirectCtrlDefault_s( ElQPDirectCtrl_s* ctrl );
@@ -729,10 +822,14 @@ EL_EXPORT ElError ElQPAffineDistSparse_d
 typedef struct {
   ElQPApproach approach; 
   ElMehrotraCtrl_s mehrotraCtrl;
+  bool presolve;
+  ElPresolveCtrl_s presolveCtrl;
 } ElQPAffineCtrl_s;
 typedef struct {
   ElQPApproach approach; 
   ElMehrotraCtrl_d mehrotraCtrl;
+  bool presolve;
+  ElPresolveCtrl_d presolveCtrl;
 } ElQPAffineCtrl_d;
 
 EL_EXPORT ElError ElQPAffineCtrlDefault_s( ElQPAffineCtrl_s* ctrl );
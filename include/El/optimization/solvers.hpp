@@ -12,5 +12,8 @@
 #include <El/optimization/solvers/LP.hpp>
 #include <El/optimization/solvers/QP.hpp>
 #include <El/optimization/solvers/SOCP.hpp>
+#include <El/optimization/solvers/SDP.hpp>
+#include <El/optimization/solvers/ADMM.hpp>
+#include <El/optimization/solvers/APG.hpp>
 
 #endif // ifndef EL_OPTIMIZATION_SOLVERS_HPP
@@ -0,0 +1,333 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_ADMM_HPP
+#define EL_OPTIMIZATION_SOLVERS_ADMM_HPP
+
+#include <El/optimization/solvers/util.hpp>
+
+// A reusable engine for the scaled form of the Alternating Direction Method
+// of Multipliers applied to
+//
+//   min f(x) + g(z), s.t. x = z,
+//
+// i.e., for k=0,1,...,
+//
+//   x := arg min_x f(x) + rho/2 || x - (z - u) ||_2^2,
+//   xHat := alpha x + (1-alpha) z,
+//   z := arg min_z g(z) + rho/2 || z - (xHat + u) ||_2^2,
+//   u := u + (xHat - z),
+//
+// where alpha in (0,2) is the over-relaxation parameter. See
+//
+//   S. Boyd, N. Parikh, E. Chu, B. Peleato, and J. Eckstein,
+//   "Distributed optimization and statistical learning via the alternating
+//    direction method of multipliers", Foundations and Trends in Machine
+//   Learning, Vol. 3, No. 1, pp. 1--122, 2011.
+//
+// Global-variable consensus (Section 7.1 of the above) fits the same form by
+// storing the local copies of x, and the replicated z, as the columns of a
+// DistMatrix<Field,STAR,VC> (one column per process) and averaging over the
+// columns within the proximal map of g.
+//
+// When ctrl.adaptiveRho is set, rho is balanced against the ratio of the
+// primal and dual residuals (Section 3.4.1 of the above). The (z,u)
+// fixed-point iteration may also be accelerated with the type-II Anderson
+// acceleration of
+//
+//   H.F. Walker and P. Ni,
+//   "Anderson acceleration for fixed-point iterations",
+//   SIAM Journal on Numerical Analysis, Vol. 49, No. 4, pp. 1715--1735, 2011,
+//
+// which is restarted whenever the fixed-point residual increases or rho
+// changes.
+//
+
+namespace El {
+
+namespace admm {
+
+// In what follows, 'xUpdate' and 'zUpdate' should be functions of the form
+//
+//   void update( Real rho, const VectorType& v, VectorType& w )
+//
+// and overwrite w with the proximal map of f/rho (respectively g/rho)
+// evaluated at v. Since rho only changes by factors of ctrl.rhoScale, an
+// xUpdate which caches a factorization should only refactor when rho differs
+// from the value the factorization was formed with. 'monitor' should have
+// the form
+//
+//   void monitor( Int iter, const VectorType& x, const VectorType& z )
+//
+// and is called after each iteration when ctrl.print is true (e.g., in order
+// to print an objective). VectorType is either Matrix<Field> or a
+// DistMatrix<Field,U,V>.
+//
+// The number of iterations is returned; it is equal to ctrl.maxIter if the
+// stopping criteria were never met, in which case (x,z,u) hold the last
+// iterate and the caller decides whether or not this is an error.
+//
+
+using first_order::IsRoot;
+
+// Type-II Anderson acceleration of the fixed-point map (z,u) -> T(z,u)
+template<typename Field,class VectorType>
+class Anderson
+{
+public:
+    Anderson( Int depth ) : depth_(depth) { }
+
+    void Restart()
+    {
+        dFz_.clear(); dFu_.clear(); dGz_.clear(); dGu_.clear();
+        fzLast_.clear(); fuLast_.clear(); gzLast_.clear(); guLast_.clear();
+    }
+
+    // Given the input (z,u) of the fixed-point map and its output (gz,gu),
+    // overwrite the latter with the accelerated iterate and return whether
+    // or not it was modified
+    bool Accelerate
+    ( const VectorType& z,
+      const VectorType& u,
+            VectorType& gz,
+            VectorType& gu )
+    {
+        EL_DEBUG_CSE
+        typedef Base<Field> Real;
+        if( depth_ <= 0 )
+            return false;
+
+        auto fz = gz;
+        auto fu = gu;
+        fz -= z;
+        fu -= u;
+        if( !fzLast_.empty() )
+        {
+            Push( dFz_, fz, fzLast_[0] );
+            Push( dFu_, fu, fuLast_[0] );
+            Push( dGz_, gz, gzLast_[0] );
+            Push( dGu_, gu, guLast_[0] );
+            fzLast_[0] = fz; fuLast_[0] = fu;
+            gzLast_[0] = gz; guLast_[0] = gu;
+        }
+        else
+        {
+            fzLast_.push_back( fz ); fuLast_.push_back( fu );
+            gzLast_.push_back( gz ); guLast_.push_back( gu );
+        }
+        const Int k = dFz_.size();
+        if( k == 0 )
+            return false;
+
+        // gamma := arg min || f - dF gamma ||_2 via the regularized normal
+        // equations, which are tiny
+        Matrix<Real> H, gamma;
+        Zeros( H, k, k );
+        Zeros( gamma, k, 1 );
+        Real maxDiag = 0;
+        for( Int i=0; i<k; ++i )
+        {
+            gamma(i) = RealPart(Dot(dFz_[i],fz)) + RealPart(Dot(dFu_[i],fu));
+            for( Int j=0; j<=i; ++j )
+                H(i,j) = RealPart(Dot(dFz_[i],dFz_[j])) +
+                         RealPart(Dot(dFu_[i],dFu_[j]));
+            maxDiag = Max( maxDiag, H(i,i) );
+        }
+        if( maxDiag == Real(0) )
+            return false;
+        ShiftDiagonal( H, Sqrt(limits::Epsilon<Real>())*maxDiag );
+        try
+        {
+            Cholesky( LOWER, H );
+            cholesky::SolveAfter( LOWER, NORMAL, H, gamma );
+        }
+        catch( std::exception& e )
+        {
+            Restart();
+            return false;
+        }
+
+        // g := g - dG gamma
+        for( Int i=0; i<k; ++i )
+        {
+            Axpy( Field(-gamma(i)), dGz_[i], gz );
+            Axpy( Field(-gamma(i)), dGu_[i], gu );
+        }
+        return true;
+    }
+
+private:
+    Int depth_;
+    // The histories of differences of residuals and of map outputs
+    vector<VectorType> dFz_, dFu_, dGz_, dGu_;
+    // The last residual and map output (stored as vectors of length at most
+    // one since VectorType need not be default-constructible on the right
+    // grid)
+    vector<VectorType> fzLast_, fuLast_, gzLast_, guLast_;
+
+    void Push
+    ( vector<VectorType>& history,
+      const VectorType& current,
+      const VectorType& last )
+    {
+        if( Int(history.size()) == depth_ )
+            history.erase( history.begin() );
+        history.push_back( current );
+        history.back() -= last;
+    }
+};
+
+template<typename Field,class VectorType,
+         class XUpdateType,class ZUpdateType,class MonitorType>
+Int Solve
+( const XUpdateType& xUpdate,
+  const ZUpdateType& zUpdate,
+  const MonitorType& monitor,
+        VectorType& x,
+        VectorType& z,
+        VectorType& u,
+  const ADMMCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( ctrl.rho <= Real(0) )
+        LogicError("rho must be positive");
+    if( ctrl.alpha <= Real(0) || ctrl.alpha >= Real(2) )
+        LogicError("alpha must lie in (0,2)");
+    const Real sqrtSize = Sqrt(Real(z.Height()*z.Width()));
+
+    Real rho = ctrl.rho;
+    Anderson<Field,VectorType> anderson( ctrl.andersonDepth );
+    bool accelerated = false;
+    Real lastFixedPointResid = 0;
+
+    auto v = z;
+    auto xHat = z;
+    auto zOld = z;
+    auto uOld = u;
+    auto t = z;
+    Int numIter=0;
+    while( numIter < ctrl.maxIter )
+    {
+        zOld = z;
+        uOld = u;
+
+        // x := prox_{f/rho}(z - u)
+        v = z;
+        v -= u;
+        xUpdate( rho, v, x );
+
+        // xHat := alpha x + (1-alpha) zOld
+        xHat = x;
+        xHat *= ctrl.alpha;
+        Axpy( 1-ctrl.alpha, zOld, xHat );
+
+        // z := prox_{g/rho}(xHat + u)
+        v = xHat;
+        v += u;
+        zUpdate( rho, v, z );
+
+        // u := u + (xHat - z)
+        u += xHat;
+        u -= z;
+
+        // rNorm := || x - z ||_2
+        t = x;
+        t -= z;
+        const Real rNorm = FrobeniusNorm( t );
+        // sNorm := rho || z - zOld ||_2
+        t = z;
+        t -= zOld;
+        const Real zDiffNorm = FrobeniusNorm( t );
+        const Real sNorm = rho*zDiffNorm;
+
+        const Real epsPri = sqrtSize*ctrl.absTol +
+            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+        const Real epsDual = sqrtSize*ctrl.absTol +
+            ctrl.relTol*rho*FrobeniusNorm(u);
+        if( ctrl.print )
+        {
+            if( IsRoot(x) )
+                Output
+                (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
+                 ", rho ||z-zOld||_2=",sNorm,", epsDual=",epsDual,
+                 ", rho=",rho);
+            monitor( numIter, x, z );
+        }
+        if( rNorm < epsPri && sNorm < epsDual )
+            break;
+        ++numIter;
+
+        if( ctrl.andersonDepth > 0 )
+        {
+            // Restart if the last accelerated step increased the residual
+            t = u;
+            t -= uOld;
+            const Real uDiffNorm = FrobeniusNorm( t );
+            const Real fixedPointResid =
+              Sqrt(zDiffNorm*zDiffNorm+uDiffNorm*uDiffNorm);
+            if( accelerated && fixedPointResid > lastFixedPointResid )
+                anderson.Restart();
+            lastFixedPointResid = fixedPointResid;
+            accelerated = anderson.Accelerate( zOld, uOld, z, u );
+        }
+
+        if( ctrl.adaptiveRho )
+        {
+            Real rhoNew = rho;
+            if( rNorm > ctrl.rhoBalance*sNorm )
+                rhoNew = rho*ctrl.rhoScale;
+            else if( sNorm > ctrl.rhoBalance*rNorm )
+                rhoNew = rho/ctrl.rhoScale;
+            if( rhoNew != rho )
+            {
+                // The scaled dual variable is y/rho
+                u *= rho/rhoNew;
+                rho = rhoNew;
+                anderson.Restart();
+                accelerated = false;
+            }
+        }
+    }
+    return numIter;
+}
+
+} // namespace admm
+
+template<typename Field,class VectorType,class XUpdateType,class ZUpdateType>
+Int ADMM
+( const XUpdateType& xUpdate,
+  const ZUpdateType& zUpdate,
+        VectorType& x,
+        VectorType& z,
+        VectorType& u,
+  const ADMMCtrl<Base<Field>>& ctrl=ADMMCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    auto monitor = []( Int, const VectorType&, const VectorType& ) { };
+    return admm::Solve<Field>( xUpdate, zUpdate, monitor, x, z, u, ctrl );
+}
+
+template<typename Field,class VectorType,
+         class XUpdateType,class ZUpdateType,class MonitorType>
+Int ADMM
+( const XUpdateType& xUpdate,
+  const ZUpdateType& zUpdate,
+  const MonitorType& monitor,
+        VectorType& x,
+        VectorType& z,
+        VectorType& u,
+  const ADMMCtrl<Base<Field>>& ctrl=ADMMCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return admm::Solve<Field>( xUpdate, zUpdate, monitor, x, z, u, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_ADMM_HPP
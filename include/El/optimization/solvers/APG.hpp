@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_APG_HPP
+#define EL_OPTIMIZATION_SOLVERS_APG_HPP
+
+#include <El/optimization/solvers/util.hpp>
+
+// An Accelerated Proximal Gradient method for
+//
+//   min f(x) + h(x),
+//
+// where f is smooth and the proximal map of h is cheap, using the
+// backtracking line search of
+//
+//   A. Beck and M. Teboulle,
+//   "A fast iterative shrinkage-thresholding algorithm for linear inverse
+//    problems", SIAM Journal on Imaging Sciences, Vol. 2, No. 1,
+//   pp. 183--202, 2009,
+//
+// along with the function-value momentum restart of
+//
+//   B. O'Donoghue and E. Candes,
+//   "Adaptive restart for accelerated gradient schemes", Foundations of
+//   Computational Mathematics, Vol. 15, No. 3, pp. 715--732, 2015.
+//
+
+namespace El {
+
+namespace apg {
+
+// In what follows, 'smooth' should be a function of the form
+//
+//   Real smooth( const VectorType& x, VectorType& gradient )
+//
+// which returns f(x) and overwrites 'gradient' with its gradient, whereas
+// 'value' should have the form
+//
+//   Real value( const VectorType& x )
+//
+// and only return f(x) (for the trial points of the line search). 'prox'
+// should have the form
+//
+//   void prox( Real t, VectorType& x )
+//
+// and overwrite x with the proximal map of t h evaluated at x, and
+// 'nonsmooth' should have the form
+//
+//   Real nonsmooth( const VectorType& x )
+//
+// and return h(x). VectorType is either Matrix<Real>, DistMatrix<Real>, or
+// DistMultiVec<Real>.
+//
+
+using first_order::IsRoot;
+
+} // namespace apg
+
+template<typename Real,class VectorType,
+         class SmoothType,class ValueType,class ProxType,class NonsmoothType>
+Int APG
+( const SmoothType& smooth,
+  const ValueType& value,
+  const ProxType& prox,
+  const NonsmoothType& nonsmooth,
+        VectorType& x,
+  const APGCtrl<Real>& ctrl=APGCtrl<Real>() )
+{
+    EL_DEBUG_CSE
+    if( ctrl.lipschitz <= Real(0) )
+        LogicError("The Lipschitz estimate must be positive");
+    if( ctrl.backtrackFactor <= Real(1) )
+        LogicError("The backtracking factor must exceed one");
+    const bool root = apg::IsRoot( x );
+
+    Real L = ctrl.lipschitz;
+    Real t = 1;
+    Real objective = value(x) + nonsmooth(x);
+
+    auto y = x;
+    auto xNew = x;
+    auto gradient = x;
+    auto diff = x;
+    Int numIter=0;
+    while( true )
+    {
+        const Real fy = smooth( y, gradient );
+
+        // Backtrack until
+        //   f(xNew) <= f(y) + <grad f(y),xNew-y> + L/2 || xNew - y ||_2^2
+        Real fNew, diffNorm;
+        while( true )
+        {
+            xNew = y;
+            Axpy( -1/L, gradient, xNew );
+            prox( 1/L, xNew );
+            diff = xNew;
+            diff -= y;
+            diffNorm = Nrm2( diff );
+            fNew = value( xNew );
+            const Real bound =
+              fy + Dot(gradient,diff) + L/2*diffNorm*diffNorm;
+            if( fNew <= bound || diffNorm == Real(0) )
+                break;
+            L *= ctrl.backtrackFactor;
+            if( !limits::IsFinite(L) )
+                RuntimeError("The APG line search failed");
+        }
+        const Real objectiveNew = fNew + nonsmooth( xNew );
+
+        // diff := xNew - x
+        diff = xNew;
+        diff -= x;
+        const Real stepNorm = Nrm2( diff );
+        const Real xNewNorm = Nrm2( xNew );
+        x = xNew;
+        ++numIter;
+        if( ctrl.print && root )
+            Output
+            ("iter ",numIter,": objective=",objectiveNew,", L=",L,
+             ", || x_{k+1} - x_k ||_2=",stepNorm);
+        if( stepNorm <= ctrl.relTol*Max(xNewNorm,Real(1)) )
+            break;
+        if( numIter == ctrl.maxIter )
+            RuntimeError("APG failed to converge");
+
+        if( ctrl.restart && objectiveNew > objective )
+        {
+            t = 1;
+            y = x;
+        }
+        else
+        {
+            // y := x + ((t-1)/tNew) (x - xOld)
+            const Real tNew = (1+Sqrt(1+4*t*t))/2;
+            y = x;
+            Axpy( (t-1)/tNew, diff, y );
+            t = tNew;
+        }
+        objective = objectiveNew;
+    }
+    return numIter;
+}
+
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_APG_HPP
@@ -43,6 +43,13 @@ struct Ctrl
     ADMMCtrl<Real> admmCtrl;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Presolve sparse problems before calling the IPM? Since any initial
+    // guess in the solution is for the original rather than the reduced
+    // problem, 'mehrotraCtrl.primalInit' and 'mehrotraCtrl.dualInit' are
+    // ignored when presolving.
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl( bool isSparse )
     { mehrotraCtrl.system = ( isSparse ? AUGMENTED_KKT : NORMAL_KKT ); }
 };
@@ -67,6 +74,11 @@ struct Ctrl
 {
     LPApproach approach=LP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+
+    // Presolve sparse problems before calling the IPM? As for the direct
+    // solver, the Mehrotra initial guess flags are then ignored.
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
 };
 
 } // namespace affine
@@ -578,6 +590,92 @@ void LP
         DistMultiVec<Real>& s,
   const lp::affine::Ctrl<Real>& ctrl=lp::affine::Ctrl<Real>() );
 
+// Warm-started re-solves
+// ----------------------
+// Solve the next member of a sequence of sparse LPs whose matrices share their
+// sparsity patterns using the Mehrotra IPM, reusing the symbolic analysis and
+// equilibration stored in the session and starting from its (lifted) previous
+// solution. The session is reset if the problem dimensions or the sparsity
+// patterns of its matrices change.
+template<typename Real>
+void LP
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        SparseMehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
+template<typename Real>
+void LP
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+        DistSparseMehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
+template<typename Real>
+void LP
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        AffineLPSolution<Matrix<Real>>& solution,
+        SparseMehrotraSession<Real>& session,
+  const lp::affine::Ctrl<Real>& ctrl=lp::affine::Ctrl<Real>() );
+template<typename Real>
+void LP
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        AffineLPSolution<DistMultiVec<Real>>& solution,
+        DistSparseMehrotraSession<Real>& session,
+  const lp::affine::Ctrl<Real>& ctrl=lp::affine::Ctrl<Real>() );
+
+// Presolve
+// --------
+// Form a reduced sparse LP (see PresolveCtrl) along with a record of the
+// reductions, and map a solution of the reduced LP back to the original.
+// Infeasibility or unboundedness detected during presolve results in an
+// exception.
+template<typename Real>
+void Presolve
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& reducedProblem,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void Presolve
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>&
+          reducedProblem,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void Presolve
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& reducedProblem,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void Presolve
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>&
+          reducedProblem,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const DirectLPSolution<Matrix<Real>>& reducedSolution,
+        DirectLPSolution<Matrix<Real>>& solution );
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const DirectLPSolution<DistMultiVec<Real>>& reducedSolution,
+        DirectLPSolution<DistMultiVec<Real>>& solution );
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const AffineLPSolution<Matrix<Real>>& reducedSolution,
+        AffineLPSolution<Matrix<Real>>& solution );
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const AffineLPSolution<DistMultiVec<Real>>& reducedSolution,
+        AffineLPSolution<DistMultiVec<Real>>& solution );
+
 // Mathematical Programming System
 // -------------------------------
 
@@ -42,9 +42,63 @@ struct Ctrl
     QPApproach approach=QP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Presolve sparse problems before calling the IPM? Since any initial
+    // guess in the solution is for the original rather than the reduced
+    // problem, 'mehrotraCtrl.primalInit' and 'mehrotraCtrl.dualInit' are
+    // ignored when presolving.
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl() { mehrotraCtrl.system = AUGMENTED_KKT; }
 };
 
+// Form a reduced sparse QP (see PresolveCtrl), where 'Q' must be explicitly
+// symmetric, along with a record of the reductions, and map a solution of the
+// reduced QP back to the original.
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z );
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z );
+
 } // namespace direct
 
 namespace affine {
@@ -65,8 +119,69 @@ struct Ctrl
 {
     QPApproach approach=QP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+
+    // Presolve sparse problems before calling the IPM? As for the direct
+    // solver, the Mehrotra initial guess flags are then ignored.
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
 };
 
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        SparseMatrix<Real>& GRed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        Matrix<Real>& hRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& G,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& h,
+        DistSparseMatrix<Real>& QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistSparseMatrix<Real>& GRed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        DistMultiVec<Real>& hRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+  const Matrix<Real>& sRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s );
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+  const DistMultiVec<Real>& sRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s );
+
 } // namespace affine
 
 namespace box {
@@ -198,6 +313,64 @@ void QP
         DistMultiVec<Real>& s,
   const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
 
+// Warm-started re-solves
+// ----------------------
+// Solve the next member of a sequence of sparse QPs whose matrices share their
+// sparsity patterns using the Mehrotra IPM, reusing the symbolic analysis and
+// equilibration stored in the session and starting from its (lifted) previous
+// solution. The session is reset if the problem dimensions or the sparsity
+// patterns of its matrices change.
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        SparseMehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
+template<typename Real>
+void QP
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistSparseMehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+        SparseMehrotraSession<Real>& session,
+  const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
+template<typename Real>
+void QP
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& G,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& h,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s,
+        DistSparseMehrotraSession<Real>& session,
+  const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
+
 } // namespace El
 
 #endif // ifndef EL_OPTIMIZATION_SOLVERS_QP_HPP
@@ -0,0 +1,90 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_SDP_HPP
+#define EL_OPTIMIZATION_SOLVERS_SDP_HPP
+
+#include <El/optimization/solvers/util.hpp>
+
+namespace El {
+
+namespace SDPApproachNS {
+enum SDPApproach {
+  SDP_MEHROTRA
+};
+} // namespace SDPApproachNS
+using namespace SDPApproachNS;
+
+namespace sdp {
+namespace direct {
+
+// Attempt to solve a pair of Semidefinite Programs in "direct" conic form:
+//
+//   min c^T x,
+//   s.t. A x = b, x in K,
+//
+//   max -b^T y
+//   s.t. A^T y - z + c = 0, z in K,
+//
+// where the cone K is a product of positive semidefinite cones and each
+// member of K is stored as the concatenation of the column-major storage of
+// its diagonal blocks (see El/optimization/util/psd.hpp). Each row of A, as
+// well as c, is therefore a vectorized block-diagonal matrix, and only its
+// symmetric part is significant.
+//
+// The Nesterov-Todd search directions are computed from the (dense) Schur
+// complement A (W kron W) A^T, which is factored with a Cholesky
+// decomposition.
+//
+
+// Control structure for the high-level "direct" conic-form SDP solver
+// -------------------------------------------------------------------
+template<typename Real>
+struct Ctrl
+{
+    SDPApproach approach=SDP_MEHROTRA;
+    MehrotraCtrl<Real> mehrotraCtrl;
+
+    // The maximum order of a block which is assigned to a single process
+    // within the distributed cone operations
+    Int cutoff=1000;
+
+    Ctrl()
+    {
+        mehrotraCtrl.minTol = Pow(limits::Epsilon<Real>(),Real(0.25));
+        mehrotraCtrl.targetTol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    }
+};
+
+} // namespace direct
+} // namespace sdp
+
+template<typename Real>
+void SDP
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Int>& orders,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const sdp::direct::Ctrl<Real>& ctrl=sdp::direct::Ctrl<Real>() );
+template<typename Real>
+void SDP
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const AbstractDistMatrix<Real>& c,
+  const Matrix<Int>& orders,
+        AbstractDistMatrix<Real>& x,
+        AbstractDistMatrix<Real>& y,
+        AbstractDistMatrix<Real>& z,
+  const sdp::direct::Ctrl<Real>& ctrl=sdp::direct::Ctrl<Real>() );
+
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_SDP_HPP
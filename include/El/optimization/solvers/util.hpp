@@ -15,7 +15,12 @@ namespace KKTSystemNS {
 enum KKTSystem {
   FULL_KKT,
   AUGMENTED_KKT,
-  NORMAL_KKT
+  NORMAL_KKT,
+  // The normal equations with the dense columns of A split off; the sparse
+  // part is factored and used to precondition the full normal operator
+  SPLIT_NORMAL_KKT,
+  // The normal equations solved inexactly using only products with A
+  MATRIX_FREE_NORMAL_KKT
 };
 }
 using namespace KKTSystemNS;
@@ -69,13 +74,53 @@ struct MehrotraCtrl
     // constraints, i.e., x in K, both AUGMENTED_KKT (use a QSD solver) and
     // NORMAL_KKT (use a Cholesky solver) are also possible. The latter should
     // be avoided when the normal equations are sufficiently denser than the
-    // (larger) augmented formulation.
+    // (larger) augmented formulation. SPLIT_NORMAL_KKT only factors the
+    // normal equations of the sparse columns of A and handles the remaining
+    // low-rank correction with preconditioned Conjugate Gradient.
+    // MATRIX_FREE_NORMAL_KKT avoids factorizations altogether and solves the
+    // normal equations with Conjugate Gradient, preconditioned by a partial
+    // Cholesky factorization. It is currently only supported by the sparse
+    // direct LP solvers (the reduced systems of QPs require solves with
+    // Q + inv(X) Z, which are not available through products alone), and
+    // there is not yet a MINRES alternative for the augmented system. Dense
+    // problems treat both of the latter as NORMAL_KKT.
     KKTSystem system=FULL_KKT;
 
+    // When using SPLIT_NORMAL_KKT, a column of A is treated as dense if its
+    // number of nonzeros exceeds both 'denseColumnRatio' times the height of
+    // A and 'denseColumnMinNonzeros'.
+    Real denseColumnRatio=Real(0.1);
+    Int denseColumnMinNonzeros=50;
+
+    // When using MATRIX_FREE_NORMAL_KKT, each Newton system is solved to a
+    // relative tolerance of 'krylovForcingFactor' times the current relative
+    // error of the IPM (capped at one), but no tighter than solveCtrl.relTol,
+    // using at most 'maxKrylovIts' iterations. The preconditioner exactly
+    // factors the 'krylovPrecondRank' columns of the normal matrix with the
+    // largest diagonal entries (which become dominant as the barrier
+    // parameter goes to zero) and uses the diagonal of the remaining Schur
+    // complement; a rank of zero yields a Jacobi preconditioner.
+    Real krylovForcingFactor=Real(0.1);
+    Int maxKrylovIts=1000;
+    Int krylovPrecondRank=20;
+
     // Use Mehrotra's second-order corrector?
-    // TODO(poulson): Add support for Gondzio's correctors
     bool mehrotra=true;
 
+    // The maximum number of Gondzio's multiple centrality correctors to add
+    // to the combined direction. Each corrector requires one additional solve
+    // with the existing factorization of the KKT system and attempts to move
+    // the complementarity products of a trial point with step lengths
+    // increased by 'centralityStepIncrease' into the interval
+    // [centralityLowerRatio*sigma*mu,centralityUpperRatio*sigma*mu]. A
+    // corrector is only accepted if it increases the step length by at least
+    // 'centralityMinAcceptance*centralityStepIncrease'.
+    Int maxCentralityCorrectors=0;
+    Real centralityLowerRatio=Real(0.1);
+    Real centralityUpperRatio=Real(10);
+    Real centralityStepIncrease=Real(0.1);
+    Real centralityMinAcceptance=Real(0.1);
+
     // For determining the ratio of the amount to balance the affine and 
     // correction updates. The other common option is 'MehrotraCentrality'.
     function<Real(Real,Real,Real,Real)>
@@ -161,6 +206,274 @@ struct MehrotraCtrl
     // replace the default, (muAff/mu)^3
 };
 
+// Gondzio's multiple centrality correctors
+// ========================================
+// Attempt to lengthen the primal and dual steps of the combined direction with
+// up to 'ctrl.maxCentralityCorrectors' centrality correctors. The function
+//
+//   bool tryCorrector
+//   ( Real alphaPriTarget, Real alphaDualTarget,
+//     Real& alphaPriNew, Real& alphaDualNew )
+//
+// should solve (with the existing factorization) for the corrector of the
+// trial point reached with the target step lengths, form the sum of the
+// current direction and the corrector in a temporary, and return the step
+// lengths of the sum (or 'false' if the solve failed), while
+// 'acceptCorrector()' should overwrite the current direction with said sum.
+// The number of accepted correctors is returned.
+template<typename Real,class TryCorrectorType,class AcceptCorrectorType>
+Int CentralityCorrectors
+(       Real& alphaPri,
+        Real& alphaDual,
+  const TryCorrectorType& tryCorrector,
+  const AcceptCorrectorType& acceptCorrector,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Real minIncrease =
+      ctrl.centralityMinAcceptance*ctrl.centralityStepIncrease;
+    Int numAccepted = 0;
+    for( ; numAccepted<ctrl.maxCentralityCorrectors; ++numAccepted )
+    {
+        if( Min(alphaPri,alphaDual) >= Real(1) )
+            break;
+        const Real alphaPriTarget =
+          Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+        const Real alphaDualTarget =
+          Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+
+        Real alphaPriNew, alphaDualNew;
+        if( !tryCorrector
+             (alphaPriTarget,alphaDualTarget,alphaPriNew,alphaDualNew) )
+            break;
+        if( ctrl.forceSameStep )
+            alphaPriNew = alphaDualNew = Min(alphaPriNew,alphaDualNew);
+        const Real alphaNew = Min(alphaPriNew,alphaDualNew);
+        if( alphaNew < Min(alphaPri,alphaDual)+minIncrease )
+            break;
+
+        acceptCorrector();
+        alphaPri = alphaPriNew;
+        alphaDual = alphaDualNew;
+    }
+    return numAccepted;
+}
+
+namespace sparsity {
+
+// An FNV-1a hash of the offsets and targets of the locally-stored rows of a
+// sparse matrix, which identifies its sparsity pattern
+inline unsigned long long Hash
+( const Int* offsetBuf, Int numOffsets, const Int* targetBuf, Int numTargets )
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    auto absorb = [&]( Int value )
+      {
+          hash ^= static_cast<unsigned long long>(value);
+          hash *= 1099511628211ULL;
+      };
+    for( Int e=0; e<numOffsets; ++e )
+        absorb( offsetBuf[e] );
+    for( Int e=0; e<numTargets; ++e )
+        absorb( targetBuf[e] );
+    return hash;
+}
+
+template<typename Real>
+unsigned long long Hash( const SparseMatrix<Real>& J )
+{
+    return Hash
+    ( J.LockedOffsetBuffer(), J.Height()+1,
+      J.LockedTargetBuffer(), J.NumEntries() );
+}
+
+template<typename Real>
+unsigned long long Hash( const DistSparseMatrix<Real>& J )
+{
+    return Hash
+    ( J.LockedOffsetBuffer(), J.LocalHeight()+1,
+      J.LockedTargetBuffer(), J.NumLocalEntries() );
+}
+
+// A combined hash of the sparsity patterns of several matrices
+template<class SparseMatrixType,class... Rest>
+unsigned long long Hash
+( const SparseMatrixType& A, const SparseMatrixType& B, const Rest&... rest )
+{ return 1099511628211ULL*Hash(A) ^ Hash(B,rest...); }
+
+// Each process only hashes its own rows, so they must agree upon the result
+template<typename Real>
+bool AllProcesses( bool condition, const SparseMatrix<Real>& J )
+{ return condition; }
+
+template<typename Real>
+bool AllProcesses( bool condition, const DistSparseMatrix<Real>& J )
+{ return mpi::AllReduce( int(condition), mpi::MIN, J.Grid().Comm() ) != 0; }
+
+} // namespace sparsity
+
+// Warm-started re-solves
+// ======================
+// A session for solving a sequence of related sparse problems whose matrices
+// share their sparsity patterns (e.g., rolling-horizon instances which only
+// differ in their right-hand sides, objectives, or a few bounds). The symbolic
+// analysis of the KKT system and the outer equilibration from the first
+// (cold) solve are reused by each subsequent solve, which begins from the
+// previous solution after lifting its cone variables away from the boundary.
+template<typename Real,class FactorizationType,class VectorType>
+struct MehrotraSession
+{
+    // Each entry of the previous cone variables is raised to at least
+    // 'warmStartShift' times the maximum of one and the max norm of said
+    // variable before being used as the initial guess of a re-solve.
+    Real warmStartShift=Real(0.01);
+
+    // Reuse the outer equilibration of the first solve? This should only be
+    // disabled if the magnitudes of the matrix entries change substantially.
+    bool reuseEquilibration=true;
+
+    // The symbolic analysis of the KKT system, along with the system type and
+    // the height, number of nonzeros, and (local) sparsity pattern hash of
+    // the matrix it was performed for
+    FactorizationType factorization;
+    bool analyzed=false;
+    KKTSystem system=FULL_KKT;
+    Int kktHeight=0, kktNumNonzeros=0;
+    unsigned long long kktPatternHash=0;
+
+    // The hash of the sparsity patterns of the problem matrices of the most
+    // recent solve
+    unsigned long long problemPatternHash=0;
+
+    // The outer equilibration, i.e., the row scalings of 'A' and 'G' (the
+    // latter is empty for direct conic form) and the column scaling
+    bool equilibrated=false;
+    VectorType rowScaleA, rowScaleG, colScale;
+
+    // The solution of the most recent solve ('s' is empty for direct conic
+    // form)
+    bool haveSolution=false;
+    VectorType x, y, z, s;
+
+    // The number of solves, the number of IPM iterations of the first and the
+    // most recent solves, and the total number of iterations saved by the
+    // warm starts relative to the first solve (a warm start which needs more
+    // iterations than the first solve is counted as saving none rather than
+    // offsetting the savings of the others)
+    Int numSolves=0;
+    Int coldIterations=0;
+    Int lastIterations=0;
+    Int iterationsSaved=0;
+
+    // Forget the analysis, equilibration, solution, and statistics (e.g., if
+    // a sparsity pattern or a problem dimension changes)
+    void Reset()
+    {
+        analyzed = false;
+        equilibrated = false;
+        haveSolution = false;
+        numSolves = coldIterations = lastIterations = iterationsSaved = 0;
+    }
+
+    void RecordIterations( Int numIts )
+    {
+        if( numSolves == 0 )
+            coldIterations = numIts;
+        else
+            iterationsSaved += Max( coldIterations-numIts, Int(0) );
+        lastIterations = numIts;
+        ++numSolves;
+    }
+
+    // Lift a cone variable of the previous solution away from the boundary
+    // (see 'warmStartShift')
+    void LiftConeVariable( VectorType& v ) const
+    {
+        const Real vMax = Max( MaxNorm(v), Real(1) );
+        LowerClip( v, warmStartShift*vMax );
+    }
+
+    // Record the sparsity patterns of the problem matrices and return whether
+    // they differ from those of the most recent solve (a session should be
+    // reset in that case, as its solution is for an unrelated problem)
+    template<class SparseMatrixType,class... Rest>
+    bool ProblemPatternChanged
+    ( const SparseMatrixType& A, const Rest&... rest )
+    {
+        const unsigned long long hash = sparsity::Hash( A, rest... );
+        const bool unchanged =
+          sparsity::AllProcesses( hash == problemPatternHash, A );
+        problemPatternHash = hash;
+        return !unchanged;
+    }
+
+    // Can the stored symbolic analysis be reused for the KKT matrix 'J'?
+    template<class SparseMatrixType>
+    bool CanReuseAnalysis
+    ( const SparseMatrixType& J, KKTSystem kktSystem ) const
+    {
+        if( !analyzed )
+            return false;
+        const bool matches =
+          system == kktSystem &&
+          kktHeight == J.Height() && kktNumNonzeros == J.NumEntries() &&
+          kktPatternHash == sparsity::Hash( J );
+        return sparsity::AllProcesses( matches, J );
+    }
+
+    template<class SparseMatrixType>
+    void RecordAnalysis( const SparseMatrixType& J, KKTSystem kktSystem )
+    {
+        analyzed = true;
+        system = kktSystem;
+        kktHeight = J.Height();
+        kktNumNonzeros = J.NumEntries();
+        kktPatternHash = sparsity::Hash( J );
+    }
+};
+
+template<typename Real>
+using SparseMehrotraSession =
+  MehrotraSession<Real,SparseLDLFactorization<Real>,Matrix<Real>>;
+template<typename Real>
+using DistSparseMehrotraSession =
+  MehrotraSession<Real,DistSparseLDLFactorization<Real>,DistMultiVec<Real>>;
+
+template<typename Real>
+void PrintSessionSummary( const SparseMehrotraSession<Real>& session )
+{
+    Output
+    ("Solve ",session.numSolves," took ",session.lastIterations,
+     " iterations (the cold solve took ",session.coldIterations,"); ",
+     session.iterationsSaved," iterations saved so far");
+}
+
+template<typename Real>
+void PrintSessionSummary( const DistSparseMehrotraSession<Real>& session )
+{
+    OutputFromRoot
+    (session.x.Grid().Comm(),
+     "Solve ",session.numSolves," took ",session.lastIterations,
+     " iterations (the cold solve took ",session.coldIterations,"); ",
+     session.iterationsSaved," iterations saved so far");
+}
+
+// First-order methods
+// ===================
+namespace first_order {
+
+// Whether or not the calling process should report the progress of a
+// first-order method upon the (possibly distributed) iterate x
+template<class VectorType>
+bool IsRoot( const VectorType& x )
+{ return mpi::Rank(x.Grid().Comm()) == 0; }
+
+template<typename Field>
+bool IsRoot( const Matrix<Field>& x )
+{ return true; }
+
+} // namespace first_order
+
 // Alternating Direction Method of Multipliers
 // ===========================================
 template<typename Real>
@@ -174,6 +487,115 @@ struct ADMMCtrl
     Real relTol=Real(1e-4);
     bool inv=true;
     bool print=true;
+
+    // Residual balancing: rho is multiplied (divided) by 'rhoScale' whenever
+    // the primal residual exceeds (falls below) 'rhoBalance' times the dual
+    // residual (or its inverse)
+    bool adaptiveRho=false;
+    Real rhoBalance=Real(10);
+    Real rhoScale=Real(2);
+
+    // The memory of the Anderson acceleration (zero disables it)
+    Int andersonDepth=0;
+};
+
+// Accelerated Proximal Gradient
+// =============================
+template<typename Real>
+struct APGCtrl
+{
+    Int maxIter=1000;
+    // Stop once || x_{k+1} - x_k ||_2 <= relTol max(|| x_{k+1} ||_2,1)
+    Real relTol=Real(1e-6);
+    // The initial estimate of the Lipschitz constant of the gradient, which
+    // is multiplied by 'backtrackFactor' until the sufficient decrease
+    // condition holds
+    Real lipschitz=Real(1);
+    Real backtrackFactor=Real(2);
+    // Reset the momentum whenever the objective increases?
+    bool restart=true;
+    bool print=false;
+};
+
+// Presolve
+// ========
+// Remove empty rows and columns, fix the variables determined by singleton
+// equality rows, eliminate forcing equality rows (whose variables must all be
+// zero for a feasible point), and drop duplicate equality rows, repeating until
+// no further reductions are found. Each reduction is recorded so that a
+// solution of the reduced problem can be mapped back to the original.
+template<typename Real>
+struct PresolveCtrl
+{
+    bool removeEmptyRows=true;
+    bool removeEmptyColumns=true;
+    bool removeSingletonRows=true;
+    bool removeForcingRows=true;
+    bool removeDuplicateRows=true;
+
+    // The maximum number of sweeps over the rows and columns
+    Int maxPasses=20;
+
+    // Right-hand sides and objective coefficients of magnitude at most 'tol'
+    // are treated as zero when testing for feasibility and boundedness, and
+    // duplicate rows must agree to within a relative tolerance of 'tol'.
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.75));
+
+    bool progress=false;
+};
+
+namespace presolve {
+
+enum ReductionType {
+  EMPTY_EQUALITY_ROW,
+  EMPTY_CONE_ROW,
+  EMPTY_COLUMN,
+  SINGLETON_ROW,
+  FORCING_ROW,
+  DUPLICATE_ROW
+};
+
+struct Reduction
+{
+    ReductionType type;
+
+    // The original index of the removed equality or cone row (if any)
+    Int row=-1;
+
+    // The original indices of the variables fixed by this reduction
+    vector<Int> columns;
+};
+
+} // namespace presolve
+
+// The information needed to map a solution of a presolved problem back to a
+// solution of the original problem. For distributed problems, the reductions
+// and original problem data are only stored on the root process, whereas the
+// index maps are stored on every process.
+template<typename Real>
+struct PresolveRecord
+{
+    // Whether the variables are constrained to be nonnegative (direct form)
+    // rather than free (affine form)
+    bool direct=true;
+
+    Int numVariables=0, numEqualities=0, numCones=0;
+
+    // The original indices of the variables, equality rows, and cone rows which
+    // were kept in the reduced problem
+    vector<Int> keptVariables, keptEqualities, keptCones;
+
+    // The values of the variables removed from the problem (indexed by their
+    // original indices and zero for kept variables)
+    Matrix<Real> fixedValues;
+
+    // The stack of reductions, in the order in which they were performed
+    vector<presolve::Reduction> reductions;
+
+    // The original problem data, with 'Q' empty for linear programs and 'G'
+    // and 'h' empty for direct conic form
+    SparseMatrix<Real> Q, A, G;
+    Matrix<Real> c, h;
 };
 
 } // namespace El
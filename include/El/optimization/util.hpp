@@ -11,6 +11,7 @@
 
 #include <El/optimization/util/cone.hpp>
 #include <El/optimization/util/pos_orth.hpp>
+#include <El/optimization/util/psd.hpp>
 #include <El/optimization/util/soc.hpp>
 
 namespace El {
@@ -12,6 +12,51 @@
 namespace El {
 namespace pos_orth {
 
+// Gondzio's centrality corrector
+// ==============================
+// Overwrite r with the difference between the complementarity products of the
+// trial point (s + alphaPri ds, z + alphaDual dz) and their projections onto
+// the interval [lowerRatio*target,upperRatio*target].
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityCorrector
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& dz,
+        Matrix<Real>& r,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityCorrector
+( const AbstractDistMatrix<Real>& s,
+  const AbstractDistMatrix<Real>& z,
+  const AbstractDistMatrix<Real>& ds,
+  const AbstractDistMatrix<Real>& dz,
+        AbstractDistMatrix<Real>& r,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityCorrector
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& dz,
+        DistMultiVec<Real>& r,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio );
+
 // Compute the complementarity ratio
 // =================================
 template<typename Real,
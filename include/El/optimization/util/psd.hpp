@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_UTIL_PSD_HPP
+#define EL_OPTIMIZATION_UTIL_PSD_HPP
+
+namespace El {
+namespace psd {
+
+// A member of a product of positive semidefinite cones is stored as the
+// concatenation of the (full) column-major storage of each of its symmetric
+// diagonal blocks, whose orders are listed in the column vector 'orders'.
+// The list of orders is typically small and is therefore replicated over
+// all processes. Quantities which only involve the eigenvalues of each block
+// (e.g., the scaled point of a Nesterov-Todd scaling) are stored as the
+// concatenation of the eigenvalues of each block.
+//
+// The distributed routines assign each block whose order is at most 'cutoff'
+// to a single process in a round-robin manner so that many small blocks are
+// handled as a batch with a single collective per operation, whereas each
+// larger block is redistributed over the entire grid.
+
+// Degree
+// ======
+// The sum of the orders of the blocks
+Int Degree( const Matrix<Int>& orders );
+
+// Height
+// ======
+// The height of the vectorization, i.e., the sum of the squares of the orders
+Int Height( const Matrix<Int>& orders );
+
+// Identity
+// ========
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Identity( Matrix<Real>& x, const Matrix<Int>& orders );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Identity( AbstractDistMatrix<Real>& x, const Matrix<Int>& orders );
+
+// Diagonal
+// ========
+// Form the block-diagonal matrix whose diagonal is given by the concatenation
+// of the diagonals, d, of each block
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Diagonal
+( const Matrix<Real>& d,
+        Matrix<Real>& x,
+  const Matrix<Int>& orders );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Diagonal
+( const AbstractDistMatrix<Real>& d,
+        AbstractDistMatrix<Real>& x,
+  const Matrix<Int>& orders );
+
+// Symmetrize
+// ==========
+// Overwrite each block X with (X + X^T)/2
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Symmetrize( Matrix<Real>& x, const Matrix<Int>& orders );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Symmetrize( AbstractDistMatrix<Real>& x, const Matrix<Int>& orders );
+
+// Congruence
+// ==========
+// Set each block of y to G X G^T if 'orientation' is NORMAL and to G^T X G
+// otherwise, where G and X are the corresponding blocks of g and x. Note
+// that G need not be symmetric.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Congruence
+(       Orientation orientation,
+  const Matrix<Real>& g,
+  const Matrix<Real>& x,
+        Matrix<Real>& y,
+  const Matrix<Int>& orders );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Congruence
+(       Orientation orientation,
+  const AbstractDistMatrix<Real>& g,
+  const AbstractDistMatrix<Real>& x,
+        AbstractDistMatrix<Real>& y,
+  const Matrix<Int>& orders,
+  Int cutoff=1000 );
+
+// Jordan product
+// ==============
+// Set each block of r to (X Y + Y X)/2
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void JordanProduct
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+        Matrix<Real>& r,
+  const Matrix<Int>& orders );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void JordanProduct
+( const AbstractDistMatrix<Real>& x,
+  const AbstractDistMatrix<Real>& y,
+        AbstractDistMatrix<Real>& r,
+  const Matrix<Int>& orders,
+  Int cutoff=1000 );
+
+// Lyapunov solve
+// ==============
+// Overwrite each block R of r with the solution H of the Lyapunov equation
+// (Lambda H + H Lambda)/2 = R, where Lambda is a positive diagonal matrix
+// whose diagonal is the corresponding piece of lambda, i.e.,
+// H(i,j) = 2 R(i,j) / (lambda(i) + lambda(j)).
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void LyapunovSolve
+( const Matrix<Real>& lambda,
+        Matrix<Real>& r,
+  const Matrix<Int>& orders );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void LyapunovSolve
+( const AbstractDistMatrix<Real>& lambda,
+        AbstractDistMatrix<Real>& r,
+  const Matrix<Int>& orders );
+
+// Maximum step
+// ============
+// The largest alpha <= upperBound such that x + alpha dx is positive
+// semidefinite, assuming that x is positive definite
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real MaxStep
+( const Matrix<Real>& x,
+  const Matrix<Real>& dx,
+  const Matrix<Int>& orders,
+  Real upperBound=limits::Max<Real>() );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real MaxStep
+( const AbstractDistMatrix<Real>& x,
+  const AbstractDistMatrix<Real>& dx,
+  const Matrix<Int>& orders,
+  Real upperBound=limits::Max<Real>(),
+  Int cutoff=1000 );
+
+// Number of members outside of cone
+// =================================
+// Return the number of blocks which are not positive definite
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Int NumOutside( const Matrix<Real>& x, const Matrix<Int>& orders );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Int NumOutside
+( const AbstractDistMatrix<Real>& x,
+  const Matrix<Int>& orders,
+  Int cutoff=1000 );
+
+// Compute a Nesterov-Todd scaling
+// ===============================
+// For each pair of positive definite blocks X and Z, with X = L L^T and
+// L^T Z L = Q Lambda^2 Q^T, form G = L Q Lambda^{-1/2} and W = G G^T so that
+//
+//   W Z W = X and G^{-1} X G^{-T} = G^T Z G = Lambda,
+//
+// where W is the Nesterov-Todd scaling point and Lambda is the (diagonal)
+// scaled point.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void NesterovTodd
+( const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Matrix<Real>& w,
+        Matrix<Real>& g,
+        Matrix<Real>& lambda,
+  const Matrix<Int>& orders );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void NesterovTodd
+( const AbstractDistMatrix<Real>& x,
+  const AbstractDistMatrix<Real>& z,
+        AbstractDistMatrix<Real>& w,
+        AbstractDistMatrix<Real>& g,
+        AbstractDistMatrix<Real>& lambda,
+  const Matrix<Int>& orders,
+  Int cutoff=1000 );
+
+} // namespace psd
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_UTIL_PSD_HPP
@@ -124,6 +124,59 @@ void ApplyQuadratic
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
 
+// Gondzio's centrality corrector
+// ==============================
+// Overwrite r with the difference between the Jordan product of the trial
+// point (s + alphaPri ds, z + alphaDual dz) and its projection (through its
+// eigenvalues) onto the interval [lowerRatio*target,upperRatio*target].
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityCorrector
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& dz,
+        Matrix<Real>& r,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityCorrector
+( const AbstractDistMatrix<Real>& s,
+  const AbstractDistMatrix<Real>& z,
+  const AbstractDistMatrix<Real>& ds,
+  const AbstractDistMatrix<Real>& dz,
+        AbstractDistMatrix<Real>& r,
+  const AbstractDistMatrix<Int>& orders,
+  const AbstractDistMatrix<Int>& firstInds,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio,
+  Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityCorrector
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& dz,
+        DistMultiVec<Real>& r,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio,
+  Int cutoff=1000 );
+
 // Degree
 // ======
 Int Degree( const Matrix<Int>& firstInds );
@@ -584,6 +584,7 @@ class HessenbergSchurCtrl(ctypes.Structure):
               ("sufficientDeflation",CFUNCTYPE(iType,iType)),
               ("scalapack",bType),
               ("blockHeight",iType),
+              ("minDistAEDSize",iType),
               ("numBulgesPerBlock",CFUNCTYPE(iType,iType))]
   def __init__(self):
     lib.ElHessenbergSchurCtrlDefault(pointer(self))
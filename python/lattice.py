@@ -20,16 +20,22 @@ class LLLInfo_s(ctypes.Structure):
               ("rank",iType),
               ("nullity",iType),
               ("numSwaps",iType),
-              ("logVol",sType)]
+              ("firstSwap",iType),
+              ("logVol",sType),
+              ("segmentTime",dType),
+              ("mergeTime",dType)]
 class LLLInfo_d(ctypes.Structure):
   _fields_ = [("delta",dType),
               ("eta",dType),
               ("rank",iType),
               ("nullity",iType),
               ("numSwaps",iType),
-              ("logVol",dType)]
+              ("firstSwap",iType),
+              ("logVol",dType),
+              ("segmentTime",dType),
+              ("mergeTime",dType)]
 
-(LLL_WEAK,LLL_NORMAL,LLL_DEEP,LLL_DEEP_REDUCE)=(0,1,2,3)
+(LLL_WEAK,LLL_NORMAL,LLL_DEEP,LLL_DEEP_REDUCE,LLL_SEGMENTED)=(0,1,2,3,4)
 
 lib.ElLLLCtrlDefault_s.argtypes = \
 lib.ElLLLCtrlDefault_d.argtypes = \
@@ -40,6 +46,7 @@ class LLLCtrl_s(ctypes.Structure):
               ("variant",c_uint),
               ("recursive",bType),
               ("cutoff",iType),
+              ("segmentSize",iType),
               ("precisionFudge",sType),
               ("minColThresh",iType),
               ("unsafeSizeReduct",bType),
@@ -61,6 +68,7 @@ class LLLCtrl_d(ctypes.Structure):
               ("variant",c_uint),
               ("recursive",bType),
               ("cutoff",iType),
+              ("segmentSize",iType),
               ("precisionFudge",dType),
               ("minColThresh",iType),
               ("unsafeSizeReduct",bType),
@@ -11,6 +11,8 @@ from solvers import *
 
 from ctypes import CFUNCTYPE
 
+(NO_PENALTY,L1_PENALTY,L2_PENALTY)=(0,1,2)
+
 # Basis pursuit
 # =============
 lib.ElBPADMMCtrlDefault_s.argtypes = \
@@ -724,12 +726,15 @@ def NNLS(A,b,ctrl=None):
 lib.ElNMFCtrlDefault_s.argtypes = \
 lib.ElNMFCtrlDefault_d.argtypes = \
   [c_void_p]
+(NMF_ALTERNATING_NNLS,NMF_HALS,NMF_BLOCK_PRINCIPAL_PIVOTING)=(0,1,2)
 class NMFCtrl_s(ctypes.Structure):
-  _fields_ = [("nnlsCtrl",NNLSCtrl_s),("maxIter",iType)]
+  _fields_ = [("approach",c_uint),("nnlsCtrl",NNLSCtrl_s),("maxIter",iType),
+              ("relTol",sType),("progress",bType)]
   def __init__(self):
     lib.ElNMFCtrlDefault_s(pointer(self))
 class NMFCtrl_d(ctypes.Structure):
-  _fields_ = [("nnlsCtrl",NNLSCtrl_d),("maxIter",iType)]
+  _fields_ = [("approach",c_uint),("nnlsCtrl",NNLSCtrl_d),("maxIter",iType),
+              ("relTol",dType),("progress",bType)]
   def __init__(self):
     lib.ElNMFCtrlDefault_d(pointer(self))
 
@@ -774,13 +779,17 @@ lib.ElBPDNADMMCtrlDefault_d.argtypes = \
 class BPDNADMMCtrl_s(ctypes.Structure):
   _fields_ = [("rho",sType),("alpha",sType),("maxIter",iType),
               ("absTol",sType),("relTol",sType),
-              ("inv",bType),("progress",bType)]
+              ("inv",bType),("progress",bType),
+              ("adaptiveRho",bType),("rhoBalance",sType),("rhoScale",sType),
+              ("andersonDepth",iType),("consensus",bType)]
   def __init__(self):
     lib.ElBPDNADMMCtrlDefault_s(pointer(self))
 class BPDNADMMCtrl_d(ctypes.Structure):
   _fields_ = [("rho",dType),("alpha",dType),("maxIter",iType),
               ("absTol",dType),("relTol",dType),
-              ("inv",bType),("progress",bType)]
+              ("inv",bType),("progress",bType),
+              ("adaptiveRho",bType),("rhoBalance",dType),("rhoScale",dType),
+              ("andersonDepth",iType),("consensus",bType)]
   def __init__(self):
     lib.ElBPDNADMMCtrlDefault_d(pointer(self))
 
@@ -978,13 +987,15 @@ lib.ElRPCACtrlDefault_s.argtypes = \
 lib.ElRPCACtrlDefault_d.argtypes = \
   [c_void_p]
 class RPCACtrl_s(ctypes.Structure):
-  _fields_ = [("useALM",bType),("usePivQR",bType),("progress",bType),
+  _fields_ = [("useALM",bType),("usePivQR",bType),("usePartialSVT",bType),
+              ("progress",bType),
               ("numPivSteps",iType),("maxIts",iType),
               ("tau",sType),("beta",sType),("rho",sType),("tol",sType)]
   def __init__(self):
     lib.ElRPCACtrlDefault_s(pointer(self))
 class RPCACtrl_d(ctypes.Structure):
-  _fields_ = [("useALM",bType),("usePivQR",bType),("progress",bType),
+  _fields_ = [("useALM",bType),("usePivQR",bType),("usePartialSVT",bType),
+              ("progress",bType),
               ("numPivSteps",iType),("maxIts",iType),
               ("tau",dType),("beta",dType),("rho",dType),("tol",dType)]
   def __init__(self):
@@ -1140,12 +1151,20 @@ def SparseInvCov(D,lambdaPre,ctrl=None):
 lib.ElSVMCtrlDefault_s.argtypes = \
 lib.ElSVMCtrlDefault_d.argtypes = \
   [c_void_p]
+(SVM_IPM,SVM_DUAL_COORDINATE_DESCENT,SVM_ACCELERATED_PROXIMAL_GRADIENT)= \
+  (0,1,2)
+class SVMDCDCtrl_s(ctypes.Structure):
+  _fields_ = [("maxIter",iType),("relTol",sType),("progress",bType)]
+class SVMDCDCtrl_d(ctypes.Structure):
+  _fields_ = [("maxIter",iType),("relTol",dType),("progress",bType)]
 class SVMCtrl_s(ctypes.Structure):
-  _fields_ = [("ipmCtrl",QPAffineCtrl_s)]
+  _fields_ = [("approach",c_uint),("ipmCtrl",QPAffineCtrl_s),
+              ("dcdCtrl",SVMDCDCtrl_s),("apgCtrl",APGCtrl_s)]
   def __init__(self):
     lib.ElSVMCtrlDefault_s(pointer(self))
 class SVMCtrl_d(ctypes.Structure):
-  _fields_ = [("ipmCtrl",QPAffineCtrl_d)]
+  _fields_ = [("approach",c_uint),("ipmCtrl",QPAffineCtrl_d),
+              ("dcdCtrl",SVMDCDCtrl_d),("apgCtrl",APGCtrl_d)]
   def __init__(self):
     lib.ElSVMCtrlDefault_d(pointer(self))
 
@@ -1235,6 +1254,107 @@ def SVM(A,d,lambdPre,ctrl=None):
     return x
   else: TypeExcept()
 
+# Logistic regression
+# ===================
+lib.ElLogisticRegressionCtrlDefault_s.argtypes = \
+lib.ElLogisticRegressionCtrlDefault_d.argtypes = \
+  [c_void_p]
+class LogisticRegressionCtrl_s(ctypes.Structure):
+  _fields_ = [("penalty",c_uint),("apgCtrl",APGCtrl_s)]
+  def __init__(self):
+    lib.ElLogisticRegressionCtrlDefault_s(pointer(self))
+class LogisticRegressionCtrl_d(ctypes.Structure):
+  _fields_ = [("penalty",c_uint),("apgCtrl",APGCtrl_d)]
+  def __init__(self):
+    lib.ElLogisticRegressionCtrlDefault_d(pointer(self))
+
+lib.ElLogisticRegression_s.argtypes = \
+lib.ElLogisticRegressionDist_s.argtypes = \
+lib.ElLogisticRegressionSparse_s.argtypes = \
+lib.ElLogisticRegressionDistSparse_s.argtypes = \
+  [c_void_p,c_void_p,sType,c_void_p,POINTER(iType)]
+lib.ElLogisticRegression_d.argtypes = \
+lib.ElLogisticRegressionDist_d.argtypes = \
+lib.ElLogisticRegressionSparse_d.argtypes = \
+lib.ElLogisticRegressionDistSparse_d.argtypes = \
+  [c_void_p,c_void_p,dType,c_void_p,POINTER(iType)]
+
+lib.ElLogisticRegressionX_s.argtypes = \
+lib.ElLogisticRegressionXDist_s.argtypes = \
+lib.ElLogisticRegressionXSparse_s.argtypes = \
+lib.ElLogisticRegressionXDistSparse_s.argtypes = \
+  [c_void_p,c_void_p,sType,c_void_p,
+   LogisticRegressionCtrl_s,POINTER(iType)]
+lib.ElLogisticRegressionX_d.argtypes = \
+lib.ElLogisticRegressionXDist_d.argtypes = \
+lib.ElLogisticRegressionXSparse_d.argtypes = \
+lib.ElLogisticRegressionXDistSparse_d.argtypes = \
+  [c_void_p,c_void_p,dType,c_void_p,
+   LogisticRegressionCtrl_d,POINTER(iType)]
+
+def LogisticRegression(A,d,lambdPre,ctrl=None):
+  if A.tag != d.tag:
+    raise Exception('Datatypes of A and d must match')
+  numIts = iType()
+  lambd = TagToType(A.tag)(lambdPre)
+  if type(A) is Matrix:
+    if type(d) is not Matrix:
+      raise Exception('d must be a Matrix')
+    x = Matrix(A.tag)
+    args = [A.obj,d.obj,lambd,x.obj,pointer(numIts)]
+    argsCtrl = [A.obj,d.obj,lambd,x.obj,ctrl,pointer(numIts)]
+    if   A.tag == sTag: 
+      if ctrl == None: lib.ElLogisticRegression_s(*args)
+      else:            lib.ElLogisticRegressionX_s(*argsCtrl)
+    elif A.tag == dTag: 
+      if ctrl == None: lib.ElLogisticRegression_d(*args)
+      else:            lib.ElLogisticRegressionX_d(*argsCtrl)
+    else: DataExcept()
+    return x, numIts
+  elif type(A) is DistMatrix:
+    if type(d) is not DistMatrix:
+      raise Exception('d must be a DistMatrix')
+    x = DistMatrix(A.tag,MC,MR,A.Grid())
+    args = [A.obj,d.obj,lambd,x.obj,pointer(numIts)]
+    argsCtrl = [A.obj,d.obj,lambd,x.obj,ctrl,pointer(numIts)]
+    if   A.tag == sTag: 
+      if ctrl == None: lib.ElLogisticRegressionDist_s(*args)
+      else:            lib.ElLogisticRegressionXDist_s(*argsCtrl)
+    elif A.tag == dTag: 
+      if ctrl == None: lib.ElLogisticRegressionDist_d(*args)
+      else:            lib.ElLogisticRegressionXDist_d(*argsCtrl)
+    else: DataExcept()
+    return x, numIts
+  elif type(A) is SparseMatrix:
+    if type(d) is not Matrix:
+      raise Exception('d must be a Matrix')
+    x = Matrix(A.tag)
+    args = [A.obj,d.obj,lambd,x.obj,pointer(numIts)]
+    argsCtrl = [A.obj,d.obj,lambd,x.obj,ctrl,pointer(numIts)]
+    if   A.tag == sTag: 
+      if ctrl == None: lib.ElLogisticRegressionSparse_s(*args)
+      else:            lib.ElLogisticRegressionXSparse_s(*argsCtrl)
+    elif A.tag == dTag: 
+      if ctrl == None: lib.ElLogisticRegressionSparse_d(*args)
+      else:            lib.ElLogisticRegressionXSparse_d(*argsCtrl)
+    else: DataExcept()
+    return x, numIts
+  elif type(A) is DistSparseMatrix:
+    if type(d) is not DistMultiVec:
+      raise Exception('d must be a DistMultiVec')
+    x = DistMultiVec(A.tag,A.Grid())
+    args = [A.obj,d.obj,lambd,x.obj,pointer(numIts)]
+    argsCtrl = [A.obj,d.obj,lambd,x.obj,ctrl,pointer(numIts)]
+    if   A.tag == sTag: 
+      if ctrl == None: lib.ElLogisticRegressionDistSparse_s(*args)
+      else:            lib.ElLogisticRegressionXDistSparse_s(*argsCtrl)
+    elif A.tag == dTag: 
+      if ctrl == None: lib.ElLogisticRegressionDistSparse_d(*args)
+      else:            lib.ElLogisticRegressionXDistSparse_d(*argsCtrl)
+    else: DataExcept()
+    return x, numIts
+  else: TypeExcept()
+
 # Total variation denoising
 # =========================
 lib.ElTV_s.argtypes = \
@@ -12,7 +12,8 @@ from El.lapack_like.factor import *
 import ctypes
 from ctypes import CFUNCTYPE
 
-(FULL_KKT,AUGMENTED_KKT,NORMAL_KKT) = (0,1,2)
+(FULL_KKT,AUGMENTED_KKT,NORMAL_KKT,SPLIT_NORMAL_KKT,
+ MATRIX_FREE_NORMAL_KKT) = (0,1,2,3,4)
 
 # Mehrotra Predictor-Corrector IPMs
 # =================================
@@ -25,7 +26,17 @@ class MehrotraCtrl_s(ctypes.Structure):
               ("maxIts",iType),
               ("maxStepRatio",sType),
               ("system",c_uint),
+              ("denseColumnRatio",sType),
+              ("denseColumnMinNonzeros",iType),
+              ("krylovForcingFactor",sType),
+              ("maxKrylovIts",iType),
+              ("krylovPrecondRank",iType),
               ("mehrotra",bType),
+              ("maxCentralityCorrectors",iType),
+              ("centralityLowerRatio",sType),
+              ("centralityUpperRatio",sType),
+              ("centralityStepIncrease",sType),
+              ("centralityMinAcceptance",sType),
               ("centralityRule",CFUNCTYPE(sType,sType,sType,sType,sType)),
               ("standardInitShift",bType),
               ("balanceTol",sType),
@@ -52,7 +63,17 @@ class MehrotraCtrl_d(ctypes.Structure):
               ("maxIts",iType),
               ("maxStepRatio",dType),
               ("system",c_uint),
+              ("denseColumnRatio",dType),
+              ("denseColumnMinNonzeros",iType),
+              ("krylovForcingFactor",dType),
+              ("maxKrylovIts",iType),
+              ("krylovPrecondRank",iType),
               ("mehrotra",bType),
+              ("maxCentralityCorrectors",iType),
+              ("centralityLowerRatio",dType),
+              ("centralityUpperRatio",dType),
+              ("centralityStepIncrease",dType),
+              ("centralityMinAcceptance",dType),
               ("centralityRule",CFUNCTYPE(dType,dType,dType,dType,dType)),
               ("standardInitShift",bType),
               ("balanceTol",dType),
@@ -83,17 +104,59 @@ class ADMMCtrl_s(ctypes.Structure):
   _fields_ = [("rho",sType),("alpha",sType),
               ("maxIter",iType),
               ("absTol",sType),("relTol",sType),
-              ("inv",bType),("progress",bType)]
+              ("inv",bType),("progress",bType),
+              ("adaptiveRho",bType),("rhoBalance",sType),("rhoScale",sType),
+              ("andersonDepth",iType)]
   def __init__(self):
     lib.ElLPDirectADMMCtrlDefault_s(pointer(self))
 class ADMMCtrl_d(ctypes.Structure):
   _fields_ = [("rho",dType),("alpha",dType),
               ("maxIter",iType),
               ("absTol",dType),("relTol",dType),
-              ("inv",bType),("progress",bType)]
+              ("inv",bType),("progress",bType),
+              ("adaptiveRho",bType),("rhoBalance",dType),("rhoScale",dType),
+              ("andersonDepth",iType)]
   def __init__(self):
     lib.ElADMMCtrlDefault_d(pointer(self))
 
+# Accelerated Proximal Gradient
+# =============================
+lib.ElAPGCtrlDefault_s.argtypes = \
+lib.ElAPGCtrlDefault_d.argtypes = \
+  [c_void_p]
+class APGCtrl_s(ctypes.Structure):
+  _fields_ = [("maxIter",iType),("relTol",sType),
+              ("lipschitz",sType),("backtrackFactor",sType),
+              ("restart",bType),("print",bType)]
+  def __init__(self):
+    lib.ElAPGCtrlDefault_s(pointer(self))
+class APGCtrl_d(ctypes.Structure):
+  _fields_ = [("maxIter",iType),("relTol",dType),
+              ("lipschitz",dType),("backtrackFactor",dType),
+              ("restart",bType),("print",bType)]
+  def __init__(self):
+    lib.ElAPGCtrlDefault_d(pointer(self))
+
+# Presolve
+# ========
+lib.ElPresolveCtrlDefault_s.argtypes = \
+lib.ElPresolveCtrlDefault_d.argtypes = \
+  [c_void_p]
+class PresolveCtrl_s(ctypes.Structure):
+  _fields_ = [("removeEmptyRows",bType),("removeEmptyColumns",bType),
+              ("removeSingletonRows",bType),("removeForcingRows",bType),
+              ("removeDuplicateRows",bType),
+              ("maxPasses",iType),("tol",sType),("progress",bType)]
+  def __init__(self):
+    lib.ElPresolveCtrlDefault_s(pointer(self))
+class PresolveCtrl_d(ctypes.Structure):
+  _fields_ = [("removeEmptyRows",bType),("removeEmptyColumns",bType),
+              ("removeSingletonRows",bType),("removeForcingRows",bType),
+              ("removeDuplicateRows",bType),
+              ("maxPasses",iType),("tol",dType),("progress",bType)]
+  def __init__(self):
+    lib.ElPresolveCtrlDefault_d(pointer(self))
+
 # Linear program
 # ==============
 
@@ -106,12 +169,14 @@ lib.ElLPDirectCtrlDefault_d.argtypes = \
   [c_void_p,bType]
 class LPDirectCtrl_s(ctypes.Structure):
   _fields_ = [("approach",c_uint),("admmCtrl",ADMMCtrl_s),
-              ("mehrotraCtrl",MehrotraCtrl_s)]
+              ("mehrotraCtrl",MehrotraCtrl_s),
+              ("presolve",bType),("presolveCtrl",PresolveCtrl_s)]
   def __init__(self,isSparse=True):
     lib.ElLPDirectCtrlDefault_s(pointer(self),isSparse)
 class LPDirectCtrl_d(ctypes.Structure):
   _fields_ = [("approach",c_uint),("admmCtrl",ADMMCtrl_d),
-              ("mehrotraCtrl",MehrotraCtrl_d)]
+              ("mehrotraCtrl",MehrotraCtrl_d),
+              ("presolve",bType),("presolveCtrl",PresolveCtrl_d)]
   def __init__(self,isSparse=True):
     lib.ElLPDirectCtrlDefault_d(pointer(self),isSparse)
 
@@ -198,12 +263,14 @@ lib.ElLPAffineCtrlDefault_d.argtypes = \
   [c_void_p]
 class LPAffineCtrl_s(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_s)]
+              ("mehrotraCtrl",MehrotraCtrl_s),
+              ("presolve",bType),("presolveCtrl",PresolveCtrl_s)]
   def __init__(self):
     lib.ElLPAffineCtrlDefault_s(pointer(self))
 class LPAffineCtrl_d(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_d)]
+              ("mehrotraCtrl",MehrotraCtrl_d),
+              ("presolve",bType),("presolveCtrl",PresolveCtrl_d)]
   def __init__(self):
     lib.ElLPAffineCtrlDefault_d(pointer(self))
 
@@ -299,12 +366,14 @@ lib.ElQPDirectCtrlDefault_d.argtypes = \
   [c_void_p]
 class QPDirectCtrl_s(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_s)]
+              ("mehrotraCtrl",MehrotraCtrl_s),
+              ("presolve",bType),("presolveCtrl",PresolveCtrl_s)]
   def __init__(self):
     lib.ElQPDirectCtrlDefault_s(pointer(self))
 class QPDirectCtrl_d(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_d)]
+              ("mehrotraCtrl",MehrotraCtrl_d),
+              ("presolve",bType),("presolveCtrl",PresolveCtrl_d)]
   def __init__(self):
     lib.ElQPDirectCtrlDefault_d(pointer(self))
 
@@ -390,12 +459,14 @@ lib.ElQPAffineCtrlDefault_d.argtypes = \
   [c_void_p]
 class QPAffineCtrl_s(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_s)]
+              ("mehrotraCtrl",MehrotraCtrl_s),
+              ("presolve",bType),("presolveCtrl",PresolveCtrl_s)]
   def __init__(self):
     lib.ElQPAffineCtrlDefault_s(pointer(self))
 class QPAffineCtrl_d(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_d)]
+              ("mehrotraCtrl",MehrotraCtrl_d),
+              ("presolve",bType),("presolveCtrl",PresolveCtrl_d)]
   def __init__(self):
     lib.ElQPAffineCtrlDefault_d(pointer(self))
 
@@ -0,0 +1,364 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./Batched/Util.hpp"
+#include "./Batched/Gemm.hpp"
+#include "./Batched/Trsm.hpp"
+
+namespace El {
+
+template<typename T>
+BatchMatrix<T>::BatchMatrix( BatchLayout layout )
+: layout_(layout)
+{ }
+
+template<typename T>
+BatchMatrix<T>::BatchMatrix
+( Int height, Int width, Int batchSize, BatchLayout layout )
+: layout_(layout)
+{
+    EL_DEBUG_CSE
+    Resize( height, width, batchSize );
+}
+
+template<typename T>
+BatchMatrix<T>::BatchMatrix( const BatchMatrix<T>& A )
+: layout_(A.layout_)
+{
+    EL_DEBUG_CSE
+    *this = A;
+}
+
+template<typename T>
+const BatchMatrix<T>& BatchMatrix<T>::operator=( const BatchMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( &A == this )
+        return *this;
+    if( !viewing_ )
+        layout_ = A.layout_;
+    Resize( A.height_, A.width_, A.batchSize_ );
+    for( Int b=0; b<batchSize_; ++b )
+        for( Int j=0; j<width_; ++j )
+            for( Int i=0; i<height_; ++i )
+                (*this)(i,j,b) = A(i,j,b);
+    return *this;
+}
+
+template<typename T>
+void BatchMatrix<T>::Empty()
+{
+    EL_DEBUG_CSE
+    height_ = width_ = batchSize_ = 0;
+    ldim_ = 1;
+    batchStride_ = 0;
+    viewing_ = locked_ = false;
+    SwapClear( memory_ );
+    buffer_ = nullptr;
+}
+
+template<typename T>
+void BatchMatrix<T>::Resize( Int height, Int width, Int batchSize )
+{
+    EL_DEBUG_CSE
+    if( height < 0 || width < 0 || batchSize < 0 )
+        LogicError("Batch dimensions must be non-negative");
+    if( viewing_ )
+    {
+        if( height != height_ || width != width_ || batchSize != batchSize_ )
+            LogicError("Cannot resize a viewing BatchMatrix");
+        return;
+    }
+    height_ = height;
+    width_ = width;
+    batchSize_ = batchSize;
+    ldim_ = Max(height,1);
+    batchStride_ =
+      ( layout_ == BATCH_STRIDED ? ldim_*width : Max(batchSize,1) );
+    memory_.resize( height*width*batchSize );
+    buffer_ = memory_.data();
+}
+
+template<typename T>
+void BatchMatrix<T>::SetLayout( BatchLayout layout )
+{
+    EL_DEBUG_CSE
+    if( layout == layout_ )
+        return;
+    if( viewing_ )
+        LogicError("Cannot change the layout of a viewing BatchMatrix");
+    BatchMatrix<T> A( height_, width_, batchSize_, layout );
+    for( Int b=0; b<batchSize_; ++b )
+        for( Int j=0; j<width_; ++j )
+            for( Int i=0; i<height_; ++i )
+                A(i,j,b) = (*this)(i,j,b);
+    *this = std::move(A);
+}
+
+template<typename T>
+void BatchMatrix<T>::Attach
+( BatchLayout layout, Int height, Int width, Int batchSize,
+  T* buffer, Int ldim, Int batchStride )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( ldim < Max(height,1) )
+          LogicError("Leading dimension was too small");
+      if( layout == BATCH_STRIDED && batchSize > 1 &&
+          batchStride < ldim*(width-1)+height )
+          LogicError("Batch stride was too small");
+      if( layout == BATCH_INTERLEAVED && batchStride < batchSize )
+          LogicError("Batch stride was too small");
+    )
+    SwapClear( memory_ );
+    layout_ = layout;
+    height_ = height;
+    width_ = width;
+    batchSize_ = batchSize;
+    ldim_ = ldim;
+    batchStride_ = batchStride;
+    viewing_ = true;
+    locked_ = false;
+    buffer_ = buffer;
+}
+
+template<typename T>
+void BatchMatrix<T>::LockedAttach
+( BatchLayout layout, Int height, Int width, Int batchSize,
+  const T* buffer, Int ldim, Int batchStride )
+{
+    EL_DEBUG_CSE
+    Attach
+    ( layout, height, width, batchSize,
+      const_cast<T*>(buffer), ldim, batchStride );
+    locked_ = true;
+}
+
+template<typename T>
+BatchLayout BatchMatrix<T>::Layout() const { return layout_; }
+template<typename T>
+Int BatchMatrix<T>::Height() const { return height_; }
+template<typename T>
+Int BatchMatrix<T>::Width() const { return width_; }
+template<typename T>
+Int BatchMatrix<T>::BatchSize() const { return batchSize_; }
+template<typename T>
+Int BatchMatrix<T>::LDim() const { return ldim_; }
+template<typename T>
+Int BatchMatrix<T>::BatchStride() const { return batchStride_; }
+template<typename T>
+bool BatchMatrix<T>::Viewing() const { return viewing_; }
+template<typename T>
+bool BatchMatrix<T>::Locked() const { return locked_; }
+
+template<typename T>
+T* BatchMatrix<T>::Buffer()
+{
+    EL_DEBUG_ONLY(
+      if( locked_ )
+          LogicError("Cannot return non-const buffer of locked BatchMatrix");
+    )
+    return buffer_;
+}
+
+template<typename T>
+const T* BatchMatrix<T>::LockedBuffer() const { return buffer_; }
+
+template<typename T>
+T& BatchMatrix<T>::operator()( Int i, Int j, Int b )
+{
+    EL_DEBUG_ONLY(
+      if( locked_ )
+          LogicError("Cannot modify data of locked BatchMatrix");
+      if( i < 0 || i >= height_ || j < 0 || j >= width_ ||
+          b < 0 || b >= batchSize_ )
+          LogicError("Entry (",i,",",j,",",b,") is out of bounds");
+    )
+    if( layout_ == BATCH_STRIDED )
+        return buffer_[i+j*ldim_+b*batchStride_];
+    else
+        return buffer_[b+(i+j*ldim_)*batchStride_];
+}
+
+template<typename T>
+const T& BatchMatrix<T>::operator()( Int i, Int j, Int b ) const
+{
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= height_ || j < 0 || j >= width_ ||
+          b < 0 || b >= batchSize_ )
+          LogicError("Entry (",i,",",j,",",b,") is out of bounds");
+    )
+    if( layout_ == BATCH_STRIDED )
+        return buffer_[i+j*ldim_+b*batchStride_];
+    else
+        return buffer_[b+(i+j*ldim_)*batchStride_];
+}
+
+template<typename T>
+void BatchMatrix<T>::GetBatch( Int b, Matrix<T>& A ) const
+{
+    EL_DEBUG_CSE
+    A.Resize( height_, width_ );
+    for( Int j=0; j<width_; ++j )
+        for( Int i=0; i<height_; ++i )
+            A(i,j) = (*this)(i,j,b);
+}
+
+template<typename T>
+void BatchMatrix<T>::SetBatch( Int b, const Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != height_ || A.Width() != width_ )
+          LogicError("Matrix did not match the batch dimensions");
+    )
+    for( Int j=0; j<width_; ++j )
+        for( Int i=0; i<height_; ++i )
+            (*this)(i,j,b) = A(i,j);
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const BatchMatrix<T>& A, const BatchMatrix<T>& B,
+  T beta,        BatchMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = ( orientA == NORMAL ? A.Height() : A.Width() );
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const Int kB = ( orientB == NORMAL ? B.Height() : B.Width() );
+    const Int n = ( orientB == NORMAL ? B.Width() : B.Height() );
+    if( k != kB || C.Height() != m || C.Width() != n )
+        LogicError("Nonconformal batched Gemm");
+    if( A.BatchSize() != C.BatchSize() || B.BatchSize() != C.BatchSize() )
+        LogicError("Batch sizes did not match");
+    if( A.Layout() != C.Layout() || B.Layout() != C.Layout() )
+        LogicError("Batch layouts did not match");
+
+    const Int numBlocks = batched::NumLaneBlocks( C );
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+        batched::Gemm
+        ( orientA, orientB, m, n, k,
+          alpha, batched::LockedGetLaneBlock( A, block ),
+                 batched::LockedGetLaneBlock( B, block ),
+          beta,  batched::GetLaneBlock( C, block ) );
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = C.size();
+    if( Int(A.size()) != batchSize || Int(B.size()) != batchSize )
+        LogicError("Batch sizes did not match");
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int m = ( orientA == NORMAL ? A[b].Height() : A[b].Width() );
+        const Int k = ( orientA == NORMAL ? A[b].Width() : A[b].Height() );
+        const Int kB = ( orientB == NORMAL ? B[b].Height() : B[b].Width() );
+        const Int n = ( orientB == NORMAL ? B[b].Width() : B[b].Height() );
+        if( k != kB || C[b].Height() != m || C[b].Width() != n )
+            LogicError("Nonconformal batched Gemm for member ",b);
+    }
+
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+        batched::Gemm
+        ( orientA, orientB,
+          C[b].Height(), C[b].Width(),
+          ( orientA == NORMAL ? A[b].Width() : A[b].Height() ),
+          alpha, batched::LockedMatrixLaneBlock( A[b] ),
+                 batched::LockedMatrixLaneBlock( B[b] ),
+          beta,  batched::MatrixLaneBlock( C[b] ) );
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const BatchMatrix<F>& A, BatchMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int order = ( side == LEFT ? B.Height() : B.Width() );
+    if( A.Height() != A.Width() || A.Height() != order )
+        LogicError("Nonconformal batched Trsm");
+    if( A.BatchSize() != B.BatchSize() )
+        LogicError("Batch sizes did not match");
+    if( A.Layout() != B.Layout() )
+        LogicError("Batch layouts did not match");
+
+    const Int numBlocks = batched::NumLaneBlocks( B );
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+        batched::Trsm
+        ( side, uplo, orientation, diag, B.Height(), B.Width(),
+          alpha, batched::LockedGetLaneBlock( A, block ),
+                 batched::GetLaneBlock( B, block ) );
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const vector<Matrix<F>>& A, vector<Matrix<F>>& B )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = B.size();
+    if( Int(A.size()) != batchSize )
+        LogicError("Batch sizes did not match");
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int order = ( side == LEFT ? B[b].Height() : B[b].Width() );
+        if( A[b].Height() != A[b].Width() || A[b].Height() != order )
+            LogicError("Nonconformal batched Trsm for member ",b);
+    }
+
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+        batched::Trsm
+        ( side, uplo, orientation, diag, B[b].Height(), B[b].Width(),
+          alpha, batched::LockedMatrixLaneBlock( A[b] ),
+                 batched::MatrixLaneBlock( B[b] ) );
+}
+
+#define PROTO_INT(T) \
+  template class BatchMatrix<T>; \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const BatchMatrix<T>& A, const BatchMatrix<T>& B, \
+    T beta,        BatchMatrix<T>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B, \
+    T beta,        vector<Matrix<T>>& C );
+
+#define PROTO(F) \
+  PROTO_INT(F) \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    F alpha, const BatchMatrix<F>& A, BatchMatrix<F>& B ); \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    F alpha, const vector<Matrix<F>>& A, vector<Matrix<F>>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
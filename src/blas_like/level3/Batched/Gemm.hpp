@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_GEMM_HPP
+#define EL_BATCHED_GEMM_HPP
+
+namespace El {
+namespace batched {
+
+// C := alpha op(A) op(B) + beta C, where, if N > 0, m=n=k=N is known at
+// compile-time (so that the loops can be fully unrolled)
+template<Orientation orientA,Orientation orientB,Int N,typename T>
+void GemmKernel
+( Int m, Int n, Int k,
+  T alpha, const LaneBlock<const T>& A, const LaneBlock<const T>& B,
+  T beta,  const LaneBlock<T>& C )
+{
+    const Int mFix = ( N > 0 ? N : m );
+    const Int nFix = ( N > 0 ? N : n );
+    const Int kFix = ( N > 0 ? N : k );
+    const Int numLanes = C.numLanes;
+    for( Int j=0; j<nFix; ++j )
+    {
+        if( beta == T(0) )
+        {
+            for( Int i=0; i<mFix; ++i )
+            {
+                EL_SIMD
+                for( Int l=0; l<numLanes; ++l )
+                    C(i,j,l) = 0;
+            }
+        }
+        else if( beta != T(1) )
+        {
+            for( Int i=0; i<mFix; ++i )
+            {
+                EL_SIMD
+                for( Int l=0; l<numLanes; ++l )
+                    C(i,j,l) *= beta;
+            }
+        }
+        for( Int p=0; p<kFix; ++p )
+        {
+            for( Int i=0; i<mFix; ++i )
+            {
+                EL_SIMD
+                for( Int l=0; l<numLanes; ++l )
+                    C(i,j,l) += alpha*OpEntry<orientA>(A,i,p,l)*
+                                      OpEntry<orientB>(B,p,j,l);
+            }
+        }
+    }
+}
+
+template<Orientation orientA,Int N,typename T>
+void GemmOrientB
+( Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const LaneBlock<const T>& A, const LaneBlock<const T>& B,
+  T beta,  const LaneBlock<T>& C )
+{
+    if( orientB == NORMAL )
+        GemmKernel<orientA,NORMAL,N>( m, n, k, alpha, A, B, beta, C );
+    else if( orientB == TRANSPOSE )
+        GemmKernel<orientA,TRANSPOSE,N>( m, n, k, alpha, A, B, beta, C );
+    else
+        GemmKernel<orientA,ADJOINT,N>( m, n, k, alpha, A, B, beta, C );
+}
+
+template<Int N,typename T>
+void GemmOrient
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const LaneBlock<const T>& A, const LaneBlock<const T>& B,
+  T beta,  const LaneBlock<T>& C )
+{
+    if( orientA == NORMAL )
+        GemmOrientB<NORMAL,N>( orientB, m, n, k, alpha, A, B, beta, C );
+    else if( orientA == TRANSPOSE )
+        GemmOrientB<TRANSPOSE,N>( orientB, m, n, k, alpha, A, B, beta, C );
+    else
+        GemmOrientB<ADJOINT,N>( orientB, m, n, k, alpha, A, B, beta, C );
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const LaneBlock<const T>& A, const LaneBlock<const T>& B,
+  T beta,  const LaneBlock<T>& C )
+{
+    if( m == n && n == k )
+    {
+        EL_BATCHED_SIZE_SWITCH( n,
+          (GemmOrient<N>( orientA, orientB, m, n, k, alpha, A, B, beta, C )) )
+    }
+    else
+        GemmOrient<0>( orientA, orientB, m, n, k, alpha, A, B, beta, C );
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_GEMM_HPP
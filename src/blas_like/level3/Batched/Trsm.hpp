@@ -0,0 +1,162 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_TRSM_HPP
+#define EL_BATCHED_TRSM_HPP
+
+namespace El {
+namespace batched {
+
+// Overwrite B with the solution of op(A) X = alpha B (side=LEFT) or
+// X op(A) = alpha B (side=RIGHT), where, if N > 0, the order of the triangular
+// matrix is known at compile-time
+template<Orientation orientation,Int N,typename F>
+void TrsmKernel
+( LeftOrRight side, UpperOrLower uplo, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const LaneBlock<const F>& A, const LaneBlock<F>& B )
+{
+    const Int numLanes = B.numLanes;
+    const bool opLower = ( (uplo==LOWER) == (orientation==NORMAL) );
+    const bool unit = ( diag == UNIT );
+
+    if( alpha != F(1) )
+    {
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+            {
+                EL_SIMD
+                for( Int l=0; l<numLanes; ++l )
+                    B(i,j,l) *= alpha;
+            }
+    }
+
+    if( side == LEFT )
+    {
+        const Int mFix = ( N > 0 ? N : m );
+        for( Int j=0; j<n; ++j )
+        {
+            if( opLower )
+            {
+                for( Int i=0; i<mFix; ++i )
+                {
+                    for( Int p=0; p<i; ++p )
+                    {
+                        EL_SIMD
+                        for( Int l=0; l<numLanes; ++l )
+                            B(i,j,l) -= OpEntry<orientation>(A,i,p,l)*B(p,j,l);
+                    }
+                    if( !unit )
+                    {
+                        EL_SIMD
+                        for( Int l=0; l<numLanes; ++l )
+                            B(i,j,l) /= OpEntry<orientation>(A,i,i,l);
+                    }
+                }
+            }
+            else
+            {
+                for( Int i=mFix-1; i>=0; --i )
+                {
+                    for( Int p=i+1; p<mFix; ++p )
+                    {
+                        EL_SIMD
+                        for( Int l=0; l<numLanes; ++l )
+                            B(i,j,l) -= OpEntry<orientation>(A,i,p,l)*B(p,j,l);
+                    }
+                    if( !unit )
+                    {
+                        EL_SIMD
+                        for( Int l=0; l<numLanes; ++l )
+                            B(i,j,l) /= OpEntry<orientation>(A,i,i,l);
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        // Column j of X satisfies
+        //   x_j op(A)(j,j) = b_j - sum_{p != j} x_p op(A)(p,j),
+        // where the sum is over p > j if op(A) is lower-triangular and over
+        // p < j otherwise
+        const Int nFix = ( N > 0 ? N : n );
+        if( opLower )
+        {
+            for( Int j=nFix-1; j>=0; --j )
+            {
+                for( Int p=j+1; p<nFix; ++p )
+                    for( Int i=0; i<m; ++i )
+                    {
+                        EL_SIMD
+                        for( Int l=0; l<numLanes; ++l )
+                            B(i,j,l) -= B(i,p,l)*OpEntry<orientation>(A,p,j,l);
+                    }
+                if( !unit )
+                    for( Int i=0; i<m; ++i )
+                    {
+                        EL_SIMD
+                        for( Int l=0; l<numLanes; ++l )
+                            B(i,j,l) /= OpEntry<orientation>(A,j,j,l);
+                    }
+            }
+        }
+        else
+        {
+            for( Int j=0; j<nFix; ++j )
+            {
+                for( Int p=0; p<j; ++p )
+                    for( Int i=0; i<m; ++i )
+                    {
+                        EL_SIMD
+                        for( Int l=0; l<numLanes; ++l )
+                            B(i,j,l) -= B(i,p,l)*OpEntry<orientation>(A,p,j,l);
+                    }
+                if( !unit )
+                    for( Int i=0; i<m; ++i )
+                    {
+                        EL_SIMD
+                        for( Int l=0; l<numLanes; ++l )
+                            B(i,j,l) /= OpEntry<orientation>(A,j,j,l);
+                    }
+            }
+        }
+    }
+}
+
+template<Int N,typename F>
+void TrsmOrient
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const LaneBlock<const F>& A, const LaneBlock<F>& B )
+{
+    if( orientation == NORMAL )
+        TrsmKernel<NORMAL,N>( side, uplo, diag, m, n, alpha, A, B );
+    else if( orientation == TRANSPOSE )
+        TrsmKernel<TRANSPOSE,N>( side, uplo, diag, m, n, alpha, A, B );
+    else
+        TrsmKernel<ADJOINT,N>( side, uplo, diag, m, n, alpha, A, B );
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const LaneBlock<const F>& A, const LaneBlock<F>& B )
+{
+    const Int order = ( side == LEFT ? m : n );
+    EL_BATCHED_SIZE_SWITCH( order,
+      (TrsmOrient<N>( side, uplo, orientation, diag, m, n, alpha, A, B )) )
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_TRSM_HPP
@@ -0,0 +1,130 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_UTIL_HPP
+#define EL_BATCHED_UTIL_HPP
+
+namespace El {
+namespace batched {
+
+// The number of interleaved matrices processed by a single kernel call
+// (and therefore the granularity of the OpenMP parallelism over the batch)
+const Int laneBlocksize = 64;
+
+// A set of 'numLanes' matrices whose (i,j) entries are stored 'entryStride'
+// entries apart, with entry (i,j) of consecutive matrices stored contiguously.
+// A single column-major matrix is the special case numLanes=entryStride=1,
+// so that each kernel below handles both batch layouts (and pointer arrays).
+template<typename T>
+struct LaneBlock
+{
+    T* buffer;
+    Int ldim;
+    Int entryStride;
+    Int numLanes;
+
+    T& operator()( Int i, Int j, Int l ) const
+    { return buffer[(i+j*ldim)*entryStride+l]; }
+};
+
+template<typename T>
+LaneBlock<T> MatrixLaneBlock( Matrix<T>& A )
+{ return LaneBlock<T>{ A.Buffer(), A.LDim(), 1, 1 }; }
+
+template<typename T>
+LaneBlock<const T> LockedMatrixLaneBlock( const Matrix<T>& A )
+{ return LaneBlock<const T>{ A.LockedBuffer(), A.LDim(), 1, 1 }; }
+
+template<typename T>
+Int NumLaneBlocks( const BatchMatrix<T>& A )
+{
+    if( A.Layout() == BATCH_STRIDED )
+        return A.BatchSize();
+    else
+        return ( A.BatchSize() + laneBlocksize - 1 ) / laneBlocksize;
+}
+
+// The index of the first member of the batch within the given lane block
+template<typename T>
+Int FirstLane( const BatchMatrix<T>& A, Int block )
+{ return ( A.Layout() == BATCH_STRIDED ? block : block*laneBlocksize ); }
+
+template<typename T>
+LaneBlock<const T> LockedGetLaneBlock( const BatchMatrix<T>& A, Int block )
+{
+    if( A.Layout() == BATCH_STRIDED )
+        return LaneBlock<const T>
+        { A.LockedBuffer() + block*A.BatchStride(), A.LDim(), 1, 1 };
+    else
+    {
+        const Int first = block*laneBlocksize;
+        return LaneBlock<const T>
+        { A.LockedBuffer() + first, A.LDim(), A.BatchStride(),
+          Min(laneBlocksize,A.BatchSize()-first) };
+    }
+}
+
+template<typename T>
+LaneBlock<T> GetLaneBlock( BatchMatrix<T>& A, Int block )
+{
+    if( A.Layout() == BATCH_STRIDED )
+        return LaneBlock<T>
+        { A.Buffer() + block*A.BatchStride(), A.LDim(), 1, 1 };
+    else
+    {
+        const Int first = block*laneBlocksize;
+        return LaneBlock<T>
+        { A.Buffer() + first, A.LDim(), A.BatchStride(),
+          Min(laneBlocksize,A.BatchSize()-first) };
+    }
+}
+
+template<Orientation orientation,typename T>
+inline T OpEntry( const LaneBlock<const T>& A, Int i, Int j, Int l )
+{
+    if( orientation == NORMAL )
+        return A(i,j,l);
+    else if( orientation == TRANSPOSE )
+        return A(j,i,l);
+    else
+        return Conj(A(j,i,l));
+}
+
+// Calls 'CALL', which should make use of the constant 'N', with N set to
+// n if n is one of the sizes for which the kernels are specialized at
+// compile-time and N=0 (which signifies a run-time size) otherwise
+#define EL_BATCHED_SIZE_SWITCH(n,CALL) \
+  switch( n ) \
+  { \
+  case 2:  { constexpr Int N=2;  CALL; break; } \
+  case 3:  { constexpr Int N=3;  CALL; break; } \
+  case 4:  { constexpr Int N=4;  CALL; break; } \
+  case 8:  { constexpr Int N=8;  CALL; break; } \
+  case 16: { constexpr Int N=16; CALL; break; } \
+  case 32: { constexpr Int N=32; CALL; break; } \
+  default: { constexpr Int N=0;  CALL; break; } \
+  }
+
+// Throws the given exception type if any member of the batch failed, where
+// 'failures' holds, for each lane block, the first failed batch index (or -1)
+template<typename ExceptionType>
+void ThrowOnFailure( const vector<Int>& failures, const char* msg )
+{
+    for( const Int failure : failures )
+        if( failure >= 0 )
+        {
+            const string fullMsg =
+              BuildString(msg," (batch member ",failure,")");
+            throw ExceptionType( fullMsg.c_str() );
+        }
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_UTIL_HPP
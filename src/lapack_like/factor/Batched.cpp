@@ -0,0 +1,436 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../../blas_like/level3/Batched/Util.hpp"
+#include "../../blas_like/level3/Batched/Trsm.hpp"
+#include "./Batched/Cholesky.hpp"
+#include "./Batched/LU.hpp"
+#include "./Batched/QR.hpp"
+
+namespace El {
+
+namespace {
+
+template<typename Field>
+void AssertSameBatches
+( const BatchMatrix<Field>& A, const BatchMatrix<Field>& B )
+{
+    if( A.BatchSize() != B.BatchSize() )
+        LogicError("Batch sizes did not match");
+    if( A.Layout() != B.Layout() )
+        LogicError("Batch layouts did not match");
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void Cholesky( UpperOrLower uplo, BatchMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    const Int numBlocks = batched::NumLaneBlocks( A );
+    vector<Int> failures( numBlocks, -1 );
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int failure =
+          batched::Cholesky( uplo, n, batched::GetLaneBlock( A, block ) );
+        if( failure >= 0 )
+            failures[block] = batched::FirstLane( A, block ) + failure;
+    }
+    batched::ThrowOnFailure<NonHPDMatrixException>
+    ( failures, "Matrix was not HPD" );
+}
+
+template<typename Field>
+void Cholesky( UpperOrLower uplo, vector<Matrix<Field>>& A )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    for( Int b=0; b<batchSize; ++b )
+        if( A[b].Height() != A[b].Width() )
+            LogicError("Member ",b," of the batch was not square");
+    vector<Int> failures( batchSize, -1 );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int failure =
+          batched::Cholesky
+          ( uplo, A[b].Height(), batched::MatrixLaneBlock( A[b] ) );
+        if( failure >= 0 )
+            failures[b] = b;
+    }
+    batched::ThrowOnFailure<NonHPDMatrixException>
+    ( failures, "Matrix was not HPD" );
+}
+
+namespace cholesky {
+
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const BatchMatrix<Field>& A,
+        BatchMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must be the same height");
+    AssertSameBatches( A, B );
+    const Int numBlocks = batched::NumLaneBlocks( B );
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+        batched::CholeskySolveAfter
+        ( uplo, orientation, B.Height(), B.Width(),
+          batched::LockedGetLaneBlock( A, block ),
+          batched::GetLaneBlock( B, block ) );
+}
+
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = B.size();
+    if( Int(A.size()) != batchSize )
+        LogicError("Batch sizes did not match");
+    for( Int b=0; b<batchSize; ++b )
+        if( A[b].Height() != A[b].Width() || A[b].Height() != B[b].Height() )
+            LogicError("Nonconformal solve for member ",b," of the batch");
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+        batched::CholeskySolveAfter
+        ( uplo, orientation, B[b].Height(), B[b].Width(),
+          batched::LockedMatrixLaneBlock( A[b] ),
+          batched::MatrixLaneBlock( B[b] ) );
+}
+
+} // namespace cholesky
+
+template<typename Field>
+void LU( BatchMatrix<Field>& A, Matrix<Int>& swapDests )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    swapDests.Resize( minDim, A.BatchSize() );
+    if( minDim == 0 )
+        return;
+
+    const Int numBlocks = batched::NumLaneBlocks( A );
+    vector<Int> failures( numBlocks, -1 );
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int first = batched::FirstLane( A, block );
+        const Int failure =
+          batched::LU
+          ( m, n, batched::GetLaneBlock( A, block ),
+            swapDests.Buffer(0,first), swapDests.LDim() );
+        if( failure >= 0 )
+            failures[block] = first + failure;
+    }
+    batched::ThrowOnFailure<SingularMatrixException>
+    ( failures, "Matrix was singular" );
+}
+
+template<typename Field>
+void LU( vector<Matrix<Field>>& A, Matrix<Int>& swapDests )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    Int maxMinDim = 0;
+    for( Int b=0; b<batchSize; ++b )
+        maxMinDim = Max( maxMinDim, Min(A[b].Height(),A[b].Width()) );
+    Zeros( swapDests, maxMinDim, batchSize );
+    if( maxMinDim == 0 )
+        return;
+
+    vector<Int> failures( batchSize, -1 );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int failure =
+          batched::LU
+          ( A[b].Height(), A[b].Width(), batched::MatrixLaneBlock( A[b] ),
+            swapDests.Buffer(0,b), swapDests.LDim() );
+        if( failure >= 0 )
+            failures[b] = b;
+    }
+    batched::ThrowOnFailure<SingularMatrixException>
+    ( failures, "Matrix was singular" );
+}
+
+namespace lu {
+
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const BatchMatrix<Field>& A,
+  const Matrix<Int>& swapDests,
+        BatchMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must be the same height");
+    if( swapDests.Height() != A.Height() ||
+        swapDests.Width() != A.BatchSize() )
+        LogicError("swapDests was of an unexpected size");
+    AssertSameBatches( A, B );
+    if( A.Height() == 0 )
+        return;
+
+    const Int numBlocks = batched::NumLaneBlocks( B );
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+        batched::LUSolveAfter
+        ( orientation, B.Height(), B.Width(),
+          batched::LockedGetLaneBlock( A, block ),
+          swapDests.LockedBuffer(0,batched::FirstLane(A,block)),
+          swapDests.LDim(),
+          batched::GetLaneBlock( B, block ) );
+}
+
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const vector<Matrix<Field>>& A,
+  const Matrix<Int>& swapDests,
+        vector<Matrix<Field>>& B )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = B.size();
+    if( Int(A.size()) != batchSize || swapDests.Width() != batchSize )
+        LogicError("Batch sizes did not match");
+    for( Int b=0; b<batchSize; ++b )
+        if( A[b].Height() != A[b].Width() || A[b].Height() != B[b].Height() ||
+            A[b].Height() > swapDests.Height() )
+            LogicError("Nonconformal solve for member ",b," of the batch");
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+        batched::LUSolveAfter
+        ( orientation, B[b].Height(), B[b].Width(),
+          batched::LockedMatrixLaneBlock( A[b] ),
+          swapDests.LockedBuffer(0,b), swapDests.LDim(),
+          batched::MatrixLaneBlock( B[b] ) );
+}
+
+} // namespace lu
+
+template<typename Field>
+void QR
+( BatchMatrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    householderScalars.Resize( minDim, A.BatchSize() );
+    signature.Resize( minDim, A.BatchSize() );
+    if( minDim == 0 )
+        return;
+
+    const Int numBlocks = batched::NumLaneBlocks( A );
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int first = batched::FirstLane( A, block );
+        batched::QR
+        ( m, n, batched::GetLaneBlock( A, block ),
+          householderScalars.Buffer(0,first), householderScalars.LDim(),
+          signature.Buffer(0,first), signature.LDim() );
+    }
+}
+
+template<typename Field>
+void QR
+( vector<Matrix<Field>>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    Int maxMinDim = 0;
+    for( Int b=0; b<batchSize; ++b )
+        maxMinDim = Max( maxMinDim, Min(A[b].Height(),A[b].Width()) );
+    Zeros( householderScalars, maxMinDim, batchSize );
+    Zeros( signature, maxMinDim, batchSize );
+    if( maxMinDim == 0 )
+        return;
+
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+        batched::QR
+        ( A[b].Height(), A[b].Width(), batched::MatrixLaneBlock( A[b] ),
+          householderScalars.Buffer(0,b), householderScalars.LDim(),
+          signature.Buffer(0,b), signature.LDim() );
+}
+
+namespace qr {
+
+template<typename Field>
+void SolveAfter
+( const BatchMatrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+  const BatchMatrix<Field>& B,
+        BatchMatrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numRHS = B.Width();
+    const Int batchSize = A.BatchSize();
+    if( m < n )
+        LogicError("Batched QR solves require m >= n");
+    if( B.Height() != m )
+        LogicError("A and B must be the same height");
+    if( householderScalars.Height() != n || signature.Height() != n ||
+        householderScalars.Width() != batchSize ||
+        signature.Width() != batchSize )
+        LogicError("Householder data was of an unexpected size");
+    AssertSameBatches( A, B );
+
+    // Overwrite a copy of B with Q^H B and then solve against R
+    BatchMatrix<Field> C( B );
+    const Int numBlocks = batched::NumLaneBlocks( C );
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int first = batched::FirstLane( C, block );
+        auto ABlock = batched::LockedGetLaneBlock( A, block );
+        auto CBlock = batched::GetLaneBlock( C, block );
+        batched::QRApplyQAdjoint
+        ( m, n, numRHS, ABlock,
+          householderScalars.LockedBuffer(0,first), householderScalars.LDim(),
+          signature.LockedBuffer(0,first), signature.LDim(),
+          CBlock );
+        batched::Trsm
+        ( LEFT, UPPER, NORMAL, NON_UNIT, n, numRHS,
+          Field(1), ABlock, CBlock );
+    }
+
+    X.Resize( n, numRHS, batchSize );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=0; i<n; ++i )
+                X(i,j,b) = C(i,j,b);
+}
+
+template<typename Field>
+void SolveAfter
+( const vector<Matrix<Field>>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+  const vector<Matrix<Field>>& B,
+        vector<Matrix<Field>>& X )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    if( Int(B.size()) != batchSize ||
+        householderScalars.Width() != batchSize ||
+        signature.Width() != batchSize )
+        LogicError("Batch sizes did not match");
+    for( Int b=0; b<batchSize; ++b )
+        if( A[b].Height() < A[b].Width() ||
+            A[b].Height() != B[b].Height() ||
+            A[b].Width() > householderScalars.Height() )
+            LogicError("Nonconformal solve for member ",b," of the batch");
+
+    X.resize( batchSize );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int m = A[b].Height();
+        const Int n = A[b].Width();
+        const Int numRHS = B[b].Width();
+        Matrix<Field> C( B[b] );
+        auto ALane = batched::LockedMatrixLaneBlock( A[b] );
+        auto CLane = batched::MatrixLaneBlock( C );
+        batched::QRApplyQAdjoint
+        ( m, n, numRHS, ALane,
+          householderScalars.LockedBuffer(0,b), householderScalars.LDim(),
+          signature.LockedBuffer(0,b), signature.LDim(),
+          CLane );
+        batched::Trsm
+        ( LEFT, UPPER, NORMAL, NON_UNIT, n, numRHS, Field(1), ALane, CLane );
+        X[b] = C( IR(0,n), ALL );
+    }
+}
+
+} // namespace qr
+
+#define PROTO(Field) \
+  template void Cholesky( UpperOrLower uplo, BatchMatrix<Field>& A ); \
+  template void Cholesky( UpperOrLower uplo, vector<Matrix<Field>>& A ); \
+  template void cholesky::SolveAfter \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const BatchMatrix<Field>& A, \
+          BatchMatrix<Field>& B ); \
+  template void cholesky::SolveAfter \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const vector<Matrix<Field>>& A, \
+          vector<Matrix<Field>>& B ); \
+  template void LU( BatchMatrix<Field>& A, Matrix<Int>& swapDests ); \
+  template void LU( vector<Matrix<Field>>& A, Matrix<Int>& swapDests ); \
+  template void lu::SolveAfter \
+  ( Orientation orientation, \
+    const BatchMatrix<Field>& A, \
+    const Matrix<Int>& swapDests, \
+          BatchMatrix<Field>& B ); \
+  template void lu::SolveAfter \
+  ( Orientation orientation, \
+    const vector<Matrix<Field>>& A, \
+    const Matrix<Int>& swapDests, \
+          vector<Matrix<Field>>& B ); \
+  template void QR \
+  ( BatchMatrix<Field>& A, \
+    Matrix<Field>& householderScalars, \
+    Matrix<Base<Field>>& signature ); \
+  template void QR \
+  ( vector<Matrix<Field>>& A, \
+    Matrix<Field>& householderScalars, \
+    Matrix<Base<Field>>& signature ); \
+  template void qr::SolveAfter \
+  ( const BatchMatrix<Field>& A, \
+    const Matrix<Field>& householderScalars, \
+    const Matrix<Base<Field>>& signature, \
+    const BatchMatrix<Field>& B, \
+          BatchMatrix<Field>& X ); \
+  template void qr::SolveAfter \
+  ( const vector<Matrix<Field>>& A, \
+    const Matrix<Field>& householderScalars, \
+    const Matrix<Base<Field>>& signature, \
+    const vector<Matrix<Field>>& B, \
+          vector<Matrix<Field>>& X );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_CHOLESKY_HPP
+#define EL_BATCHED_CHOLESKY_HPP
+
+namespace El {
+namespace batched {
+
+// Returns the index of the first lane which was not HPD (or -1)
+template<Int N,typename F>
+Int CholeskyKernel( UpperOrLower uplo, Int n, const LaneBlock<F>& A )
+{
+    typedef Base<F> Real;
+    const Int nFix = ( N > 0 ? N : n );
+    const Int numLanes = A.numLanes;
+    Int failure = -1;
+    for( Int k=0; k<nFix; ++k )
+    {
+        for( Int l=0; l<numLanes; ++l )
+        {
+            Real delta = RealPart(A(k,k,l));
+            if( delta <= Real(0) )
+            {
+                if( failure < 0 )
+                    failure = l;
+                delta = Real(1);
+            }
+            A(k,k,l) = Sqrt(delta);
+        }
+        if( uplo == LOWER )
+        {
+            for( Int i=k+1; i<nFix; ++i )
+            {
+                EL_SIMD
+                for( Int l=0; l<numLanes; ++l )
+                    A(i,k,l) /= A(k,k,l);
+            }
+            for( Int j=k+1; j<nFix; ++j )
+                for( Int i=j; i<nFix; ++i )
+                {
+                    EL_SIMD
+                    for( Int l=0; l<numLanes; ++l )
+                        A(i,j,l) -= A(i,k,l)*Conj(A(j,k,l));
+                }
+        }
+        else
+        {
+            for( Int j=k+1; j<nFix; ++j )
+            {
+                EL_SIMD
+                for( Int l=0; l<numLanes; ++l )
+                    A(k,j,l) /= A(k,k,l);
+            }
+            for( Int j=k+1; j<nFix; ++j )
+                for( Int i=k+1; i<=j; ++i )
+                {
+                    EL_SIMD
+                    for( Int l=0; l<numLanes; ++l )
+                        A(i,j,l) -= Conj(A(k,i,l))*A(k,j,l);
+                }
+        }
+    }
+    return failure;
+}
+
+template<typename F>
+Int Cholesky( UpperOrLower uplo, Int n, const LaneBlock<F>& A )
+{
+    Int failure = -1;
+    EL_BATCHED_SIZE_SWITCH( n, (failure = CholeskyKernel<N>( uplo, n, A )) )
+    return failure;
+}
+
+template<typename F>
+void ConjugateLanes( Int m, Int n, const LaneBlock<F>& B )
+{
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            EL_SIMD
+            for( Int l=0; l<B.numLanes; ++l )
+                B(i,j,l) = Conj(B(i,j,l));
+        }
+}
+
+template<Int N,typename F>
+void CholeskySolveAfterKernel
+( UpperOrLower uplo,
+  Orientation orientation,
+  Int n, Int numRHS,
+  const LaneBlock<const F>& A,
+  const LaneBlock<F>& B )
+{
+    if( orientation == TRANSPOSE )
+        ConjugateLanes( n, numRHS, B );
+    if( uplo == LOWER )
+    {
+        TrsmKernel<NORMAL,N>( LEFT, LOWER, NON_UNIT, n, numRHS, F(1), A, B );
+        TrsmKernel<ADJOINT,N>( LEFT, LOWER, NON_UNIT, n, numRHS, F(1), A, B );
+    }
+    else
+    {
+        TrsmKernel<ADJOINT,N>( LEFT, UPPER, NON_UNIT, n, numRHS, F(1), A, B );
+        TrsmKernel<NORMAL,N>( LEFT, UPPER, NON_UNIT, n, numRHS, F(1), A, B );
+    }
+    if( orientation == TRANSPOSE )
+        ConjugateLanes( n, numRHS, B );
+}
+
+template<typename F>
+void CholeskySolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  Int n, Int numRHS,
+  const LaneBlock<const F>& A,
+  const LaneBlock<F>& B )
+{
+    EL_BATCHED_SIZE_SWITCH( n,
+      (CholeskySolveAfterKernel<N>( uplo, orientation, n, numRHS, A, B )) )
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_CHOLESKY_HPP
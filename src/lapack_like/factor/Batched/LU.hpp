@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_LU_HPP
+#define EL_BATCHED_LU_HPP
+
+namespace El {
+namespace batched {
+
+// The row swaps of lane l are stored in swapDests[k+l*swapLDim].
+// Returns the index of the first lane which encountered a zero pivot (or -1).
+template<Int N,typename F>
+Int LUKernel
+( Int m, Int n, const LaneBlock<F>& A, Int* swapDests, Int swapLDim )
+{
+    typedef Base<F> Real;
+    const Int mFix = ( N > 0 ? N : m );
+    const Int nFix = ( N > 0 ? N : n );
+    const Int minDim = Min(mFix,nFix);
+    const Int numLanes = A.numLanes;
+    Int failure = -1;
+    for( Int k=0; k<minDim; ++k )
+    {
+        // Pivot each lane independently
+        for( Int l=0; l<numLanes; ++l )
+        {
+            Int pivot = k;
+            Real pivotAbs = Abs(A(k,k,l));
+            for( Int i=k+1; i<mFix; ++i )
+            {
+                const Real alphaAbs = Abs(A(i,k,l));
+                if( alphaAbs > pivotAbs )
+                {
+                    pivot = i;
+                    pivotAbs = alphaAbs;
+                }
+            }
+            swapDests[k+l*swapLDim] = pivot;
+            if( pivot != k )
+                for( Int j=0; j<nFix; ++j )
+                    std::swap( A(k,j,l), A(pivot,j,l) );
+            if( pivotAbs == Real(0) )
+            {
+                if( failure < 0 )
+                    failure = l;
+                A(k,k,l) = F(1);
+            }
+        }
+
+        for( Int i=k+1; i<mFix; ++i )
+        {
+            EL_SIMD
+            for( Int l=0; l<numLanes; ++l )
+                A(i,k,l) /= A(k,k,l);
+        }
+        for( Int j=k+1; j<nFix; ++j )
+            for( Int i=k+1; i<mFix; ++i )
+            {
+                EL_SIMD
+                for( Int l=0; l<numLanes; ++l )
+                    A(i,j,l) -= A(i,k,l)*A(k,j,l);
+            }
+    }
+    return failure;
+}
+
+template<typename F>
+Int LU( Int m, Int n, const LaneBlock<F>& A, Int* swapDests, Int swapLDim )
+{
+    Int failure = -1;
+    if( m == n )
+    {
+        EL_BATCHED_SIZE_SWITCH( n,
+          (failure = LUKernel<N>( m, n, A, swapDests, swapLDim )) )
+    }
+    else
+        failure = LUKernel<0>( m, n, A, swapDests, swapLDim );
+    return failure;
+}
+
+template<typename F>
+void ApplyRowSwaps
+( bool forward, Int numSwaps, Int numRHS,
+  const Int* swapDests, Int swapLDim, const LaneBlock<F>& B )
+{
+    for( Int l=0; l<B.numLanes; ++l )
+    {
+        for( Int t=0; t<numSwaps; ++t )
+        {
+            const Int k = ( forward ? t : numSwaps-1-t );
+            const Int pivot = swapDests[k+l*swapLDim];
+            if( pivot != k )
+                for( Int j=0; j<numRHS; ++j )
+                    std::swap( B(k,j,l), B(pivot,j,l) );
+        }
+    }
+}
+
+// Since P A = L U, A X = B can be solved via L U X = P B, and
+// op(A) X = B via op(U) op(L) (P X) = B
+template<Int N,typename F>
+void LUSolveAfterKernel
+( Orientation orientation,
+  Int n, Int numRHS,
+  const LaneBlock<const F>& A,
+  const Int* swapDests, Int swapLDim,
+  const LaneBlock<F>& B )
+{
+    if( orientation == NORMAL )
+    {
+        ApplyRowSwaps( true, n, numRHS, swapDests, swapLDim, B );
+        TrsmKernel<NORMAL,N>( LEFT, LOWER, UNIT, n, numRHS, F(1), A, B );
+        TrsmKernel<NORMAL,N>( LEFT, UPPER, NON_UNIT, n, numRHS, F(1), A, B );
+    }
+    else
+    {
+        TrsmOrient<N>
+        ( LEFT, UPPER, orientation, NON_UNIT, n, numRHS, F(1), A, B );
+        TrsmOrient<N>
+        ( LEFT, LOWER, orientation, UNIT, n, numRHS, F(1), A, B );
+        ApplyRowSwaps( false, n, numRHS, swapDests, swapLDim, B );
+    }
+}
+
+template<typename F>
+void LUSolveAfter
+( Orientation orientation,
+  Int n, Int numRHS,
+  const LaneBlock<const F>& A,
+  const Int* swapDests, Int swapLDim,
+  const LaneBlock<F>& B )
+{
+    EL_BATCHED_SIZE_SWITCH( n,
+      (LUSolveAfterKernel<N>
+       ( orientation, n, numRHS, A, swapDests, swapLDim, B )) )
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_LU_HPP
@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_QR_HPP
+#define EL_BATCHED_QR_HPP
+
+namespace El {
+namespace batched {
+
+// An unblocked Householder QR factorization of each lane which mirrors
+// qr::PanelHouseholder. Since the reflector generation involves a norm
+// computation for each lane, the lanes are processed one at a time.
+template<typename F>
+void QR
+( Int m, Int n,
+  const LaneBlock<F>& A,
+  F* householderScalars, Int tLDim,
+  Base<F>* signature, Int dLDim )
+{
+    typedef Base<F> Real;
+    const Int minDim = Min(m,n);
+    for( Int l=0; l<A.numLanes; ++l )
+    {
+        F* t = &householderScalars[l*tLDim];
+        Real* d = &signature[l*dLDim];
+        for( Int k=0; k<minDim; ++k )
+        {
+            // Find tau and u such that
+            //  / I - tau | 1 | | 1, u^H | \ | alpha11 | = | beta |
+            //  \         | u |            / |     a21 | = |    0 |
+            F* a21 = ( k+1 < m ? &A(k+1,k,l) : &A(k,k,l) );
+            const F tau =
+              lapack::Reflector( m-k, A(k,k,l), a21, A.entryStride );
+            t[k] = tau;
+
+            // Apply (I - tau [1; u] [1; u]^H) from the left
+            for( Int j=k+1; j<n; ++j )
+            {
+                F gamma = A(k,j,l);
+                for( Int i=k+1; i<m; ++i )
+                    gamma += Conj(A(i,k,l))*A(i,j,l);
+                gamma *= tau;
+                A(k,j,l) -= gamma;
+                for( Int i=k+1; i<m; ++i )
+                    A(i,j,l) -= A(i,k,l)*gamma;
+            }
+        }
+
+        // Form d and rescale R
+        for( Int k=0; k<minDim; ++k )
+        {
+            d[k] = ( RealPart(A(k,k,l)) >= Real(0) ? Real(1) : Real(-1) );
+            for( Int j=k; j<n; ++j )
+                A(k,j,l) *= d[k];
+        }
+    }
+}
+
+// B := Q^H B, where Q is the unitary factor from the above factorization of
+// the m x n matrices (with m >= n)
+template<typename F>
+void QRApplyQAdjoint
+( Int m, Int n, Int numRHS,
+  const LaneBlock<const F>& A,
+  const F* householderScalars, Int tLDim,
+  const Base<F>* signature, Int dLDim,
+  const LaneBlock<F>& B )
+{
+    for( Int l=0; l<A.numLanes; ++l )
+    {
+        const F* t = &householderScalars[l*tLDim];
+        const Base<F>* d = &signature[l*dLDim];
+        for( Int k=0; k<n; ++k )
+        {
+            for( Int j=0; j<numRHS; ++j )
+            {
+                F gamma = B(k,j,l);
+                for( Int i=k+1; i<m; ++i )
+                    gamma += Conj(A(i,k,l))*B(i,j,l);
+                gamma *= t[k];
+                B(k,j,l) -= gamma;
+                for( Int i=k+1; i<m; ++i )
+                    B(i,j,l) -= A(i,k,l)*gamma;
+            }
+        }
+        for( Int j=0; j<numRHS; ++j )
+            for( Int k=0; k<n; ++k )
+                B(k,j,l) *= d[k];
+    }
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_QR_HPP
@@ -0,0 +1,294 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./Tiled/TaskGraph.hpp"
+#include "./Tiled/Cholesky.hpp"
+#include "./Tiled/LU.hpp"
+#include "./Tiled/QR.hpp"
+
+namespace El {
+
+template<typename F>
+TileMatrix<F>::TileMatrix( Int tileSize )
+: tileSize_(tileSize)
+{
+    EL_DEBUG_CSE
+    if( tileSize < 1 )
+        LogicError("Tile sizes must be positive");
+}
+
+template<typename F>
+TileMatrix<F>::TileMatrix( const Matrix<F>& A, Int tileSize )
+: TileMatrix<F>(tileSize)
+{
+    EL_DEBUG_CSE
+    CopyFrom( A );
+}
+
+template<typename F>
+void TileMatrix<F>::Empty()
+{
+    EL_DEBUG_CSE
+    height_ = width_ = 0;
+    numTileRows_ = numTileCols_ = 0;
+    tiles_.clear();
+    SwapClear( buffer_ );
+}
+
+template<typename F>
+void TileMatrix<F>::SetTileSize( Int tileSize )
+{
+    EL_DEBUG_CSE
+    if( tileSize < 1 )
+        LogicError("Tile sizes must be positive");
+    if( tileSize != tileSize_ )
+    {
+        tileSize_ = tileSize;
+        Resize( height_, width_ );
+    }
+}
+
+template<typename F>
+void TileMatrix<F>::Resize( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    height_ = height;
+    width_ = width;
+    numTileRows_ = ( height + tileSize_ - 1 ) / tileSize_;
+    numTileCols_ = ( width + tileSize_ - 1 ) / tileSize_;
+
+    // The tiles are stored contiguously, one tile row after another, so that
+    // each tile begins at the offset of the full tiles which precede it
+    buffer_.resize( height*width );
+    tiles_.clear();
+    tiles_.resize( numTileRows_*numTileCols_ );
+    Int offset = 0;
+    for( Int i=0; i<numTileRows_; ++i )
+    {
+        const Int tileHeight = TileHeight(i);
+        for( Int j=0; j<numTileCols_; ++j )
+        {
+            const Int tileWidth = TileWidth(j);
+            tiles_[i*numTileCols_+j].Attach
+            ( tileHeight, tileWidth, &buffer_[offset], tileHeight );
+            offset += tileHeight*tileWidth;
+        }
+    }
+}
+
+template<typename F>
+void TileMatrix<F>::CopyFrom( const Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    Resize( A.Height(), A.Width() );
+    EL_PARALLEL_FOR
+    for( Int i=0; i<numTileRows_; ++i )
+    {
+        const IR tileRows( i*tileSize_, i*tileSize_+TileHeight(i) );
+        for( Int j=0; j<numTileCols_; ++j )
+        {
+            const IR tileCols( j*tileSize_, j*tileSize_+TileWidth(j) );
+            auto ATile = A( tileRows, tileCols );
+            Copy( ATile, Tile(i,j) );
+        }
+    }
+}
+
+template<typename F>
+void TileMatrix<F>::CopyTo( Matrix<F>& A ) const
+{
+    EL_DEBUG_CSE
+    A.Resize( height_, width_ );
+    EL_PARALLEL_FOR
+    for( Int i=0; i<numTileRows_; ++i )
+    {
+        const IR tileRows( i*tileSize_, i*tileSize_+TileHeight(i) );
+        for( Int j=0; j<numTileCols_; ++j )
+        {
+            const IR tileCols( j*tileSize_, j*tileSize_+TileWidth(j) );
+            auto ATile = A( tileRows, tileCols );
+            Copy( Tile(i,j), ATile );
+        }
+    }
+}
+
+template<typename F>
+Int TileMatrix<F>::Height() const { return height_; }
+template<typename F>
+Int TileMatrix<F>::Width() const { return width_; }
+template<typename F>
+Int TileMatrix<F>::TileSize() const { return tileSize_; }
+template<typename F>
+Int TileMatrix<F>::NumTileRows() const { return numTileRows_; }
+template<typename F>
+Int TileMatrix<F>::NumTileCols() const { return numTileCols_; }
+
+template<typename F>
+Int TileMatrix<F>::TileHeight( Int i ) const
+{ return Min( tileSize_, height_-i*tileSize_ ); }
+
+template<typename F>
+Int TileMatrix<F>::TileWidth( Int j ) const
+{ return Min( tileSize_, width_-j*tileSize_ ); }
+
+template<typename F>
+Matrix<F>& TileMatrix<F>::Tile( Int i, Int j )
+{
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= numTileRows_ || j < 0 || j >= numTileCols_ )
+          LogicError("Tile (",i,",",j,") is out of bounds");
+    )
+    return tiles_[i*numTileCols_+j];
+}
+
+template<typename F>
+const Matrix<F>& TileMatrix<F>::Tile( Int i, Int j ) const
+{
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= numTileRows_ || j < 0 || j >= numTileCols_ )
+          LogicError("Tile (",i,",",j,") is out of bounds");
+    )
+    return tiles_[i*numTileCols_+j];
+}
+
+namespace cholesky {
+
+template<typename F>
+void Tiled( UpperOrLower uplo, TileMatrix<F>& A, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    if( uplo == LOWER )
+        LowerTiled( A, ctrl );
+    else
+        UpperTiled( A, ctrl );
+    if( ctrl.time )
+        Output("Tiled Cholesky: ",timer.Stop()," seconds");
+}
+
+template<typename F>
+void Tiled( UpperOrLower uplo, Matrix<F>& A, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    TileMatrix<F> ATiled( A, ctrl.tileSize );
+    if( ctrl.time )
+        Output("Conversion to tiles: ",timer.Stop()," seconds");
+
+    Tiled( uplo, ATiled, ctrl );
+
+    if( ctrl.time )
+        timer.Start();
+    ATiled.CopyTo( A );
+    if( ctrl.time )
+        Output("Conversion from tiles: ",timer.Stop()," seconds");
+}
+
+} // namespace cholesky
+
+namespace lu {
+
+template<typename F>
+void Tiled( Matrix<F>& A, Permutation& P, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    TileMatrix<F> ATiled( A, ctrl.tileSize );
+    if( ctrl.time )
+    {
+        Output("Conversion to tiles: ",timer.Stop()," seconds");
+        timer.Start();
+    }
+
+    Tiled( ATiled, P, ctrl );
+
+    if( ctrl.time )
+    {
+        Output("Tiled LU: ",timer.Stop()," seconds");
+        timer.Start();
+    }
+    ATiled.CopyTo( A );
+    if( ctrl.time )
+        Output("Conversion from tiles: ",timer.Stop()," seconds");
+}
+
+} // namespace lu
+
+namespace qr {
+
+template<typename F>
+void Tiled( Matrix<F>& A, TiledData<F>& data, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    TileMatrix<F> ATiled( A, ctrl.tileSize );
+    if( ctrl.time )
+    {
+        Output("Conversion to tiles: ",timer.Stop()," seconds");
+        timer.Start();
+    }
+
+    Tiled( ATiled, data, ctrl );
+
+    if( ctrl.time )
+    {
+        Output("Tiled QR: ",timer.Stop()," seconds");
+        timer.Start();
+    }
+    ATiled.CopyTo( A );
+    if( ctrl.time )
+        Output("Conversion from tiles: ",timer.Stop()," seconds");
+}
+
+} // namespace qr
+
+#define PROTO(F) \
+  template class TileMatrix<F>; \
+  template void cholesky::Tiled \
+  ( UpperOrLower uplo, Matrix<F>& A, const TiledCtrl& ctrl ); \
+  template void cholesky::Tiled \
+  ( UpperOrLower uplo, TileMatrix<F>& A, const TiledCtrl& ctrl ); \
+  template void lu::Tiled \
+  ( Matrix<F>& A, Permutation& P, const TiledCtrl& ctrl ); \
+  template void lu::Tiled \
+  ( TileMatrix<F>& A, Permutation& P, const TiledCtrl& ctrl ); \
+  template void qr::Tiled \
+  ( Matrix<F>& A, qr::TiledData<F>& data, const TiledCtrl& ctrl ); \
+  template void qr::Tiled \
+  ( TileMatrix<F>& A, qr::TiledData<F>& data, const TiledCtrl& ctrl ); \
+  template void qr::tiled::ApplyQ \
+  ( Orientation orientation, \
+    const Matrix<F>& A, \
+    const qr::TiledData<F>& data, \
+          Matrix<F>& B ); \
+  template void qr::tiled::SolveAfter \
+  ( const Matrix<F>& A, \
+    const qr::TiledData<F>& data, \
+    const Matrix<F>& B, \
+          Matrix<F>& X );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
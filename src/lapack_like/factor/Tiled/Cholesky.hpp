@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TILED_CHOLESKY_HPP
+#define EL_TILED_CHOLESKY_HPP
+
+namespace El {
+namespace cholesky {
+
+// Right-looking tiled Cholesky: step k factors the diagonal tile, solves
+// against it for the tiles in the k'th tile column (row), and then updates
+// each tile of the trailing Hermitian submatrix independently.
+
+template<typename F>
+void LowerTiled( TileMatrix<F>& A, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int nt = A.NumTileRows();
+    auto id = [=]( Int i, Int j ) { return i + j*nt; };
+
+    tiled::TaskGraph graph( nt*nt );
+    for( Int k=0; k<nt; ++k )
+    {
+        const Int pathPriority = 2*(nt-k);
+        graph.Submit
+        ( [&A,k]() { Cholesky( LOWER, A.Tile(k,k) ); },
+          {}, {id(k,k)}, pathPriority+1 );
+        for( Int i=k+1; i<nt; ++i )
+            graph.Submit
+            ( [&A,i,k]()
+              { Trsm
+                ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+                  F(1), A.Tile(k,k), A.Tile(i,k) ); },
+              {id(k,k)}, {id(i,k)}, pathPriority+1 );
+        for( Int i=k+1; i<nt; ++i )
+        {
+            // Updates of the next tile column are on the critical path
+            const Int priority = ( i == k+1 ? pathPriority : 0 );
+            graph.Submit
+            ( [&A,i,k]()
+              { Herk
+                ( LOWER, NORMAL,
+                  Base<F>(-1), A.Tile(i,k), Base<F>(1), A.Tile(i,i) ); },
+              {id(i,k)}, {id(i,i)}, priority );
+            for( Int j=k+1; j<i; ++j )
+                graph.Submit
+                ( [&A,i,j,k]()
+                  { Gemm
+                    ( NORMAL, ADJOINT,
+                      F(-1), A.Tile(i,k), A.Tile(j,k), F(1), A.Tile(i,j) ); },
+                  {id(i,k),id(j,k)}, {id(i,j)},
+                  ( j == k+1 ? pathPriority : 0 ) );
+        }
+    }
+    graph.Execute( ctrl.parallel );
+}
+
+template<typename F>
+void UpperTiled( TileMatrix<F>& A, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int nt = A.NumTileRows();
+    auto id = [=]( Int i, Int j ) { return i + j*nt; };
+
+    tiled::TaskGraph graph( nt*nt );
+    for( Int k=0; k<nt; ++k )
+    {
+        const Int pathPriority = 2*(nt-k);
+        graph.Submit
+        ( [&A,k]() { Cholesky( UPPER, A.Tile(k,k) ); },
+          {}, {id(k,k)}, pathPriority+1 );
+        for( Int j=k+1; j<nt; ++j )
+            graph.Submit
+            ( [&A,j,k]()
+              { Trsm
+                ( LEFT, UPPER, ADJOINT, NON_UNIT,
+                  F(1), A.Tile(k,k), A.Tile(k,j) ); },
+              {id(k,k)}, {id(k,j)}, pathPriority+1 );
+        for( Int j=k+1; j<nt; ++j )
+        {
+            const Int priority = ( j == k+1 ? pathPriority : 0 );
+            graph.Submit
+            ( [&A,j,k]()
+              { Herk
+                ( UPPER, ADJOINT,
+                  Base<F>(-1), A.Tile(k,j), Base<F>(1), A.Tile(j,j) ); },
+              {id(k,j)}, {id(j,j)}, priority );
+            for( Int i=k+1; i<j; ++i )
+                graph.Submit
+                ( [&A,i,j,k]()
+                  { Gemm
+                    ( ADJOINT, NORMAL,
+                      F(-1), A.Tile(k,i), A.Tile(k,j), F(1), A.Tile(i,j) ); },
+                  {id(k,i),id(k,j)}, {id(i,j)},
+                  ( i == k+1 ? pathPriority : 0 ) );
+        }
+    }
+    graph.Execute( ctrl.parallel );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_TILED_CHOLESKY_HPP
@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TILED_LU_HPP
+#define EL_TILED_LU_HPP
+
+namespace El {
+namespace lu {
+
+// Swap rows of the j'th tile column using the swaps from the panel
+// factorization of the k'th tile column (which are relative to row k*nb)
+template<typename F>
+void ApplyTiledPanelSwaps
+( TileMatrix<F>& A, const Matrix<Int>& swapDests, Int k, Int j )
+{
+    EL_DEBUG_CSE
+    const Int nb = A.TileSize();
+    const Int width = A.TileWidth(j);
+    const Int numSwaps = swapDests.Height();
+    for( Int s=0; s<numSwaps; ++s )
+    {
+        const Int origin = k*nb + s;
+        const Int dest = k*nb + swapDests(s);
+        if( origin == dest )
+            continue;
+        auto& AOrig = A.Tile( origin/nb, j );
+        auto& ADest = A.Tile( dest/nb, j );
+        blas::Swap
+        ( width,
+          AOrig.Buffer(origin%nb,0), AOrig.LDim(),
+          ADest.Buffer(dest%nb,0), ADest.LDim() );
+    }
+}
+
+// Factor the k'th tile column (from the diagonal down) with partial pivoting
+template<typename F>
+void TiledPanel
+( TileMatrix<F>& A, Int k, Matrix<Int>& swapDests )
+{
+    EL_DEBUG_CSE
+    const Int mt = A.NumTileRows();
+    const Int nb = A.TileSize();
+    const Int width = A.TileWidth(k);
+    const Int panelHeight = A.Height() - k*nb;
+
+    Matrix<F> panel( panelHeight, width );
+    for( Int i=k; i<mt; ++i )
+    {
+        auto panelTile = panel( IR((i-k)*nb,(i-k)*nb+A.TileHeight(i)), ALL );
+        Copy( A.Tile(i,k), panelTile );
+    }
+
+    Permutation PB;
+    LU( panel, PB );
+    swapDests = PB.SwapDestinations();
+
+    for( Int i=k; i<mt; ++i )
+    {
+        auto panelTile = panel( IR((i-k)*nb,(i-k)*nb+A.TileHeight(i)), ALL );
+        Copy( panelTile, A.Tile(i,k) );
+    }
+}
+
+// Since partial pivoting couples all of the rows of a tile column, the tasks
+// operate on entire tile columns: the panel factorization of tile column k is
+// followed by independent updates of each trailing tile column j (the row
+// swaps, the triangular solve, and the Schur-complement updates), as well as
+// the application of the row swaps to the previously factored tile columns.
+// The dependencies naturally allow the factorization of panel k+1 to proceed
+// as soon as its own update from step k has completed (i.e., lookahead).
+template<typename F>
+void Tiled( TileMatrix<F>& A, Permutation& P, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int mt = A.NumTileRows();
+    const Int nt = A.NumTileCols();
+    const Int nb = A.TileSize();
+    const Int kt = Min(mt,nt);
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( Min(m,n) );
+
+    vector<Matrix<Int>> swapDests( kt );
+    tiled::TaskGraph graph( nt );
+    for( Int k=0; k<kt; ++k )
+    {
+        const Int pathPriority = 2*(nt-k);
+        graph.Submit
+        ( [&A,&P,&swapDests,k,nb]()
+          {
+              TiledPanel( A, k, swapDests[k] );
+              P.ImplicitSwapSequence( swapDests[k], k*nb );
+          },
+          {}, {k}, pathPriority+1 );
+        for( Int j=k+1; j<nt; ++j )
+        {
+            graph.Submit
+            ( [&A,&swapDests,k,j,mt]()
+              {
+                  ApplyTiledPanelSwaps( A, swapDests[k], k, j );
+
+                  const auto& Akk = A.Tile(k,k);
+                  const Int kb = Min(Akk.Height(),Akk.Width());
+                  auto L11 = Akk( IR(0,kb), IR(0,kb) );
+                  auto& Akj = A.Tile(k,j);
+                  auto A1j = Akj( IR(0,kb), ALL );
+                  Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, A1j );
+                  for( Int i=k+1; i<mt; ++i )
+                      Gemm
+                      ( NORMAL, NORMAL,
+                        F(-1), A.Tile(i,k), A1j, F(1), A.Tile(i,j) );
+              },
+              {k}, {j}, ( j == k+1 ? pathPriority : 0 ) );
+        }
+        for( Int j=0; j<k; ++j )
+            graph.Submit
+            ( [&A,&swapDests,k,j]()
+              { ApplyTiledPanelSwaps( A, swapDests[k], k, j ); },
+              {k}, {j}, -1 );
+    }
+    graph.Execute( ctrl.parallel );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_TILED_LU_HPP
@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TILED_QR_HPP
+#define EL_TILED_QR_HPP
+
+namespace El {
+namespace qr {
+
+// Factor the stacked matrix [R; B], where R is the upper triangle of the
+// diagonal tile A, overwriting the upper triangle of A with the new triangular
+// factor and B with the Householder vectors. Since R is triangular, the top
+// portion of each Householder vector is the corresponding column of the
+// identity, so that the strictly-lower portion of A (which holds the
+// Householder vectors from the factorization of the diagonal tile) is left
+// untouched.
+template<typename F>
+void TiledStackedQR
+( Matrix<F>& A,
+  Matrix<F>& B,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    const Int mA = A.Height();
+    const Int mB = B.Height();
+    const Int n = A.Width();
+
+    Matrix<F> S;
+    Zeros( S, mA+mB, n );
+    auto ST = S( IR(0,mA), ALL );
+    auto SB = S( IR(mA,END), ALL );
+    ST = A;
+    MakeTrapezoidal( UPPER, ST );
+    SB = B;
+
+    QR( S, householderScalars, signature );
+
+    MakeTrapezoidal( LOWER, A, -1 );
+    AxpyTrapezoid( UPPER, F(1), ST, A );
+    B = SB;
+}
+
+// Apply the implicit unitary matrix from TiledStackedQR to [BT; BB]
+template<typename F>
+void TiledStackedApplyQ
+( Orientation orientation,
+  const Matrix<F>& V,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+        Matrix<F>& BT,
+        Matrix<F>& BB )
+{
+    EL_DEBUG_CSE
+    const Int mT = BT.Height();
+    const Int mB = BB.Height();
+    const Int n = BT.Width();
+
+    // The top portion of the Householder vectors is implicitly the identity
+    Matrix<F> VStack;
+    Zeros( VStack, mT+mB, V.Width() );
+    auto VStackB = VStack( IR(mT,END), ALL );
+    VStackB = V;
+
+    Matrix<F> C( mT+mB, n );
+    auto CT = C( IR(0,mT), ALL );
+    auto CB = C( IR(mT,END), ALL );
+    CT = BT;
+    CB = BB;
+    ApplyQ( LEFT, orientation, VStack, householderScalars, signature, C );
+    BT = CT;
+    BB = CB;
+}
+
+// A flat-tree tiled Householder QR factorization: step k factors the diagonal
+// tile and applies its reflectors to the rest of the k'th tile row, then
+// successively eliminates each tile beneath the diagonal against the current
+// triangular factor and applies the result to the corresponding pair of tile
+// rows.
+template<typename F>
+void Tiled( TileMatrix<F>& A, TiledData<F>& data, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int mt = A.NumTileRows();
+    const Int nt = A.NumTileCols();
+    const Int kt = Min(mt,nt);
+    auto id = [=]( Int i, Int j ) { return i + j*mt; };
+
+    data.tileSize = A.TileSize();
+    data.numTileRows = mt;
+    data.numTileCols = nt;
+    data.householderScalars.clear();
+    data.signature.clear();
+    data.householderScalars.resize( mt*kt );
+    data.signature.resize( mt*kt );
+
+    El::tiled::TaskGraph graph( mt*nt );
+    for( Int k=0; k<kt; ++k )
+    {
+        const Int pathPriority = 2*(kt-k);
+        graph.Submit
+        ( [&A,&data,k,id]()
+          { QR
+            ( A.Tile(k,k),
+              data.householderScalars[id(k,k)],
+              data.signature[id(k,k)] ); },
+          {}, {id(k,k)}, pathPriority+1 );
+        for( Int j=k+1; j<nt; ++j )
+            graph.Submit
+            ( [&A,&data,j,k,id]()
+              { ApplyQ
+                ( LEFT, ADJOINT,
+                  A.Tile(k,k),
+                  data.householderScalars[id(k,k)],
+                  data.signature[id(k,k)],
+                  A.Tile(k,j) ); },
+              {id(k,k)}, {id(k,j)}, ( j == k+1 ? pathPriority : 0 ) );
+        for( Int i=k+1; i<mt; ++i )
+        {
+            graph.Submit
+            ( [&A,&data,i,k,id]()
+              { TiledStackedQR
+                ( A.Tile(k,k), A.Tile(i,k),
+                  data.householderScalars[id(i,k)],
+                  data.signature[id(i,k)] ); },
+              {}, {id(k,k),id(i,k)}, pathPriority+1 );
+            for( Int j=k+1; j<nt; ++j )
+                graph.Submit
+                ( [&A,&data,i,j,k,id]()
+                  { TiledStackedApplyQ
+                    ( ADJOINT,
+                      A.Tile(i,k),
+                      data.householderScalars[id(i,k)],
+                      data.signature[id(i,k)],
+                      A.Tile(k,j), A.Tile(i,j) ); },
+                  {id(i,k)}, {id(k,j),id(i,j)},
+                  ( j == k+1 ? pathPriority : 0 ) );
+        }
+    }
+    graph.Execute( ctrl.parallel );
+}
+
+namespace tiled {
+
+template<typename F>
+void ApplyQ
+( Orientation orientation,
+  const Matrix<F>& A,
+  const TiledData<F>& data,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int nb = data.tileSize;
+    const Int mt = data.numTileRows;
+    const Int kt = Min(data.numTileRows,data.numTileCols);
+    EL_DEBUG_ONLY(
+      if( B.Height() != m )
+          LogicError("B must have as many rows as A");
+    )
+    auto id = [=]( Int i, Int j ) { return i + j*mt; };
+    auto tileRows = [=]( Int i ) { return IR(i*nb,Min((i+1)*nb,m)); };
+    auto tileCols = [=]( Int j ) { return IR(j*nb,Min((j+1)*nb,A.Width())); };
+
+    if( orientation == NORMAL )
+    {
+        for( Int k=kt-1; k>=0; --k )
+        {
+            auto Bk = B( tileRows(k), ALL );
+            for( Int i=mt-1; i>k; --i )
+            {
+                auto Aik = A( tileRows(i), tileCols(k) );
+                auto Bi = B( tileRows(i), ALL );
+                TiledStackedApplyQ
+                ( NORMAL, Aik,
+                  data.householderScalars[id(i,k)],
+                  data.signature[id(i,k)], Bk, Bi );
+            }
+            auto Akk = A( tileRows(k), tileCols(k) );
+            qr::ApplyQ
+            ( LEFT, NORMAL, Akk,
+              data.householderScalars[id(k,k)],
+              data.signature[id(k,k)], Bk );
+        }
+    }
+    else
+    {
+        for( Int k=0; k<kt; ++k )
+        {
+            auto Bk = B( tileRows(k), ALL );
+            auto Akk = A( tileRows(k), tileCols(k) );
+            qr::ApplyQ
+            ( LEFT, orientation, Akk,
+              data.householderScalars[id(k,k)],
+              data.signature[id(k,k)], Bk );
+            for( Int i=k+1; i<mt; ++i )
+            {
+                auto Aik = A( tileRows(i), tileCols(k) );
+                auto Bi = B( tileRows(i), ALL );
+                TiledStackedApplyQ
+                ( orientation, Aik,
+                  data.householderScalars[id(i,k)],
+                  data.signature[id(i,k)], Bk, Bi );
+            }
+        }
+    }
+}
+
+template<typename F>
+void SolveAfter
+( const Matrix<F>& A,
+  const TiledData<F>& data,
+  const Matrix<F>& B,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+        LogicError("Tiled QR solves require at least as many rows as columns");
+
+    Matrix<F> C( B );
+    tiled::ApplyQ( ADJOINT, A, data, C );
+
+    auto AT = A( IR(0,n), IR(0,n) );
+    X = C( IR(0,n), ALL );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), AT, X );
+}
+
+} // namespace tiled
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_TILED_QR_HPP
@@ -0,0 +1,192 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TILED_TASKGRAPH_HPP
+#define EL_TILED_TASKGRAPH_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+
+namespace El {
+namespace tiled {
+
+// A simple dataflow scheduler: tasks are submitted in a valid sequential order
+// along with the tiles that they read and write, and the read-after-write,
+// write-after-read, and write-after-write hazards on each tile are converted
+// into the edges of a directed acyclic graph. Executing the graph with a
+// single thread runs the tasks in their submission order, whereas hybrid
+// builds dynamically schedule the ready tasks over the OpenMP threads,
+// preferring those with the largest priority (e.g., those on the critical
+// path of the factorization).
+class TaskGraph
+{
+public:
+    TaskGraph( Int numTiles )
+    : lastWriter_(numTiles,-1), readers_(numTiles)
+    { }
+
+    Int NumTasks() const { return tasks_.size(); }
+
+    void Submit
+    ( function<void()> kernel,
+      const vector<Int>& reads,
+      const vector<Int>& writes,
+      Int priority=0 )
+    {
+        EL_DEBUG_CSE
+        const Int task = tasks_.size();
+        vector<Int> preds;
+        for( const Int& tile : reads )
+        {
+            if( lastWriter_[tile] >= 0 )
+                preds.push_back( lastWriter_[tile] );
+            readers_[tile].push_back( task );
+        }
+        for( const Int& tile : writes )
+        {
+            if( lastWriter_[tile] >= 0 )
+                preds.push_back( lastWriter_[tile] );
+            for( const Int& reader : readers_[tile] )
+                if( reader != task )
+                    preds.push_back( reader );
+            lastWriter_[tile] = task;
+            readers_[tile].clear();
+        }
+        std::sort( preds.begin(), preds.end() );
+        preds.erase( std::unique(preds.begin(),preds.end()), preds.end() );
+
+        Task newTask;
+        newTask.kernel = kernel;
+        newTask.numPreds = preds.size();
+        newTask.priority = priority;
+        tasks_.push_back( move(newTask) );
+        for( const Int& pred : preds )
+            tasks_[pred].succs.push_back( task );
+    }
+
+    void Execute( bool parallel=true )
+    {
+        EL_DEBUG_CSE
+#ifdef EL_HYBRID
+        if( parallel && omp_get_max_threads() > 1 )
+        {
+            ExecuteParallel();
+            return;
+        }
+#endif
+        for( auto& task : tasks_ )
+            task.kernel();
+    }
+
+private:
+    struct Task
+    {
+        function<void()> kernel;
+        vector<Int> succs;
+        Int numPreds=0;
+        Int priority=0;
+    };
+
+    vector<Task> tasks_;
+    vector<Int> lastWriter_;
+    vector<vector<Int>> readers_;
+
+#ifdef EL_HYBRID
+    void ExecuteParallel()
+    {
+        EL_DEBUG_CSE
+        const Int numTasks = tasks_.size();
+
+        // Ready tasks are ordered by their priority and then by the order in
+        // which they were submitted
+        std::priority_queue<pair<Int,Int>> ready;
+        vector<Int> numRemaining( numTasks );
+        for( Int task=0; task<numTasks; ++task )
+        {
+            numRemaining[task] = tasks_[task].numPreds;
+            if( numRemaining[task] == 0 )
+                ready.emplace( tasks_[task].priority, -task );
+        }
+
+        // Idle threads sleep on the condition variable until either a task
+        // becomes ready or every task has completed
+        Int numCompleted = 0;
+        bool failed = false;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable cond;
+        #pragma omp parallel
+        {
+            while( true )
+            {
+                Int task;
+                bool skip;
+                {
+                    std::unique_lock<std::mutex> lock( mutex );
+                    cond.wait
+                    ( lock,
+                      [&]() { return numCompleted == numTasks ||
+                                     !ready.empty(); } );
+                    if( numCompleted == numTasks )
+                        break;
+                    task = -ready.top().second;
+                    ready.pop();
+                    skip = failed;
+                }
+
+                // Once a kernel has failed, the remaining tasks are retired
+                // without being executed so that the error can be rethrown
+                if( !skip )
+                {
+                    try { tasks_[task].kernel(); }
+                    catch( ... )
+                    {
+                        std::lock_guard<std::mutex> lock( mutex );
+                        if( !failed )
+                        {
+                            failed = true;
+                            error = std::current_exception();
+                        }
+                    }
+                }
+
+                Int numNewlyReady = 0;
+                bool finished;
+                {
+                    std::lock_guard<std::mutex> lock( mutex );
+                    ++numCompleted;
+                    for( const Int& succ : tasks_[task].succs )
+                    {
+                        if( --numRemaining[succ] == 0 )
+                        {
+                            ready.emplace( tasks_[succ].priority, -succ );
+                            ++numNewlyReady;
+                        }
+                    }
+                    finished = ( numCompleted == numTasks );
+                }
+                if( finished )
+                    cond.notify_all();
+                else
+                    for( Int k=0; k<numNewlyReady; ++k )
+                        cond.notify_one();
+            }
+        }
+        if( failed )
+            std::rethrow_exception( error );
+    }
+#endif // ifdef EL_HYBRID
+};
+
+} // namespace tiled
+} // namespace El
+
+#endif // ifndef EL_TILED_TASKGRAPH_HPP
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace hpd_solve {
@@ -106,6 +108,69 @@ void HPDSolve
     sparseLDLFact.Solve( B );
 }
 
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> LowField;
+
+    Matrix<LowField> ALow;
+    Copy( A, ALow );
+    Cholesky( uplo, ALow );
+
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      { Hemm( LEFT, uplo, alpha, A, X, beta, Y ); };
+    auto lowSolve =
+      [&]( Matrix<Field>& Y )
+      {
+          Matrix<LowField> YLow;
+          Copy( Y, YLow );
+          cholesky::SolveAfter( uplo, NORMAL, ALow, YLow );
+          Copy( YLow, Y );
+      };
+    return mixed_precision::Solve( applyA, lowSolve, B, ctrl );
+}
+
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> LowField;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& grid = A.Grid();
+
+    DistMatrix<LowField> ALow(grid);
+    Copy( A, ALow );
+    Cholesky( uplo, ALow );
+
+    auto applyA =
+      [&]( Field alpha, const DistMatrix<Field>& X,
+           Field beta,        DistMatrix<Field>& Y )
+      { Hemm( LEFT, uplo, alpha, A, X, beta, Y ); };
+    auto lowSolve =
+      [&]( DistMatrix<Field>& Y )
+      {
+          DistMatrix<LowField> YLow(grid);
+          Copy( Y, YLow );
+          cholesky::SolveAfter( uplo, NORMAL, ALow, YLow );
+          Copy( YLow, Y );
+      };
+    return mixed_precision::Solve( applyA, lowSolve, B, ctrl );
+}
+
 #define PROTO(Field) \
   template void hpd_solve::Overwrite \
   ( UpperOrLower uplo, Orientation orientation, \
@@ -123,7 +188,14 @@ void HPDSolve
   ( const SparseMatrix<Field>& A, Matrix<Field>& B, const BisectCtrl& ctrl ); \
   template void HPDSolve \
   ( const DistSparseMatrix<Field>& A, DistMultiVec<Field>& B, \
-    const BisectCtrl& ctrl );
+    const BisectCtrl& ctrl ); \
+  template Int MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, const Matrix<Field>& A, Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template Int MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
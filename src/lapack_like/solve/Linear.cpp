@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace lu {
@@ -317,6 +319,69 @@ void LinearSolve
     B = X;
 }
 
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> LowField;
+
+    Matrix<LowField> ALow;
+    Copy( A, ALow );
+    Permutation P;
+    LU( ALow, P );
+
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y ); };
+    auto lowSolve =
+      [&]( Matrix<Field>& Y )
+      {
+          Matrix<LowField> YLow;
+          Copy( Y, YLow );
+          lu::SolveAfter( NORMAL, ALow, P, YLow );
+          Copy( YLow, Y );
+      };
+    return mixed_precision::Solve( applyA, lowSolve, B, ctrl );
+}
+
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> LowField;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& grid = A.Grid();
+
+    DistMatrix<LowField> ALow(grid);
+    Copy( A, ALow );
+    DistPermutation P(grid);
+    LU( ALow, P );
+
+    auto applyA =
+      [&]( Field alpha, const DistMatrix<Field>& X,
+           Field beta,        DistMatrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y ); };
+    auto lowSolve =
+      [&]( DistMatrix<Field>& Y )
+      {
+          DistMatrix<LowField> YLow(grid);
+          Copy( Y, YLow );
+          lu::SolveAfter( NORMAL, ALow, P, YLow );
+          Copy( YLow, Y );
+      };
+    return mixed_precision::Solve( applyA, lowSolve, B, ctrl );
+}
+
 #define PROTO(Field) \
   template void lin_solve::Overwrite( Matrix<Field>& A, Matrix<Field>& B ); \
   template void lin_solve::Overwrite \
@@ -333,7 +398,15 @@ void LinearSolve
   template void LinearSolve \
   ( const DistSparseMatrix<Field>& A, \
           DistMultiVec<Field>& B, \
-    const LeastSquaresCtrl<Base<Field>>& ctrl );
+    const LeastSquaresCtrl<Base<Field>>& ctrl ); \
+  template Int MixedPrecisionLinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template Int MixedPrecisionLinearSolve \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
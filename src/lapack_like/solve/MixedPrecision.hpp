@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_MIXEDPRECISION_HPP
+#define EL_SOLVE_MIXEDPRECISION_HPP
+
+namespace El {
+namespace mixed_precision {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const MatrixType& X, Field beta, MatrixType& Y )
+//
+// and overwrite Y := alpha A X + beta Y in the working precision, whereas
+// 'lowSolve' should have the form
+//
+//   void lowSolve( MatrixType& B )
+//
+// and overwrite B with inv(A) B using the low-precision factorization.
+//
+
+// Iteratively refine all of the right-hand sides at once, stopping as soon as
+// the relative residual either drops below the tolerance or fails to decrease
+template<typename Real,class MatrixType,class ApplyAType,class ApplyAInvType>
+Int Refine
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        MatrixType& B,
+        Real relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Real bNorm = MaxNorm( B );
+    if( bNorm == Real(0) )
+        return 0;
+
+    // Compute the initial guess
+    // =========================
+    MatrixType X( B );
+    applyAInv( X );
+
+    MatrixType R( B ), Y( B ), XCand( X );
+    applyA( X, Y );
+    R -= Y;
+    Real errorNorm = MaxNorm( R );
+    if( progress )
+        Output("original rel error: ",errorNorm/bNorm);
+
+    Int refineIt = 0;
+    while( errorNorm/bNorm > relTol && refineIt < maxRefineIts )
+    {
+        // Solve the correction equation, A dX = R, and form the candidate
+        // ---------------------------------------------------------------
+        applyAInv( R );
+        XCand = X;
+        XCand += R;
+        ++refineIt;
+
+        // Check the new residual
+        // ----------------------
+        applyA( XCand, Y );
+        R = B;
+        R -= Y;
+        const Real newErrorNorm = MaxNorm( R );
+        if( progress )
+            Output("refined rel error: ",newErrorNorm/bNorm);
+        if( newErrorNorm >= errorNorm )
+            break;
+
+        X = XCand;
+        errorNorm = newErrorNorm;
+    }
+    B = X;
+    return refineIt;
+}
+
+template<typename Field,class ApplyAType,class LowSolveType>
+Int Solve
+( const ApplyAType& applyA,
+  const LowSolveType& lowSolve,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyARefine =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { applyA( Field(1), X, Field(0), Y ); };
+
+    if( ctrl.alg == MIXED_PRECISION_GMRES_REFINE )
+    {
+        // Solve each correction equation with FGMRES preconditioned by the
+        // low-precision factorization. If FGMRES does not converge, its last
+        // iterate is used as the correction (the refinement loop rejects it
+        // if the residual does not decrease).
+        auto correctionSolve =
+          [&]( Matrix<Field>& R )
+          {
+              for( Int j=0; j<R.Width(); ++j )
+              {
+                  auto r = R( ALL, IR(j) );
+                  try
+                  {
+                      FGMRES
+                      ( applyA, lowSolve, r,
+                        ctrl.relTolGMRES, ctrl.restart, ctrl.maxGMRESIts,
+                        false );
+                  }
+                  catch( const std::runtime_error& )
+                  {
+                      if( ctrl.progress )
+                          Output("FGMRES did not converge for column ",j);
+                  }
+              }
+          };
+        return Refine
+          ( applyARefine, correctionSolve, B,
+            ctrl.relTol, ctrl.maxRefineIts, ctrl.progress );
+    }
+    else
+    {
+        return Refine
+          ( applyARefine, lowSolve, B,
+            ctrl.relTol, ctrl.maxRefineIts, ctrl.progress );
+    }
+}
+
+template<typename Field,class ApplyAType,class LowSolveType>
+Int Solve
+( const ApplyAType& applyA,
+  const LowSolveType& lowSolve,
+        DistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = B.Grid();
+    auto applyARefine =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { applyA( Field(1), X, Field(0), Y ); };
+    const bool progress = ctrl.progress && grid.Rank() == 0;
+
+    if( ctrl.alg == MIXED_PRECISION_GMRES_REFINE )
+    {
+        // The distributed FGMRES acts upon DistMultiVec's, so the operator
+        // and the preconditioner redistribute to and from [MC,MR]
+        auto applyAMultiVec =
+          [&]( Field alpha, const DistMultiVec<Field>& X,
+               Field beta,        DistMultiVec<Field>& Y )
+          {
+              DistMatrix<Field> XDist(grid), YDist(grid);
+              Copy( X, XDist );
+              Copy( Y, YDist );
+              applyA( alpha, XDist, beta, YDist );
+              Copy( YDist, Y );
+          };
+        auto lowSolveMultiVec =
+          [&]( DistMultiVec<Field>& X )
+          {
+              DistMatrix<Field> XDist(grid);
+              Copy( X, XDist );
+              lowSolve( XDist );
+              Copy( XDist, X );
+          };
+        auto correctionSolve =
+          [&]( DistMatrix<Field>& R )
+          {
+              DistMultiVec<Field> d(grid);
+              for( Int j=0; j<R.Width(); ++j )
+              {
+                  auto r = R( ALL, IR(j) );
+                  Copy( r, d );
+                  try
+                  {
+                      FGMRES
+                      ( applyAMultiVec, lowSolveMultiVec, d,
+                        ctrl.relTolGMRES, ctrl.restart, ctrl.maxGMRESIts,
+                        false );
+                  }
+                  catch( const std::runtime_error& )
+                  {
+                      if( progress )
+                          Output("FGMRES did not converge for column ",j);
+                  }
+                  Copy( d, r );
+              }
+          };
+        return Refine
+          ( applyARefine, correctionSolve, B,
+            ctrl.relTol, ctrl.maxRefineIts, progress );
+    }
+    else
+    {
+        return Refine
+          ( applyARefine, lowSolve, B,
+            ctrl.relTol, ctrl.maxRefineIts, progress );
+    }
+}
+
+} // namespace mixed_precision
+} // namespace El
+
+#endif // ifndef EL_SOLVE_MIXEDPRECISION_HPP
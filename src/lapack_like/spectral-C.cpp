@@ -338,6 +338,7 @@ ElError ElHessenbergSchurCtrlDefault( ElHessenbergSchurCtrl* ctrl )
 
     ctrl->scalapack = false;
     ctrl->blockHeight = DefaultBlockHeight();
+    ctrl->minDistAEDSize = 1000;
     ctrl->numBulgesPerBlock = &hess_schur::multibulge::NumBulgesPerBlock;
 
     return EL_SUCCESS;
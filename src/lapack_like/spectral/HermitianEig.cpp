@@ -1124,6 +1124,144 @@ HermitianEig
     return info;
 }
 
+// Batched eigensolvers
+// --------------------
+// Each member of the batch is handed to the sequential eigensolver, with the
+// batch distributed over the OpenMP threads. Members of strided batches are
+// viewed in place, whereas interleaved members are first gathered.
+
+namespace herm_eig {
+
+template<typename F>
+void CheckBatchedCtrl( const HermitianEigCtrl<F>& ctrl )
+{
+    const auto& subset = ctrl.tridiagEigCtrl.subset;
+    if( subset.indexSubset || subset.rangeSubset )
+        LogicError("Batched Hermitian eigensolvers do not support subsets");
+}
+
+template<typename F>
+void GetBatchMember( BatchMatrix<F>& A, Int b, Matrix<F>& AMember )
+{
+    if( A.Layout() == BATCH_STRIDED )
+        AMember.Attach
+        ( A.Height(), A.Width(), A.Buffer()+b*A.BatchStride(), A.LDim() );
+    else
+        A.GetBatch( b, AMember );
+}
+
+template<typename F>
+void SetBatchMember( BatchMatrix<F>& A, Int b, const Matrix<F>& AMember )
+{
+    if( A.Layout() == BATCH_INTERLEAVED )
+        A.SetBatch( b, AMember );
+}
+
+} // namespace herm_eig
+
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo,
+  BatchMatrix<F>& A,
+  Matrix<Base<F>>& w,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    herm_eig::CheckBatchedCtrl( ctrl );
+    const Int n = A.Height();
+    const Int batchSize = A.BatchSize();
+    w.Resize( n, batchSize );
+
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<F> AMember;
+        Matrix<Base<F>> wMember;
+        herm_eig::GetBatchMember( A, b, AMember );
+        HermitianEig( uplo, AMember, wMember, ctrl );
+        herm_eig::SetBatchMember( A, b, AMember );
+        auto wCol = w( ALL, IR(b) );
+        Copy( wMember, wCol );
+    }
+}
+
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo,
+  BatchMatrix<F>& A,
+  Matrix<Base<F>>& w,
+  BatchMatrix<F>& Q,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    herm_eig::CheckBatchedCtrl( ctrl );
+    const Int n = A.Height();
+    const Int batchSize = A.BatchSize();
+    w.Resize( n, batchSize );
+    if( !Q.Viewing() )
+        Q.SetLayout( A.Layout() );
+    Q.Resize( n, n, batchSize );
+
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<F> AMember, QMember;
+        Matrix<Base<F>> wMember;
+        herm_eig::GetBatchMember( A, b, AMember );
+        HermitianEig( uplo, AMember, wMember, QMember, ctrl );
+        herm_eig::SetBatchMember( A, b, AMember );
+        Q.SetBatch( b, QMember );
+        auto wCol = w( ALL, IR(b) );
+        Copy( wMember, wCol );
+    }
+}
+
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo,
+  vector<Matrix<F>>& A,
+  vector<Matrix<Base<F>>>& w,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    herm_eig::CheckBatchedCtrl( ctrl );
+    const Int batchSize = A.size();
+    for( Int b=0; b<batchSize; ++b )
+        if( A[b].Height() != A[b].Width() )
+            LogicError("Member ",b," of the batch was not square");
+    w.resize( batchSize );
+
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+        HermitianEig( uplo, A[b], w[b], ctrl );
+}
+
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo,
+  vector<Matrix<F>>& A,
+  vector<Matrix<Base<F>>>& w,
+  vector<Matrix<F>>& Q,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    herm_eig::CheckBatchedCtrl( ctrl );
+    const Int batchSize = A.size();
+    for( Int b=0; b<batchSize; ++b )
+        if( A[b].Height() != A[b].Width() )
+            LogicError("Member ",b," of the batch was not square");
+    w.resize( batchSize );
+    Q.resize( batchSize );
+
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+        HermitianEig( uplo, A[b], w[b], Q[b], ctrl );
+}
+
 #define EIGVAL_PROTO(F) \
   template HermitianEigInfo HermitianEig\
   ( UpperOrLower uplo, \
@@ -1150,9 +1288,34 @@ HermitianEig
     AbstractDistMatrix<F>& Q, \
     const HermitianEigCtrl<F>& ctrl );
 
+#define BATCHED_PROTO(F) \
+  template void HermitianEig \
+  ( UpperOrLower uplo, \
+    BatchMatrix<F>& A, \
+    Matrix<Base<F>>& w, \
+    const HermitianEigCtrl<F>& ctrl ); \
+  template void HermitianEig \
+  ( UpperOrLower uplo, \
+    BatchMatrix<F>& A, \
+    Matrix<Base<F>>& w, \
+    BatchMatrix<F>& Q, \
+    const HermitianEigCtrl<F>& ctrl ); \
+  template void HermitianEig \
+  ( UpperOrLower uplo, \
+    vector<Matrix<F>>& A, \
+    vector<Matrix<Base<F>>>& w, \
+    const HermitianEigCtrl<F>& ctrl ); \
+  template void HermitianEig \
+  ( UpperOrLower uplo, \
+    vector<Matrix<F>>& A, \
+    vector<Matrix<Base<F>>>& w, \
+    vector<Matrix<F>>& Q, \
+    const HermitianEigCtrl<F>& ctrl );
+
 #define PROTO(F) \
   EIGVAL_PROTO(F) \
-  EIGPAIR_PROTO(F)
+  EIGPAIR_PROTO(F) \
+  BATCHED_PROTO(F)
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -15,61 +15,26 @@ namespace El {
 namespace hess_schur {
 namespace aed {
 
-// The spike value will be overwritten
+// Given the (partial) Schur decomposition H = V T V' of the deflation window,
+// where the leading 'numUnconverged' eigenvalues did not converge, determine
+// which eigenvalues can be deflated, form the shift candidates, and restore
+// T to upper Hessenberg form. If no transformation is required, V is emptied.
 template<typename Real>
-AEDInfo NibbleHelper
-( Matrix<Real>& H,
+AEDInfo DeflateSpike
+( Matrix<Real>& T,
   Real& spikeValue,
   Matrix<Complex<Real>>& w,
   Matrix<Real>& V,
+  Int numUnconverged,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    const Int n = H.Height();
-    AEDInfo info;
-
+    const Int n = T.Height();
     const Real zero(0);
-    const Real ulp = limits::Precision<Real>();
-    const Real safeMin = limits::SafeMin<Real>();
-    const Real smallNum = safeMin*(Real(n)/ulp);
-
-    Zeros( V, 0, 0 );
-    if( n == 1 )
-    {
-        w(0) = H(0,0);
-        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
-        {
-            // The offdiagonal entry was small enough to deflate
-            info.numDeflated = 1;
-            spikeValue = zero;
-        }
-        else
-        {
-            // The offdiagonal entry was too large to deflate
-            info.numShiftCandidates = 1;
-        }
-        return info;
-    }
-
-    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
-    auto T( H ); // TODO(poulson): Reuse this matrix?
-    Identity( V, n, n );
-    auto ctrlSub( ctrl );
-    ctrlSub.winBeg = 0;
-    ctrlSub.winEnd = n;
-    ctrlSub.fullTriangle = true;
-    ctrlSub.wantSchurVecs = true;
-    ctrlSub.demandConverged = false;
-    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
-                                      : HESSENBERG_SCHUR_MULTIBULGE );
-    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
-    EL_DEBUG_ONLY(
-      if( infoSub.numUnconverged != 0 )
-          Output(infoSub.numUnconverged," eigenvalues did not converge");
-    )
+    AEDInfo info;
 
     vector<Real> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -173,29 +138,26 @@ AEDInfo NibbleHelper
     }
 
     spikeValue *= V(0,0);
-    // NOTE(poulson): We could copy only the upper Hessenberg part of T
-    H = T;
-    MakeTrapezoidal( UPPER, H, -1 );
-
     if( spikeSize > 1 && spikeValue != zero )
     {
         hessenberg::ApplyQ
         ( RIGHT, UPPER, NORMAL, TTL, householderScalarsT, VL );
     }
+    MakeTrapezoidal( UPPER, T, -1 );
 
     return info;
 }
 
+// The spike value will be overwritten
 template<typename Real>
 AEDInfo NibbleHelper
-( Matrix<Complex<Real>>& H,
-  Complex<Real>& spikeValue,
+( Matrix<Real>& H,
+  Real& spikeValue,
   Matrix<Complex<Real>>& w,
-  Matrix<Complex<Real>>& V,
+  Matrix<Real>& V,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Complex<Real> Field;
     const Int n = H.Height();
     AEDInfo info;
 
@@ -208,7 +170,7 @@ AEDInfo NibbleHelper
     if( n == 1 )
     {
         w(0) = H(0,0);
-        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
         {
             // The offdiagonal entry was small enough to deflate
             info.numDeflated = 1;
@@ -239,8 +201,33 @@ AEDInfo NibbleHelper
           Output(infoSub.numUnconverged," eigenvalues did not converge");
     )
 
+    info = DeflateSpike( T, spikeValue, w, V, infoSub.numUnconverged, ctrl );
+    if( V.Height() != 0 || V.Width() != 0 )
+        H = T;
+    return info;
+}
+
+// Given the (partial) Schur decomposition H = V T V' of the deflation window,
+// where the leading 'numUnconverged' eigenvalues did not converge, determine
+// which eigenvalues can be deflated, form the shift candidates, and restore
+// T to upper Hessenberg form. If no transformation is required, V is emptied.
+template<typename Real>
+AEDInfo DeflateSpike
+( Matrix<Complex<Real>>& T,
+  Complex<Real>& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Matrix<Complex<Real>>& V,
+  Int numUnconverged,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> Field;
+    const Int n = T.Height();
+    const Real zero(0);
+    AEDInfo info;
+
     vector<Field> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -324,16 +311,71 @@ AEDInfo NibbleHelper
     }
 
     spikeValue *= Conj(V(0,0));
-    // NOTE(poulson): We could copy only the upper Hessenberg part of T
-    H = T;
-    MakeTrapezoidal( UPPER, H, -1 );
-
     if( spikeSize > 1 && spikeValue != zero )
     {
         hessenberg::ApplyQ
         ( RIGHT, UPPER, NORMAL, TTL, householderScalarsT, VL );
     }
+    MakeTrapezoidal( UPPER, T, -1 );
+
+    return info;
+}
+
+template<typename Real>
+AEDInfo NibbleHelper
+( Matrix<Complex<Real>>& H,
+  Complex<Real>& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Matrix<Complex<Real>>& V,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    AEDInfo info;
+
+    const Real zero(0);
+    const Real ulp = limits::Precision<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    Zeros( V, 0, 0 );
+    if( n == 1 )
+    {
+        w(0) = H(0,0);
+        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        {
+            // The offdiagonal entry was small enough to deflate
+            info.numDeflated = 1;
+            spikeValue = zero;
+        }
+        else
+        {
+            // The offdiagonal entry was too large to deflate
+            info.numShiftCandidates = 1;
+        }
+        return info;
+    }
+
+    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
+    auto T( H ); // TODO(poulson): Reuse this matrix?
+    Identity( V, n, n );
+    auto ctrlSub( ctrl );
+    ctrlSub.winBeg = 0;
+    ctrlSub.winEnd = n;
+    ctrlSub.fullTriangle = true;
+    ctrlSub.wantSchurVecs = true;
+    ctrlSub.demandConverged = false;
+    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                      : HESSENBERG_SCHUR_MULTIBULGE );
+    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
+    EL_DEBUG_ONLY(
+      if( infoSub.numUnconverged != 0 )
+          Output(infoSub.numUnconverged," eigenvalues did not converge");
+    )
 
+    info = DeflateSpike( T, spikeValue, w, V, infoSub.numUnconverged, ctrl );
+    if( V.Height() != 0 || V.Width() != 0 )
+        H = T;
     return info;
 }
 
@@ -396,6 +438,93 @@ AEDInfo Nibble
     return info;
 }
 
+// The dimension of the square subgrid used for computing the Schur
+// decomposition of a distributed deflation window (one if the window should
+// be handled on a single process). Each process of the subgrid is assigned
+// roughly eight diagonal blocks of the window.
+inline Int AEDSubgridDim
+( Int windowSize, const Grid& grid, const HessenbergSchurCtrl& ctrl )
+{
+    if( windowSize < ctrl.minDistAEDSize )
+        return 1;
+    const Int sqrtSize = Int(Sqrt(double(grid.Size())));
+    return Min( sqrtSize, Max( Int(1), windowSize/(8*ctrl.blockHeight) ) );
+}
+
+// Compute the (partial) Schur decomposition HDefl = V T V' of the deflation
+// window on a subgrid of subgridDim x subgridDim processes of HDefl's grid so
+// that the cubic cost of the window is not serialized on a single process.
+// The number of unconverged eigenvalues is returned on every process.
+//
+// TODO(poulson): Only the Schur decomposition is distributed. The spike
+// deflation, the condensation of the spike, and the re-Hessenberg reduction
+// of the undeflated part of the window (see DeflateSpike) are still cubic in
+// the window size and are performed on the single process which owns the
+// window. Distributing them over the same subgrid is left to a separate
+// change.
+template<typename Field>
+Int SubgridWindowSchur
+( const DistMatrix<Field,MC,MR,BLOCK>& HDefl,
+        DistMatrix<Field>& T,
+        DistMatrix<Complex<Base<Field>>,STAR,STAR>& wDefl,
+        DistMatrix<Field>& V,
+        Int subgridDim,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = HDefl.Grid();
+
+    vector<int> subgridRanks(subgridDim*subgridDim);
+    for( Int q=0; q<subgridDim*subgridDim; ++q )
+        subgridRanks[q] = q;
+    mpi::Group subgridGroup;
+    mpi::Incl
+    ( grid.OwningGroup(), subgridRanks.size(), subgridRanks.data(),
+      subgridGroup );
+    const Grid subgrid
+    ( grid.ViewingComm(), subgridGroup, subgridDim, grid.Order() );
+    mpi::Free( subgridGroup );
+
+    // Since the [MC,MR] translation between grids is specialized, we first
+    // redistribute the window into an elemental distribution
+    DistMatrix<Field> HWin(grid), TSub(subgrid), VSub(subgrid);
+    DistMatrix<Complex<Base<Field>>,STAR,STAR> wSub(subgrid), wWin(grid);
+    HWin = HDefl;
+    TSub = HWin;
+
+    auto ctrlSub( ctrl );
+    ctrlSub.winBeg = 0;
+    ctrlSub.winEnd = END;
+    ctrlSub.fullTriangle = true;
+    ctrlSub.wantSchurVecs = true;
+    ctrlSub.accumulateSchurVecs = false;
+    ctrlSub.demandConverged = false;
+    ctrlSub.scalapack = false;
+    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                      : HESSENBERG_SCHUR_MULTIBULGE );
+    Int numUnconverged = 0;
+    if( subgrid.InGrid() )
+    {
+        auto infoSub = HessenbergSchur( TSub, wSub, VSub, ctrlSub );
+        numUnconverged = infoSub.numUnconverged;
+    }
+    else
+    {
+        // Keep the dimensions consistent for the redistributions below
+        TSub.Resize( HDefl.Height(), HDefl.Width() );
+        VSub.Resize( HDefl.Height(), HDefl.Width() );
+        wSub.Resize( HDefl.Height(), 1 );
+    }
+    numUnconverged = mpi::AllReduce( numUnconverged, mpi::MAX, grid.VCComm() );
+
+    T = TSub;
+    V = VSub;
+    wWin = wSub;
+    wDefl = wWin;
+
+    return numUnconverged;
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( DistMatrix<Field,MC,MR,BLOCK>& H,
@@ -425,17 +554,47 @@ AEDInfo Nibble
 
     const int owner = HDefl.Owner(0,0);
     DistMatrix<Field,CIRC,CIRC> HDefl_CIRC_CIRC( grid, owner );
-    HDefl_CIRC_CIRC = HDefl;
     Field spikeValue =
       ( deflateBeg==winBeg ? Field(0) : H.Get(deflateBeg,deflateBeg-1) );
     Int VSize = 0;
     Matrix<Field> V;
-    if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+    const Int subgridDim = AEDSubgridDim( blockSize, grid, ctrl );
+    if( subgridDim > 1 )
     {
-        info =
-          NibbleHelper
-          ( HDefl_CIRC_CIRC.Matrix(), spikeValue, wDefl.Matrix(), V, ctrl );
-        VSize = V.Height();
+        if( ctrl.progress )
+            Output
+            ("  Computing ",blockSize," x ",blockSize," AED window on a ",
+             subgridDim," x ",subgridDim," subgrid");
+        DistMatrix<Field> T(grid), VDist(grid);
+        const Int numUnconverged =
+          SubgridWindowSchur( HDefl, T, wDefl, VDist, subgridDim, ctrl );
+
+        // The remainder of the AED is still sequential (see the TODO above
+        // SubgridWindowSchur)
+        HDefl_CIRC_CIRC = T;
+        DistMatrix<Field,CIRC,CIRC> V_CIRC_CIRC( grid, owner );
+        V_CIRC_CIRC = VDist;
+        if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+        {
+            info =
+              DeflateSpike
+              ( HDefl_CIRC_CIRC.Matrix(), spikeValue, wDefl.Matrix(),
+                V_CIRC_CIRC.Matrix(), numUnconverged, ctrl );
+            V = V_CIRC_CIRC.Matrix();
+            VSize = V.Height();
+        }
+    }
+    else
+    {
+        HDefl_CIRC_CIRC = HDefl;
+        if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+        {
+            info =
+              NibbleHelper
+              ( HDefl_CIRC_CIRC.Matrix(), spikeValue, wDefl.Matrix(), V,
+                ctrl );
+            VSize = V.Height();
+        }
     }
     El::Broadcast( wDefl, HDefl_CIRC_CIRC.CrossComm(), HDefl_CIRC_CIRC.Root() );
 
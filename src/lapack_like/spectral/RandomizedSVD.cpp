@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void RangeFinder
+( const Matrix<Field>& A,
+        Matrix<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, Field(1), A, X, Field(0), Y ); };
+    auto applyAAdj =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Gemm( ADJOINT, NORMAL, Field(1), A, X, Field(0), Y ); };
+    RangeFinder( A.Height(), A.Width(), applyA, applyAAdj, Q, rank, ctrl );
+}
+
+template<typename Field>
+void RangeFinder
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, Field(1), A, X, Field(0), Y ); };
+    auto applyAAdj =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { Gemm( ADJOINT, NORMAL, Field(1), A, X, Field(0), Y ); };
+    DistMatrix<Field> QLoc( A.Grid() );
+    RangeFinder( A.Height(), A.Width(), applyA, applyAAdj, QLoc, rank, ctrl );
+    Copy( QLoc, Q );
+}
+
+template<typename Field>
+void RangeFinder
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Multiply( NORMAL, Field(1), A, X, Field(0), Y ); };
+    auto applyAAdj =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Multiply( ADJOINT, Field(1), A, X, Field(0), Y ); };
+    RangeFinder( A.Height(), A.Width(), applyA, applyAAdj, Q, rank, ctrl );
+}
+
+template<typename Field>
+void RangeFinder
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& Q,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { Multiply( NORMAL, Field(1), A, X, Field(0), Y ); };
+    auto applyAAdj =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { Multiply( ADJOINT, Field(1), A, X, Field(0), Y ); };
+    DistMatrix<Field> QLoc( A.Grid() );
+    RangeFinder( A.Height(), A.Width(), applyA, applyAAdj, QLoc, rank, ctrl );
+    Copy( QLoc, Q );
+}
+
+template<typename Field>
+void RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, Field(1), A, X, Field(0), Y ); };
+    auto applyAAdj =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Gemm( ADJOINT, NORMAL, Field(1), A, X, Field(0), Y ); };
+    RandomizedSVD
+    ( A.Height(), A.Width(), applyA, applyAAdj, U, s, V, rank, ctrl );
+}
+
+template<typename Field>
+void RandomizedSVD
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& grid = A.Grid();
+
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, Field(1), A, X, Field(0), Y ); };
+    auto applyAAdj =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { Gemm( ADJOINT, NORMAL, Field(1), A, X, Field(0), Y ); };
+    DistMatrix<Field> ULoc(grid), VLoc(grid);
+    DistMatrix<Base<Field>,STAR,STAR> sLoc(grid);
+    RandomizedSVD
+    ( A.Height(), A.Width(), applyA, applyAAdj, ULoc, sLoc, VLoc, rank, ctrl );
+    Copy( ULoc, U );
+    Copy( sLoc, s );
+    Copy( VLoc, V );
+}
+
+template<typename Field>
+void RandomizedSVD
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Multiply( NORMAL, Field(1), A, X, Field(0), Y ); };
+    auto applyAAdj =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Multiply( ADJOINT, Field(1), A, X, Field(0), Y ); };
+    RandomizedSVD
+    ( A.Height(), A.Width(), applyA, applyAAdj, U, s, V, rank, ctrl );
+}
+
+template<typename Field>
+void RandomizedSVD
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        DistMultiVec<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { Multiply( NORMAL, Field(1), A, X, Field(0), Y ); };
+    auto applyAAdj =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { Multiply( ADJOINT, Field(1), A, X, Field(0), Y ); };
+    DistMatrix<Field> ULoc(grid), VLoc(grid);
+    DistMatrix<Base<Field>,STAR,STAR> sLoc(grid);
+    RandomizedSVD
+    ( A.Height(), A.Width(), applyA, applyAAdj, ULoc, sLoc, VLoc, rank, ctrl );
+    Copy( ULoc, U );
+    Copy( sLoc, s );
+    Copy( VLoc, V );
+}
+
+#define PROTO(Field) \
+  template void RangeFinder \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& Q, \
+          Int rank, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void RangeFinder \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& Q, \
+          Int rank, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void RangeFinder \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Field>& Q, \
+          Int rank, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void RangeFinder \
+  ( const DistSparseMatrix<Field>& A, \
+          DistMultiVec<Field>& Q, \
+          Int rank, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+          Int rank, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& U, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          AbstractDistMatrix<Field>& V, \
+          Int rank, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+          Int rank, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const DistSparseMatrix<Field>& A, \
+          DistMultiVec<Field>& U, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          DistMultiVec<Field>& V, \
+          Int rank, \
+    const RandomizedSVDCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -24,6 +24,7 @@ ElError ElLLLCtrlDefault_s( ElLLLCtrl_s* ctrl )
     ctrl->variant = EL_LLL_NORMAL;
     ctrl->recursive = false;
     ctrl->cutoff = 10;
+    ctrl->segmentSize = 64;
     ctrl->precisionFudge = 2.0f;
     ctrl->minColThresh = 0;
     ctrl->unsafeSizeReduct = false;
@@ -49,6 +50,7 @@ ElError ElLLLCtrlDefault_d( ElLLLCtrl_d* ctrl )
     ctrl->variant = EL_LLL_NORMAL;
     ctrl->recursive = false;
     ctrl->cutoff = 10;
+    ctrl->segmentSize = 64;
     ctrl->precisionFudge = 2;
     ctrl->minColThresh = 0;
     ctrl->unsafeSizeReduct = false;
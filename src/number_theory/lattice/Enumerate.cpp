@@ -228,6 +228,62 @@ Matrix<Real> PrunedUpperBounds( Int n, Real normUpperBound, bool linear )
     return upperBounds;
 }
 
+// Choose the pruned upper bounds of the GNR_ENUM trials over a lattice with
+// the given Gram-Schmidt norms, as well as the number of trials
+template<typename Real>
+Matrix<Real> GNRUpperBounds
+( const Matrix<Real>& gsNorms,
+        Real normUpperBound,
+        Int& numTrials,
+  const EnumCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = gsNorms.Height();
+    numTrials = ctrl.numTrials;
+    if( !ctrl.optimizePruning )
+        return PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
+
+    Real successProb;
+    auto upperBounds =
+      OptimizedPruning( gsNorms, normUpperBound, successProb, ctrl );
+    if( ctrl.targetSuccessProb < 1 )
+    {
+        const double prob = Min(Max(double(successProb),1e-12),1-1e-12);
+        const double neededTrials =
+          std::log(1-ctrl.targetSuccessProb) / std::log(1-prob);
+        if( neededTrials < double(numTrials) )
+            numTrials = Max( Int(std::ceil(neededTrials)), Int(1) );
+    }
+    return upperBounds;
+}
+
+// The BKZ applied to each randomized basis does not need to be particularly
+// powerful, but large preprocessing blocksizes are themselves enumerated with
+// optimized pruning (and preprocessed with half of the blocksize), as in
+// BKZ 2.0
+template<typename Real>
+BKZCtrl<Real> PreprocessCtrl( const EnumCtrl<Real>& ctrl )
+{
+    const Int minRecursiveBlocksize = 20;
+    BKZCtrl<Real> bkzCtrl;
+    bkzCtrl.jumpstart = true; // accumulate into U
+    bkzCtrl.blocksize = ctrl.preprocessBlocksize;
+    bkzCtrl.recursive = false;
+    bkzCtrl.lllCtrl.recursive = false;
+    // Follow the caller rather than the BKZ defaults
+    bkzCtrl.parallelEnum = ctrl.parallel;
+    bkzCtrl.optimizePruning = ctrl.optimizePruning;
+    if( ctrl.preprocessBlocksize > minRecursiveBlocksize )
+    {
+        bkzCtrl.enumCtrl = ctrl;
+        bkzCtrl.enumCtrl.enumType = GNR_ENUM;
+        bkzCtrl.enumCtrl.time = false;
+        bkzCtrl.enumCtrl.progress = false;
+        bkzCtrl.enumCtrl.preprocessBlocksize = ctrl.preprocessBlocksize/2;
+    }
+    return bkzCtrl;
+}
+
 } // namespace svp
 
 // NOTE: This norm upper bound is *non-inclusive*
@@ -296,8 +352,9 @@ Base<Field> ShortVectorEnumeration
 
     if( ctrl.enumType == GNR_ENUM )
     {
+        Int numTrials;
         auto upperBounds =
-          svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
+          svp::GNRUpperBounds( d, normUpperBound, numTrials, ctrl );
 
         // Since we will manually build up a (weakly) pseudorandom
         // unimodular matrix so that the probabalistic enumerations traverse
@@ -306,7 +363,12 @@ Base<Field> ShortVectorEnumeration
         auto RNew( R );
         Matrix<Field> BNew, U;
 
-        for( Int trial=0; trial<ctrl.numTrials; ++trial )
+        // The trials are randomized independently on each process, so only
+        // thread over each of them
+        auto trialCtrl( ctrl );
+        trialCtrl.comm = mpi::COMM_SELF;
+
+        for( Int trial=0; trial<numTrials; ++trial )
         {
             BNew = B;
             Identity( U, n, n );
@@ -332,15 +394,10 @@ Base<Field> ShortVectorEnumeration
                     Axpy( scale, uc, uj );
                 }
 
-                // The BKZ does not need to be particularly powerful
-                BKZCtrl<Real> ctrl;
-                ctrl.jumpstart = true; // accumulate into U
-                ctrl.blocksize = 10;
-                ctrl.recursive = false;
-                ctrl.lllCtrl.recursive = false;
+                auto bkzCtrl = svp::PreprocessCtrl( trialCtrl );
                 if( ctrl.time )
                     timer.Start();
-                BKZ( BNew, U, RNew, ctrl );
+                BKZ( BNew, U, RNew, bkzCtrl );
                 if( ctrl.time )
                     Output("  Fix-up BKZ: ",timer.Stop()," seconds");
             }
@@ -357,7 +414,7 @@ Base<Field> ShortVectorEnumeration
             if( ctrl.time )
                 timer.Start();
             Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
+              svp::GNREnumeration( dNew, NNew, upperBounds, v, trialCtrl );
             if( ctrl.time )
                 Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
             if( result < normUpperBound )
@@ -425,6 +482,17 @@ Base<Field> ShortVectorEnumeration
             Output("YSPARSE_ENUM(",n,"): ",timer.Stop()," seconds");
         return result;
     }
+    else if( ctrl.enumType == SIEVE_ENUM )
+    {
+        if( ctrl.progress )
+            Output("Starting SIEVE_ENUM(",n,")");
+        if( ctrl.time )
+            timer.Start();
+        Real result = svp::GaussSieve( R, normUpperBound, v, ctrl );
+        if( ctrl.time )
+            Output("SIEVE_ENUM(",n,"): ",timer.Stop()," seconds");
+        return result;
+    }
     else
     {
         Matrix<Real> upperBounds;
@@ -512,8 +580,9 @@ MultiShortVectorEnumeration
         // GNR enumeration does not yet support multi-enumeration
         const Real normUpperBound = modNormUpperBounds(0);
 
+        Int numTrials;
         auto upperBounds =
-          svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
+          svp::GNRUpperBounds( d, normUpperBound, numTrials, ctrl );
 
         // Since we will manually build up a (weakly) pseudorandom
         // unimodular matrix so that the probabalistic enumerations traverse
@@ -522,7 +591,12 @@ MultiShortVectorEnumeration
         auto RNew( R );
         Matrix<Field> BNew, U;
 
-        for( Int trial=0; trial<ctrl.numTrials; ++trial )
+        // The trials are randomized independently on each process, so only
+        // thread over each of them
+        auto trialCtrl( ctrl );
+        trialCtrl.comm = mpi::COMM_SELF;
+
+        for( Int trial=0; trial<numTrials; ++trial )
         {
             BNew = B;
             Identity( U, n, n );
@@ -548,15 +622,10 @@ MultiShortVectorEnumeration
                     Axpy( scale, uc, uj );
                 }
 
-                // The BKZ does not need to be particularly powerful
-                BKZCtrl<Real> ctrl;
-                ctrl.jumpstart = true; // accumulate into U
-                ctrl.blocksize = 10;
-                ctrl.recursive = false;
-                ctrl.lllCtrl.recursive = false;
+                auto bkzCtrl = svp::PreprocessCtrl( trialCtrl );
                 if( ctrl.time )
                     timer.Start();
-                BKZ( BNew, U, RNew, ctrl );
+                BKZ( BNew, U, RNew, bkzCtrl );
                 if( ctrl.time )
                     Output("  Fix-up BKZ: ",timer.Stop()," seconds");
             }
@@ -573,7 +642,7 @@ MultiShortVectorEnumeration
             if( ctrl.time )
                 timer.Start();
             Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
+              svp::GNREnumeration( dNew, NNew, upperBounds, v, trialCtrl );
             if( ctrl.time )
                 Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
             if( result < normUpperBound )
@@ -652,19 +721,34 @@ MultiShortVectorEnumeration
     }
     else
     {
-        // Full enumeration does not (yet) support multi-enumeration
+        // Neither full enumeration nor sieving (yet) support
+        // multi-enumeration
         const Real normUpperBound = modNormUpperBounds(0);
 
-        Matrix<Real> upperBounds;
-        Zeros( upperBounds, n, 1 );
-        Fill( upperBounds, normUpperBound );
-        if( ctrl.progress )
-            Output("Starting FULL_ENUM(",n,")");
-        if( ctrl.time )
-            timer.Start();
-        Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
-        if( ctrl.time )
-            Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
+        Real result;
+        if( ctrl.enumType == SIEVE_ENUM )
+        {
+            if( ctrl.progress )
+                Output("Starting SIEVE_ENUM(",n,")");
+            if( ctrl.time )
+                timer.Start();
+            result = svp::GaussSieve( R, normUpperBound, v, ctrl );
+            if( ctrl.time )
+                Output("SIEVE_ENUM(",n,"): ",timer.Stop()," seconds");
+        }
+        else
+        {
+            Matrix<Real> upperBounds;
+            Zeros( upperBounds, n, 1 );
+            Fill( upperBounds, normUpperBound );
+            if( ctrl.progress )
+                Output("Starting FULL_ENUM(",n,")");
+            if( ctrl.time )
+                timer.Start();
+            result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
+            if( ctrl.time )
+                Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
+        }
 
         if( result < normUpperBound )
         {
@@ -804,8 +888,12 @@ Base<Field> ShortestVectorEnumeration
             v = vCand;
             targetNorm = result;
             satisfiedBound = true;
-            // Y-sparse enumeration does not benefit from repetition
-            if( ctrl.enumType == YSPARSE_ENUM )
+            // Neither Y-sparse enumeration nor sieving benefit from repetition
+            if( ctrl.enumType == YSPARSE_ENUM || ctrl.enumType == SIEVE_ENUM )
+                return result;
+            // The parallel enumeration already returns the shortest vector
+            if( ctrl.enumType == FULL_ENUM &&
+                svp::UseParallelEnumeration( n, ctrl ) )
                 return result;
         }
         else if( satisfiedBound )
@@ -898,8 +986,12 @@ MultiShortestVectorEnumeration
             targetNorms(indexCand) = normCand;
             satisfiedBound = true;
             satisfiedIndex = indexCand;
-            // Y-sparse enumeration does not benefit from repetition
-            if( ctrl.enumType == YSPARSE_ENUM )
+            // Neither Y-sparse enumeration nor sieving benefit from repetition
+            if( ctrl.enumType == YSPARSE_ENUM || ctrl.enumType == SIEVE_ENUM )
+                return result;
+            // The parallel enumeration already returns the shortest vector
+            if( ctrl.enumType == FULL_ENUM && indexCand == 0 &&
+                svp::UseParallelEnumeration( n, ctrl ) )
                 return result;
         }
         else if( satisfiedBound )
@@ -241,6 +241,8 @@ Base<F> GNREnumeration
   const EnumCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( UseParallelEnumeration( N.Width(), ctrl ) )
+        return ParallelEnumeration( d, N, upperBounds, v, ctrl );
     if( ctrl.explicitTranspose )
     {
         Matrix<F> NTrans;
@@ -0,0 +1,499 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <algorithm>
+#include <deque>
+#include <exception>
+
+namespace El {
+
+namespace svp {
+
+// The enumeration tree of GNR.cpp is split at a 'split' level: the nodes at
+// that level (the assignments of the coordinates v(split:n-1) whose
+// projections satisfy the bounds) become independent jobs, each of which
+// searches the subtree beneath it. One more job searches the subtree where
+// all of v(split:n-1) is zero, i.e., the enumeration of the sublattice
+// spanned by the first 'split' basis vectors.
+//
+// The jobs are sorted by the norms of their projections, dealt cyclically to
+// the processes of the communicator and then to per-thread queues, and idle
+// threads steal from the back of the longest remaining queue. Rather than
+// stopping at the first vector satisfying the bounds, each success shrinks
+// the bounds (by uniformly scaling the pruning profile) so that the search
+// returns the shortest such vector. The scale is shared between the threads
+// of a process immediately and between processes after each round of jobs.
+//
+// See, e.g.,
+//
+//   Jens Hermans, Michael Schneider, Johannes Buchmann, Frederik
+//   Vercauteren, and Bart Preneel, "Parallel shortest lattice vector
+//   enumeration on graphics cards", AFRICACRYPT 2010.
+//
+//   Ozgur Dagdelen and Michael Schneider, "Parallel enumeration of shortest
+//   lattice vectors", Euro-Par 2010.
+
+namespace par_enum {
+
+template<typename F>
+struct Job
+{
+    // The coordinates v(split:n-1)
+    Matrix<F> prefix;
+    // The norm of the projection of B v onto the orthogonal complement of
+    // the first 'split' basis vectors
+    Base<F> norm;
+    // Whether all of the prefix coordinates are zero
+    bool zero;
+};
+
+// Traverse the levels [leaf,top] of the subtree beneath the fixed
+// coordinates v(top+1:n-1), whose projection has norm 'prefixNorm'. If the
+// fixed coordinates are all zero, then the leading nonzero coordinate is
+// constrained (as in GNR.cpp) so that only one of each pair {v,-v} (or each
+// quadruple {v,i v,-v,-i v}) is visited.
+//
+// Each node at the leaf level which satisfies the bounds is passed to
+// 'visit', and, every so often, 'refresh' is queried. Both return the
+// current scale of the bounds, which may only decrease.
+template<typename F,class VisitType,class RefreshType>
+void Subtree
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int leaf,
+        Int top,
+        Base<F> prefixNorm,
+        bool zeroPrefix,
+        Matrix<F>& v,
+  const VisitType& visit,
+  const RefreshType& refresh )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    const Int refreshInterval = 1024;
+
+    Matrix<F> partialSums;
+    Zeros( partialSums, n+1, n );
+
+    // See GNR.cpp for the meaning of 'sumIndices'. None of the fixed
+    // coordinates have been accumulated into the partial sums.
+    Matrix<Int> sumIndices;
+    Zeros( sumIndices, n+1, 1 );
+    for( Int j=0; j<=n; ++j )
+        sumIndices(j) = j-1;
+    sumIndices(top+1) = n-1;
+
+    Matrix<Real> partialNorms;
+    Zeros( partialNorms, n+1, 1 );
+    partialNorms(top+1) = prefixNorm;
+
+    Matrix<F> centers;
+    Zeros( centers, n, 1 );
+
+    vector<SpiralState<F>> spiralStates(n);
+
+    Real scale = refresh();
+    auto bounds( upperBounds );
+    bounds *= scale;
+    auto rescale = [&]( const Real& newScale )
+      {
+          if( newScale < scale )
+          {
+              scale = newScale;
+              bounds = upperBounds;
+              bounds *= scale;
+          }
+      };
+
+    F* vBuf = v.Buffer();
+    for( Int i=0; i<=top; ++i )
+        vBuf[i] = F(0);
+
+    Int k, lastNonzero;
+    if( zeroPrefix )
+    {
+        k = leaf;
+        lastNonzero = leaf;
+        spiralStates[k].Initialize( true );
+        vBuf[k] = spiralStates[k].Step();
+    }
+    else
+    {
+        // The leading nonzero coordinate is fixed, so never constrain
+        lastNonzero = n;
+
+        k = top;
+        sumIndices(k) = Max(sumIndices(k),sumIndices(k+1));
+              F* s = &partialSums(0,k);
+        const F* nBuf = &NTrans(0,k);
+        for( Int i=sumIndices(k+1); i>=k+1; --i )
+            s[i] = s[i+1] + nBuf[i]*vBuf[i];
+        centers(k) = -partialSums(k+1,k);
+        vBuf[k] = Round(centers(k));
+        spiralStates[k].Initialize( centers(k) );
+    }
+
+    Int numNodes = 0;
+    while( true )
+    {
+        if( ++numNodes == refreshInterval )
+        {
+            numNodes = 0;
+            rescale( refresh() );
+        }
+
+        const F entry = d(k)*(vBuf[k] - centers(k));
+        const Real partialNorm = SafeNorm( partialNorms(k+1), entry );
+        partialNorms(k) = partialNorm;
+        if( partialNorm < bounds((n-1)-k) )
+        {
+            if( k == leaf )
+            {
+                rescale( visit( v, partialNorm ) );
+
+                // Move on to the next sibling
+                vBuf[k] = spiralStates[k].Step();
+            }
+            else
+            {
+                // Move down the tree
+                --k;
+                sumIndices(k) = Max(sumIndices(k),sumIndices(k+1));
+
+                      F* s = &partialSums(0,k);
+                const F* nBuf = &NTrans(0,k);
+                for( Int i=sumIndices(k+1); i>=k+1; --i )
+                    s[i] = s[i+1] + nBuf[i]*vBuf[i];
+
+                centers(k) = -partialSums(k+1,k);
+                vBuf[k] = Round(centers(k));
+                spiralStates[k].Initialize( centers(k) );
+            }
+        }
+        else
+        {
+            // Move up the tree
+            ++k;
+            if( k == top+1 )
+                return;
+            sumIndices(k) = k; // indicate that (i,j) are not synchronized
+            if( k > lastNonzero )
+            {
+                // Seed a constrained spiral out from zero
+                spiralStates[k].Initialize( true );
+                vBuf[k] = spiralStates[k].Step();
+                lastNonzero = k;
+            }
+            else
+            {
+                vBuf[k] = spiralStates[k].Step();
+            }
+        }
+    }
+}
+
+// Form the jobs at the given split level, sorted by their norms, with the
+// all-zero prefix first
+template<typename F>
+vector<Job<F>> FormJobs
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int split )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+
+    vector<Job<F>> jobs;
+    auto visit = [&]( const Matrix<F>& v, const Real& norm )
+      {
+          Job<F> job;
+          job.prefix = v( IR(split,n), ALL );
+          job.norm = norm;
+          job.zero = false;
+          jobs.push_back( job );
+          return Real(1);
+      };
+    auto refresh = []() { return Real(1); };
+
+    Matrix<F> v;
+    Zeros( v, n, 1 );
+    Subtree
+    ( d, NTrans, upperBounds, split, n-1, Real(0), true, v, visit, refresh );
+    std::stable_sort
+    ( jobs.begin(), jobs.end(),
+      []( const Job<F>& a, const Job<F>& b ) { return a.norm < b.norm; } );
+
+    Job<F> zeroJob;
+    Zeros( zeroJob.prefix, n-split, 1 );
+    zeroJob.norm = Real(0);
+    zeroJob.zero = true;
+    jobs.insert( jobs.begin(), zeroJob );
+
+    return jobs;
+}
+
+} // namespace par_enum
+
+template<typename F>
+Base<F> ParallelEnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = N.Height();
+    const Int n = N.Width();
+    if( n > m )
+        LogicError("Expected height(N) >= width(N)");
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+    if( n == 1 )
+        return GNREnumeration( d, N, upperBounds, v, ctrl );
+
+    // Every thread traverses the columns of N, so explicitly transpose it
+    Matrix<F> NTrans;
+    Transpose( N, NTrans );
+
+    mpi::Comm comm = ctrl.comm;
+    const Int commSize = mpi::Size( comm );
+    const Int commRank = mpi::Rank( comm );
+    Int numThreads = 1;
+#ifdef EL_HYBRID
+    numThreads = omp_get_max_threads();
+#endif
+    const Int maxThreads = mpi::AllReduce( numThreads, mpi::MAX, comm );
+    const Int numWorkers = commSize*maxThreads;
+
+    // Find the shallowest split with enough jobs to balance the load
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    const Int targetJobs = ctrl.jobsPerWorker*numWorkers;
+    vector<par_enum::Job<F>> jobs;
+    Int split = n-1;
+    while( true )
+    {
+        jobs = par_enum::FormJobs( d, NTrans, upperBounds, split );
+        if( Int(jobs.size()) >= targetJobs || split == 1 )
+            break;
+        --split;
+    }
+    const Int numJobs = jobs.size();
+    if( ctrl.progress && commRank == 0 )
+        Output("Split into ",numJobs," subtrees at level ",split);
+    if( ctrl.time && commRank == 0 )
+        Output("  Forming jobs: ",timer.Stop()," seconds");
+
+    // The shortest vector found so far, and the scale of the bounds which
+    // only admits shorter vectors
+    const Real upperBound = upperBounds(n-1);
+    Real bestNorm = upperBound, globalBestNorm = upperBound;
+    Real scale = Real(1);
+    Matrix<F> bestV;
+    Zeros( bestV, n, 1 );
+
+    auto runJob = [&]( const par_enum::Job<F>& job, Matrix<F>& vJob )
+      {
+          auto visit = [&]( const Matrix<F>& vCand, const Real& norm )
+            {
+                Real newScale;
+#ifdef EL_HYBRID
+                #pragma omp critical(El_svp_ParallelEnumeration)
+#endif
+                {
+                    if( norm < bestNorm )
+                    {
+                        bestNorm = norm;
+                        bestV = vCand;
+                        scale = bestNorm / upperBound;
+                    }
+                    newScale = scale;
+                }
+                return newScale;
+            };
+          auto refresh = [&]()
+            {
+                Real newScale;
+#ifdef EL_HYBRID
+                #pragma omp critical(El_svp_ParallelEnumeration)
+#endif
+                newScale = scale;
+                return newScale;
+            };
+          auto vPrefix = vJob( IR(split,n), ALL );
+          vPrefix = job.prefix;
+          par_enum::Subtree
+          ( d, NTrans, upperBounds, 0, split-1, job.norm, job.zero, vJob,
+            visit, refresh );
+      };
+
+    // Each round, the processes search their (cyclic) share of the next
+    // 'roundSize' jobs and then agree upon the shortest vector
+    const Int roundSize = ( commSize == 1 ? numJobs : 2*numWorkers );
+    if( ctrl.time )
+        timer.Start();
+    for( Int roundBeg=0; roundBeg<numJobs; roundBeg+=roundSize )
+    {
+        const Int roundEnd = Min(roundBeg+roundSize,numJobs);
+        vector<Int> localJobs;
+        for( Int job=roundBeg; job<roundEnd; ++job )
+            if( job % commSize == commRank )
+                localJobs.push_back( job );
+        const Int numLocalJobs = localJobs.size();
+
+        // Exceptions are caught so that every process still reaches the
+        // collectives at the end of the round (rather than deadlocking)
+        bool failed = false;
+        std::exception_ptr error;
+#ifdef EL_HYBRID
+        if( numThreads > 1 )
+        {
+            vector<std::deque<Int>> queues( numThreads );
+            for( Int j=0; j<numLocalJobs; ++j )
+                queues[j % numThreads].push_back( localJobs[j] );
+
+            #pragma omp parallel
+            {
+                const Int thread = omp_get_thread_num();
+                Matrix<F> vJob;
+                Zeros( vJob, n, 1 );
+                while( true )
+                {
+                    Int job = -1;
+                    #pragma omp critical(El_svp_ParallelEnumerationQueues)
+                    {
+                        if( !failed )
+                        {
+                            if( !queues[thread].empty() )
+                            {
+                                job = queues[thread].front();
+                                queues[thread].pop_front();
+                            }
+                            else
+                            {
+                                // Steal from the back of the longest queue
+                                Int victim = -1;
+                                size_t victimSize = 0;
+                                for( Int t=0; t<numThreads; ++t )
+                                    if( queues[t].size() > victimSize )
+                                    {
+                                        victim = t;
+                                        victimSize = queues[t].size();
+                                    }
+                                if( victim >= 0 )
+                                {
+                                    job = queues[victim].back();
+                                    queues[victim].pop_back();
+                                }
+                            }
+                        }
+                    }
+                    if( job < 0 )
+                        break;
+
+                    try { runJob( jobs[job], vJob ); }
+                    catch( ... )
+                    {
+                        #pragma omp critical(El_svp_ParallelEnumerationQueues)
+                        {
+                            if( !failed )
+                            {
+                                failed = true;
+                                error = std::current_exception();
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        else
+#endif
+        {
+            Matrix<F> vJob;
+            Zeros( vJob, n, 1 );
+            try
+            {
+                for( Int j=0; j<numLocalJobs; ++j )
+                    runJob( jobs[localJobs[j]], vJob );
+            }
+            catch( ... )
+            {
+                failed = true;
+                error = std::current_exception();
+            }
+        }
+
+        if( commSize > 1 )
+        {
+            // Ensure that every process agrees on whether to proceed before
+            // taking part in the reduction
+            const Int numFailed =
+              mpi::AllReduce( Int(failed), mpi::SUM, comm );
+            if( failed )
+                std::rethrow_exception( error );
+            if( numFailed > 0 )
+                RuntimeError
+                ("Parallel enumeration failed on ",numFailed," other process",
+                 (numFailed > 1 ? "es" : ""));
+
+            ValueInt<Real> best;
+            best.value = bestNorm;
+            best.index = commRank;
+            best = mpi::AllReduce( best, mpi::MinLocOp<Real>(), comm );
+            if( best.value < globalBestNorm )
+            {
+                mpi::Broadcast( bestV.Buffer(), n, best.index, comm );
+                bestNorm = globalBestNorm = best.value;
+                scale = bestNorm / upperBound;
+            }
+        }
+        else if( failed )
+            std::rethrow_exception( error );
+    }
+    if( ctrl.time && commRank == 0 )
+        Output("  Parallel enumeration: ",timer.Stop()," seconds");
+
+    if( bestNorm < upperBound )
+    {
+        v = bestV;
+        return bestNorm;
+    }
+    else
+    {
+        // Return an arbitrary value greater than upperBounds(n-1)
+        return 2*upperBound+1;
+    }
+}
+
+#define PROTO(F) \
+  template Base<F> ParallelEnumeration \
+  ( const Matrix<Base<F>>& d, \
+    const Matrix<F>& N, \
+    const Matrix<Base<F>>& u, \
+          Matrix<F>& v, \
+    const EnumCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace svp
+
+} // namespace El
@@ -0,0 +1,284 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <map>
+#include <mutex>
+
+namespace El {
+
+namespace svp {
+
+// The pruning profiles are optimized using the cost model of
+//
+//   Nicolas Gama, Phong Q. Nguyen, and Oded Regev, "Lattice enumeration
+//   using extreme pruning", EUROCRYPT 2010,
+//
+// as used by
+//
+//   Yuanmi Chen and Phong Q. Nguyen, "BKZ 2.0: Better lattice security
+//   estimates", ASIACRYPT 2011.
+//
+// The bounds of each pair of consecutive levels are kept equal so that,
+// under the Gaussian heuristic, both the number of nodes at each level and
+// the probability of the target vector (assumed to be uniformly distributed
+// on the sphere of radius 'normUpperBound') surviving the pruning reduce to
+// probabilities that sorted uniform random variables lie beneath a given
+// profile. The latter are computed by numerically integrating the joint
+// density over a uniform grid.
+
+namespace pruning {
+
+// The number of intervals of the grid used for integrating over [0,1]
+const Int numIntervals = 256;
+
+// The probability that the order statistics of a.size() independent uniform
+// random variables on [0,1] are bounded by the (nondecreasing) entries of a
+double SortedUniformProb( const vector<double>& a )
+{
+    const Int m = a.size();
+    const double h = 1./numIntervals;
+    vector<double> density(numIntervals+1,1.), cumul(numIntervals+1);
+    for( Int j=0; j<m; ++j )
+    {
+        // density := (j+1) int_0^{min(x,a_j)} density(y) dy
+        const double bound = Min(Max(a[j],0.),1.);
+        cumul[0] = 0;
+        for( Int g=1; g<=numIntervals; ++g )
+            cumul[g] = cumul[g-1] + h*(density[g-1]+density[g])/2;
+        const Int g0 = Min( Int(bound*numIntervals), numIntervals-1 );
+        const double theta = bound*numIntervals - g0;
+        const double cumulBound = (1-theta)*cumul[g0] + theta*cumul[g0+1];
+        for( Int g=0; g<=numIntervals; ++g )
+            density[g] = (j+1)*( g*h <= bound ? cumul[g] : cumulBound );
+    }
+    return Min( density[numIntervals], 1. );
+}
+
+double LogAddExp( double alpha, double beta )
+{
+    const double maxVal = Max(alpha,beta);
+    if( maxVal == -limits::Infinity<double>() )
+        return maxVal;
+    return maxVal + std::log(std::exp(alpha-maxVal)+std::exp(beta-maxVal));
+}
+
+// Returns the logarithms of the expected number of enumeration nodes and of
+// the probability of success for the pair bounds 'pairBounds' (the squares
+// of the bounds relative to the radius)
+pair<double,double> LogCostAndProb
+( const vector<double>& pairBounds,
+  const vector<double>& logGSSuffixSums,
+        double logRadius )
+{
+    const Int n = logGSSuffixSums.size()-1;
+    const double logPi = std::log(Pi<double>());
+    double logCost = -limits::Infinity<double>();
+    vector<double> a;
+    for( Int k=1; k<=n; ++k )
+    {
+        const double top = pairBounds[(k-1)/2];
+        const Int numPairs = k/2;
+        a.resize( numPairs );
+        for( Int j=0; j<numPairs; ++j )
+            a[j] = Min( pairBounds[j]/top, 1. );
+        const double prob = SortedUniformProb( a );
+        if( prob <= 0. )
+            continue;
+        // Half of the volume of the pruned ball divided by the volume of the
+        // projected sublattice
+        const double logVol = (k/2.)*(logPi+2*logRadius+std::log(top)) -
+          std::lgamma(k/2.+1);
+        const double logNodes =
+          std::log(0.5) + logVol - logGSSuffixSums[n-k] + std::log(prob);
+        logCost = LogAddExp( logCost, logNodes );
+    }
+
+    vector<double> aSucc( pairBounds.begin(),
+                          pairBounds.begin()+Max(n/2-1,Int(0)) );
+    const double prob = SortedUniformProb( aSucc );
+    return pair<double,double>
+      ( logCost, std::log(Max(prob,limits::Min<double>())) );
+}
+
+// In-memory cache of the most recently optimized pair bounds per dimension,
+// which is shared by all of the threads of the process
+std::mutex cacheMutex;
+std::map<Int,vector<double>> cache;
+
+string CacheFilename( const string& dir, Int n )
+{ return BuildString(dir,"/Pruning",n,".txt"); }
+
+bool ReadCache( const string& dir, Int n, vector<double>& pairBounds )
+{
+    if( dir.empty() )
+        return false;
+    std::ifstream file( CacheFilename(dir,n).c_str() );
+    if( !file.is_open() )
+        return false;
+    const Int numPairs = (n+1)/2;
+    vector<double> bounds(numPairs);
+    for( Int j=0; j<numPairs; ++j )
+        if( !(file >> bounds[j]) )
+            return false;
+    pairBounds = bounds;
+    return true;
+}
+
+// The on-disk cache is only an optimization, so failing to write it is not
+// an error
+bool WriteCache( const string& dir, Int n, const vector<double>& pairBounds )
+{
+    if( dir.empty() )
+        return false;
+    std::ofstream file( CacheFilename(dir,n).c_str() );
+    if( !file.is_open() )
+        return false;
+    file.precision( 17 );
+    for( const double& bound : pairBounds )
+        file << bound << "\n";
+    return file.good();
+}
+
+} // namespace pruning
+
+template<typename Real>
+Matrix<Real> OptimizedPruning
+( const Matrix<Real>& gsNorms,
+        Real normUpperBound,
+        Real& successProb,
+  const EnumCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = gsNorms.Height();
+    Matrix<Real> upperBounds;
+    Zeros( upperBounds, n, 1 );
+    successProb = 1;
+    if( n == 0 )
+        return upperBounds;
+
+    vector<double> logGSSuffixSums(n+1,0.);
+    for( Int i=n-1; i>=0; --i )
+        logGSSuffixSums[i] =
+          logGSSuffixSums[i+1] + double(Log(Abs(gsNorms(i))));
+    const double logRadius = double(Log(normUpperBound));
+    const double logPreprocess =
+      ( ctrl.preprocessCost < 0 ? 3*std::log(double(n))
+                                : std::log(Max(ctrl.preprocessCost,1.)) );
+    auto logExpectedCost = [&]( const vector<double>& pairBounds )
+      {
+          auto logs = pruning::LogCostAndProb
+            ( pairBounds, logGSSuffixSums, logRadius );
+          return pruning::LogAddExp(logPreprocess,logs.first) - logs.second;
+      };
+
+    // Start from the cached profile for this dimension if there is one,
+    // otherwise from linear pruning
+    const Int numPairs = (n+1)/2;
+    vector<double> pairBounds;
+    double step = 0.25;
+    bool cached;
+    {
+        std::lock_guard<std::mutex> lock( pruning::cacheMutex );
+        auto iter = pruning::cache.find( n );
+        cached = ( iter != pruning::cache.end() );
+        if( cached )
+            pairBounds = iter->second;
+    }
+    // Only a profile which was in neither cache is written to disk
+    bool writeToDisk = false;
+    if( !cached )
+    {
+        cached = pruning::ReadCache( ctrl.pruningCacheDir, n, pairBounds );
+        writeToDisk = !cached;
+    }
+    if( cached )
+    {
+        step = 1./32;
+    }
+    else
+    {
+        pairBounds.resize( numPairs );
+        for( Int j=0; j<numPairs; ++j )
+            pairBounds[j] = double(Min(2*(j+1),n))/n;
+    }
+
+    // Multiplicatively perturb each (non-final) pair bound while preserving
+    // monotonicity, halving the perturbation when no sweep improves
+    const double minStep = 1./128;
+    const double minBound = 1e-4;
+    double bestCost = logExpectedCost( pairBounds );
+    vector<double> trialBounds;
+    while( step >= minStep )
+    {
+        bool improved = false;
+        for( Int j=0; j<numPairs-1; ++j )
+        {
+            const double lower = ( j == 0 ? minBound : pairBounds[j-1] );
+            const double upper = pairBounds[j+1];
+            for( const double factor : { 1+step, 1/(1+step) } )
+            {
+                trialBounds = pairBounds;
+                trialBounds[j] =
+                  Min( Max(pairBounds[j]*factor,lower), upper );
+                if( trialBounds[j] == pairBounds[j] )
+                    continue;
+                const double cost = logExpectedCost( trialBounds );
+                if( cost < bestCost )
+                {
+                    bestCost = cost;
+                    pairBounds = trialBounds;
+                    improved = true;
+                }
+            }
+        }
+        if( !improved )
+            step /= 2;
+    }
+    {
+        std::lock_guard<std::mutex> lock( pruning::cacheMutex );
+        pruning::cache[n] = pairBounds;
+    }
+    // Every process computes the same profile, so only the root writes it
+    if( writeToDisk && mpi::Rank() == 0 &&
+        !pruning::WriteCache( ctrl.pruningCacheDir, n, pairBounds ) &&
+        ctrl.progress )
+        Output
+        ("Could not write ",pruning::CacheFilename(ctrl.pruningCacheDir,n));
+
+    const auto logs =
+      pruning::LogCostAndProb( pairBounds, logGSSuffixSums, logRadius );
+    successProb = Real(std::exp(logs.second));
+    if( ctrl.progress )
+        Output
+        ("Optimized pruning for n=",n,": expected ",std::exp(logs.first),
+         " nodes per trial with success probability ",successProb);
+
+    for( Int i=0; i<n; ++i )
+        upperBounds(i) = normUpperBound*Sqrt(Real(pairBounds[i/2]));
+    return upperBounds;
+}
+
+#define PROTO(Real) \
+  template Matrix<Real> OptimizedPruning \
+  ( const Matrix<Real>& gsNorms, \
+          Real normUpperBound, \
+          Real& successProb, \
+    const EnumCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace svp
+
+} // namespace El
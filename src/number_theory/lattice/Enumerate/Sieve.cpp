@@ -0,0 +1,476 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <unordered_map>
+
+namespace El {
+
+namespace svp {
+
+// The Gauss sieve of
+//
+//   Daniele Micciancio and Panagiotis Voulgaris, "Faster exponential time
+//   algorithms for the shortest vector problem", SODA 2010.
+//
+// maintains a list of lattice vectors which are pairwise Gauss-reduced, i.e.,
+// || u - q w ||_2 >= max(|| u ||_2,|| w ||_2) for every integer q. Each new
+// sample (or previously-listed vector which was shortened by a newer list
+// member) is reduced against the shorter list members, then used to reduce
+// the longer list members, and then inserted into the list. When a sample
+// reduces to zero, we count a "collision", and the sieve stops after the
+// number of collisions exceeds a fraction of the list size.
+//
+// Rather than comparing each new vector against the entire list, the list is
+// (optionally) bucketed using the angular locality-sensitive hashes of
+//
+//   Thijs Laarhoven, "Sieving for shortest vectors in lattices using angular
+//   locality-sensitive hashing", CRYPTO 2015,
+//
+// so that only the list members sharing a bucket with the new vector in at
+// least one of the hash tables are considered. Further, the candidates are
+// screened using inner products against scaled single-precision copies of
+// the vectors before the exact inner products are computed.
+
+namespace sieve {
+
+template<typename F>
+struct Entry
+{
+    typedef ConvertBase<F,float> FLow;
+
+    // The coefficients of the lattice vector with respect to the basis, 'z',
+    // and its image, 'w := R z'
+    Matrix<F> z, w;
+    Base<F> normSquared;
+
+    // A copy of 'w / scale' in single-precision
+    vector<FLow> wLow;
+    float normSquaredLow;
+
+    // The bucket of the vector in each hash table
+    vector<Int> hashes;
+
+    // The position within the list (or -1 if not listed)
+    Int listIndex=-1;
+};
+
+// A single-precision inner product with several independent partial sums so
+// that it is readily vectorized
+template<typename FLow>
+FLow LowDot( const FLow* x, const FLow* y, Int n )
+{
+    FLow s0(0), s1(0), s2(0), s3(0);
+    Int i=0;
+    for( ; i+4<=n; i+=4 )
+    {
+        s0 += Conj(x[i  ])*y[i  ];
+        s1 += Conj(x[i+1])*y[i+1];
+        s2 += Conj(x[i+2])*y[i+2];
+        s3 += Conj(x[i+3])*y[i+3];
+    }
+    for( ; i<n; ++i )
+        s0 += Conj(x[i])*y[i];
+    return (s0+s1) + (s2+s3);
+}
+
+template<typename F>
+class GaussSiever
+{
+public:
+    typedef Base<F> Real;
+    typedef ConvertBase<F,float> FLow;
+
+    GaussSiever( const Matrix<F>& R, const EnumCtrl<Real>& ctrl );
+    Real Run( Real normUpperBound, Matrix<F>& v );
+
+private:
+    const Matrix<F>& R_;
+    const EnumCtrl<Real>& ctrl_;
+    Int n_;
+    Real scale_;
+
+    vector<Entry<F>> entries_;
+    vector<Int> freeEntries_, list_, stack_;
+
+    Int numTables_, hashLength_;
+    vector<vector<FLow>> hyperplanes_;
+    vector<std::unordered_map<Int,vector<Int>>> buckets_;
+
+    // For avoiding duplicate candidates from different hash tables
+    vector<Int> visitStamps_;
+    Int visitStamp_=0;
+
+    Int NewEntry();
+    void FreeEntry( Int index );
+    void Sample( Entry<F>& p );
+    void Refresh( Entry<F>& p );
+    bool Reduce( Entry<F>& p, const Entry<F>& u ) const;
+    void Candidates( const Entry<F>& p, vector<Int>& candidates );
+    void Insert( Int index );
+    void Remove( Int index );
+};
+
+template<typename F>
+GaussSiever<F>::GaussSiever( const Matrix<F>& R, const EnumCtrl<Real>& ctrl )
+: R_(R), ctrl_(ctrl), n_(R.Width())
+{
+    EL_DEBUG_CSE
+    scale_ = 0;
+    for( Int j=0; j<n_; ++j )
+    {
+        const Real diagAbs = Abs(R(j,j));
+        if( diagAbs == Real(0) )
+            LogicError("The sieve requires a basis with full column rank");
+        scale_ = Max( scale_, diagAbs );
+    }
+
+    numTables_ = ctrl.sieveNumHashTables;
+    if( numTables_ < 0 )
+        numTables_ =
+          ( n_ < 30 ? 0 : Int(Round(Pow(2.,0.129*double(n_)))) );
+    hashLength_ = ctrl.sieveHashLength;
+    if( hashLength_ < 0 )
+        hashLength_ = Max( Int(Round(0.2206*double(n_))), Int(1) );
+    hashLength_ = Min( hashLength_, Int(8*sizeof(Int)-2) );
+
+    hyperplanes_.resize( numTables_ );
+    for( Int t=0; t<numTables_; ++t )
+    {
+        hyperplanes_[t].resize( hashLength_*n_ );
+        for( auto& alpha : hyperplanes_[t] )
+            alpha = SampleNormal<FLow>();
+    }
+    buckets_.resize( numTables_ );
+}
+
+template<typename F>
+Int GaussSiever<F>::NewEntry()
+{
+    Int index;
+    if( freeEntries_.empty() )
+    {
+        index = entries_.size();
+        entries_.emplace_back();
+        visitStamps_.push_back( 0 );
+        auto& p = entries_.back();
+        p.z.Resize( n_, 1 );
+        p.w.Resize( n_, 1 );
+        p.wLow.resize( n_ );
+        p.hashes.resize( numTables_ );
+    }
+    else
+    {
+        index = freeEntries_.back();
+        freeEntries_.pop_back();
+    }
+    entries_[index].listIndex = -1;
+    return index;
+}
+
+template<typename F>
+void GaussSiever<F>::FreeEntry( Int index )
+{ freeEntries_.push_back( index ); }
+
+// Draw a random lattice vector using the randomized nearest-plane algorithm
+// of Klein, where the deviation of each coordinate is chosen so that every
+// Gram-Schmidt direction contributes comparably to the (expected) norm
+template<typename F>
+void GaussSiever<F>::Sample( Entry<F>& p )
+{
+    EL_DEBUG_CSE
+    do
+    {
+        Zero( p.w );
+        for( Int j=n_-1; j>=0; --j )
+        {
+            const F center = -p.w(j) / R_(j,j);
+            const Real deviation = scale_ / Abs(R_(j,j));
+            const F zj = Round( SampleNormal( center, deviation ) );
+            p.z(j) = zj;
+            if( zj != F(0) )
+                for( Int i=0; i<=j; ++i )
+                    p.w(i) += R_(i,j)*zj;
+        }
+    } while( MaxNorm(p.z) == Real(0) );
+    Refresh( p );
+}
+
+// Recompute the image, its norm, its low-precision copy, and its hashes after
+// a change to the coefficients
+template<typename F>
+void GaussSiever<F>::Refresh( Entry<F>& p )
+{
+    Gemv( NORMAL, F(1), R_, p.z, F(0), p.w );
+    const Real norm = FrobeniusNorm( p.w );
+    p.normSquared = norm*norm;
+
+    for( Int i=0; i<n_; ++i )
+        p.wLow[i] = FLow(p.w(i)/scale_);
+    p.normSquaredLow = float(p.normSquared/(scale_*scale_));
+
+    for( Int t=0; t<numTables_; ++t )
+    {
+        const FLow* planes = hyperplanes_[t].data();
+        Int hash = 0;
+        for( Int b=0; b<hashLength_; ++b )
+            if( RealPart(LowDot(&planes[b*n_],p.wLow.data(),n_)) > 0.f )
+                hash |= Int(1) << b;
+        p.hashes[t] = hash;
+    }
+}
+
+// Attempt to shorten p by an integer multiple of u
+template<typename F>
+bool GaussSiever<F>::Reduce( Entry<F>& p, const Entry<F>& u ) const
+{
+    // Nonzero multiples are only possible when 2 |u^H p| >= || u ||_2^2, so
+    // screen with the single-precision copies (with a generous tolerance)
+    const FLow dotLow = LowDot( u.wLow.data(), p.wLow.data(), n_ );
+    if( 2*Abs(dotLow) < 0.99f*u.normSquaredLow )
+        return false;
+
+    const F dot = Dot( u.w, p.w );
+    const F q = Round( dot / u.normSquared );
+    if( q == F(0) )
+        return false;
+    const Real newNormSquared = p.normSquared - 2*RealPart(Conj(q)*dot) +
+      RealPart(Conj(q)*q)*u.normSquared;
+    if( newNormSquared >= p.normSquared )
+        return false;
+
+    Axpy( -q, u.z, p.z );
+    Axpy( -q, u.w, p.w );
+    p.normSquared = newNormSquared;
+    const FLow qLow = FLow(q);
+    for( Int i=0; i<n_; ++i )
+        p.wLow[i] -= qLow*u.wLow[i];
+    p.normSquaredLow = float(newNormSquared/(scale_*scale_));
+    return true;
+}
+
+template<typename F>
+void GaussSiever<F>::Candidates
+( const Entry<F>& p, vector<Int>& candidates )
+{
+    candidates.resize( 0 );
+    if( numTables_ == 0 )
+    {
+        candidates = list_;
+        return;
+    }
+    ++visitStamp_;
+    for( Int t=0; t<numTables_; ++t )
+    {
+        auto iter = buckets_[t].find( p.hashes[t] );
+        if( iter == buckets_[t].end() )
+            continue;
+        for( const Int index : iter->second )
+        {
+            if( visitStamps_[index] != visitStamp_ )
+            {
+                visitStamps_[index] = visitStamp_;
+                candidates.push_back( index );
+            }
+        }
+    }
+}
+
+template<typename F>
+void GaussSiever<F>::Insert( Int index )
+{
+    auto& p = entries_[index];
+    p.listIndex = list_.size();
+    list_.push_back( index );
+    for( Int t=0; t<numTables_; ++t )
+        buckets_[t][p.hashes[t]].push_back( index );
+}
+
+template<typename F>
+void GaussSiever<F>::Remove( Int index )
+{
+    auto& p = entries_[index];
+    const Int last = list_.back();
+    list_[p.listIndex] = last;
+    entries_[last].listIndex = p.listIndex;
+    list_.pop_back();
+    p.listIndex = -1;
+    for( Int t=0; t<numTables_; ++t )
+    {
+        auto& bucket = buckets_[t][p.hashes[t]];
+        for( size_t k=0; k<bucket.size(); ++k )
+        {
+            if( bucket[k] == index )
+            {
+                bucket[k] = bucket.back();
+                bucket.pop_back();
+                break;
+            }
+        }
+    }
+}
+
+template<typename F>
+Base<F> GaussSiever<F>::Run( Real normUpperBound, Matrix<F>& v )
+{
+    EL_DEBUG_CSE
+    // Seed the stack with the basis vectors
+    for( Int j=n_-1; j>=0; --j )
+    {
+        const Int index = NewEntry();
+        auto& p = entries_[index];
+        Zero( p.z );
+        p.z(j) = F(1);
+        Refresh( p );
+        stack_.push_back( index );
+    }
+
+    Real bestNormSquared = normUpperBound*normUpperBound;
+
+    Int numCollisions=0, numIts=0;
+    bool hitMaxListSize = false;
+    vector<Int> candidates;
+    while( true )
+    {
+        const Int listSize = list_.size();
+        const double maxCollisions =
+          ctrl_.sieveCollisionRatio*listSize + ctrl_.sieveMinCollisions;
+        if( numCollisions > maxCollisions )
+            break;
+        if( listSize >= ctrl_.sieveMaxListSize )
+        {
+            hitMaxListSize = true;
+            break;
+        }
+        if( ctrl_.innerProgress && numIts % 10000 == 0 )
+            Output
+            ("  sieve iteration ",numIts,": list size=",listSize,
+             ", stack size=",stack_.size(),", collisions=",numCollisions,
+             ", shortest norm=",Sqrt(bestNormSquared));
+        ++numIts;
+
+        Int index;
+        if( stack_.empty() )
+        {
+            index = NewEntry();
+            Sample( entries_[index] );
+        }
+        else
+        {
+            index = stack_.back();
+            stack_.pop_back();
+        }
+        auto& p = entries_[index];
+
+        // Reduce p against the (no longer) list members until it is stable
+        bool reduced = true;
+        while( reduced )
+        {
+            reduced = false;
+            Candidates( p, candidates );
+            for( const Int uIndex : candidates )
+            {
+                const auto& u = entries_[uIndex];
+                if( u.normSquared <= p.normSquared && Reduce( p, u ) )
+                    reduced = true;
+            }
+            if( reduced )
+                Refresh( p );
+        }
+        if( MaxNorm(p.z) == Real(0) )
+        {
+            ++numCollisions;
+            FreeEntry( index );
+            continue;
+        }
+
+        // Reduce the longer list members against p
+        for( const Int uIndex : candidates )
+        {
+            auto& u = entries_[uIndex];
+            if( u.normSquared <= p.normSquared || !Reduce( u, p ) )
+                continue;
+            Remove( uIndex );
+            Refresh( u );
+            if( MaxNorm(u.z) == Real(0) )
+            {
+                ++numCollisions;
+                FreeEntry( uIndex );
+            }
+            else
+            {
+                stack_.push_back( uIndex );
+            }
+        }
+
+        Insert( index );
+        if( p.normSquared < bestNormSquared )
+        {
+            bestNormSquared = p.normSquared;
+            v = p.z;
+        }
+    }
+    if( ctrl_.innerProgress )
+    {
+        if( hitMaxListSize )
+            Output("  sieve stopped at the maximum list size");
+        Output
+        ("  sieve finished after ",numIts," iterations with list size ",
+         list_.size()," and ",numCollisions," collisions");
+    }
+
+    // The best vector was copied into 'v' when it was found, so it does not
+    // matter if its entry was subsequently shortened or freed
+    if( bestNormSquared < normUpperBound*normUpperBound )
+        return Sqrt(bestNormSquared);
+    else
+        return 2*normUpperBound+1;
+}
+
+} // namespace sieve
+
+template<typename F>
+Base<F> GaussSieve
+( const Matrix<F>& R,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = R.Width();
+    if( R.Height() < n )
+        LogicError("Expected height(R) >= width(R)");
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+
+    // Ignore anything stored below the diagonal
+    Matrix<F> RTop( R( IR(0,n), ALL ) );
+    MakeTrapezoidal( UPPER, RTop );
+    sieve::GaussSiever<F> siever( RTop, ctrl );
+    return siever.Run( normUpperBound, v );
+}
+
+#define PROTO(F) \
+  template Base<F> GaussSieve \
+  ( const Matrix<F>& R, \
+          Base<F> normUpperBound, \
+          Matrix<F>& v, \
+    const EnumCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace svp
+
+} // namespace El
@@ -83,6 +83,11 @@ ElError ElBPDNADMMCtrlDefault_s( ElBPDNADMMCtrl_s* ctrl )
     ctrl->relTol = 1e-4;
     ctrl->inv = true;
     ctrl->progress = true;
+    ctrl->adaptiveRho = false;
+    ctrl->rhoBalance = 10;
+    ctrl->rhoScale = 2;
+    ctrl->andersonDepth = 0;
+    ctrl->consensus = false;
     return EL_SUCCESS;
 }
 
@@ -95,6 +100,11 @@ ElError ElBPDNADMMCtrlDefault_d( ElBPDNADMMCtrl_d* ctrl )
     ctrl->relTol = 1e-4;
     ctrl->inv = true;
     ctrl->progress = true;
+    ctrl->adaptiveRho = false;
+    ctrl->rhoBalance = 10;
+    ctrl->rhoScale = 2;
+    ctrl->andersonDepth = 0;
+    ctrl->consensus = false;
     return EL_SUCCESS;
 }
 
@@ -138,15 +148,21 @@ ElError ElNNLSCtrlDefault_d( ElNNLSCtrl_d* ctrl )
    ================================= */
 ElError ElNMFCtrlDefault_s( ElNMFCtrl_s* ctrl )
 {
+    ctrl->approach = EL_NMF_ALTERNATING_NNLS;
     ElNNLSCtrlDefault_s( &ctrl->nnlsCtrl );
     ctrl->maxIter = 20;
+    ctrl->relTol = 1e-6;
+    ctrl->progress = false;
     return EL_SUCCESS;
 }
 
 ElError ElNMFCtrlDefault_d( ElNMFCtrl_d* ctrl )
 {
+    ctrl->approach = EL_NMF_ALTERNATING_NNLS;
     ElNNLSCtrlDefault_d( &ctrl->nnlsCtrl );
     ctrl->maxIter = 20;
+    ctrl->relTol = 1e-6;
+    ctrl->progress = false;
     return EL_SUCCESS;
 }
 
@@ -208,13 +224,39 @@ ElError ElSparseInvCovCtrlDefault_d( ElSparseInvCovCtrl_d* ctrl )
    ====================== */
 ElError ElSVMCtrlDefault_s( ElSVMCtrl_s* ctrl )
 {
+    ctrl->approach = EL_SVM_IPM;
     ElQPAffineCtrlDefault_s( &ctrl->ipmCtrl );
+    ctrl->dcdCtrl.maxIter = 1000;
+    ctrl->dcdCtrl.relTol = 1e-2;
+    ctrl->dcdCtrl.progress = false;
+    ElAPGCtrlDefault_s( &ctrl->apgCtrl );
     return EL_SUCCESS;
 }
 
 ElError ElSVMCtrlDefault_d( ElSVMCtrl_d* ctrl )
 {
+    ctrl->approach = EL_SVM_IPM;
     ElQPAffineCtrlDefault_d( &ctrl->ipmCtrl );
+    ctrl->dcdCtrl.maxIter = 1000;
+    ctrl->dcdCtrl.relTol = 1e-2;
+    ctrl->dcdCtrl.progress = false;
+    ElAPGCtrlDefault_d( &ctrl->apgCtrl );
+    return EL_SUCCESS;
+}
+
+/* Logistic regression
+   =================== */
+ElError ElLogisticRegressionCtrlDefault_s( ElLogisticRegressionCtrl_s* ctrl )
+{
+    ctrl->penalty = EL_L1_PENALTY;
+    ElAPGCtrlDefault_s( &ctrl->apgCtrl );
+    return EL_SUCCESS;
+}
+
+ElError ElLogisticRegressionCtrlDefault_d( ElLogisticRegressionCtrl_d* ctrl )
+{
+    ctrl->penalty = EL_L1_PENALTY;
+    ElAPGCtrlDefault_d( &ctrl->apgCtrl );
     return EL_SUCCESS;
 }
 
@@ -558,6 +600,58 @@ ElError ElSVMCtrlDefault_d( ElSVMCtrl_d* ctrl )
     Real lambda, ElDistMultiVec_ ## SIG x, ElSVMCtrl_ ## SIG ctrl ) \
   { EL_TRY( SVM \
       ( *CReflect(A), *CReflect(d), lambda, *CReflect(x), CReflect(ctrl) ) ) } \
+  /* Logistic regression
+     =================== */ \
+  ElError ElLogisticRegression_ ## SIG \
+  ( ElConstMatrix_ ## SIG A, ElConstMatrix_ ## SIG d, \
+    Real lambda, ElMatrix_ ## SIG x, ElInt* numIts ) \
+  { EL_TRY( *numIts = LogisticRegression \
+      ( *CReflect(A), *CReflect(d), lambda, *CReflect(x) ) ) } \
+  ElError ElLogisticRegressionDist_ ## SIG \
+  ( ElConstDistMatrix_ ## SIG A, ElConstDistMatrix_ ## SIG d, \
+    Real lambda, ElDistMatrix_ ## SIG x, ElInt* numIts ) \
+  { EL_TRY( *numIts = LogisticRegression \
+      ( *CReflect(A), *CReflect(d), lambda, *CReflect(x) ) ) } \
+  ElError ElLogisticRegressionSparse_ ## SIG \
+  ( ElConstSparseMatrix_ ## SIG A, ElConstMatrix_ ## SIG d, \
+    Real lambda, ElMatrix_ ## SIG x, ElInt* numIts ) \
+  { EL_TRY( *numIts = LogisticRegression \
+      ( *CReflect(A), *CReflect(d), lambda, *CReflect(x) ) ) } \
+  ElError ElLogisticRegressionDistSparse_ ## SIG \
+  ( ElConstDistSparseMatrix_ ## SIG A, ElConstDistMultiVec_ ## SIG d, \
+    Real lambda, ElDistMultiVec_ ## SIG x, ElInt* numIts ) \
+  { EL_TRY( *numIts = LogisticRegression \
+      ( *CReflect(A), *CReflect(d), lambda, *CReflect(x) ) ) } \
+  /* Expert versions
+     --------------- */ \
+  ElError ElLogisticRegressionX_ ## SIG \
+  ( ElConstMatrix_ ## SIG A, ElConstMatrix_ ## SIG d, \
+    Real lambda, ElMatrix_ ## SIG x, \
+    ElLogisticRegressionCtrl_ ## SIG ctrl, ElInt* numIts ) \
+  { EL_TRY( *numIts = LogisticRegression \
+      ( *CReflect(A), *CReflect(d), lambda, *CReflect(x), \
+        CReflect(ctrl) ) ) } \
+  ElError ElLogisticRegressionXDist_ ## SIG \
+  ( ElConstDistMatrix_ ## SIG A, ElConstDistMatrix_ ## SIG d, \
+    Real lambda, ElDistMatrix_ ## SIG x, \
+    ElLogisticRegressionCtrl_ ## SIG ctrl, ElInt* numIts ) \
+  { EL_TRY( *numIts = LogisticRegression \
+      ( *CReflect(A), *CReflect(d), lambda, *CReflect(x), \
+        CReflect(ctrl) ) ) } \
+  ElError ElLogisticRegressionXSparse_ ## SIG \
+  ( ElConstSparseMatrix_ ## SIG A, ElConstMatrix_ ## SIG d, \
+    Real lambda, ElMatrix_ ## SIG x, \
+    ElLogisticRegressionCtrl_ ## SIG ctrl, ElInt* numIts ) \
+  { EL_TRY( *numIts = LogisticRegression \
+      ( *CReflect(A), *CReflect(d), lambda, *CReflect(x), \
+        CReflect(ctrl) ) ) } \
+  ElError ElLogisticRegressionXDistSparse_ ## SIG \
+  ( ElConstDistSparseMatrix_ ## SIG A, ElConstDistMultiVec_ ## SIG d, \
+    Real lambda, ElDistMultiVec_ ## SIG x, \
+    ElLogisticRegressionCtrl_ ## SIG ctrl, ElInt* numIts ) \
+  { EL_TRY( *numIts = LogisticRegression \
+      ( *CReflect(A), *CReflect(d), lambda, *CReflect(x), \
+        CReflect(ctrl) ) ) } \
   /* Total variation denoising 
      ========================= */ \
   ElError ElTV_ ## SIG \
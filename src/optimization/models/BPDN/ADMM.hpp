@@ -28,133 +28,276 @@
 // Woodbury matrix identity to re-express inv(A' A + rho) as
 //   (I - A' inv(A A' + rho) A) / rho.
 
+//
+// In the distributed global-variable consensus form, each process owns a
+// block of rows, A_i, of A (and the corresponding entries of b), and the
+// problem is rewritten as
+//     min sum_i 1/2 || A_i x_i - b_i ||_2^2 + lambda || z ||_1,
+//     s.t. x_i = z,
+// so that each x-update only involves local data and the z-update is the
+// soft-thresholding of an average over the grid.
+
 namespace El {
 namespace bpdn {
 
-template<typename Field>
-Int ADMM
-( const Matrix<Field>& A,
-  const Matrix<Field>& b,
-        Base<Field> lambda,
-        Matrix<Field>& z,
-  const ADMMCtrl<Base<Field>>& ctrl )
+template<typename Real>
+El::ADMMCtrl<Real> EngineCtrl( const ADMMCtrl<Real>& ctrl )
+{
+    El::ADMMCtrl<Real> engineCtrl;
+    engineCtrl.rho = ctrl.rho;
+    engineCtrl.alpha = ctrl.alpha;
+    engineCtrl.maxIter = ctrl.maxIter;
+    engineCtrl.absTol = ctrl.absTol;
+    engineCtrl.relTol = ctrl.relTol;
+    engineCtrl.inv = ctrl.inv;
+    engineCtrl.print = ctrl.progress;
+    engineCtrl.adaptiveRho = ctrl.adaptiveRho;
+    engineCtrl.rhoBalance = ctrl.rhoBalance;
+    engineCtrl.rhoScale = ctrl.rhoScale;
+    engineCtrl.andersonDepth = ctrl.andersonDepth;
+    return engineCtrl;
+}
+
+// Form either the inverse or the Cholesky factor of A^H A + rho I (if A is at
+// least as tall as it is wide) or of A A^H + rho I (otherwise)
+template<typename Field,class MatrixType>
+void FormProx
+( const MatrixType& A,
+        Base<Field> rho,
+        bool inv,
+        MatrixType& P )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     const Int m = A.Height();
     const Int n = A.Width();
-
-    Matrix<Field> P;
     if( m >= n )
     {
         Identity( P, n, n );
-        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
+        Herk( LOWER, ADJOINT, Real(1), A, rho, P );
     }
     else
     {
         Identity( P, m, m );
-        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
+        Herk( LOWER, NORMAL, Real(1), A, rho, P );
     }
-    if( ctrl.inv )
+    if( inv )
         HPDInverse( LOWER, P );
     else
         Cholesky( LOWER, P );
+}
 
-    // Cache w := A^H b
-    Matrix<Field> w;
-    Gemv( ADJOINT, Field(1), A, b, w );
-
-    // Start the LASSO
-    Int numIter=0;
-    Matrix<Field> x, u, s, zOld, xHat;
-    Zeros( x, n, 1 );
-    Zeros( z, n, 1 );
-    Zeros( u, n, 1 );
-    while( numIter < ctrl.maxIter )
+// x := (A^H A + rho) \ (w + rho*v), where w = A^H b
+template<typename Field,class MatrixType>
+void ApplyProx
+( const MatrixType& A,
+  const MatrixType& P,
+  const MatrixType& w,
+        Base<Field> rho,
+        bool inv,
+  const MatrixType& v,
+        MatrixType& x )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    x = w;
+    Axpy( rho, v, x );
+    auto s = w;
+    if( m >= n )
     {
-        zOld = z;
-
-        // x := (A^H A + rho) \ (A^H b + rho*(z-u))
-        x = w;
-        Axpy(  ctrl.rho, z, x );
-        Axpy( -ctrl.rho, u, x );
-        if( m >= n )
+        if( inv )
         {
-            if( ctrl.inv )
-            {
-                s = x;
-                Hemv( LOWER, Field(1), P, s, Field(0), x );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, x );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
-            }
+            s = x;
+            Hemv( LOWER, Field(1), P, s, Field(0), x );
         }
         else
         {
-            Gemv( NORMAL, Field(1), A, x, s );
-            if( ctrl.inv )
-            {
-                auto t( s );
-                Hemv( LOWER, Field(1), P, t, Field(0), s );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, s );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
-            }
-            Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
-            x *= 1/ctrl.rho;
+            Trsv( LOWER, NORMAL, NON_UNIT, P, x );
+            Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
         }
+    }
+    else
+    {
+        Gemv( NORMAL, Field(1), A, x, s );
+        if( inv )
+        {
+            auto t( s );
+            Hemv( LOWER, Field(1), P, t, Field(0), s );
+        }
+        else
+        {
+            Trsv( LOWER, NORMAL, NON_UNIT, P, s );
+            Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
+        }
+        Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
+        x *= 1/rho;
+    }
+}
 
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,lambda/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
+template<typename Field,class MatrixType>
+Int ADMMHelper
+( const MatrixType& A,
+  const MatrixType& b,
+        Base<Field> lambda,
+        MatrixType& z,
+  const ADMMCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Width();
 
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
+    // Cache w := A^H b
+    auto w = b;
+    Gemv( ADJOINT, Field(1), A, b, w );
 
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+    auto P = w;
+    Real factoredRho = 0;
+    auto xUpdate =
+      [&]( Real rho, const MatrixType& v, MatrixType& x )
+      {
+          if( rho != factoredRho )
+          {
+              FormProx<Field>( A, rho, ctrl.inv, P );
+              factoredRho = rho;
+          }
+          ApplyProx<Field>( A, P, w, rho, ctrl.inv, v, x );
+      };
+
+    // z := SoftThresh(v,lambda/rho)
+    auto zUpdate =
+      [&]( Real rho, const MatrixType& v, MatrixType& z )
+      {
+          z = v;
+          SoftThreshold( z, lambda/rho );
+      };
+
+    auto s = b;
+    auto monitor =
+      [&]( Int, const MatrixType& x, const MatrixType& z )
+      {
+          s = b;
+          Gemv( NORMAL, Field(-1), A, x, Field(1), s );
+          const Real resid = FrobeniusNorm( s );
+          const Real obj = Real(1)/Real(2)*resid*resid + lambda*OneNorm(z);
+          if( admm::IsRoot(x) )
+              Output("  objective=",obj);
+      };
 
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+    Zeros( z, n, 1 );
+    auto x = z;
+    auto u = z;
+    const Int numIter = El::ADMM<Field>
+      ( xUpdate, zUpdate, monitor, x, z, u, EngineCtrl(ctrl) );
+    if( ctrl.maxIter == numIter )
+        RuntimeError("Lasso failed to converge");
+    return numIter;
+}
 
-        if( ctrl.progress )
-        {
-            s = b;
-            Gemv( NORMAL, Field(-1), A, x, Field(1), s );
-            const Real resid = FrobeniusNorm( s );
-            const Real obj = Real(1)/Real(2)*resid*resid + lambda*OneNorm(z);
-            Output
-            (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
-             ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
-             ", objective=",obj);
-        }
+template<typename Field>
+Int ADMM
+( const Matrix<Field>& A,
+  const Matrix<Field>& b,
+        Base<Field> lambda,
+        Matrix<Field>& z,
+  const ADMMCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return ADMMHelper<Field>( A, b, lambda, z, ctrl );
+}
 
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+template<typename Field>
+Int ConsensusADMM
+( const AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& bPre,
+        Base<Field> lambda,
+        AbstractDistMatrix<Field>& zPre,
+  const ADMMCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = APre.Width();
+    const Grid& grid = APre.Grid();
+    const Int numProcs = grid.Size();
+
+    DistMatrix<Field,VC,STAR> A_VC_STAR( APre ), b_VC_STAR( bPre );
+    const auto& ALoc = A_VC_STAR.LockedMatrix();
+    const auto& bLoc = b_VC_STAR.LockedMatrix();
+    const Int localHeight = ALoc.Height();
+
+    // Cache wLoc := A_i^H b_i
+    Matrix<Field> wLoc;
+    Zeros( wLoc, n, 1 );
+    if( localHeight > 0 )
+        Gemv( ADJOINT, Field(1), ALoc, bLoc, wLoc );
+
+    // Column i of each of x, z, and u is owned by process i
+    Matrix<Field> PLoc;
+    Real factoredRho = 0;
+    auto xUpdate =
+      [&]( Real rho,
+           const DistMatrix<Field,STAR,VC>& v,
+                 DistMatrix<Field,STAR,VC>& x )
+      {
+          if( localHeight == 0 )
+          {
+              x = v;
+              return;
+          }
+          if( rho != factoredRho )
+          {
+              FormProx<Field>( ALoc, rho, ctrl.inv, PLoc );
+              factoredRho = rho;
+          }
+          ApplyProx<Field>
+          ( ALoc, PLoc, wLoc, rho, ctrl.inv, v.LockedMatrix(), x.Matrix() );
+      };
+
+    // z := SoftThresh(average(v),lambda/(rho numProcs))
+    auto zUpdate =
+      [&]( Real rho,
+           const DistMatrix<Field,STAR,VC>& v,
+                 DistMatrix<Field,STAR,VC>& z )
+      {
+          z = v;
+          auto& zLoc = z.Matrix();
+          mpi::AllReduce( zLoc.Buffer(), n, grid.VCComm() );
+          zLoc *= Real(1)/Real(numProcs);
+          SoftThreshold( zLoc, lambda/(rho*numProcs) );
+      };
+
+    Matrix<Field> sLoc;
+    auto monitor =
+      [&]( Int,
+           const DistMatrix<Field,STAR,VC>& x,
+           const DistMatrix<Field,STAR,VC>& z )
+      {
+          sLoc = bLoc;
+          if( localHeight > 0 )
+              Gemv
+              ( NORMAL, Field(-1), ALoc, x.LockedMatrix(), Field(1), sLoc );
+          const Real localResid = FrobeniusNorm( sLoc );
+          const Real residSquared =
+            mpi::AllReduce( localResid*localResid, grid.VCComm() );
+          const Real obj =
+            Real(1)/Real(2)*residSquared + lambda*OneNorm(z.LockedMatrix());
+          if( grid.Rank() == 0 )
+              Output("  objective=",obj);
+      };
+
+    DistMatrix<Field,STAR,VC> x(grid), z(grid), u(grid);
+    Zeros( x, n, numProcs );
+    Zeros( z, n, numProcs );
+    Zeros( u, n, numProcs );
+    const Int numIter = El::ADMM<Field>
+      ( xUpdate, zUpdate, monitor, x, z, u, EngineCtrl(ctrl) );
     if( ctrl.maxIter == numIter )
         RuntimeError("Lasso failed to converge");
+
+    // Every column of z is equal to the consensus
+    DistMatrix<Field,STAR,STAR> z_STAR_STAR( n, 1, grid );
+    z_STAR_STAR.Matrix() = z.LockedMatrix();
+    Copy( z_STAR_STAR, zPre );
     return numIter;
 }
 
@@ -167,6 +310,8 @@ Int ADMM
   const ADMMCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.consensus )
+        return ConsensusADMM( APre, bPre, lambda, zPre, ctrl );
 
     DistMatrixReadProxy<Field,Field,MC,MR>
       AProx( APre ),
@@ -177,126 +322,7 @@ Int ADMM
     auto& b = bProx.GetLocked();
     auto& z = zProx.Get();
 
-    typedef Base<Field> Real;
-    const Int m = A.Height();
-    const Int n = A.Width();
-    const Grid& g = A.Grid();
-
-    DistMatrix<Field> P(g);
-    if( m >= n )
-    {
-        Identity( P, n, n );
-        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
-    }
-    else
-    {
-        Identity( P, m, m );
-        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
-    }
-    if( ctrl.inv )
-        HPDInverse( LOWER, P );
-    else
-        Cholesky( LOWER, P );
-
-    // Cache w := A^H b
-    DistMatrix<Field> w(g);
-    Gemv( ADJOINT, Field(1), A, b, w );
-
-    // Start the LASSO
-    Int numIter=0;
-    DistMatrix<Field> x(g), u(g), s(g), zOld(g), xHat(g);
-    Zeros( x, n, 1 );
-    Zeros( z, n, 1 );
-    Zeros( u, n, 1 );
-    while( numIter < ctrl.maxIter )
-    {
-        zOld = z;
-
-        // x := (A^H A + rho) \ (A^H b + rho*(z-u))
-        x = w;
-        Axpy(  ctrl.rho, z, x );
-        Axpy( -ctrl.rho, u, x );
-        if( m >= n )
-        {
-            if( ctrl.inv )
-            {
-                s = x;
-                Hemv( LOWER, Field(1), P, s, Field(0), x );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, x );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
-            }
-        }
-        else
-        {
-            Gemv( NORMAL, Field(1), A, x, s );
-            if( ctrl.inv )
-            {
-                auto t( s );
-                Hemv( LOWER, Field(1), P, t, Field(0), s );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, s );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
-            }
-            Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
-            x *= 1/ctrl.rho;
-        }
-
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,lambda/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
-
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
-
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
-
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
-
-        if( ctrl.progress )
-        {
-            s = b;
-            Gemv( NORMAL, Field(-1), A, x, Field(1), s );
-            const Real resid = FrobeniusNorm( s );
-            const Real obj = Real(1)/Real(2)*resid*resid + lambda*OneNorm(z);
-            if( g.Rank() == 0 )
-            {
-                Output
-                (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
-                 ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
-                 ", objective=",obj);
-            }
-        }
-
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
-    if( ctrl.maxIter == numIter )
-        RuntimeError("Lasso failed to converge");
-    return numIter;
+    return ADMMHelper<Field>( A, b, lambda, z, ctrl );
 }
 
 } // namespace bpdn
@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./util/LinearModel.hpp"
+
+// Regularized logistic regression,
+//
+//   min_x sum_i log(1+exp(-mu_i)) + lambda r(x), with mu = diag(d) AAug x,
+//
+// where AAug = [A, ones(m,1)] and x = [w; beta], is solved with an
+// Accelerated Proximal Gradient method. The gradient of the smooth term is
+//
+//   -AAug^T diag(d) (1 ./ (1 + exp(mu))),
+//
+// and so only products with AAug and its transpose are required. The
+// penalty does not involve beta, and so its proximal map is a (masked)
+// soft-thresholding (for the one norm) or scaling (for the two norm).
+//
+
+namespace El {
+
+namespace {
+
+// log(1+exp(-mu)), evaluated without overflow
+template<typename Real>
+Real LogisticLoss( const Real& mu )
+{
+    if( mu > Real(0) )
+        return Log(1+Exp(-mu));
+    else
+        return Log(1+Exp(mu)) - mu;
+}
+
+template<typename Real,class MatrixType,class VectorType>
+Int LogisticRegressionHelper
+( const MatrixType& AAug,
+  const VectorType& d,
+        Real lambda,
+        VectorType& x,
+  const LogisticRegressionCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = AAug.Width();
+    if( lambda < Real(0) )
+        LogicError("lambda must be non-negative");
+
+    auto mu = d;
+    auto losses = d;
+    auto ones = d;
+    Fill( ones, Real(1) );
+    auto mask = x;
+    linear_model::PenaltyMask<Real>( mask, n );
+    auto maskedX = x;
+    Zeros( x, n, 1 );
+
+    function<Real(const Real&)> loss = LogisticLoss<Real>;
+    function<Real(const Real&)> lossDeriv =
+      []( const Real& alpha ) { return -1/(1+Exp(alpha)); };
+    function<Real(const Real&)> absolute =
+      []( const Real& alpha ) { return Abs(alpha); };
+
+    // mu := diag(d) AAug x
+    auto margins =
+      [&]( const VectorType& x )
+      {
+          linear_model::Apply( NORMAL, AAug, x, mu );
+          DiagonalScale( LEFT, NORMAL, d, mu );
+      };
+    auto value =
+      [&]( const VectorType& x ) -> Real
+      {
+          margins( x );
+          EntrywiseMap( mu, loss );
+          return Dot( ones, mu );
+      };
+    auto smooth =
+      [&]( const VectorType& x, VectorType& gradient ) -> Real
+      {
+          margins( x );
+          losses = mu;
+          EntrywiseMap( losses, loss );
+          const Real f = Dot( ones, losses );
+          EntrywiseMap( mu, lossDeriv );
+          DiagonalScale( LEFT, NORMAL, d, mu );
+          linear_model::Apply( TRANSPOSE, AAug, mu, gradient );
+          return f;
+      };
+    auto prox =
+      [&]( Real t, VectorType& x )
+      {
+          if( ctrl.penalty == L1_PENALTY )
+          {
+              // x := x - Clip(mask o x,-lambda t,lambda t)
+              Hadamard( mask, x, maskedX );
+              Clip( maskedX, -lambda*t, lambda*t );
+              x -= maskedX;
+          }
+          else if( ctrl.penalty == L2_PENALTY )
+          {
+              // x := x - (lambda t/(1+lambda t)) (mask o x)
+              Hadamard( mask, x, maskedX );
+              Axpy( -lambda*t/(1+lambda*t), maskedX, x );
+          }
+      };
+    auto nonsmooth =
+      [&]( const VectorType& x ) -> Real
+      {
+          if( ctrl.penalty == NO_PENALTY )
+              return Real(0);
+          Hadamard( mask, x, maskedX );
+          if( ctrl.penalty == L1_PENALTY )
+          {
+              EntrywiseMap( maskedX, absolute );
+              return lambda*Dot( mask, maskedX );
+          }
+          else
+              return lambda*Dot( maskedX, maskedX )/2;
+      };
+
+    return APG<Real>( smooth, value, prox, nonsmooth, x, ctrl.apgCtrl );
+}
+
+} // anonymous namespace
+
+template<typename Real>
+Int LogisticRegression
+( const Matrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const LogisticRegressionCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> AAug;
+    linear_model::Augment( A, AAug );
+    return LogisticRegressionHelper( AAug, d, lambda, x, ctrl );
+}
+
+template<typename Real>
+Int LogisticRegression
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& dPre,
+        Real lambda,
+        AbstractDistMatrix<Real>& xPre,
+  const LogisticRegressionCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> dProx( dPre );
+    DistMatrixWriteProxy<Real,Real,MC,MR> xProx( xPre );
+    auto& d = dProx.GetLocked();
+    auto& x = xProx.Get();
+
+    DistMatrix<Real> AAug(A.Grid());
+    linear_model::Augment( A, AAug );
+    return LogisticRegressionHelper( AAug, d, lambda, x, ctrl );
+}
+
+template<typename Real>
+Int LogisticRegression
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const LogisticRegressionCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseMatrix<Real> AAug;
+    linear_model::Augment( A, AAug );
+    return LogisticRegressionHelper( AAug, d, lambda, x, ctrl );
+}
+
+template<typename Real>
+Int LogisticRegression
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& d,
+        Real lambda,
+        DistMultiVec<Real>& x,
+  const LogisticRegressionCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseMatrix<Real> AAug(A.Grid());
+    linear_model::Augment( A, AAug );
+    x.SetGrid( A.Grid() );
+    return LogisticRegressionHelper( AAug, d, lambda, x, ctrl );
+}
+
+#define PROTO(Real) \
+  template Int LogisticRegression \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& d, \
+          Real lambda, \
+          Matrix<Real>& x, \
+    const LogisticRegressionCtrl<Real>& ctrl ); \
+  template Int LogisticRegression \
+  ( const AbstractDistMatrix<Real>& A, \
+    const AbstractDistMatrix<Real>& d, \
+          Real lambda, \
+          AbstractDistMatrix<Real>& x, \
+    const LogisticRegressionCtrl<Real>& ctrl ); \
+  template Int LogisticRegression \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& d, \
+          Real lambda, \
+          Matrix<Real>& x, \
+    const LogisticRegressionCtrl<Real>& ctrl ); \
+  template Int LogisticRegression \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& d, \
+          Real lambda, \
+          DistMultiVec<Real>& x, \
+    const LogisticRegressionCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -7,13 +7,141 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./NMF/HALS.hpp"
+#include "./NMF/BPP.hpp"
 
 namespace El {
 
+namespace nmf {
+
+// Alternately update Y and X given the Gram matrix of the other factor and
+// the product of (the transpose of) A with it, i.e., Q = X^T X and P = A^T X
+// when updating Y and Q = Y^T Y and P = A Y when updating X. The local
+// block of A is combined with the rows of X which match its local rows and
+// the rows of Y which match its local columns, so that, for a 2D
+// distribution of A, each of P and Q is formed via a local Gemm and a
+// reduction over a single row or column of the process grid. Both X^T X
+// and Y^T Y are small and so each update of a factor is entirely local.
+// Since A is only accessed through its norm and the products A^T X and A Y,
+// it may also be sparse.
+
+template<typename Real>
+Real SquaredFrobeniusNorm( const Matrix<Real>& A )
+{ return Dot( A, A ); }
+
+template<typename Real>
+Real SquaredFrobeniusNorm( const SparseMatrix<Real>& A )
+{
+    const Real ANorm = FrobeniusNorm( A );
+    return ANorm*ANorm;
+}
+
+// P := op(A) B
+template<typename Real>
+void Product
+( Orientation orientation, const Matrix<Real>& A, const Matrix<Real>& B,
+  Matrix<Real>& P )
+{ Gemm( orientation, NORMAL, Real(1), A, B, P ); }
+
+template<typename Real>
+void Product
+( Orientation orientation, const SparseMatrix<Real>& A,
+  const Matrix<Real>& B, Matrix<Real>& P )
+{
+    const Int height = ( orientation == NORMAL ? A.Height() : A.Width() );
+    Zeros( P, height, B.Width() );
+    Multiply( orientation, Real(1), A, B, Real(0), P );
+}
+
+template<typename Real,class MatrixType,class UpdateType>
+void Alternate
+( const MatrixType& A,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        mpi::Comm colComm,
+        mpi::Comm rowComm,
+  const UpdateType& update,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int rank = X.Width();
+    const bool isRoot =
+      mpi::Rank(colComm) == 0 && mpi::Rank(rowComm) == 0;
+
+    Real ANormSquared = SquaredFrobeniusNorm( A );
+    ANormSquared = mpi::AllReduce( ANormSquared, colComm );
+    ANormSquared = mpi::AllReduce( ANormSquared, rowComm );
+    const Real ANorm = Sqrt( ANormSquared );
+
+    Zeros( Y, n, rank );
+    Matrix<Real> P, QX, QY;
+    Real lastRelResid = limits::Infinity<Real>();
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
+    {
+        // Y := argmin_{Y >= 0} || A - X Y^T ||_F
+        // =======================================
+        Product( TRANSPOSE, A, X, P );
+        AllReduce( P, colComm );
+        Gemm( TRANSPOSE, NORMAL, Real(1), X, X, QX );
+        AllReduce( QX, colComm );
+        update( QX, P, Y );
+        Gemm( TRANSPOSE, NORMAL, Real(1), Y, Y, QY );
+        AllReduce( QY, rowComm );
+
+        // || A - X Y^T ||_F^2 = || A ||_F^2 - 2 <Y, A^T X> + <X^T X, Y^T Y>
+        // ==================================================================
+        const Real cross = mpi::AllReduce( Dot(Y,P), rowComm );
+        const Real residSquared = ANormSquared - 2*cross + Dot(QX,QY);
+        const Real relResid =
+          ( ANorm == Real(0) ? Real(0) :
+            Sqrt(Max(residSquared,Real(0)))/ANorm );
+        if( ctrl.progress && isRoot )
+            Output("iter ",iter,": || A - X Y^T ||_F / || A ||_F = ",relResid);
+
+        // X := argmin_{X >= 0} || A - X Y^T ||_F
+        // =======================================
+        Product( NORMAL, A, Y, P );
+        AllReduce( P, rowComm );
+        update( QY, P, X );
+
+        if( lastRelResid-relResid <= ctrl.relTol )
+            break;
+        lastRelResid = relResid;
+    }
+}
+
+template<typename Real,class UpdateType>
+void Alternate
+( const DistMatrix<Real>& A,
+        DistMatrix<Real>& X,
+        DistMatrix<Real>& Y,
+  const UpdateType& update,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    DistMatrix<Real,MC,STAR> X_MC_STAR(grid);
+    X_MC_STAR.AlignWith( A );
+    X_MC_STAR = X;
+    DistMatrix<Real,MR,STAR> Y_MR_STAR(grid);
+    Y_MR_STAR.AlignWith( A );
+    Y_MR_STAR.Resize( A.Width(), X.Width() );
+
+    Alternate
+    ( A.LockedMatrix(), X_MC_STAR.Matrix(), Y_MR_STAR.Matrix(),
+      A.ColComm(), A.RowComm(), update, ctrl );
+
+    X = X_MC_STAR;
+    Y = Y_MR_STAR;
+}
+
+} // namespace nmf
+
 // TODO(poulson):
 // Better convergence criterions. E.g., accept a relative tolerance in addition
 // to the maximum number of iterations.
-
+// NOTE: Only NMF_HALS and NMF_BLOCK_PRINCIPAL_PIVOTING currently use relTol.
 template<typename Real>
 void NMF
 ( const Matrix<Real>& A,
@@ -22,6 +150,22 @@ void NMF
   const NMFCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.approach == NMF_HALS )
+    {
+        nmf::Alternate
+        ( A, X, Y, mpi::COMM_SELF, mpi::COMM_SELF,
+          nmf::HALS<Real>, ctrl );
+        return;
+    }
+    else if( ctrl.approach == NMF_BLOCK_PRINCIPAL_PIVOTING )
+    {
+        nmf::Alternate
+        ( A, X, Y, mpi::COMM_SELF, mpi::COMM_SELF,
+          nmf::BPP<Real>, ctrl );
+        return;
+    }
+    else if( ctrl.approach != NMF_ALTERNATING_NNLS )
+        LogicError("Unrecognized NMF approach");
 
     Matrix<Real> AAdj, XAdj, YAdj;
     Adjoint( A, AAdj );
@@ -35,6 +179,35 @@ void NMF
     }
 }
 
+template<typename Real>
+void NMF
+( const SparseMatrix<Real>& A,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == NMF_HALS )
+    {
+        nmf::Alternate
+        ( A, X, Y, mpi::COMM_SELF, mpi::COMM_SELF,
+          nmf::HALS<Real>, ctrl );
+    }
+    else if( ctrl.approach == NMF_BLOCK_PRINCIPAL_PIVOTING )
+    {
+        nmf::Alternate
+        ( A, X, Y, mpi::COMM_SELF, mpi::COMM_SELF,
+          nmf::BPP<Real>, ctrl );
+    }
+    else
+    {
+        // The general-purpose NNLS solvers require dense right-hand sides
+        Matrix<Real> ADense;
+        Copy( A, ADense );
+        NMF( ADense, X, Y, ctrl );
+    }
+}
+
 template<typename Real>
 void NMF
 ( const AbstractDistMatrix<Real>& APre,
@@ -54,6 +227,19 @@ void NMF
     auto& X = XProx.Get();
     auto& Y = YProx.Get();
 
+    if( ctrl.approach == NMF_HALS )
+    {
+        nmf::Alternate( A, X, Y, nmf::HALS<Real>, ctrl );
+        return;
+    }
+    else if( ctrl.approach == NMF_BLOCK_PRINCIPAL_PIVOTING )
+    {
+        nmf::Alternate( A, X, Y, nmf::BPP<Real>, ctrl );
+        return;
+    }
+    else if( ctrl.approach != NMF_ALTERNATING_NNLS )
+        LogicError("Unrecognized NMF approach");
+
     DistMatrix<Real> AAdj(A.Grid()), XAdj(A.Grid()), YAdj(A.Grid());
     Adjoint( A, AAdj );
 
@@ -73,6 +259,11 @@ void NMF
           Matrix<Real>& Y, \
     const NMFCtrl<Real>& ctrl ); \
   template void NMF \
+  ( const SparseMatrix<Real>& A, \
+          Matrix<Real>& X, \
+          Matrix<Real>& Y, \
+    const NMFCtrl<Real>& ctrl ); \
+  template void NMF \
   ( const AbstractDistMatrix<Real>& A, \
           AbstractDistMatrix<Real>& X, \
           AbstractDistMatrix<Real>& Y, \
@@ -0,0 +1,205 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Block Principal Pivoting [1] solves each of the non-negative least squares
+// problems
+//
+//   min || A - X Z^T ||_F, s.t. Z >= 0,
+//
+// (one per row of Z) through the equivalent linear complementarity problems
+//
+//   y = Q z - p, z >= 0, y >= 0, z^T y = 0,
+//
+// where Q = X^T X and p is the corresponding row of P = A^T X. Rather than
+// moving a single variable between the free (passive) and active sets per
+// step, all infeasible variables are exchanged, with the backup rule of
+// Judice and Pires falling back to single exchanges when the number of
+// infeasibilities stalls. Each step requires solving with Q restricted to the
+// free set, and so, as in [1], the problems which share a free set are solved
+// together with a single (small) Cholesky factorization. The previous Z is
+// used to initialize the free sets.
+//
+// [1] J. Kim and H. Park, "Fast nonnegative matrix factorization: An
+//     active-set-like method and comparisons", SIAM Journal on Scientific
+//     Computing, Vol. 33, No. 6, pp. 3261--3281, 2011.
+//
+
+namespace El {
+namespace nmf {
+namespace bpp {
+
+// Overwrite the requested columns of ZT with the solutions of the
+// unconstrained least squares problems over their free sets
+template<typename Real>
+void SolveFree
+( const Matrix<Real>& Q,
+  const Matrix<Real>& PT,
+  const vector<Int>& columns,
+  const vector<char>& free,
+        Matrix<Real>& ZT )
+{
+    EL_DEBUG_CSE
+    const Int rank = Q.Height();
+    std::map<vector<char>,vector<Int>> groups;
+    for( const Int j : columns )
+    {
+        vector<char> key( free.begin()+j*rank, free.begin()+(j+1)*rank );
+        groups[key].push_back( j );
+    }
+
+    vector<Int> freeInds;
+    Matrix<Real> QFree, RHS;
+    for( const auto& group : groups )
+    {
+        const auto& key = group.first;
+        const auto& groupCols = group.second;
+        const Int numCols = groupCols.size();
+        freeInds.resize( 0 );
+        for( Int i=0; i<rank; ++i )
+            if( key[i] )
+                freeInds.push_back( i );
+        const Int numFree = freeInds.size();
+        for( const Int j : groupCols )
+            for( Int i=0; i<rank; ++i )
+                ZT(i,j) = 0;
+        if( numFree == 0 )
+            continue;
+
+        QFree.Resize( numFree, numFree );
+        for( Int jFree=0; jFree<numFree; ++jFree )
+            for( Int iFree=0; iFree<numFree; ++iFree )
+                QFree(iFree,jFree) = Q(freeInds[iFree],freeInds[jFree]);
+        RHS.Resize( numFree, numCols );
+        for( Int jGroup=0; jGroup<numCols; ++jGroup )
+            for( Int iFree=0; iFree<numFree; ++iFree )
+                RHS(iFree,jGroup) = PT(freeInds[iFree],groupCols[jGroup]);
+
+        Cholesky( LOWER, QFree );
+        cholesky::SolveAfter( LOWER, NORMAL, QFree, RHS );
+
+        for( Int jGroup=0; jGroup<numCols; ++jGroup )
+            for( Int iFree=0; iFree<numFree; ++iFree )
+                ZT(freeInds[iFree],groupCols[jGroup]) = RHS(iFree,jGroup);
+    }
+}
+
+} // namespace bpp
+
+template<typename Real>
+void BPP
+( const Matrix<Real>& Q,
+  const Matrix<Real>& P,
+        Matrix<Real>& Z )
+{
+    EL_DEBUG_CSE
+    const Int height = Z.Height();
+    const Int rank = Z.Width();
+    if( height == 0 || rank == 0 )
+        return;
+
+    // Ensure that every principal submatrix of Q can be factored, even if
+    // some of the columns of X are zero (or nearly linearly dependent)
+    auto QReg = Q;
+    {
+        auto d = GetDiagonal( Q );
+        const Real shift =
+          rank*limits::Epsilon<Real>()*Max(MaxNorm(d),Real(1));
+        ShiftDiagonal( QReg, shift );
+    }
+
+    Matrix<Real> PT, ZT;
+    Transpose( P, PT );
+    Transpose( Z, ZT );
+
+    // Warm-start the free sets with the support of the previous iterate
+    vector<char> free(rank*height);
+    for( Int j=0; j<height; ++j )
+        for( Int i=0; i<rank; ++i )
+            free[i+j*rank] = ( ZT(i,j) > Real(0) );
+    vector<Int> backupCount(height,3), minInfeasible(height,rank+1);
+    vector<Int> columns(height);
+    for( Int j=0; j<height; ++j )
+        columns[j] = j;
+    bpp::SolveFree( QReg, PT, columns, free, ZT );
+
+    Matrix<Real> YT;
+    const Int maxSteps = 100*(rank+1);
+    for( Int step=0; step<maxSteps; ++step )
+    {
+        // YT := Q ZT - PT over the columns that have not yet converged
+        const Int numActive = columns.size();
+        Matrix<Real> ZActive, PActive;
+        Zeros( ZActive, rank, numActive );
+        Zeros( PActive, rank, numActive );
+        for( Int jActive=0; jActive<numActive; ++jActive )
+            for( Int i=0; i<rank; ++i )
+            {
+                ZActive(i,jActive) = ZT(i,columns[jActive]);
+                PActive(i,jActive) = PT(i,columns[jActive]);
+            }
+        YT = PActive;
+        Gemm( NORMAL, NORMAL, Real(1), QReg, ZActive, Real(-1), YT );
+
+        // Exchange the infeasible variables of each column
+        vector<Int> newColumns;
+        for( Int jActive=0; jActive<numActive; ++jActive )
+        {
+            const Int j = columns[jActive];
+            char* freeCol = &free[j*rank];
+            Int numInfeasible = 0, lastInfeasible = -1;
+            for( Int i=0; i<rank; ++i )
+            {
+                const bool infeasible =
+                  freeCol[i] ? ZT(i,j) < Real(0) : YT(i,jActive) < Real(0);
+                if( infeasible )
+                {
+                    ++numInfeasible;
+                    lastInfeasible = i;
+                }
+            }
+            if( numInfeasible == 0 )
+                continue;
+            newColumns.push_back( j );
+
+            if( numInfeasible < minInfeasible[j] )
+            {
+                minInfeasible[j] = numInfeasible;
+                backupCount[j] = 3;
+            }
+            else if( backupCount[j] > 0 )
+            {
+                --backupCount[j];
+            }
+            else
+            {
+                // Fall back to exchanging the last infeasible variable
+                freeCol[lastInfeasible] = !freeCol[lastInfeasible];
+                continue;
+            }
+            for( Int i=0; i<rank; ++i )
+            {
+                const bool infeasible =
+                  freeCol[i] ? ZT(i,j) < Real(0) : YT(i,jActive) < Real(0);
+                if( infeasible )
+                    freeCol[i] = !freeCol[i];
+            }
+        }
+        columns = newColumns;
+        if( columns.empty() )
+        {
+            Transpose( ZT, Z );
+            return;
+        }
+        bpp::SolveFree( QReg, PT, columns, free, ZT );
+    }
+    RuntimeError("Block principal pivoting did not converge");
+}
+
+} // namespace nmf
+} // namespace El
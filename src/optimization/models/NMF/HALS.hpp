@@ -0,0 +1,58 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Hierarchical Alternating Least Squares [1] updates each column of the
+// factor Z in turn with the exact minimizer of
+//
+//   min || A - X Z^T ||_F, s.t. Z >= 0,
+//
+// over that column, i.e.,
+//
+//   z_k := max(0, z_k + (p_k - Z q_k) / Q(k,k)),
+//
+// where P = A^T X and Q = X^T X. Since P and Q are fixed over the sweep,
+// each row of Z is updated independently, and so the (local) rows of Z can
+// be swept over without any communication.
+//
+// [1] A. Cichocki and A.-H. Phan, "Fast local algorithms for large scale
+//     nonnegative matrix and tensor factorizations", IEICE Transactions on
+//     Fundamentals of Electronics, Communications and Computer Sciences,
+//     Vol. E92-A, No. 3, pp. 708--721, 2009.
+//
+
+namespace El {
+namespace nmf {
+
+template<typename Real>
+void HALS
+( const Matrix<Real>& Q,
+  const Matrix<Real>& P,
+        Matrix<Real>& Z )
+{
+    EL_DEBUG_CSE
+    const Int rank = Z.Width();
+    Matrix<Real> t;
+    for( Int k=0; k<rank; ++k )
+    {
+        // Leave the column alone if the corresponding column of X is zero
+        const Real diag = Q(k,k);
+        if( diag <= Real(0) )
+            continue;
+
+        // z_k := max(0, z_k + (p_k - Z q_k) / Q(k,k))
+        auto zk = Z( ALL, IR(k) );
+        t = P( ALL, IR(k) );
+        Gemv( NORMAL, Real(-1), Z, Q(ALL,IR(k)), Real(1), t );
+        Axpy( Real(1)/diag, t, zk );
+        LowerClip( zk, Real(0) );
+    }
+}
+
+} // namespace nmf
+} // namespace El
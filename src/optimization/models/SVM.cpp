@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 #include "./SVM/IPM.hpp"
+#include "./SVM/DCD.hpp"
+#include "./SVM/APG.hpp"
 
 namespace El {
 
@@ -20,7 +22,14 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_IPM )
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    else if( ctrl.approach == SVM_DUAL_COORDINATE_DESCENT )
+        svm::DCD( A, d, lambda, x, ctrl.dcdCtrl );
+    else if( ctrl.approach == SVM_ACCELERATED_PROXIMAL_GRADIENT )
+        svm::APG( A, d, lambda, x, ctrl.apgCtrl );
+    else
+        LogicError("Unrecognized SVM approach");
 }
 
 template<typename Real>
@@ -32,7 +41,14 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_IPM )
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    else if( ctrl.approach == SVM_DUAL_COORDINATE_DESCENT )
+        svm::DCD( A, d, lambda, x, ctrl.dcdCtrl );
+    else if( ctrl.approach == SVM_ACCELERATED_PROXIMAL_GRADIENT )
+        svm::APG( A, d, lambda, x, ctrl.apgCtrl );
+    else
+        LogicError("Unrecognized SVM approach");
 }
 
 template<typename Real>
@@ -44,7 +60,14 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_IPM )
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    else if( ctrl.approach == SVM_DUAL_COORDINATE_DESCENT )
+        svm::DCD( A, d, lambda, x, ctrl.dcdCtrl );
+    else if( ctrl.approach == SVM_ACCELERATED_PROXIMAL_GRADIENT )
+        svm::APG( A, d, lambda, x, ctrl.apgCtrl );
+    else
+        LogicError("Unrecognized SVM approach");
 }
 
 template<typename Real>
@@ -56,7 +79,14 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_IPM )
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    else if( ctrl.approach == SVM_DUAL_COORDINATE_DESCENT )
+        svm::DCD( A, d, lambda, x, ctrl.dcdCtrl );
+    else if( ctrl.approach == SVM_ACCELERATED_PROXIMAL_GRADIENT )
+        svm::APG( A, d, lambda, x, ctrl.apgCtrl );
+    else
+        LogicError("Unrecognized SVM approach");
 }
 
 #define PROTO(Real) \
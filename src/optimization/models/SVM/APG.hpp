@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../util/LinearModel.hpp"
+
+// Accelerated projected gradient for the box-constrained dual of the
+// soft-margin SVM,
+//
+//   min_alpha f(alpha) = (1/2) || AAug^T diag(d) alpha ||_2^2 - 1^T alpha,
+//   s.t. 0 <= alpha <= lambda,
+//
+// where AAug = [A, ones(m,1)], whose gradient is
+//
+//   grad f(alpha) = diag(d) AAug x - 1, with x = AAug^T diag(d) alpha.
+//
+// Since only products with AAug and its transpose are required, the feature
+// matrix keeps its native distribution, and the projection onto the box is
+// a clip. The primal solution is then x = [w; beta].
+//
+
+namespace El {
+namespace svm {
+
+template<typename Real,class MatrixType,class VectorType>
+Int APGHelper
+( const MatrixType& AAug,
+  const VectorType& d,
+        Real lambda,
+        VectorType& x,
+  const APGCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = AAug.Height();
+
+    auto alpha = d;
+    Zeros( alpha, m, 1 );
+    auto ones = d;
+    Fill( ones, Real(1) );
+    auto t = d;
+
+    // x := AAug^T diag(d) alpha
+    auto primal =
+      [&]( const VectorType& alpha )
+      {
+          t = alpha;
+          DiagonalScale( LEFT, NORMAL, d, t );
+          linear_model::Apply( TRANSPOSE, AAug, t, x );
+      };
+    auto value =
+      [&]( const VectorType& alpha ) -> Real
+      {
+          primal( alpha );
+          return Dot(x,x)/2 - Dot(ones,alpha);
+      };
+    auto smooth =
+      [&]( const VectorType& alpha, VectorType& gradient ) -> Real
+      {
+          const Real f = value( alpha );
+          linear_model::Apply( NORMAL, AAug, x, gradient );
+          DiagonalScale( LEFT, NORMAL, d, gradient );
+          Shift( gradient, Real(-1) );
+          return f;
+      };
+    auto prox =
+      [&]( Real, VectorType& alpha ) { Clip( alpha, Real(0), lambda ); };
+    auto nonsmooth = []( const VectorType& ) { return Real(0); };
+
+    const Int numIter =
+      El::APG<Real>( smooth, value, prox, nonsmooth, alpha, ctrl );
+    primal( alpha );
+    return numIter;
+}
+
+template<typename Real>
+void APG
+( const Matrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const APGCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> AAug;
+    linear_model::Augment( A, AAug );
+    APGHelper( AAug, d, lambda, x, ctrl );
+}
+
+template<typename Real>
+void APG
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& dPre,
+        Real lambda,
+        AbstractDistMatrix<Real>& xPre,
+  const APGCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> dProx( dPre );
+    DistMatrixWriteProxy<Real,Real,MC,MR> xProx( xPre );
+    auto& d = dProx.GetLocked();
+    auto& x = xProx.Get();
+
+    DistMatrix<Real> AAug(A.Grid());
+    linear_model::Augment( A, AAug );
+    APGHelper( AAug, d, lambda, x, ctrl );
+}
+
+template<typename Real>
+void APG
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const APGCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseMatrix<Real> AAug;
+    linear_model::Augment( A, AAug );
+    APGHelper( AAug, d, lambda, x, ctrl );
+}
+
+template<typename Real>
+void APG
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& d,
+        Real lambda,
+        DistMultiVec<Real>& x,
+  const APGCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseMatrix<Real> AAug(A.Grid());
+    linear_model::Augment( A, AAug );
+    x.SetGrid( A.Grid() );
+    APGHelper( AAug, d, lambda, x, ctrl );
+}
+
+} // namespace svm
+} // namespace El
@@ -0,0 +1,299 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../util/LinearModel.hpp"
+
+// Dual coordinate descent [1] for the dual of the soft-margin SVM,
+//
+//   min_alpha (1/2) || AAug^T diag(d) alpha ||_2^2 - 1^T alpha,
+//   s.t. 0 <= alpha <= lambda,
+//
+// where AAug = [A, ones(m,1)], while maintaining the primal solution
+// x = [w; beta] = AAug^T diag(d) alpha. Each process sweeps over its own
+// samples (in a random order) against its local copy of x, and the updates
+// are then summed as in the 'adding' variant of CoCoA+ [2], which scales the
+// local curvature by the number of processes. On a single process, this
+// reduces to the sequential algorithm of [1].
+//
+// [1] C.-J. Hsieh, K.-W. Chang, C.-J. Lin, S.S. Keerthi, and S. Sundararajan,
+//     "A dual coordinate descent method for large-scale linear SVM",
+//     Proceedings of the 25th International Conference on Machine Learning,
+//     pp. 408--415, 2008.
+//
+// [2] C. Ma, V. Smith, M. Jaggi, M.I. Jordan, P. Richtarik, and M. Takac,
+//     "Adding vs. averaging in distributed primal-dual optimization",
+//     Proceedings of the 32nd International Conference on Machine Learning,
+//     pp. 1973--1982, 2015.
+//
+
+namespace El {
+namespace svm {
+namespace dcd {
+
+// The local samples stored as the columns of a dense matrix
+template<typename Real>
+class DenseSamples
+{
+public:
+    DenseSamples( const Matrix<Real>& ALoc ) { Transpose( ALoc, samples_ ); }
+
+    Int NumSamples() const { return samples_.Width(); }
+
+    Real Dot( Int i, const Matrix<Real>& x ) const
+    {
+        return blas::Dot
+          ( samples_.Height(), samples_.LockedBuffer(0,i), 1,
+            x.LockedBuffer(), 1 );
+    }
+
+    void Axpy( Real alpha, Int i, Matrix<Real>& x ) const
+    {
+        blas::Axpy
+        ( samples_.Height(), alpha, samples_.LockedBuffer(0,i), 1,
+          x.Buffer(), 1 );
+    }
+
+    Real NormSquared( Int i ) const
+    {
+        const Real* a = samples_.LockedBuffer(0,i);
+        return blas::Dot( samples_.Height(), a, 1, a, 1 );
+    }
+
+private:
+    Matrix<Real> samples_;
+};
+
+// The local samples stored as the rows of a compressed sparse matrix
+template<typename Real>
+class SparseSamples
+{
+public:
+    SparseSamples
+    ( Int numSamples,
+      const Int* offsets,
+      const Int* targets,
+      const Real* values )
+    : numSamples_(numSamples), offsets_(offsets), targets_(targets),
+      values_(values)
+    { }
+
+    Int NumSamples() const { return numSamples_; }
+
+    Real Dot( Int i, const Matrix<Real>& x ) const
+    {
+        Real gamma = 0;
+        for( Int e=offsets_[i]; e<offsets_[i+1]; ++e )
+            gamma += values_[e]*x(targets_[e]);
+        return gamma;
+    }
+
+    void Axpy( Real alpha, Int i, Matrix<Real>& x ) const
+    {
+        for( Int e=offsets_[i]; e<offsets_[i+1]; ++e )
+            x(targets_[e]) += alpha*values_[e];
+    }
+
+    Real NormSquared( Int i ) const
+    {
+        Real gamma = 0;
+        for( Int e=offsets_[i]; e<offsets_[i+1]; ++e )
+            gamma += values_[e]*values_[e];
+        return gamma;
+    }
+
+private:
+    Int numSamples_;
+    const Int* offsets_;
+    const Int* targets_;
+    const Real* values_;
+};
+
+// Overwrite the replicated vector x with the solution
+template<typename Real,class SamplesType>
+Int Solve
+( const SamplesType& samples,
+  const Matrix<Real>& dLoc,
+        Real lambda,
+        Matrix<Real>& x,
+        mpi::Comm comm,
+  const DCDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numLocal = samples.NumSamples();
+    const Int xHeight = x.Height();
+    const Real sigma = mpi::Size( comm );
+    const bool root = mpi::Rank( comm ) == 0;
+
+    Matrix<Real> alpha, diagQ;
+    Zeros( alpha, numLocal, 1 );
+    Zeros( diagQ, numLocal, 1 );
+    for( Int i=0; i<numLocal; ++i )
+        diagQ(i) = sigma*samples.NormSquared(i);
+    Zeros( x, xHeight, 1 );
+
+    vector<Int> order( numLocal );
+    for( Int i=0; i<numLocal; ++i )
+        order[i] = i;
+
+    // Each sweep updates xLoc := x + sigma dx, where dx is the change in x
+    // due to the local samples
+    Matrix<Real> xLoc;
+    Int numIter=0;
+    while( true )
+    {
+        std::shuffle( order.begin(), order.end(), Generator() );
+        xLoc = x;
+        for( Int k=0; k<numLocal; ++k )
+        {
+            const Int i = order[k];
+            if( diagQ(i) == Real(0) )
+                continue;
+            const Real gradient = dLoc(i)*samples.Dot(i,xLoc) - 1;
+            const Real alphaNew =
+              Min( Max( alpha(i)-gradient/diagQ(i), Real(0) ), lambda );
+            const Real delta = alphaNew - alpha(i);
+            if( delta != Real(0) )
+            {
+                alpha(i) = alphaNew;
+                samples.Axpy( sigma*delta*dLoc(i), i, xLoc );
+            }
+        }
+        // x := x + sum_k dx_k
+        xLoc -= x;
+        xLoc *= 1/sigma;
+        mpi::AllReduce( xLoc.Buffer(), xHeight, comm );
+        x += xLoc;
+        ++numIter;
+
+        // Compute the primal and dual objectives,
+        //   (1/2) || x ||_2^2 + lambda sum_i max(0,1-d_i aAug_i^T x), and
+        //   1^T alpha - (1/2) || x ||_2^2.
+        Real sums[2] = { Real(0), Real(0) };
+        for( Int i=0; i<numLocal; ++i )
+        {
+            sums[0] += Max( 1-dLoc(i)*samples.Dot(i,x), Real(0) );
+            sums[1] += alpha(i);
+        }
+        mpi::AllReduce( sums, 2, comm );
+        const Real xNorm = FrobeniusNorm( x );
+        const Real primal = xNorm*xNorm/2 + lambda*sums[0];
+        const Real dual = sums[1] - xNorm*xNorm/2;
+        const Real gap = primal - dual;
+        if( ctrl.progress && root )
+            Output
+            ("iter ",numIter,": primal=",primal,", dual=",dual,", gap=",gap);
+        if( gap <= ctrl.relTol*Max(Abs(primal),Real(1)) )
+            break;
+        if( numIter == ctrl.maxIter )
+            RuntimeError("Dual coordinate descent failed to converge");
+    }
+    return numIter;
+}
+
+} // namespace dcd
+
+template<typename Real>
+void DCD
+( const Matrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const DCDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> AAug;
+    linear_model::Augment( A, AAug );
+    dcd::DenseSamples<Real> samples( AAug );
+    Zeros( x, AAug.Width(), 1 );
+    dcd::Solve( samples, d, lambda, x, mpi::COMM_SELF, ctrl );
+}
+
+template<typename Real>
+void DCD
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& d,
+        Real lambda,
+        AbstractDistMatrix<Real>& x,
+  const DCDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+
+    // Distribute the samples (and labels) in a cyclic manner
+    DistMatrix<Real,VC,STAR> AAug_VC_STAR(grid), d_VC_STAR(grid);
+    {
+        DistMatrix<Real> AAug(grid);
+        linear_model::Augment( A, AAug );
+        AAug_VC_STAR = AAug;
+    }
+    d_VC_STAR.AlignWith( AAug_VC_STAR );
+    d_VC_STAR = d;
+    dcd::DenseSamples<Real> samples( AAug_VC_STAR.LockedMatrix() );
+
+    DistMatrix<Real,STAR,STAR> x_STAR_STAR( A.Width()+1, 1, grid );
+    dcd::Solve
+    ( samples, d_VC_STAR.LockedMatrix(), lambda, x_STAR_STAR.Matrix(),
+      grid.VCComm(), ctrl );
+    Copy( x_STAR_STAR, x );
+}
+
+template<typename Real>
+void DCD
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const DCDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseMatrix<Real> AAug;
+    linear_model::Augment( A, AAug );
+    dcd::SparseSamples<Real> samples
+    ( AAug.Height(), AAug.LockedOffsetBuffer(), AAug.LockedTargetBuffer(),
+      AAug.LockedValueBuffer() );
+    Zeros( x, AAug.Width(), 1 );
+    dcd::Solve( samples, d, lambda, x, mpi::COMM_SELF, ctrl );
+}
+
+template<typename Real>
+void DCD
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& d,
+        Real lambda,
+        DistMultiVec<Real>& x,
+  const DCDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    if( d.FirstLocalRow() != A.FirstLocalRow() ||
+        d.LocalHeight() != A.LocalHeight() )
+        LogicError("The rows of A and d were not distributed alike");
+
+    // The samples are already distributed by contiguous blocks of rows
+    DistSparseMatrix<Real> AAug(grid);
+    linear_model::Augment( A, AAug );
+    dcd::SparseSamples<Real> samples
+    ( AAug.LocalHeight(), AAug.LockedOffsetBuffer(),
+      AAug.LockedTargetBuffer(), AAug.LockedValueBuffer() );
+
+    const Int xHeight = AAug.Width();
+    Matrix<Real> xRep;
+    Zeros( xRep, xHeight, 1 );
+    dcd::Solve
+    ( samples, d.LockedMatrix(), lambda, xRep, grid.Comm(), ctrl );
+
+    x.SetGrid( grid );
+    Zeros( x, xHeight, 1 );
+    auto& xLoc = x.Matrix();
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+        xLoc(iLoc) = xRep(x.GlobalRow(iLoc));
+}
+
+} // namespace svm
+} // namespace El
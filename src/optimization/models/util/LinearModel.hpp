@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_MODELS_UTIL_LINEARMODEL_HPP
+#define EL_OPTIMIZATION_MODELS_UTIL_LINEARMODEL_HPP
+
+// Utilities for the first-order solvers of models which are linear in the
+// features, i.e., which only involve the rows a_i of A through
+// a_i^T w + beta. Appending a column of ones to A allows x = [w; beta] to be
+// treated as a single vector.
+
+namespace El {
+namespace linear_model {
+
+// AAug := [A, ones(m,1)]
+// ======================
+template<typename Real>
+void Augment( const Matrix<Real>& A, Matrix<Real>& AAug )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( AAug, m, n+1 );
+    auto AAugLeft = AAug( ALL, IR(0,n) );
+    AAugLeft = A;
+    auto AAugRight = AAug( ALL, IR(n) );
+    Fill( AAugRight, Real(1) );
+}
+
+template<typename Real>
+void Augment( const AbstractDistMatrix<Real>& A, DistMatrix<Real>& AAug )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    AAug.SetGrid( A.Grid() );
+    Zeros( AAug, m, n+1 );
+    auto AAugLeft = AAug( ALL, IR(0,n) );
+    Copy( A, AAugLeft );
+    auto AAugRight = AAug( ALL, IR(n) );
+    Fill( AAugRight, Real(1) );
+}
+
+template<typename Real>
+void Augment( const SparseMatrix<Real>& A, SparseMatrix<Real>& AAug )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( AAug, m, n+1 );
+    AAug.Reserve( A.NumEntries()+m );
+    for( Int e=0; e<A.NumEntries(); ++e )
+        AAug.QueueUpdate( A.Row(e), A.Col(e), A.Value(e) );
+    for( Int i=0; i<m; ++i )
+        AAug.QueueUpdate( i, n, Real(1) );
+    AAug.ProcessQueues();
+}
+
+template<typename Real>
+void Augment( const DistSparseMatrix<Real>& A, DistSparseMatrix<Real>& AAug )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int localHeight = A.LocalHeight();
+    AAug.SetGrid( A.Grid() );
+    Zeros( AAug, m, n+1 );
+    AAug.Reserve( A.NumLocalEntries()+localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int rowBeg = A.RowOffset(iLoc);
+        const Int rowEnd = A.RowOffset(iLoc+1);
+        for( Int e=rowBeg; e<rowEnd; ++e )
+            AAug.QueueLocalUpdate( iLoc, A.Col(e), A.Value(e) );
+        AAug.QueueLocalUpdate( iLoc, n, Real(1) );
+    }
+    AAug.ProcessLocalQueues();
+}
+
+// y := A x or y := A^T x
+// ======================
+template<typename Real>
+void Apply
+( Orientation orientation,
+  const Matrix<Real>& A,
+  const Matrix<Real>& x,
+        Matrix<Real>& y )
+{
+    EL_DEBUG_CSE
+    Gemv( orientation, Real(1), A, x, y );
+}
+
+template<typename Real>
+void Apply
+( Orientation orientation,
+  const DistMatrix<Real>& A,
+  const DistMatrix<Real>& x,
+        DistMatrix<Real>& y )
+{
+    EL_DEBUG_CSE
+    Gemv( orientation, Real(1), A, x, y );
+}
+
+template<typename Real>
+void Apply
+( Orientation orientation,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& x,
+        Matrix<Real>& y )
+{
+    EL_DEBUG_CSE
+    Zeros( y, orientation==NORMAL ? A.Height() : A.Width(), 1 );
+    Multiply( orientation, Real(1), A, x, Real(0), y );
+}
+
+template<typename Real>
+void Apply
+( Orientation orientation,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y )
+{
+    EL_DEBUG_CSE
+    Zeros( y, orientation==NORMAL ? A.Height() : A.Width(), 1 );
+    Multiply( orientation, Real(1), A, x, Real(0), y );
+}
+
+// Set 'mask' to a vector of ones of the given height whose last entry is zero
+// (so that the penalty on w does not involve beta)
+template<typename Real,class VectorType>
+void PenaltyMask( VectorType& mask, Int height )
+{
+    EL_DEBUG_CSE
+    Ones( mask, height, 1 );
+    mask.Set( height-1, 0, Real(0) );
+}
+
+} // namespace linear_model
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_MODELS_UTIL_LINEARMODEL_HPP
@@ -12,6 +12,7 @@
 #include "./SVT/Cross.hpp"
 #include "./SVT/PivotedQR.hpp"
 #include "./SVT/TSQR.hpp"
+#include "./SVT/Partial.hpp"
 
 namespace El {
 
@@ -85,6 +86,12 @@ Int SVT( DistMatrix<Field,U,STAR>& A, const Base<Field>& tau, bool relative )
     bool relative ); \
   template Int svt::TSQR \
   ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, bool relative ); \
+  template Int svt::Partial \
+  ( Matrix<Field>& A, const Base<Field>& tau, Matrix<Field>& V, \
+    const svt::PartialCtrl& ctrl, bool relative ); \
+  template Int svt::Partial \
+  ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, \
+    DistMatrix<Field>& V, const svt::PartialCtrl& ctrl, bool relative ); \
   PROTO_DIST(Field,MC  ) \
   PROTO_DIST(Field,MD  ) \
   PROTO_DIST(Field,MR  ) \
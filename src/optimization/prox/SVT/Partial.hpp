@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_PARTIAL_HPP
+#define EL_SVT_PARTIAL_HPP
+
+namespace El {
+namespace svt {
+
+// Only compute the singular triplets above the threshold via (randomized)
+// subspace iteration on the dominant right singular subspace, e.g., as in
+// Algorithm 4.4 of
+//
+//   N. Halko, P.G. Martinsson, and J.A. Tropp,
+//   "Finding structure with randomness: Probabilistic algorithms for
+//    constructing approximate matrix decompositions",
+//   SIAM Review, Vol. 53, No. 2, pp. 217--288, 2011.
+//
+// The subspace is doubled until at least one of its Ritz values falls below
+// the threshold and, on exit, V is overwritten with the leading
+// rank+oversample right singular vectors so that the next call (e.g., within
+// the following iteration of an ADMM method) starts from a good
+// approximation of the dominant subspace with an appropriate width.
+
+namespace partial {
+
+template<typename Field,class BlockType,class RealBlockType>
+Int SVT
+( BlockType& A,
+  const Base<Field>& tau,
+  BlockType& V,
+  RealBlockType& s,
+  const PartialCtrl& ctrl,
+  bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+        return 0;
+
+    Int width = V.Width();
+    if( V.Height() != n || width == 0 || width > minDim )
+    {
+        width = Min( ctrl.initialRank+ctrl.oversample, minDim );
+        Gaussian( V, n, width );
+    }
+
+    auto Q = randomized::NewBlock( A );
+    auto Z = randomized::NewBlock( A );
+    auto UHat = randomized::NewBlock( A );
+    auto VHat = randomized::NewBlock( A );
+    SVDCtrl<Real> svdCtrl;
+    svdCtrl.overwrite = true;
+    svdCtrl.bidiagSVDCtrl.approach = THIN_SVD;
+
+    Real thresh = tau;
+    Int rank = 0;
+    while( true )
+    {
+        // Q := orth(A (A^H A)^q V)
+        // ========================
+        qr::ExplicitUnitary( V );
+        for( Int powerIt=0; powerIt<=ctrl.numPower; ++powerIt )
+        {
+            Gemm( NORMAL, NORMAL, Field(1), A, V, Q );
+            qr::ExplicitUnitary( Q );
+            if( powerIt == ctrl.numPower )
+                break;
+            Gemm( ADJOINT, NORMAL, Field(1), A, Q, V );
+            qr::ExplicitUnitary( V );
+        }
+
+        // A ~= Q (A^H Q)^H = (Q VHat) diag(s) UHat^H
+        // ==========================================
+        Gemm( ADJOINT, NORMAL, Field(1), A, Q, Z );
+        El::SVD( Z, UHat, s, VHat, svdCtrl );
+        thresh = ( relative ? tau*s.Get(0,0) : tau );
+        rank = 0;
+        while( rank < width && s.Get(rank,0) > thresh )
+            ++rank;
+        if( rank < width || width == minDim )
+            break;
+
+        // Every Ritz value exceeded the threshold, so double the subspace
+        // -------------------------------------------------------------
+        const Int newWidth = Min( 2*width, minDim );
+        Gaussian( V, n, newWidth );
+        auto VL = V( ALL, IR(0,width) );
+        VL = UHat;
+        width = newWidth;
+    }
+
+    // A := (Q VHat_L) diag(s_L - thresh) UHat_L^H
+    // ===========================================
+    if( rank == 0 )
+        Zero( A );
+    else
+    {
+        auto sL = s( IR(0,rank), ALL );
+        auto sMap = [=]( const Real& sigma ) { return sigma-thresh; };
+        EntrywiseMap( sL, function<Real(const Real&)>(sMap) );
+        auto VHatL = VHat( ALL, IR(0,rank) );
+        auto UHatL = UHat( ALL, IR(0,rank) );
+        auto U = randomized::NewBlock( A );
+        Gemm( NORMAL, NORMAL, Field(1), Q, VHatL, U );
+        DiagonalScale( RIGHT, NORMAL, sL, U );
+        Gemm( NORMAL, ADJOINT, Field(1), U, UHatL, Field(0), A );
+    }
+
+    // Predict the rank of the next call
+    // =================================
+    const Int nextWidth = Min( Max(rank,Int(1))+ctrl.oversample, minDim );
+    const Int numKept = Min( nextWidth, width );
+    auto UHatKept = UHat( ALL, IR(0,numKept) );
+    auto VNext = randomized::NewBlock( A );
+    Gaussian( VNext, n, nextWidth );
+    auto VNextL = VNext( ALL, IR(0,numKept) );
+    VNextL = UHatKept;
+    V = VNext;
+
+    return rank;
+}
+
+} // namespace partial
+
+template<typename Field>
+Int Partial
+( Matrix<Field>& A,
+  const Base<Field>& tau,
+  Matrix<Field>& V,
+  const PartialCtrl& ctrl,
+  bool relative )
+{
+    EL_DEBUG_CSE
+    Matrix<Base<Field>> s;
+    return partial::SVT<Field>( A, tau, V, s, ctrl, relative );
+}
+
+template<typename Field>
+Int Partial
+( AbstractDistMatrix<Field>& APre,
+  const Base<Field>& tau,
+  DistMatrix<Field>& V,
+  const PartialCtrl& ctrl,
+  bool relative )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    if( A.Grid() != V.Grid() )
+        LogicError("A and V must be distributed over the same grid");
+    DistMatrix<Base<Field>,STAR,STAR> s( A.Grid() );
+    return partial::SVT<Field>( A, tau, V, s, ctrl, relative );
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_PARTIAL_HPP
@@ -105,6 +105,10 @@ ElError ElADMMCtrlDefault_s( ElADMMCtrl_s* ctrl )
     ctrl->relTol = 1e-2;
     ctrl->inv = true;
     ctrl->print = true;
+    ctrl->adaptiveRho = false;
+    ctrl->rhoBalance = 10;
+    ctrl->rhoScale = 2;
+    ctrl->andersonDepth = 0;
     return EL_SUCCESS;
 }
 
@@ -117,6 +121,62 @@ ElError ElADMMCtrlDefault_d( ElADMMCtrl_d* ctrl )
     ctrl->relTol = 1e-4;
     ctrl->inv = true;
     ctrl->print = true;
+    ctrl->adaptiveRho = false;
+    ctrl->rhoBalance = 10;
+    ctrl->rhoScale = 2;
+    ctrl->andersonDepth = 0;
+    return EL_SUCCESS;
+}
+
+/* Accelerated Proximal Gradient
+   ============================= */
+ElError ElAPGCtrlDefault_s( ElAPGCtrl_s* ctrl )
+{
+    ctrl->maxIter = 1000;
+    ctrl->relTol = 1e-6;
+    ctrl->lipschitz = 1;
+    ctrl->backtrackFactor = 2;
+    ctrl->restart = true;
+    ctrl->print = false;
+    return EL_SUCCESS;
+}
+
+ElError ElAPGCtrlDefault_d( ElAPGCtrl_d* ctrl )
+{
+    ctrl->maxIter = 1000;
+    ctrl->relTol = 1e-6;
+    ctrl->lipschitz = 1;
+    ctrl->backtrackFactor = 2;
+    ctrl->restart = true;
+    ctrl->print = false;
+    return EL_SUCCESS;
+}
+
+/* Presolve
+   ======== */
+ElError ElPresolveCtrlDefault_s( ElPresolveCtrl_s* ctrl )
+{
+    ctrl->removeEmptyRows = true;
+    ctrl->removeEmptyColumns = true;
+    ctrl->removeSingletonRows = true;
+    ctrl->removeForcingRows = true;
+    ctrl->removeDuplicateRows = true;
+    ctrl->maxPasses = 20;
+    ctrl->tol = Pow(limits::Epsilon<float>(),float(0.75));
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+
+ElError ElPresolveCtrlDefault_d( ElPresolveCtrl_d* ctrl )
+{
+    ctrl->removeEmptyRows = true;
+    ctrl->removeEmptyColumns = true;
+    ctrl->removeSingletonRows = true;
+    ctrl->removeForcingRows = true;
+    ctrl->removeDuplicateRows = true;
+    ctrl->maxPasses = 20;
+    ctrl->tol = Pow(limits::Epsilon<double>(),double(0.75));
+    ctrl->progress = false;
     return EL_SUCCESS;
 }
 
@@ -134,6 +194,8 @@ ElError ElLPDirectCtrlDefault_s( ElLPDirectCtrl_s* ctrl, bool isSparse )
         ctrl->mehrotraCtrl.system = EL_AUGMENTED_KKT;
     else
         ctrl->mehrotraCtrl.system = EL_NORMAL_KKT;
+    ctrl->presolve = false;
+    ElPresolveCtrlDefault_s( &ctrl->presolveCtrl );
     return EL_SUCCESS;
 }
 
@@ -146,6 +208,8 @@ ElError ElLPDirectCtrlDefault_d( ElLPDirectCtrl_d* ctrl, bool isSparse )
         ctrl->mehrotraCtrl.system = EL_AUGMENTED_KKT;
     else
         ctrl->mehrotraCtrl.system = EL_NORMAL_KKT;
+    ctrl->presolve = false;
+    ElPresolveCtrlDefault_d( &ctrl->presolveCtrl );
     return EL_SUCCESS;
 }
 
@@ -155,6 +219,8 @@ ElError ElLPAffineCtrlDefault_s( ElLPAffineCtrl_s* ctrl )
 {
     ctrl->approach = EL_LP_MEHROTRA;
     ElMehrotraCtrlDefault_s( &ctrl->mehrotraCtrl );
+    ctrl->presolve = false;
+    ElPresolveCtrlDefault_s( &ctrl->presolveCtrl );
     return EL_SUCCESS;
 }
 
@@ -162,6 +228,8 @@ ElError ElLPAffineCtrlDefault_d( ElLPAffineCtrl_d* ctrl )
 {
     ctrl->approach = EL_LP_MEHROTRA;
     ElMehrotraCtrlDefault_d( &ctrl->mehrotraCtrl );
+    ctrl->presolve = false;
+    ElPresolveCtrlDefault_d( &ctrl->presolveCtrl );
     return EL_SUCCESS;
 }
 
@@ -175,6 +243,8 @@ ElError ElQPDirectCtrlDefault_s( ElQPDirectCtrl_s* ctrl )
     ctrl->approach = EL_QP_MEHROTRA;
     ElMehrotraCtrlDefault_s( &ctrl->mehrotraCtrl );
     ctrl->mehrotraCtrl.system = EL_AUGMENTED_KKT;
+    ctrl->presolve = false;
+    ElPresolveCtrlDefault_s( &ctrl->presolveCtrl );
     return EL_SUCCESS;
 }
 
@@ -183,6 +253,8 @@ ElError ElQPDirectCtrlDefault_d( ElQPDirectCtrl_d* ctrl )
     ctrl->approach = EL_QP_MEHROTRA;
     ElMehrotraCtrlDefault_d( &ctrl->mehrotraCtrl );
     ctrl->mehrotraCtrl.system = EL_AUGMENTED_KKT;
+    ctrl->presolve = false;
+    ElPresolveCtrlDefault_d( &ctrl->presolveCtrl );
     return EL_SUCCESS;
 }
 
@@ -192,6 +264,8 @@ ElError ElQPAffineCtrlDefault_s( ElQPAffineCtrl_s* ctrl )
 {
     ctrl->approach = EL_QP_MEHROTRA;
     ElMehrotraCtrlDefault_s( &ctrl->mehrotraCtrl );
+    ctrl->presolve = false;
+    ElPresolveCtrlDefault_s( &ctrl->presolveCtrl );
     return EL_SUCCESS;
 }
 
@@ -199,6 +273,8 @@ ElError ElQPAffineCtrlDefault_d( ElQPAffineCtrl_d* ctrl )
 {
     ctrl->approach = EL_QP_MEHROTRA;
     ElMehrotraCtrlDefault_d( &ctrl->mehrotraCtrl );
+    ctrl->presolve = false;
+    ElPresolveCtrlDefault_d( &ctrl->presolveCtrl );
     return EL_SUCCESS;
 }
 
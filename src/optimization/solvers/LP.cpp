@@ -200,10 +200,32 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+    if( ctrl.presolve )
+    {
+        DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> reducedProblem;
+        DirectLPSolution<Matrix<Real>> reducedSolution;
+        PresolveRecord<Real> record;
+        Presolve( problem, reducedProblem, record, ctrl.presolveCtrl );
+        if( reducedProblem.A.Width() > 0 )
+        {
+            auto mehrotraCtrl = ctrl.mehrotraCtrl;
+            mehrotraCtrl.primalInit = false;
+            mehrotraCtrl.dualInit = false;
+            lp::direct::Mehrotra
+            ( reducedProblem, reducedSolution, mehrotraCtrl );
+        }
+        else
+        {
+            Zeros( reducedSolution.x, 0, 1 );
+            Zeros( reducedSolution.y, reducedProblem.A.Height(), 1 );
+            Zeros( reducedSolution.z, 0, 1 );
+        }
+        Postsolve( record, reducedSolution, solution );
+    }
+    else
+        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
 }
 
 // This interface is now deprecated.
@@ -239,10 +261,33 @@ void LP
   const lp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+    if( ctrl.presolve )
+    {
+        AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> reducedProblem;
+        AffineLPSolution<Matrix<Real>> reducedSolution;
+        PresolveRecord<Real> record;
+        Presolve( problem, reducedProblem, record, ctrl.presolveCtrl );
+        if( reducedProblem.A.Width() > 0 )
+        {
+            auto mehrotraCtrl = ctrl.mehrotraCtrl;
+            mehrotraCtrl.primalInit = false;
+            mehrotraCtrl.dualInit = false;
+            lp::affine::Mehrotra
+            ( reducedProblem, reducedSolution, mehrotraCtrl );
+        }
+        else
+        {
+            Zeros( reducedSolution.x, 0, 1 );
+            Zeros( reducedSolution.y, reducedProblem.A.Height(), 1 );
+            Zeros( reducedSolution.z, reducedProblem.G.Height(), 1 );
+            reducedSolution.s = reducedProblem.h;
+        }
+        Postsolve( record, reducedSolution, solution );
+    }
+    else
+        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
 }
 
 // This interface is now deprecated.
@@ -285,10 +330,36 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+    if( ctrl.presolve )
+    {
+        const Grid& grid = problem.A.Grid();
+        DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+          reducedProblem;
+        DirectLPSolution<DistMultiVec<Real>> reducedSolution;
+        ForceSimpleAlignments( reducedProblem, grid );
+        ForceSimpleAlignments( reducedSolution, grid );
+        PresolveRecord<Real> record;
+        Presolve( problem, reducedProblem, record, ctrl.presolveCtrl );
+        if( reducedProblem.A.Width() > 0 )
+        {
+            auto mehrotraCtrl = ctrl.mehrotraCtrl;
+            mehrotraCtrl.primalInit = false;
+            mehrotraCtrl.dualInit = false;
+            lp::direct::Mehrotra
+            ( reducedProblem, reducedSolution, mehrotraCtrl );
+        }
+        else
+        {
+            Zeros( reducedSolution.x, 0, 1 );
+            Zeros( reducedSolution.y, reducedProblem.A.Height(), 1 );
+            Zeros( reducedSolution.z, 0, 1 );
+        }
+        Postsolve( record, reducedSolution, solution );
+    }
+    else
+        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
 }
 
 // This interface is now deprecated.
@@ -329,10 +400,37 @@ void LP
   const lp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+    if( ctrl.presolve )
+    {
+        const Grid& grid = problem.A.Grid();
+        AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+          reducedProblem;
+        AffineLPSolution<DistMultiVec<Real>> reducedSolution;
+        ForceSimpleAlignments( reducedProblem, grid );
+        ForceSimpleAlignments( reducedSolution, grid );
+        PresolveRecord<Real> record;
+        Presolve( problem, reducedProblem, record, ctrl.presolveCtrl );
+        if( reducedProblem.A.Width() > 0 )
+        {
+            auto mehrotraCtrl = ctrl.mehrotraCtrl;
+            mehrotraCtrl.primalInit = false;
+            mehrotraCtrl.dualInit = false;
+            lp::affine::Mehrotra
+            ( reducedProblem, reducedSolution, mehrotraCtrl );
+        }
+        else
+        {
+            Zeros( reducedSolution.x, 0, 1 );
+            Zeros( reducedSolution.y, reducedProblem.A.Height(), 1 );
+            Zeros( reducedSolution.z, reducedProblem.G.Height(), 1 );
+            reducedSolution.s = reducedProblem.h;
+        }
+        Postsolve( record, reducedSolution, solution );
+    }
+    else
+        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
 }
 
 // This interface is now deprecated.
@@ -373,6 +471,144 @@ void LP
     s = solution.s;
 }
 
+namespace lp {
+
+namespace direct {
+
+template<typename Real,class MatrixType,class VectorType,class SessionType>
+void WarmStartedMehrotra
+( const DirectLPProblem<MatrixType,VectorType>& problem,
+        DirectLPSolution<VectorType>& solution,
+        SessionType& session,
+  const Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach != LP_MEHROTRA )
+        LogicError("Warm-started re-solves require the Mehrotra IPM");
+    if( ctrl.presolve )
+        LogicError("Presolve is not supported for warm-started re-solves");
+    const bool patternChanged = session.ProblemPatternChanged( problem.A );
+    if( session.haveSolution &&
+        (session.x.Height() != problem.A.Width() ||
+         session.y.Height() != problem.A.Height() || patternChanged) )
+        session.Reset();
+
+    auto mehrotraCtrl = ctrl.mehrotraCtrl;
+    if( session.haveSolution )
+    {
+        solution.x = session.x;
+        solution.y = session.y;
+        solution.z = session.z;
+        session.LiftConeVariable( solution.x );
+        session.LiftConeVariable( solution.z );
+        mehrotraCtrl.primalInit = true;
+        mehrotraCtrl.dualInit = true;
+    }
+    Mehrotra( problem, solution, mehrotraCtrl, &session );
+
+    session.x = solution.x;
+    session.y = solution.y;
+    session.z = solution.z;
+    session.haveSolution = true;
+    if( mehrotraCtrl.print )
+        PrintSessionSummary( session );
+}
+
+} // namespace direct
+
+namespace affine {
+
+template<typename Real,class MatrixType,class VectorType,class SessionType>
+void WarmStartedMehrotra
+( const AffineLPProblem<MatrixType,VectorType>& problem,
+        AffineLPSolution<VectorType>& solution,
+        SessionType& session,
+  const Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach != LP_MEHROTRA )
+        LogicError("Warm-started re-solves require the Mehrotra IPM");
+    if( ctrl.presolve )
+        LogicError("Presolve is not supported for warm-started re-solves");
+    const bool patternChanged =
+      session.ProblemPatternChanged( problem.A, problem.G );
+    if( session.haveSolution &&
+        (session.x.Height() != problem.A.Width() ||
+         session.y.Height() != problem.A.Height() ||
+         session.z.Height() != problem.G.Height() || patternChanged) )
+        session.Reset();
+
+    auto mehrotraCtrl = ctrl.mehrotraCtrl;
+    if( session.haveSolution )
+    {
+        solution.x = session.x;
+        solution.y = session.y;
+        solution.z = session.z;
+        solution.s = session.s;
+        session.LiftConeVariable( solution.s );
+        session.LiftConeVariable( solution.z );
+        mehrotraCtrl.primalInit = true;
+        mehrotraCtrl.dualInit = true;
+    }
+    Mehrotra( problem, solution, mehrotraCtrl, &session );
+
+    session.x = solution.x;
+    session.y = solution.y;
+    session.z = solution.z;
+    session.s = solution.s;
+    session.haveSolution = true;
+    if( mehrotraCtrl.print )
+        PrintSessionSummary( session );
+}
+
+} // namespace affine
+
+} // namespace lp
+
+template<typename Real>
+void LP
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        SparseMehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    lp::direct::WarmStartedMehrotra( problem, solution, session, ctrl );
+}
+
+template<typename Real>
+void LP
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+        DistSparseMehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    lp::direct::WarmStartedMehrotra( problem, solution, session, ctrl );
+}
+
+template<typename Real>
+void LP
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        AffineLPSolution<Matrix<Real>>& solution,
+        SparseMehrotraSession<Real>& session,
+  const lp::affine::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    lp::affine::WarmStartedMehrotra( problem, solution, session, ctrl );
+}
+
+template<typename Real>
+void LP
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        AffineLPSolution<DistMultiVec<Real>>& solution,
+        DistSparseMehrotraSession<Real>& session,
+  const lp::affine::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    lp::affine::WarmStartedMehrotra( problem, solution, session, ctrl );
+}
+
 #define PROTO(Real) \
   template void LP \
   ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
@@ -482,6 +718,26 @@ void LP
           DistMultiVec<Real>& z, \
           DistMultiVec<Real>& s, \
     const lp::affine::Ctrl<Real>& ctrl ); \
+  template void LP \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          SparseMehrotraSession<Real>& session, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          DirectLPSolution<DistMultiVec<Real>>& solution, \
+          DistSparseMehrotraSession<Real>& session, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
+  ( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          AffineLPSolution<Matrix<Real>>& solution, \
+          SparseMehrotraSession<Real>& session, \
+    const lp::affine::Ctrl<Real>& ctrl ); \
+  template void LP \
+  ( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          AffineLPSolution<DistMultiVec<Real>>& solution, \
+          DistSparseMehrotraSession<Real>& session, \
+    const lp::affine::Ctrl<Real>& ctrl ); \
   template void ReadMPS \
   ( AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
     const string& filename, \
@@ -33,6 +33,21 @@ void Mehrotra
         AffineLPSolution<DistMultiVec<Real>>& solution,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
+// Variants which reuse the symbolic analysis and equilibration stored in a
+// session between calls
+template<typename Real>
+void Mehrotra
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        AffineLPSolution<Matrix<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session );
+template<typename Real>
+void Mehrotra
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        AffineLPSolution<DistMultiVec<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session );
+
 } // namespace affine
 } // namespace lp
 } // namespace El
@@ -220,7 +220,8 @@ void Equilibrate
         AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& equilibratedProblem,
         AffineLPSolution<Matrix<Real>>& equilibratedSolution,
         SparseAffineLPEquilibration<Real>& equilibration,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+  bool reuseScaling=false )
 {
     EL_DEBUG_CSE
 
@@ -228,13 +229,26 @@ void Equilibrate
     equilibratedSolution = solution;
 
     // Equilibrate the LP by diagonally scaling [A;G]
-    StackedRuizEquil
-    ( equilibratedProblem.A,
-      equilibratedProblem.G,
-      equilibration.rowScaleA,
-      equilibration.rowScaleG,
-      equilibration.colScale,
-      ctrl.print );
+    if( reuseScaling )
+    {
+        // Apply the row and column scalings of a previous equilibration
+        DiagonalSolve
+        ( LEFT, NORMAL, equilibration.rowScaleA, equilibratedProblem.A );
+        DiagonalSolve
+        ( LEFT, NORMAL, equilibration.rowScaleG, equilibratedProblem.G );
+        DiagonalSolve
+        ( RIGHT, NORMAL, equilibration.colScale, equilibratedProblem.A );
+        DiagonalSolve
+        ( RIGHT, NORMAL, equilibration.colScale, equilibratedProblem.G );
+    }
+    else
+        StackedRuizEquil
+        ( equilibratedProblem.A,
+          equilibratedProblem.G,
+          equilibration.rowScaleA,
+          equilibration.rowScaleG,
+          equilibration.colScale,
+          ctrl.print );
 
     DiagonalSolve
     ( LEFT, NORMAL, equilibration.rowScaleA, equilibratedProblem.b );
@@ -287,7 +301,8 @@ void Equilibrate
           equilibratedProblem,
         AffineLPSolution<DistMultiVec<Real>>& equilibratedSolution,
         DistSparseAffineLPEquilibration<Real>& equilibration,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+  bool reuseScaling=false )
 {
     EL_DEBUG_CSE
     const Grid& grid = problem.A.Grid();
@@ -298,13 +313,26 @@ void Equilibrate
     equilibratedSolution = solution;
 
     // Equilibrate the LP by diagonally scaling [A;G]
-    StackedRuizEquil
-    ( equilibratedProblem.A,
-      equilibratedProblem.G,
-      equilibration.rowScaleA,
-      equilibration.rowScaleG,
-      equilibration.colScale,
-      ctrl.print );
+    if( reuseScaling )
+    {
+        // Apply the row and column scalings of a previous equilibration
+        DiagonalSolve
+        ( LEFT, NORMAL, equilibration.rowScaleA, equilibratedProblem.A );
+        DiagonalSolve
+        ( LEFT, NORMAL, equilibration.rowScaleG, equilibratedProblem.G );
+        DiagonalSolve
+        ( RIGHT, NORMAL, equilibration.colScale, equilibratedProblem.A );
+        DiagonalSolve
+        ( RIGHT, NORMAL, equilibration.colScale, equilibratedProblem.G );
+    }
+    else
+        StackedRuizEquil
+        ( equilibratedProblem.A,
+          equilibratedProblem.G,
+          equilibration.rowScaleA,
+          equilibration.rowScaleG,
+          equilibration.colScale,
+          ctrl.print );
 
     DiagonalSolve
     ( LEFT, NORMAL, equilibration.rowScaleA, equilibratedProblem.b );
@@ -702,6 +730,70 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            AffineLPResidual<Matrix<Real>> centralityResidual;
+            AffineLPSolution<Matrix<Real>> centralityCorrection,
+              trialCorrection;
+            Zeros( centralityResidual.primalEquality, m, 1 );
+            Zeros( centralityResidual.primalConic, k, 1 );
+            Zeros( centralityResidual.dualEquality, n, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( solution.s, solution.z, correction.s, correction.z,
+                    centralityResidual.dualConic,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  KKTRHS
+                  ( centralityResidual.dualEquality,
+                    centralityResidual.primalEquality,
+                    centralityResidual.primalConic,
+                    centralityResidual.dualConic,
+                    solution.z, d );
+                  if( !attemptToSolve(d) )
+                      return false;
+                  ExpandSolution
+                  ( m, n, d, centralityResidual.dualConic,
+                    solution.s, solution.z,
+                    centralityCorrection.x, centralityCorrection.y,
+                    centralityCorrection.z, centralityCorrection.s );
+                  trialCorrection.x = correction.x;
+                  trialCorrection.y = correction.y;
+                  trialCorrection.z = correction.z;
+                  trialCorrection.s = correction.s;
+                  trialCorrection.x += centralityCorrection.x;
+                  trialCorrection.y += centralityCorrection.y;
+                  trialCorrection.z += centralityCorrection.z;
+                  trialCorrection.s += centralityCorrection.s;
+                  alphaPriNew =
+                    pos_orth::MaxStep
+                    ( solution.s, trialCorrection.s, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep
+                    ( solution.z, trialCorrection.z, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  correction.x = trialCorrection.x;
+                  correction.y = trialCorrection.y;
+                  correction.z = trialCorrection.z;
+                  correction.s = trialCorrection.s;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1047,6 +1139,73 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            AffineLPResidual<DistMatrix<Real>> centralityResidual;
+            AffineLPSolution<DistMatrix<Real>> centralityCorrection,
+              trialCorrection;
+            ForceSimpleAlignments( centralityResidual, grid );
+            ForceSimpleAlignments( centralityCorrection, grid );
+            ForceSimpleAlignments( trialCorrection, grid );
+            Zeros( centralityResidual.primalEquality, m, 1 );
+            Zeros( centralityResidual.primalConic, k, 1 );
+            Zeros( centralityResidual.dualEquality, n, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( solution.s, solution.z, correction.s, correction.z,
+                    centralityResidual.dualConic,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  KKTRHS
+                  ( centralityResidual.dualEquality,
+                    centralityResidual.primalEquality,
+                    centralityResidual.primalConic,
+                    centralityResidual.dualConic,
+                    solution.z, d );
+                  if( !attemptToSolve(d) )
+                      return false;
+                  ExpandSolution
+                  ( m, n, d, centralityResidual.dualConic,
+                    solution.s, solution.z,
+                    centralityCorrection.x, centralityCorrection.y,
+                    centralityCorrection.z, centralityCorrection.s );
+                  trialCorrection.x = correction.x;
+                  trialCorrection.y = correction.y;
+                  trialCorrection.z = correction.z;
+                  trialCorrection.s = correction.s;
+                  trialCorrection.x += centralityCorrection.x;
+                  trialCorrection.y += centralityCorrection.y;
+                  trialCorrection.z += centralityCorrection.z;
+                  trialCorrection.s += centralityCorrection.s;
+                  alphaPriNew =
+                    pos_orth::MaxStep
+                    ( solution.s, trialCorrection.s, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep
+                    ( solution.z, trialCorrection.z, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  correction.x = trialCorrection.x;
+                  correction.y = trialCorrection.y;
+                  correction.z = trialCorrection.z;
+                  correction.s = trialCorrection.s;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1132,10 +1291,11 @@ void Mehrotra
 }
 
 template<typename Real>
-void EquilibratedMehrotra
+Int EquilibratedMehrotra
 ( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         AffineLPSolution<Matrix<Real>>& solution,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session=nullptr )
 {
     EL_DEBUG_CSE
     const Int m = problem.A.Height();
@@ -1176,7 +1336,11 @@ void EquilibratedMehrotra
       JStatic, false );
     JStatic.FreezeSparsity();
 
-    SparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the factorization (and, when possible, its symbolic analysis)
+    // stored in the session, if there is one
+    SparseLDLFactorization<Real> localSparseLDLFact;
+    SparseLDLFactorization<Real>& sparseLDLFact =
+      ( session ? session->factorization : localSparseLDLFact );
     Initialize
     ( problem, solution, JStatic, regTmp,
       sparseLDLFact,
@@ -1198,7 +1362,8 @@ void EquilibratedMehrotra
             else
                 Ones( dInner, J.Height(), 1 );
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
+            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit &&
+                !(session && session->CanReuseAnalysis(J,FULL_KKT)) )
             {
                 const bool hermitian = true;
                 const BisectCtrl bisectCtrl;
@@ -1208,6 +1373,8 @@ void EquilibratedMehrotra
             {
                 sparseLDLFact.ChangeNonzeroValues( J );
             }
+            if( session && numIts == 0 )
+                session->RecordAnalysis( J, FULL_KKT );
             sparseLDLFact.Factor();
         }
         catch(...)
@@ -1481,6 +1648,70 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            AffineLPResidual<Matrix<Real>> centralityResidual;
+            AffineLPSolution<Matrix<Real>> centralityCorrection,
+              trialCorrection;
+            Zeros( centralityResidual.primalEquality, m, 1 );
+            Zeros( centralityResidual.primalConic, k, 1 );
+            Zeros( centralityResidual.dualEquality, n, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( solution.s, solution.z, correction.s, correction.z,
+                    centralityResidual.dualConic,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  KKTRHS
+                  ( centralityResidual.dualEquality,
+                    centralityResidual.primalEquality,
+                    centralityResidual.primalConic,
+                    centralityResidual.dualConic,
+                    solution.z, d );
+                  if( !attemptToSolve(d) )
+                      return false;
+                  ExpandSolution
+                  ( m, n, d, centralityResidual.dualConic,
+                    solution.s, solution.z,
+                    centralityCorrection.x, centralityCorrection.y,
+                    centralityCorrection.z, centralityCorrection.s );
+                  trialCorrection.x = correction.x;
+                  trialCorrection.y = correction.y;
+                  trialCorrection.z = correction.z;
+                  trialCorrection.s = correction.s;
+                  trialCorrection.x += centralityCorrection.x;
+                  trialCorrection.y += centralityCorrection.y;
+                  trialCorrection.z += centralityCorrection.z;
+                  trialCorrection.s += centralityCorrection.s;
+                  alphaPriNew =
+                    pos_orth::MaxStep
+                    ( solution.s, trialCorrection.s, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep
+                    ( solution.z, trialCorrection.z, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  correction.x = trialCorrection.x;
+                  correction.y = trialCorrection.y;
+                  correction.z = trialCorrection.z;
+                  correction.s = trialCorrection.s;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1497,13 +1728,15 @@ void EquilibratedMehrotra
         }
     }
     SetIndent( indent );
+    return numIts;
 }
 
 template<typename Real>
 void Mehrotra
 ( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         AffineLPSolution<Matrix<Real>>& solution,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session )
 {
     EL_DEBUG_CSE
     if( ctrl.outerEquil )
@@ -1511,24 +1744,61 @@ void Mehrotra
         AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> equilibratedProblem;
         AffineLPSolution<Matrix<Real>> equilibratedSolution;
         SparseAffineLPEquilibration<Real> equilibration;
+        const bool reuseScaling =
+          session && session->reuseEquilibration && session->equilibrated &&
+          session->rowScaleA.Height() == problem.A.Height() &&
+          session->rowScaleG.Height() == problem.G.Height() &&
+          session->colScale.Height() == problem.A.Width();
+        if( reuseScaling )
+        {
+            equilibration.rowScaleA = session->rowScaleA;
+            equilibration.rowScaleG = session->rowScaleG;
+            equilibration.colScale = session->colScale;
+        }
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution,
-          equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+          equilibration, ctrl, reuseScaling );
+        if( session && !reuseScaling )
+        {
+            session->rowScaleA = equilibration.rowScaleA;
+            session->rowScaleG = equilibration.rowScaleG;
+            session->colScale = equilibration.colScale;
+            session->equilibrated = true;
+        }
+        const Int numIts =
+          EquilibratedMehrotra
+          ( equilibratedProblem, equilibratedSolution, ctrl, session );
+        if( session )
+            session->RecordIterations( numIts );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        const Int numIts =
+          EquilibratedMehrotra( problem, solution, ctrl, session );
+        if( session )
+            session->RecordIterations( numIts );
     }
 }
 
 template<typename Real>
-void EquilibratedMehrotra
+void Mehrotra
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        AffineLPSolution<Matrix<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseMehrotraSession<Real>* session = nullptr;
+    Mehrotra( problem, solution, ctrl, session );
+}
+
+template<typename Real>
+Int EquilibratedMehrotra
 ( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         AffineLPSolution<DistMultiVec<Real>>& solution,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session=nullptr )
 {
     EL_DEBUG_CSE
     const Int m = problem.A.Height();
@@ -1592,7 +1862,11 @@ void EquilibratedMehrotra
 
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    DistSparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the factorization (and, when possible, its symbolic analysis)
+    // stored in the session, if there is one
+    DistSparseLDLFactorization<Real> localSparseLDLFact;
+    DistSparseLDLFactorization<Real>& sparseLDLFact =
+      ( session ? session->factorization : localSparseLDLFact );
     Initialize
     ( problem, solution, JStatic, regTmp,
       sparseLDLFact,
@@ -1619,7 +1893,8 @@ void EquilibratedMehrotra
             if( commRank == 0 && ctrl.time )
                 Output("Equilibration: ",timer.Stop()," secs");
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
+            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit &&
+                !(session && session->CanReuseAnalysis(J,FULL_KKT)) )
             {
                 const bool hermitian = true;
                 const BisectCtrl bisectCtrl;
@@ -1629,6 +1904,8 @@ void EquilibratedMehrotra
             {
                 sparseLDLFact.ChangeNonzeroValues( J );
             }
+            if( session && numIts == 0 )
+                session->RecordAnalysis( J, FULL_KKT );
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
@@ -1920,6 +2197,73 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            AffineLPResidual<DistMultiVec<Real>> centralityResidual;
+            AffineLPSolution<DistMultiVec<Real>> centralityCorrection,
+              trialCorrection;
+            ForceSimpleAlignments( centralityResidual, grid );
+            ForceSimpleAlignments( centralityCorrection, grid );
+            ForceSimpleAlignments( trialCorrection, grid );
+            Zeros( centralityResidual.primalEquality, m, 1 );
+            Zeros( centralityResidual.primalConic, k, 1 );
+            Zeros( centralityResidual.dualEquality, n, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( solution.s, solution.z, correction.s, correction.z,
+                    centralityResidual.dualConic,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  KKTRHS
+                  ( centralityResidual.dualEquality,
+                    centralityResidual.primalEquality,
+                    centralityResidual.primalConic,
+                    centralityResidual.dualConic,
+                    solution.z, d );
+                  if( !attemptToSolve(d) )
+                      return false;
+                  ExpandSolution
+                  ( m, n, d, centralityResidual.dualConic,
+                    solution.s, solution.z,
+                    centralityCorrection.x, centralityCorrection.y,
+                    centralityCorrection.z, centralityCorrection.s );
+                  trialCorrection.x = correction.x;
+                  trialCorrection.y = correction.y;
+                  trialCorrection.z = correction.z;
+                  trialCorrection.s = correction.s;
+                  trialCorrection.x += centralityCorrection.x;
+                  trialCorrection.y += centralityCorrection.y;
+                  trialCorrection.z += centralityCorrection.z;
+                  trialCorrection.s += centralityCorrection.s;
+                  alphaPriNew =
+                    pos_orth::MaxStep
+                    ( solution.s, trialCorrection.s, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep
+                    ( solution.z, trialCorrection.z, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  correction.x = trialCorrection.x;
+                  correction.y = trialCorrection.y;
+                  correction.z = trialCorrection.z;
+                  correction.s = trialCorrection.s;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1936,13 +2280,15 @@ void EquilibratedMehrotra
         }
     }
     SetIndent( indent );
+    return numIts;
 }
 
 template<typename Real>
 void Mehrotra
 ( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         AffineLPSolution<DistMultiVec<Real>>& solution,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session )
 {
     EL_DEBUG_CSE
     if( ctrl.outerEquil )
@@ -1956,19 +2302,55 @@ void Mehrotra
         ForceSimpleAlignments( equilibratedSolution, grid );
         ForceSimpleAlignments( equilibratedProblem, grid );
 
+        const bool reuseScaling =
+          session && session->reuseEquilibration && session->equilibrated &&
+          session->rowScaleA.Height() == problem.A.Height() &&
+          session->rowScaleG.Height() == problem.G.Height() &&
+          session->colScale.Height() == problem.A.Width();
+        if( reuseScaling )
+        {
+            equilibration.rowScaleA = session->rowScaleA;
+            equilibration.rowScaleG = session->rowScaleG;
+            equilibration.colScale = session->colScale;
+        }
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution,
-          equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+          equilibration, ctrl, reuseScaling );
+        if( session && !reuseScaling )
+        {
+            session->rowScaleA = equilibration.rowScaleA;
+            session->rowScaleG = equilibration.rowScaleG;
+            session->colScale = equilibration.colScale;
+            session->equilibrated = true;
+        }
+        const Int numIts =
+          EquilibratedMehrotra
+          ( equilibratedProblem, equilibratedSolution, ctrl, session );
+        if( session )
+            session->RecordIterations( numIts );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        const Int numIts =
+          EquilibratedMehrotra( problem, solution, ctrl, session );
+        if( session )
+            session->RecordIterations( numIts );
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        AffineLPSolution<DistMultiVec<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseMehrotraSession<Real>* session = nullptr;
+    Mehrotra( problem, solution, ctrl, session );
+}
+
 #define PROTO(Real) \
   template void Mehrotra \
   ( const AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
@@ -1983,9 +2365,19 @@ void Mehrotra
           AffineLPSolution<Matrix<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          AffineLPSolution<Matrix<Real>>& solution, \
+    const MehrotraCtrl<Real>& ctrl, \
+          SparseMehrotraSession<Real>* session ); \
+  template void Mehrotra \
+  ( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          AffineLPSolution<DistMultiVec<Real>>& solution, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
           AffineLPSolution<DistMultiVec<Real>>& solution, \
-    const MehrotraCtrl<Real>& ctrl );
+    const MehrotraCtrl<Real>& ctrl, \
+          DistSparseMehrotraSession<Real>* session );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -52,125 +52,102 @@ Int ADMM
     //   | I 0   | | rho*I A^H | = | I   0   | | rho*I U12 |,
     //   | 0 P22 | | A     0   |   | L21 L22 | | 0     U22 |
     // where [L22,U22] are stored within B22.
-    Matrix<Real> U12, L21, B22, bPiv;
-    Adjoint( A, U12 );
-    L21 = A;
-    L21 *= 1/ctrl.rho;
-    Herk( LOWER, NORMAL, -1/ctrl.rho, A, B22 );
-    MakeHermitian( LOWER, B22 );
-    // TODO: Replace with sparse-direct Cholesky version?
+    //
+    // Since U12 does not depend upon rho, only L21 and the Schur complement
+    // are reformed when rho is adapted.
+    Matrix<Real> U12, L21, B22, bPiv, X22;
     Permutation P2;
-    LU( B22, P2 );
-    P2.PermuteRows( L21 );
-    bPiv = b;
-    P2.PermuteRows( bPiv );
-
-    // Possibly form the inverse of L22 U22
-    Matrix<Real> X22;
-    if( ctrl.inv )
-    {
-        X22 = B22;
-        MakeTrapezoidal( LOWER, X22 );
-        FillDiagonal( X22, Real(1) );
-        TriangularInverse( LOWER, UNIT, X22 );
-        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), B22, X22 );
-    }
-
-    Int numIter=0;
-    const Int m = A.Height();
-    const Int n = A.Width();
-    Matrix<Real> g, xTmp, y, t;
-    Zeros( g, m+n, 1 );
-    PartitionDown( g, xTmp, y, n );
-    Matrix<Real> x, u, zOld, xHat;
-    Zeros( z, n, 1 );
-    Zeros( u, n, 1 );
-    Zeros( t, n, 1 );
-    while( numIter < ctrl.maxIter )
-    {
-        zOld = z;
-
-        // Find x from
-        //  | rho*I  A^H | | x | = | rho*(z-u)-c |
-        //  | A      0   | | y |   | b           |
-        // via our cached custom factorization:
-        //
-        // |x| = inv(U) inv(L) P' |rho*(z-u)-c|
-        // |y|                    |b          |
-        //     = |rho*I U12|^{-1} |I   0  | |I 0   | |rho*(z-u)-c|
-        //     = |0     U22|      |L21 L22| |0 P22'| |b          |
-        //     = "                        " |rho*(z-u)-c|
-        //                                  | P22' b    |
-        xTmp = z;
-        xTmp -= u;
-        xTmp *= ctrl.rho;
-        xTmp -= c;
-        y = bPiv;
-        Gemv( NORMAL, Real(-1), L21, xTmp, Real(1), y );
-        if( ctrl.inv )
-        {
-            Gemv( NORMAL, Real(1), X22, y, t );
-            y = t;
-        }
-        else
-        {
-            Trsv( LOWER, NORMAL, UNIT, B22, y );
-            Trsv( UPPER, NORMAL, NON_UNIT, B22, y );
-        }
-        Gemv( NORMAL, Real(-1), U12, y, Real(1), xTmp );
-        xTmp *= 1/ctrl.rho;
-
-        // xHat := alpha*x + (1-alpha)*zOld
-        xHat = xTmp;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := pos(xHat+u)
-        z = xHat;
-        z += u;
-        LowerClip( z, Real(0) );
+    Adjoint( A, U12 );
+    Real factoredRho = 0;
+    auto factor =
+      [&]( Real rho )
+      {
+          L21 = A;
+          L21 *= 1/rho;
+          Herk( LOWER, NORMAL, -1/rho, A, B22 );
+          MakeHermitian( LOWER, B22 );
+          // TODO: Replace with sparse-direct Cholesky version?
+          LU( B22, P2 );
+          P2.PermuteRows( L21 );
+          bPiv = b;
+          P2.PermuteRows( bPiv );
 
-        // u := u + (xHat-z)
-        u += xHat;
-        u -= z;
+          // Possibly form the inverse of L22 U22
+          if( ctrl.inv )
+          {
+              X22 = B22;
+              MakeTrapezoidal( LOWER, X22 );
+              FillDiagonal( X22, Real(1) );
+              TriangularInverse( LOWER, UNIT, X22 );
+              Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), B22, X22 );
+          }
+          factoredRho = rho;
+      };
 
-        const Real objective = Dot( c, xTmp );
+    // Find x from
+    //  | rho*I  A^H | | x | = | rho*v-c |
+    //  | A      0   | | y |   | b       |
+    // via our cached custom factorization:
+    //
+    // |x| = inv(U) inv(L) P' |rho*v-c|
+    // |y|                    |b      |
+    //     = |rho*I U12|^{-1} |I   0  | |I 0   | |rho*v-c|
+    //     = |0     U22|      |L21 L22| |0 P22'| |b      |
+    //     = "                        " |rho*v-c|
+    //                                  | P22' b|
+    Matrix<Real> y, t;
+    auto xUpdate =
+      [&]( Real rho, const Matrix<Real>& v, Matrix<Real>& x )
+      {
+          if( rho != factoredRho )
+              factor( rho );
+          x = v;
+          x *= rho;
+          x -= c;
+          y = bPiv;
+          Gemv( NORMAL, Real(-1), L21, x, Real(1), y );
+          if( ctrl.inv )
+          {
+              Gemv( NORMAL, Real(1), X22, y, t );
+              y = t;
+          }
+          else
+          {
+              Trsv( LOWER, NORMAL, UNIT, B22, y );
+              Trsv( UPPER, NORMAL, NON_UNIT, B22, y );
+          }
+          Gemv( NORMAL, Real(-1), U12, y, Real(1), x );
+          x *= 1/rho;
+      };
 
-        // rNorm := || x - z ||_2
-        t = xTmp;
-        t -= z;
-        const Real rNorm = FrobeniusNorm( t );
-        // sNorm := |rho| || z - zOld ||_2
-        t = z;
-        t -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( t );
+    // z := pos(v)
+    auto zUpdate =
+      []( Real rho, const Matrix<Real>& v, Matrix<Real>& z )
+      {
+          z = v;
+          LowerClip( z, Real(0) );
+      };
 
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(xTmp),FrobeniusNorm(z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+    auto monitor =
+      [&]( Int, const Matrix<Real>& x, const Matrix<Real>& )
+      {
+          const Real objective = Dot( c, x );
+          t = x;
+          LowerClip( t, Real(0) );
+          t -= x;
+          const Real clipDist = FrobeniusNorm( t );
+          Output("  ||x-Pos(x)||_2=",clipDist,", c'x=",objective);
+      };
 
-        if( ctrl.print )
-        {
-            t = xTmp;
-            LowerClip( t, Real(0) );
-            t -= xTmp;
-            const Real clipDist = FrobeniusNorm( t );
-            cout << numIter << ": "
-              << "||x-z||_2=" << rNorm << ", "
-              << "epsPri=" << epsPri << ", "
-              << "|rho| ||z-zOld||_2=" << sNorm << ", "
-              << "epsDual=" << epsDual << ", "
-              << "||x-Pos(x)||_2=" << clipDist << ", "
-              << "c'x=" << objective << endl;
-        }
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+    const Int n = A.Width();
+    Matrix<Real> x, u;
+    Zeros( x, n, 1 );
+    Zeros( z, n, 1 );
+    Zeros( u, n, 1 );
+    const Int numIter =
+      El::ADMM<Real>( xUpdate, zUpdate, monitor, x, z, u, ctrl );
     if( ctrl.maxIter == numIter )
-        cout << "ADMM failed to converge" << endl;
-    x = xTmp;
+        Output("ADMM failed to converge");
     return numIter;
 }
 
@@ -216,129 +193,99 @@ Int ADMM
     //   | I 0   | | rho*I A^H | = | I   0   | | rho*I U12 |,
     //   | 0 P22 | | A     0   |   | L21 L22 | | 0     U22 |
     // where [L22,U22] are stored within B22.
-    const Int m = A.Height();
+    //
+    // Since U12 does not depend upon rho, only L21 and the Schur complement
+    // are reformed when rho is adapted.
     const Int n = A.Width();
     const Grid& grid = A.Grid();
-    DistMatrix<Real> U12(grid), L21(grid), B22(grid), bPiv(grid);
+    DistMatrix<Real> U12(grid), L21(grid), B22(grid), bPiv(grid), X22(grid);
     U12.Align( 0,                 n%U12.RowStride() );
     L21.Align( n%L21.ColStride(), 0                 );
     B22.Align( n%B22.ColStride(), n%B22.RowStride() );
-    Adjoint( A, U12 );
-    L21 = A;
-    L21 *= 1/ctrl.rho;
-    Herk( LOWER, NORMAL, -1/ctrl.rho, A, B22 );
-    MakeHermitian( LOWER, B22 );
     DistPermutation P2(grid);
-    LU( B22, P2 );
-    P2.PermuteRows( L21 );
-    bPiv = b;
-    P2.PermuteRows( bPiv );
-
-    // Possibly form the inverse of L22 U22
-    DistMatrix<Real> X22(grid);
-    if( ctrl.inv )
-    {
-        X22 = B22;
-        MakeTrapezoidal( LOWER, X22 );
-        FillDiagonal( X22, Real(1) );
-        TriangularInverse( LOWER, UNIT, X22 );
-        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), B22, X22 );
-    }
-
-    Int numIter=0;
-    DistMatrix<Real> g(grid), xTmp(grid), y(grid), t(grid);
-    Zeros( g, m+n, 1 );
-    PartitionDown( g, xTmp, y, n );
-    DistMatrix<Real> x(grid), u(grid), zOld(grid), xHat(grid);
-    Zeros( z, n, 1 );
-    Zeros( u, n, 1 );
-    Zeros( t, n, 1 );
-    while( numIter < ctrl.maxIter )
-    {
-        zOld = z;
-
-        // Find x from
-        //  | rho*I  A^H | | x | = | rho*(z-u)-c |
-        //  | A      0   | | y |   | b           |
-        // via our cached custom factorization:
-        //
-        // |x| = inv(U) inv(L) P' |rho*(z-u)-c|
-        // |y|                    |b          |
-        //     = |rho*I U12|^{-1} |I   0  | |I 0   | |rho*(z-u)-c|
-        //     = |0     U22|      |L21 L22| |0 P22'| |b          |
-        //     = "                        " |rho*(z-u)-c|
-        //                                  | P22' b    |
-        xTmp = z;
-        xTmp -= u;
-        xTmp *= ctrl.rho;
-        xTmp -= c;
-        y = bPiv;
-        Gemv( NORMAL, Real(-1), L21, xTmp, Real(1), y );
-        if( ctrl.inv )
-        {
-            Gemv( NORMAL, Real(1), X22, y, t );
-            y = t;
-        }
-        else
-        {
-            Trsv( LOWER, NORMAL, UNIT, B22, y );
-            Trsv( UPPER, NORMAL, NON_UNIT, B22, y );
-        }
-        Gemv( NORMAL, Real(-1), U12, y, Real(1), xTmp );
-        xTmp *= 1/ctrl.rho;
-
-        // xHat := alpha*x + (1-alpha)*zOld
-        xHat = xTmp;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := pos(xHat+u)
-        z = xHat;
-        z += u;
-        LowerClip( z, Real(0) );
+    Adjoint( A, U12 );
+    Real factoredRho = 0;
+    auto factor =
+      [&]( Real rho )
+      {
+          L21 = A;
+          L21 *= 1/rho;
+          Herk( LOWER, NORMAL, -1/rho, A, B22 );
+          MakeHermitian( LOWER, B22 );
+          LU( B22, P2 );
+          P2.PermuteRows( L21 );
+          bPiv = b;
+          P2.PermuteRows( bPiv );
 
-        // u := u + (xHat-z)
-        u += xHat;
-        u -= z;
+          // Possibly form the inverse of L22 U22
+          if( ctrl.inv )
+          {
+              X22 = B22;
+              MakeTrapezoidal( LOWER, X22 );
+              FillDiagonal( X22, Real(1) );
+              TriangularInverse( LOWER, UNIT, X22 );
+              Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), B22, X22 );
+          }
+          factoredRho = rho;
+      };
 
-        const Real objective = Dot( c, xTmp );
+    // Find x from
+    //  | rho*I  A^H | | x | = | rho*v-c |
+    //  | A      0   | | y |   | b       |
+    // via our cached custom factorization (see the sequential implementation)
+    DistMatrix<Real> y(grid), t(grid);
+    auto xUpdate =
+      [&]( Real rho, const DistMatrix<Real>& v, DistMatrix<Real>& x )
+      {
+          if( rho != factoredRho )
+              factor( rho );
+          x = v;
+          x *= rho;
+          x -= c;
+          y = bPiv;
+          Gemv( NORMAL, Real(-1), L21, x, Real(1), y );
+          if( ctrl.inv )
+          {
+              Gemv( NORMAL, Real(1), X22, y, t );
+              y = t;
+          }
+          else
+          {
+              Trsv( LOWER, NORMAL, UNIT, B22, y );
+              Trsv( UPPER, NORMAL, NON_UNIT, B22, y );
+          }
+          Gemv( NORMAL, Real(-1), U12, y, Real(1), x );
+          x *= 1/rho;
+      };
 
-        // rNorm := || x - z ||_2
-        t = xTmp;
-        t -= z;
-        const Real rNorm = FrobeniusNorm( t );
-        // sNorm := |rho| || z - zOld ||_2
-        t = z;
-        t -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( t );
+    // z := pos(v)
+    auto zUpdate =
+      []( Real rho, const DistMatrix<Real>& v, DistMatrix<Real>& z )
+      {
+          z = v;
+          LowerClip( z, Real(0) );
+      };
 
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(xTmp),FrobeniusNorm(z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+    auto monitor =
+      [&]( Int, const DistMatrix<Real>& x, const DistMatrix<Real>& )
+      {
+          const Real objective = Dot( c, x );
+          t = x;
+          LowerClip( t, Real(0) );
+          t -= x;
+          const Real clipDist = FrobeniusNorm( t );
+          if( grid.Rank() == 0 )
+              Output("  ||x-Pos(x)||_2=",clipDist,", c'x=",objective);
+      };
 
-        if( ctrl.print )
-        {
-            t = xTmp;
-            LowerClip( t, Real(0) );
-            t -= xTmp;
-            const Real clipDist = FrobeniusNorm( t );
-            if( grid.Rank() == 0 )
-                cout << numIter << ": "
-                  << "||x-z||_2=" << rNorm << ", "
-                  << "epsPri=" << epsPri << ", "
-                  << "|rho| ||z-zOld||_2=" << sNorm << ", "
-                  << "epsDual=" << epsDual << ", "
-                  << "||x-Pos(x)||_2=" << clipDist << ", "
-                  << "c'x=" << objective << endl;
-        }
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+    DistMatrix<Real> x(grid), u(grid);
+    Zeros( x, n, 1 );
+    Zeros( z, n, 1 );
+    Zeros( u, n, 1 );
+    const Int numIter =
+      El::ADMM<Real>( xUpdate, zUpdate, monitor, x, z, u, ctrl );
     if( ctrl.maxIter == numIter && grid.Rank() == 0 )
-        cout << "ADMM failed to converge" << endl;
-    x = xTmp;
+        Output("ADMM failed to converge");
     return numIter;
 }
 
@@ -33,6 +33,21 @@ void Mehrotra
         DirectLPSolution<DistMultiVec<Real>>& solution,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
+// Variants which reuse the symbolic analysis and equilibration stored in a
+// session between calls
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session );
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session );
+
 // NOTE: This should be in a different header
 template<typename Real>
 Int ADMM
@@ -216,15 +216,25 @@ void Equilibrate
         DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& equilibratedProblem,
         DirectLPSolution<Matrix<Real>>& equilibratedSolution,
         SparseDirectLPEquilibration<Real>& equilibration,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+  bool reuseScaling=false )
 {
     EL_DEBUG_CSE
     equilibratedProblem = problem;
     equilibratedSolution = solution;
 
-    RuizEquil
-    ( equilibratedProblem.A,
-      equilibration.rowScale, equilibration.colScale, ctrl.print );
+    if( reuseScaling )
+    {
+        // Apply the row and column scalings of a previous equilibration
+        DiagonalSolve
+        ( LEFT, NORMAL, equilibration.rowScale, equilibratedProblem.A );
+        DiagonalSolve
+        ( RIGHT, NORMAL, equilibration.colScale, equilibratedProblem.A );
+    }
+    else
+        RuizEquil
+        ( equilibratedProblem.A,
+          equilibration.rowScale, equilibration.colScale, ctrl.print );
 
     DiagonalSolve
     ( LEFT, NORMAL, equilibration.rowScale, equilibratedProblem.b );
@@ -267,7 +277,8 @@ void Equilibrate
           equilibratedProblem,
         DirectLPSolution<DistMultiVec<Real>>& equilibratedSolution,
         DistSparseDirectLPEquilibration<Real>& equilibration,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+  bool reuseScaling=false )
 {
     EL_DEBUG_CSE
     const Grid& grid = problem.A.Grid();
@@ -276,11 +287,22 @@ void Equilibrate
 
     equilibratedProblem = problem;
     equilibratedSolution = solution;
-    equilibration.rowScale.SetGrid( grid );
-    equilibration.colScale.SetGrid( grid );
-    RuizEquil
-    ( equilibratedProblem.A,
-      equilibration.rowScale, equilibration.colScale, ctrl.print );
+    if( reuseScaling )
+    {
+        // Apply the row and column scalings of a previous equilibration
+        DiagonalSolve
+        ( LEFT, NORMAL, equilibration.rowScale, equilibratedProblem.A );
+        DiagonalSolve
+        ( RIGHT, NORMAL, equilibration.colScale, equilibratedProblem.A );
+    }
+    else
+    {
+        equilibration.rowScale.SetGrid( grid );
+        equilibration.colScale.SetGrid( grid );
+        RuizEquil
+        ( equilibratedProblem.A,
+          equilibration.rowScale, equilibration.colScale, ctrl.print );
+    }
 
     DiagonalSolve
     ( LEFT, NORMAL, equilibration.rowScale, equilibratedProblem.b );
@@ -617,7 +639,7 @@ struct DirectKKTSolver<Real,Matrix<Real>,Matrix<Real>>
         {
             AugmentedKKT( problem.A, solution.x, solution.z, kktSystem );
         }
-        else if( system == NORMAL_KKT )
+        else // system is a variant of NORMAL_KKT
         {
             NormalKKT
             ( problem.A, Sqrt(permReg.dualEquality),
@@ -657,7 +679,7 @@ struct DirectKKTSolver<Real,Matrix<Real>,Matrix<Real>>
             ( solution.x, solution.z, residual.dualConic, temp,
               correction.x, correction.y, correction.z );
         }
-        else if( system == NORMAL_KKT )
+        else // system is a variant of NORMAL_KKT
         {
             NormalKKTRHS
             ( problem.A, Sqrt(permReg.dualEquality), solution.x, solution.z,
@@ -681,6 +703,7 @@ void EquilibratedMehrotra
   bool outputRoot )
 {
     EL_DEBUG_CSE
+    const Int m = problem.A.Height();
     const Int n = problem.A.Width();
     const Int degree = n;
 
@@ -790,6 +813,57 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DirectLPResidual<Matrix<Real>> centralityResidual;
+            DirectLPSolution<Matrix<Real>> centralityCorrection,
+              trialCorrection;
+            Zeros( centralityResidual.primalEquality, m, 1 );
+            Zeros( centralityResidual.dualEquality, n, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( solution.x, solution.z, correction.x, correction.z,
+                    centralityResidual.dualConic,
+                    alphaPriTarget, alphaDualTarget,
+                    state.sigma*state.barrier,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  solver.SolveSystem
+                  ( problem, permReg, centralityResidual, solution,
+                    centralityCorrection, ctrl.system );
+                  trialCorrection.x = correction.x;
+                  trialCorrection.y = correction.y;
+                  trialCorrection.z = correction.z;
+                  trialCorrection.x += centralityCorrection.x;
+                  trialCorrection.y += centralityCorrection.y;
+                  trialCorrection.z += centralityCorrection.z;
+                  alphaPriNew =
+                    pos_orth::MaxStep
+                    ( solution.x, trialCorrection.x, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep
+                    ( solution.z, trialCorrection.z, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  correction.x = trialCorrection.x;
+                  correction.y = trialCorrection.y;
+                  correction.z = trialCorrection.z;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && outputRoot )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && outputRoot )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -939,6 +1013,62 @@ void EquilibratedMehrotra
         return true;
       };
 
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DirectLPResidual<DistMatrix<Real>>& rhs,
+           DirectLPSolution<DistMatrix<Real>>& dir )
+      {
+        if( ctrl.system == FULL_KKT )
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS
+            ( rhs.dualEquality, rhs.primalEquality,
+              rhs.dualConic, solution.z, d );
+
+            // Solve for the direction
+            // -----------------------
+            if( !attemptToSolve(d) )
+                return false;
+            ExpandSolution( m, n, d, dir.x, dir.y, dir.z );
+        }
+        else if( ctrl.system == AUGMENTED_KKT )
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            AugmentedKKTRHS
+            ( solution.x, rhs.dualEquality, rhs.primalEquality,
+              rhs.dualConic, d );
+
+            // Solve for the direction
+            // -----------------------
+            if( !attemptToSolve(d) )
+                return false;
+            ExpandAugmentedSolution
+            ( solution.x, solution.z, rhs.dualConic, d,
+              dir.x, dir.y, dir.z );
+        }
+        else // ctrl.system is a variant of NORMAL_KKT
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              rhs.dualEquality, rhs.primalEquality,
+              rhs.dualConic, dir.y );
+
+            // Solve for the direction
+            // -----------------------
+            if( !attemptToSolve(dir.y) )
+                return false;
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              rhs.dualEquality, rhs.dualConic,
+              dir.x, dir.y, dir.z );
+        }
+        return true;
+      };
+
     DirectLPSolution<DistMatrix<Real>> affineCorrection, correction;
     ForceSimpleAlignments( affineCorrection, grid );
     ForceSimpleAlignments( correction, grid );
@@ -1069,7 +1199,7 @@ void EquilibratedMehrotra
             ( solution.x, solution.z, residual.dualConic, d,
               affineCorrection.x, affineCorrection.y, affineCorrection.z );
         }
-        else if( ctrl.system == NORMAL_KKT )
+        else // ctrl.system is a variant of NORMAL_KKT
         {
             // Construct the KKT system
             // ------------------------
@@ -1169,54 +1299,8 @@ void EquilibratedMehrotra
             residual.dualConic += correction.z;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS
-            ( residual.dualEquality, residual.primalEquality,
-              residual.dualConic, solution.z, d );
-
-            // Solve for the direction
-            // -----------------------
-            if( !attemptToSolve(d) )
-                break;
-            ExpandSolution( m, n, d, correction.x, correction.y, correction.z );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS
-            ( solution.x, residual.dualEquality, residual.primalEquality,
-              residual.dualConic, d );
-
-            // Solve for the direction
-            // -----------------------
-            if( !attemptToSolve(d) )
-                break;
-            ExpandAugmentedSolution
-            ( solution.x, solution.z, residual.dualConic, d,
-              correction.x, correction.y, correction.z );
-        }
-        else if( ctrl.system == NORMAL_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            NormalKKTRHS
-            ( problem.A, gammaPerm, solution.x, solution.z,
-              residual.dualEquality, residual.primalEquality,
-              residual.dualConic, correction.y );
-
-            // Solve for the direction
-            // -----------------------
-            if( !attemptToSolve(correction.y) )
-                break;
-            ExpandNormalSolution
-            ( problem.A, gammaPerm, solution.x, solution.z,
-              residual.dualEquality, residual.dualConic,
-              correction.x, correction.y, correction.z );
-        }
+        if( !solveWithFactorization( residual, correction ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -1229,6 +1313,59 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DirectLPResidual<DistMatrix<Real>> centralityResidual;
+            DirectLPSolution<DistMatrix<Real>> centralityCorrection,
+              trialCorrection;
+            ForceSimpleAlignments( centralityResidual, grid );
+            ForceSimpleAlignments( centralityCorrection, grid );
+            ForceSimpleAlignments( trialCorrection, grid );
+            Zeros( centralityResidual.primalEquality, m, 1 );
+            Zeros( centralityResidual.dualEquality, n, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( solution.x, solution.z, correction.x, correction.z,
+                    centralityResidual.dualConic,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( centralityResidual, centralityCorrection ) )
+                      return false;
+                  trialCorrection.x = correction.x;
+                  trialCorrection.y = correction.y;
+                  trialCorrection.z = correction.z;
+                  trialCorrection.x += centralityCorrection.x;
+                  trialCorrection.y += centralityCorrection.y;
+                  trialCorrection.z += centralityCorrection.z;
+                  alphaPriNew =
+                    pos_orth::MaxStep
+                    ( solution.x, trialCorrection.x, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep
+                    ( solution.z, trialCorrection.z, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  correction.x = trialCorrection.x;
+                  correction.y = trialCorrection.y;
+                  correction.z = trialCorrection.z;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1357,10 +1494,11 @@ void Mehrotra
 }
 
 template<typename Real>
-void EquilibratedMehrotra
+Int EquilibratedMehrotra
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session=nullptr )
 {
     EL_DEBUG_CSE
     const Int m = problem.A.Height();
@@ -1369,7 +1507,7 @@ void EquilibratedMehrotra
 
     // TODO(poulson): Move these into the control structure
     Real gammaPerm, deltaPerm, betaPerm, gammaTmp, deltaTmp, betaTmp;
-    if( ctrl.system == NORMAL_KKT )
+    if( ctrl.system != FULL_KKT && ctrl.system != AUGMENTED_KKT )
     {
         gammaPerm = deltaPerm = betaPerm = gammaTmp = deltaTmp = betaTmp = 0;
     }
@@ -1394,7 +1532,24 @@ void EquilibratedMehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    SparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the factorization (and, when possible, its symbolic analysis)
+    // stored in the session, if there is one
+    SparseLDLFactorization<Real> localSparseLDLFact;
+    SparseLDLFactorization<Real>& sparseLDLFact =
+      ( session ? session->factorization : localSparseLDLFact );
+
+    // The entrywise square of A determines the diagonal of the normal
+    // matrix for the matrix-free preconditioner
+    SparseMatrix<Real> ASquared;
+    if( ctrl.system == MATRIX_FREE_NORMAL_KKT )
+    {
+        ASquared = problem.A;
+        EntrywiseMap
+        ( ASquared,
+          function<Real(const Real&)>
+          ( []( const Real& alpha ) { return alpha*alpha; } ) );
+    }
+
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -1405,6 +1560,14 @@ void EquilibratedMehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    else if( ctrl.system == MATRIX_FREE_NORMAL_KKT )
+    {
+        MatrixFreeInitialize
+        ( problem, ASquared, solution,
+          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          ctrl.solveCtrl.relTol, ctrl.maxKrylovIts, ctrl.krylovPrecondRank,
+          ctrl.solveCtrl.progress );
+    }
     else
     {
         SparseLDLFactorization<Real> augmentedSparseLDLFact;
@@ -1434,7 +1597,7 @@ void EquilibratedMehrotra
             else        regTmp(i) = -deltaTmp*deltaTmp;
         }
     }
-    else if( ctrl.system == NORMAL_KKT )
+    else
     {
         regTmp.Resize( m, 1 );
         Fill( regTmp, deltaTmp*deltaTmp );
@@ -1444,15 +1607,140 @@ void EquilibratedMehrotra
     Real muOld = 0.1;
     Real relError = 1;
     SparseMatrix<Real> J, JOrig;
+
+    // Split off the dense columns of A from the normal equations
+    SparseMatrix<Real> ASparse;
+    Int numDenseColumns = 0;
+    if( ctrl.system == SPLIT_NORMAL_KKT )
+    {
+        numDenseColumns =
+          SplitDenseColumns
+          ( problem.A, ASparse,
+            ctrl.denseColumnRatio, ctrl.denseColumnMinNonzeros );
+        if( ctrl.print )
+            Output("Split off ",numDenseColumns," dense columns of A");
+    }
+    const Int maxSplitNormalIts =
+      numDenseColumns + 1 + ctrl.solveCtrl.maxRefineIts;
+
+    // The relative tolerance of the matrix-free solves
+    Real krylovTol = ctrl.solveCtrl.relTol;
     Matrix<Real> d, w;
     Matrix<Real> dInner;
 
     DirectLPSolution<Matrix<Real>> affineCorrection, correction;
     DirectLPResidual<Matrix<Real>> residual, error;
 
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DirectLPResidual<Matrix<Real>>& rhs,
+           DirectLPSolution<Matrix<Real>>& dir )
+      {
+        if( ctrl.system == FULL_KKT )
+        {
+            KKTRHS
+            ( rhs.dualEquality, rhs.primalEquality,
+              rhs.dualConic, solution.z, d );
+            try
+            {
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandSolution( m, n, d, dir.x, dir.y, dir.z );
+        }
+        else if( ctrl.system == AUGMENTED_KKT )
+        {
+            AugmentedKKTRHS
+            ( solution.x, rhs.dualEquality, rhs.primalEquality,
+              rhs.dualConic, d );
+            try
+            {
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandAugmentedSolution
+            ( solution.x, solution.z, rhs.dualConic, d,
+              dir.x, dir.y, dir.z );
+        }
+        else
+        {
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              rhs.dualEquality, rhs.primalEquality,
+              rhs.dualConic, dir.y );
+            try
+            {
+                if( ctrl.system == SPLIT_NORMAL_KKT )
+                    SplitNormalSolve
+                    ( problem.A, gammaPerm, deltaPerm,
+                      solution.x, solution.z, sparseLDLFact, dir.y,
+                      ctrl.solveCtrl.relTol, maxSplitNormalIts,
+                      ctrl.solveCtrl.progress );
+                else if( ctrl.system == MATRIX_FREE_NORMAL_KKT )
+                    MatrixFreeNormalSolve
+                    ( problem.A, ASquared, gammaPerm, deltaPerm,
+                      solution.x, solution.z, dir.y,
+                      krylovTol, ctrl.maxKrylovIts, ctrl.krylovPrecondRank,
+                      ctrl.solveCtrl.progress );
+                else
+                    // NOTE: regTmp should be all zeros
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, dir.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              rhs.dualEquality, rhs.dualConic,
+              dir.x, dir.y, dir.z );
+        }
+        return true;
+      };
+
     Matrix<Real> prod;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts = 0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -1492,6 +1780,9 @@ void EquilibratedMehrotra
         // Now check the pieces
         // --------------------
         relError = Max(Max(objConv,rbConv),rcConv);
+        krylovTol =
+          Max( ctrl.krylovForcingFactor*Min(relError,Real(1)),
+               ctrl.solveCtrl.relTol );
 
         // Compute the scaling point
         // =========================
@@ -1588,7 +1879,8 @@ void EquilibratedMehrotra
 
                 if( numIts == 0 &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                     (ctrl.primalInit && ctrl.dualInit)) &&
+                    !(session && session->CanReuseAnalysis(J,ctrl.system)) )
                 {
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
@@ -1598,6 +1890,8 @@ void EquilibratedMehrotra
                 {
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
+                if( session && numIts == 0 )
+                    session->RecordAnalysis( J, ctrl.system );
 
                 sparseLDLFact.Factor( LDL_2D );
                 if( ctrl.resolveReg )
@@ -1627,15 +1921,54 @@ void EquilibratedMehrotra
                 ( solution.x, solution.z, residual.dualConic, d,
                   affineCorrection.x, affineCorrection.y, affineCorrection.z );
         }
-        else // ctrl.system == NORMAL_KKT
+        else if( ctrl.system == MATRIX_FREE_NORMAL_KKT )
+        {
+            // Inexactly solve the normal equations using products with A
+            // -----------------------------------------------------------
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.primalEquality,
+              residual.dualConic, affineCorrection.y );
+            try
+            {
+                const Int krylovIts =
+                  MatrixFreeNormalSolve
+                  ( problem.A, ASquared, gammaPerm, deltaPerm,
+                    solution.x, solution.z, affineCorrection.y,
+                    krylovTol, ctrl.maxKrylovIts, ctrl.krylovPrecondRank,
+                    ctrl.solveCtrl.progress );
+                if( ctrl.print )
+                    Output
+                    ("Affine PCG: ",krylovIts," iterations with tolerance ",
+                     krylovTol);
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    break;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.dualConic,
+              affineCorrection.x, affineCorrection.y, affineCorrection.z );
+        }
+        else // ctrl.system == NORMAL_KKT || ctrl.system == SPLIT_NORMAL_KKT
         {
             // Construct the KKT system
             // ------------------------
             // TODO(poulson): Apply updates to a matrix of explicit zeros
             // (with the correct sparsity pattern)
-            NormalKKT
-            ( problem.A, gammaPerm, deltaPerm,
-              solution.x, solution.z, J, false );
+            if( ctrl.system == SPLIT_NORMAL_KKT )
+                SplitNormalKKT
+                ( ASparse, gammaPerm, deltaPerm,
+                  solution.x, solution.z, J, false );
+            else
+                NormalKKT
+                ( problem.A, gammaPerm, deltaPerm,
+                  solution.x, solution.z, J, false );
             NormalKKTRHS
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
@@ -1645,7 +1978,8 @@ void EquilibratedMehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( numIts == 0 &&
+                    !(session && session->CanReuseAnalysis(J,ctrl.system)) )
                 {
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
@@ -1655,16 +1989,26 @@ void EquilibratedMehrotra
                 {
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
+                if( session && numIts == 0 )
+                    session->RecordAnalysis( J, ctrl.system );
 
                 sparseLDLFact.Factor( LDL_2D );
 
-                // NOTE: regTmp should be all zeros; replace with unregularized
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, affineCorrection.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                if( ctrl.system == SPLIT_NORMAL_KKT )
+                    SplitNormalSolve
+                    ( problem.A, gammaPerm, deltaPerm,
+                      solution.x, solution.z, sparseLDLFact,
+                      affineCorrection.y,
+                      ctrl.solveCtrl.relTol, maxSplitNormalIts,
+                      ctrl.solveCtrl.progress );
+                else
+                    // NOTE: regTmp should be all zeros
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, affineCorrection.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
             }
             catch(...)
             {
@@ -1757,103 +2101,70 @@ void EquilibratedMehrotra
             residual.dualConic += correction.z;
         }
 
-        if( ctrl.system == FULL_KKT )
+        if( !solveWithFactorization( residual, correction ) )
+            break;
+        // TODO(poulson): Residual checks
+
+        // Update the current estimates
+        // ============================
+        Real alphaPri =
+          pos_orth::MaxStep( solution.x, correction.x, 1/ctrl.maxStepRatio );
+        Real alphaDual =
+          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
+        alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
+        alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
         {
-            KKTRHS
-            ( residual.dualEquality, residual.primalEquality,
-              residual.dualConic, solution.z, d );
-            try
-            {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, correction.x, correction.y, correction.z );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            AugmentedKKTRHS
-            ( solution.x, residual.dualEquality, residual.primalEquality,
-              residual.dualConic, d );
-            try
-            {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution
-            ( solution.x, solution.z, residual.dualConic, d,
-              correction.x, correction.y, correction.z );
-        }
-        else
-        {
-            NormalKKTRHS
-            ( problem.A, gammaPerm, solution.x, solution.z,
-              residual.dualEquality, residual.primalEquality,
-              residual.dualConic, correction.y );
-            try
-            {
-                // NOTE: regTmp should be all zeros; replace with unregularized
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, correction.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandNormalSolution
-            ( problem.A, gammaPerm, solution.x, solution.z,
-              residual.dualEquality, residual.dualConic,
-              correction.x, correction.y, correction.z );
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DirectLPResidual<Matrix<Real>> centralityResidual;
+            DirectLPSolution<Matrix<Real>> centralityCorrection,
+              trialCorrection;
+            Zeros( centralityResidual.primalEquality, m, 1 );
+            Zeros( centralityResidual.dualEquality, n, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( solution.x, solution.z, correction.x, correction.z,
+                    centralityResidual.dualConic,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( centralityResidual, centralityCorrection ) )
+                      return false;
+                  trialCorrection.x = correction.x;
+                  trialCorrection.y = correction.y;
+                  trialCorrection.z = correction.z;
+                  trialCorrection.x += centralityCorrection.x;
+                  trialCorrection.y += centralityCorrection.y;
+                  trialCorrection.z += centralityCorrection.z;
+                  alphaPriNew =
+                    pos_orth::MaxStep
+                    ( solution.x, trialCorrection.x, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep
+                    ( solution.z, trialCorrection.z, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  correction.x = trialCorrection.x;
+                  correction.y = trialCorrection.y;
+                  correction.z = trialCorrection.z;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print )
+                Output("Accepted ",numCorrectors," centrality correctors");
         }
-        // TODO(poulson): Residual checks
-
-        // Update the current estimates
-        // ============================
-        Real alphaPri =
-          pos_orth::MaxStep( solution.x, correction.x, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
-        alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
-        alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
-        if( ctrl.forceSameStep )
-            alphaPri = alphaDual = Min(alphaPri,alphaDual);
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1869,13 +2180,15 @@ void EquilibratedMehrotra
         }
     }
     SetIndent( indent );
+    return numIts;
 }
 
 template<typename Real>
 void Mehrotra
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session )
 {
     EL_DEBUG_CSE
     if( ctrl.outerEquil )
@@ -1883,15 +2196,38 @@ void Mehrotra
         DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> equilibratedProblem;
         DirectLPSolution<Matrix<Real>> equilibratedSolution;
         SparseDirectLPEquilibration<Real> equilibration;
+        const bool reuseScaling =
+          session && session->reuseEquilibration && session->equilibrated &&
+          session->rowScaleA.Height() == problem.A.Height() &&
+          session->colScale.Height() == problem.A.Width();
+        if( reuseScaling )
+        {
+            equilibration.rowScale = session->rowScaleA;
+            equilibration.colScale = session->colScale;
+        }
         Equilibrate
         ( problem, solution,
-          equilibratedProblem, equilibratedSolution, equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+          equilibratedProblem, equilibratedSolution, equilibration, ctrl,
+          reuseScaling );
+        if( session && !reuseScaling )
+        {
+            session->rowScaleA = equilibration.rowScale;
+            session->colScale = equilibration.colScale;
+            session->equilibrated = true;
+        }
+        const Int numIts =
+          EquilibratedMehrotra
+          ( equilibratedProblem, equilibratedSolution, ctrl, session );
+        if( session )
+            session->RecordIterations( numIts );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        const Int numIts =
+          EquilibratedMehrotra( problem, solution, ctrl, session );
+        if( session )
+            session->RecordIterations( numIts );
     }
     if( ctrl.print )
     {
@@ -1912,6 +2248,17 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseMehrotraSession<Real>* session = nullptr;
+    Mehrotra( problem, solution, ctrl, session );
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void Mehrotra
@@ -1940,10 +2287,11 @@ void Mehrotra
 
 // TODO(poulson): Not use temporary regularization except in final iterations?
 template<typename Real>
-void EquilibratedMehrotra
+Int EquilibratedMehrotra
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         DirectLPSolution<DistMultiVec<Real>>& solution,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session=nullptr )
 {
     EL_DEBUG_CSE
     const Int m = problem.A.Height();
@@ -1955,7 +2303,7 @@ void EquilibratedMehrotra
 
     // TODO(poulson): Move these into the control structure
     Real gammaPerm, deltaPerm, betaPerm, gammaTmp, deltaTmp, betaTmp;
-    if( ctrl.system == NORMAL_KKT )
+    if( ctrl.system != FULL_KKT && ctrl.system != AUGMENTED_KKT )
     {
         gammaPerm = deltaPerm = betaPerm = gammaTmp = deltaTmp = betaTmp = 0;
     }
@@ -1985,7 +2333,24 @@ void EquilibratedMehrotra
         }
     }
 
-    DistSparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the factorization (and, when possible, its symbolic analysis)
+    // stored in the session, if there is one
+    DistSparseLDLFactorization<Real> localSparseLDLFact;
+    DistSparseLDLFactorization<Real>& sparseLDLFact =
+      ( session ? session->factorization : localSparseLDLFact );
+
+    // The entrywise square of A determines the diagonal of the normal
+    // matrix for the matrix-free preconditioner
+    DistSparseMatrix<Real> ASquared(grid);
+    if( ctrl.system == MATRIX_FREE_NORMAL_KKT )
+    {
+        ASquared = problem.A;
+        EntrywiseMap
+        ( ASquared,
+          function<Real(const Real&)>
+          ( []( const Real& alpha ) { return alpha*alpha; } ) );
+    }
+
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -1998,6 +2363,14 @@ void EquilibratedMehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    else if( ctrl.system == MATRIX_FREE_NORMAL_KKT )
+    {
+        MatrixFreeInitialize
+        ( problem, ASquared, solution,
+          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          ctrl.solveCtrl.relTol, ctrl.maxKrylovIts, ctrl.krylovPrecondRank,
+          ctrl.solveCtrl.progress );
+    }
     else
     {
         DistSparseLDLFactorization<Real> augmentedSparseLDLFact;
@@ -2031,7 +2404,7 @@ void EquilibratedMehrotra
             else        regTmp.SetLocal( iLoc, 0, -deltaTmp*deltaTmp );
         }
     }
-    else if( ctrl.system == NORMAL_KKT )
+    else
     {
         regTmp.Resize( m, 1 );
         Fill( regTmp, deltaTmp*deltaTmp );
@@ -2043,6 +2416,24 @@ void EquilibratedMehrotra
 
     DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
+
+    // Split off the dense columns of A from the normal equations
+    DistSparseMatrix<Real> ASparse(grid);
+    Int numDenseColumns = 0;
+    if( ctrl.system == SPLIT_NORMAL_KKT )
+    {
+        numDenseColumns =
+          SplitDenseColumns
+          ( problem.A, ASparse,
+            ctrl.denseColumnRatio, ctrl.denseColumnMinNonzeros );
+        if( ctrl.print && commRank == 0 )
+            Output("Split off ",numDenseColumns," dense columns of A");
+    }
+    const Int maxSplitNormalIts =
+      numDenseColumns + 1 + ctrl.solveCtrl.maxRefineIts;
+
+    // The relative tolerance of the matrix-free solves
+    Real krylovTol = ctrl.solveCtrl.relTol;
     DistMultiVec<Real> d(grid), w(grid);
     DistMultiVec<Real> dInner(grid);
 
@@ -2053,9 +2444,127 @@ void EquilibratedMehrotra
     ForceSimpleAlignments( residual, grid );
     ForceSimpleAlignments( error, grid );
 
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DirectLPResidual<DistMultiVec<Real>>& rhs,
+           DirectLPSolution<DistMultiVec<Real>>& dir )
+      {
+        if( ctrl.system == FULL_KKT )
+        {
+            KKTRHS
+            ( rhs.dualEquality, rhs.primalEquality,
+              rhs.dualConic, solution.z, d );
+            try
+            {
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+                if( commRank == 0 && ctrl.time )
+                    Output("Corrector: ",timer.Stop()," secs");
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandSolution( m, n, d, dir.x, dir.y, dir.z );
+        }
+        else if( ctrl.system == AUGMENTED_KKT )
+        {
+            AugmentedKKTRHS
+            ( solution.x, rhs.dualEquality, rhs.primalEquality,
+              rhs.dualConic, d );
+            try
+            {
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+                if( commRank == 0 && ctrl.time )
+                    Output("Corrector: ",timer.Stop()," secs");
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandAugmentedSolution
+            ( solution.x, solution.z, rhs.dualConic, d,
+              dir.x, dir.y, dir.z );
+        }
+        else
+        {
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              rhs.dualEquality, rhs.primalEquality,
+              rhs.dualConic, dir.y );
+            try
+            {
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                if( ctrl.system == SPLIT_NORMAL_KKT )
+                    SplitNormalSolve
+                    ( problem.A, gammaPerm, deltaPerm,
+                      solution.x, solution.z, sparseLDLFact, dir.y,
+                      ctrl.solveCtrl.relTol, maxSplitNormalIts,
+                      ctrl.solveCtrl.progress );
+                else if( ctrl.system == MATRIX_FREE_NORMAL_KKT )
+                    MatrixFreeNormalSolve
+                    ( problem.A, ASquared, gammaPerm, deltaPerm,
+                      solution.x, solution.z, dir.y,
+                      krylovTol, ctrl.maxKrylovIts, ctrl.krylovPrecondRank,
+                      ctrl.solveCtrl.progress );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, dir.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+                if( commRank == 0 && ctrl.time )
+                    Output("Corrector: ",timer.Stop()," secs");
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              rhs.dualEquality, rhs.dualConic,
+              dir.x, dir.y, dir.z );
+        }
+        return true;
+      };
+
     DistMultiVec<Real> prod(grid);
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts = 0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -2106,6 +2615,9 @@ void EquilibratedMehrotra
         // Now check the pieces
         // --------------------
         relError = Max(Max(objConv,rbConv),rcConv);
+        krylovTol =
+          Max( ctrl.krylovForcingFactor*Min(relError,Real(1)),
+               ctrl.solveCtrl.relTol );
         if( ctrl.print )
         {
             const Real xNrm2 = FrobeniusNorm( solution.x );
@@ -2208,7 +2720,8 @@ void EquilibratedMehrotra
 
                 if( numIts == 0 &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                     (ctrl.primalInit && ctrl.dualInit)) &&
+                    !(session && session->CanReuseAnalysis(J,ctrl.system)) )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
@@ -2220,6 +2733,8 @@ void EquilibratedMehrotra
                 }
                 else
                     sparseLDLFact.ChangeNonzeroValues( J );
+                if( session && numIts == 0 )
+                    session->RecordAnalysis( J, ctrl.system );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -2259,14 +2774,53 @@ void EquilibratedMehrotra
                 ( solution.x, solution.z, residual.dualConic, d,
                   affineCorrection.x, affineCorrection.y, affineCorrection.z );
         }
-        else // ctrl.system == NORMAL_KKT
+        else if( ctrl.system == MATRIX_FREE_NORMAL_KKT )
+        {
+            // Inexactly solve the normal equations using products with A
+            // -----------------------------------------------------------
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.primalEquality,
+              residual.dualConic, affineCorrection.y );
+            try
+            {
+                const Int krylovIts =
+                  MatrixFreeNormalSolve
+                  ( problem.A, ASquared, gammaPerm, deltaPerm,
+                    solution.x, solution.z, affineCorrection.y,
+                    krylovTol, ctrl.maxKrylovIts, ctrl.krylovPrecondRank,
+                    ctrl.solveCtrl.progress );
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Affine PCG: ",krylovIts," iterations with tolerance ",
+                     krylovTol);
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    break;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.dualConic,
+              affineCorrection.x, affineCorrection.y, affineCorrection.z );
+        }
+        else // ctrl.system == NORMAL_KKT || ctrl.system == SPLIT_NORMAL_KKT
         {
             // Assemble the KKT system
             // -----------------------
             // TODO(poulson): Apply updates on top of explicit zeros
-            NormalKKT
-            ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
-              J, false );
+            if( ctrl.system == SPLIT_NORMAL_KKT )
+                SplitNormalKKT
+                ( ASparse, gammaPerm, deltaPerm, solution.x, solution.z,
+                  J, false );
+            else
+                NormalKKT
+                ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
+                  J, false );
             NormalKKTRHS
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
@@ -2290,7 +2844,8 @@ void EquilibratedMehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( numIts == 0 &&
+                    !(session && session->CanReuseAnalysis(J,ctrl.system)) )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
@@ -2304,6 +2859,8 @@ void EquilibratedMehrotra
                 {
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
+                if( session && numIts == 0 )
+                    session->RecordAnalysis( J, ctrl.system );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -2313,12 +2870,20 @@ void EquilibratedMehrotra
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, affineCorrection.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                if( ctrl.system == SPLIT_NORMAL_KKT )
+                    SplitNormalSolve
+                    ( problem.A, gammaPerm, deltaPerm,
+                      solution.x, solution.z, sparseLDLFact,
+                      affineCorrection.y,
+                      ctrl.solveCtrl.relTol, maxSplitNormalIts,
+                      ctrl.solveCtrl.progress );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, affineCorrection.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
                 if( commRank == 0 && ctrl.time )
                     Output("Affine: ",timer.Stop()," secs");
             }
@@ -2413,102 +2978,8 @@ void EquilibratedMehrotra
             residual.dualConic += correction.z;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            KKTRHS
-            ( residual.dualEquality, residual.primalEquality,
-              residual.dualConic, solution.z, d );
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, correction.x, correction.y, correction.z );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            AugmentedKKTRHS
-            ( solution.x, residual.dualEquality, residual.primalEquality,
-              residual.dualConic, d );
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution
-            ( solution.x, solution.z, residual.dualConic, d,
-              correction.x, correction.y, correction.z );
-        }
-        else
-        {
-            NormalKKTRHS
-            ( problem.A, gammaPerm, solution.x, solution.z,
-              residual.dualEquality, residual.primalEquality,
-              residual.dualConic, correction.y );
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, correction.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandNormalSolution
-            ( problem.A, gammaPerm, solution.x, solution.z,
-              residual.dualEquality, residual.dualConic,
-              correction.x, correction.y, correction.z );
-        }
+        if( !solveWithFactorization( residual, correction ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -2521,6 +2992,59 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DirectLPResidual<DistMultiVec<Real>> centralityResidual;
+            DirectLPSolution<DistMultiVec<Real>> centralityCorrection,
+              trialCorrection;
+            ForceSimpleAlignments( centralityResidual, grid );
+            ForceSimpleAlignments( centralityCorrection, grid );
+            ForceSimpleAlignments( trialCorrection, grid );
+            Zeros( centralityResidual.primalEquality, m, 1 );
+            Zeros( centralityResidual.dualEquality, n, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( solution.x, solution.z, correction.x, correction.z,
+                    centralityResidual.dualConic,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( centralityResidual, centralityCorrection ) )
+                      return false;
+                  trialCorrection.x = correction.x;
+                  trialCorrection.y = correction.y;
+                  trialCorrection.z = correction.z;
+                  trialCorrection.x += centralityCorrection.x;
+                  trialCorrection.y += centralityCorrection.y;
+                  trialCorrection.z += centralityCorrection.z;
+                  alphaPriNew =
+                    pos_orth::MaxStep
+                    ( solution.x, trialCorrection.x, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep
+                    ( solution.z, trialCorrection.z, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  correction.x = trialCorrection.x;
+                  correction.y = trialCorrection.y;
+                  correction.z = trialCorrection.z;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -2536,13 +3060,15 @@ void EquilibratedMehrotra
         }
     }
     SetIndent( indent );
+    return numIts;
 }
 
 template<typename Real>
 void Mehrotra
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         DirectLPSolution<DistMultiVec<Real>>& solution,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session )
 {
     EL_DEBUG_CSE
     if( ctrl.outerEquil )
@@ -2551,15 +3077,38 @@ void Mehrotra
           equilibratedProblem;
         DirectLPSolution<DistMultiVec<Real>> equilibratedSolution;
         DistSparseDirectLPEquilibration<Real> equilibration;
+        const bool reuseScaling =
+          session && session->reuseEquilibration && session->equilibrated &&
+          session->rowScaleA.Height() == problem.A.Height() &&
+          session->colScale.Height() == problem.A.Width();
+        if( reuseScaling )
+        {
+            equilibration.rowScale = session->rowScaleA;
+            equilibration.colScale = session->colScale;
+        }
         Equilibrate
         ( problem, solution,
-          equilibratedProblem, equilibratedSolution, equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+          equilibratedProblem, equilibratedSolution, equilibration, ctrl,
+          reuseScaling );
+        if( session && !reuseScaling )
+        {
+            session->rowScaleA = equilibration.rowScale;
+            session->colScale = equilibration.colScale;
+            session->equilibrated = true;
+        }
+        const Int numIts =
+          EquilibratedMehrotra
+          ( equilibratedProblem, equilibratedSolution, ctrl, session );
+        if( session )
+            session->RecordIterations( numIts );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        const Int numIts =
+          EquilibratedMehrotra( problem, solution, ctrl, session );
+        if( session )
+            session->RecordIterations( numIts );
     }
     if( ctrl.print )
     {
@@ -2581,6 +3130,17 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseMehrotraSession<Real>* session = nullptr;
+    Mehrotra( problem, solution, ctrl, session );
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void Mehrotra
@@ -2642,6 +3202,11 @@ void Mehrotra
           DirectLPSolution<Matrix<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+    const MehrotraCtrl<Real>& ctrl, \
+          SparseMehrotraSession<Real>* session ); \
+  template void Mehrotra \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
@@ -2654,6 +3219,11 @@ void Mehrotra
           DirectLPSolution<DistMultiVec<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          DirectLPSolution<DistMultiVec<Real>>& solution, \
+    const MehrotraCtrl<Real>& ctrl, \
+          DistSparseMehrotraSession<Real>* session ); \
+  template void Mehrotra \
   ( const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
     const DistMultiVec<Real>& c, \
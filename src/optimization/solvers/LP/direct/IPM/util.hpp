@@ -239,6 +239,129 @@ void ExpandNormalSolution
   const DistMultiVec<Real>& dy,
         DistMultiVec<Real>& dz );
 
+// Normal equations with the dense columns of A split off
+// =======================================================
+// Returns the number of columns of A which were deemed dense and dropped
+// from 'ASparse'.
+template<typename Real>
+Int SplitDenseColumns
+( const SparseMatrix<Real>& A,
+        SparseMatrix<Real>& ASparse,
+        Real denseColumnRatio,
+        Int denseColumnMinNonzeros );
+template<typename Real>
+Int SplitDenseColumns
+( const DistSparseMatrix<Real>& A,
+        DistSparseMatrix<Real>& ASparse,
+        Real denseColumnRatio,
+        Int denseColumnMinNonzeros );
+
+template<typename Real>
+void SplitNormalKKT
+( const SparseMatrix<Real>& ASparse,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+  bool onlyLower=true );
+template<typename Real>
+void SplitNormalKKT
+( const DistSparseMatrix<Real>& ASparse,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower=true );
+
+// Overwrite d with the solution of (A D^2 A^T + delta^2 I) dy = d using PCG,
+// where 'sparseLDLFact' holds the factorization from SplitNormalKKT. The
+// number of PCG iterations is returned.
+template<typename Real>
+Int SplitNormalSolve
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+  const SparseLDLFactorization<Real>& sparseLDLFact,
+        Matrix<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress );
+template<typename Real>
+Int SplitNormalSolve
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+  const DistSparseLDLFactorization<Real>& sparseLDLFact,
+        DistMultiVec<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress );
+
+// Matrix-free solves of the normal equations
+// ==========================================
+template<typename Real>
+void MatrixFreeInitialize
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  const SparseMatrix<Real>& ASquared,
+        DirectLPSolution<Matrix<Real>>& solution,
+  bool primalInit,
+  bool dualInit,
+  bool standardShift,
+  Real relTol,
+  Int maxIts,
+  Int precondRank,
+  bool progress );
+template<typename Real>
+void MatrixFreeInitialize
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+  const DistSparseMatrix<Real>& ASquared,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+  bool primalInit,
+  bool dualInit,
+  bool standardShift,
+  Real relTol,
+  Int maxIts,
+  Int precondRank,
+  bool progress );
+
+// Overwrite d with the solution of (A D^2 A^T + delta^2 I) dy = d using
+// Conjugate Gradient preconditioned with a partial Cholesky factorization of
+// the 'precondRank' largest pivots (zero yields a Jacobi preconditioner).
+// ASquared should be the entrywise square of A. The number of iterations is
+// returned.
+template<typename Real>
+Int MatrixFreeNormalSolve
+( const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& ASquared,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Matrix<Real>& d,
+        Real relTol,
+        Int maxIts,
+        Int precondRank,
+        bool progress );
+template<typename Real>
+Int MatrixFreeNormalSolve
+( const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& ASquared,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& d,
+        Real relTol,
+        Int maxIts,
+        Int precondRank,
+        bool progress );
+
 } // namespace direct
 } // namespace lp
 } // namespace El
@@ -0,0 +1,567 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../util.hpp"
+
+namespace El {
+namespace lp {
+namespace direct {
+
+// When the fill-in of a sparse factorization of the normal equations
+//
+//   (A D^2 A^T + delta^2 I) dy = A D^2 (r_1 + inv(X) r_3) - r_2,
+//
+// is prohibitive, they can instead be solved inexactly using Preconditioned
+// Conjugate Gradient, which only requires products with A and A^T. The
+// diagonal of A D^2 A^T is (A o A) d^2, where 'o' is the Hadamard product,
+// and the columns of the normal matrix corresponding to its largest diagonal
+// entries can be formed with a single multi-vector product, which allows
+// for the partial Cholesky preconditioner of
+//
+//   J. Gondzio, "Matrix-free interior point method",
+//   Computational Optimization and Applications, Vol. 51, pp. 457--480, 2012.
+//
+// The PCG tolerance is tied to the residual of the IPM via a forcing
+// sequence, as also described there.
+//
+
+namespace {
+
+template<typename Real>
+Int FirstLocalRow( const Matrix<Real>& v ) { return 0; }
+template<typename Real>
+Int FirstLocalRow( const DistMultiVec<Real>& v ) { return v.FirstLocalRow(); }
+
+template<typename Real>
+Matrix<Real>& LocalPart( Matrix<Real>& v ) { return v; }
+template<typename Real>
+Matrix<Real>& LocalPart( DistMultiVec<Real>& v ) { return v.Matrix(); }
+
+template<typename Real>
+const Matrix<Real>& LockedLocalPart( const Matrix<Real>& v ) { return v; }
+template<typename Real>
+const Matrix<Real>& LockedLocalPart( const DistMultiVec<Real>& v )
+{ return v.LockedMatrix(); }
+
+// Sum the (contiguous) matrix Z over the processes sharing v
+template<typename Real>
+void SumOver( const Matrix<Real>& v, Matrix<Real>& Z ) { }
+template<typename Real>
+void SumOver( const DistMultiVec<Real>& v, Matrix<Real>& Z )
+{ mpi::AllReduce( Z.Buffer(), Z.Height()*Z.Width(), v.Grid().Comm() ); }
+
+// Return the (global) indices of the (at most) k largest entries of v
+template<typename Real>
+vector<Int>
+LocalLargestEntries( const Matrix<Real>& vLoc, Int firstRow, Int k )
+{
+    const Int localHeight = vLoc.Height();
+    vector<Int> indices( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        indices[iLoc] = iLoc;
+    k = Min( k, localHeight );
+    std::partial_sort
+    ( indices.begin(), indices.begin()+k, indices.end(),
+      [&]( const Int& i, const Int& j ) { return vLoc(i) > vLoc(j); } );
+    indices.resize( k );
+    for( auto& index : indices )
+        index += firstRow;
+    return indices;
+}
+
+template<typename Real>
+vector<Int> LargestEntries( const Matrix<Real>& v, Int k )
+{ return LocalLargestEntries( v, 0, k ); }
+
+template<typename Real>
+vector<Int> LargestEntries( const DistMultiVec<Real>& v, Int k )
+{
+    EL_DEBUG_CSE
+    const auto& vLoc = v.LockedMatrix();
+    const Int firstRow = v.FirstLocalRow();
+    const vector<Int> localIndices = LocalLargestEntries( vLoc, firstRow, k );
+
+    // Gather the local candidates (padded with negative values)
+    mpi::Comm comm = v.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    vector<double> values( k, -1. ), allValues( k*commSize );
+    vector<Int> indices( k, -1 ), allIndices( k*commSize );
+    for( Int j=0; j<Int(localIndices.size()); ++j )
+    {
+        indices[j] = localIndices[j];
+        values[j] = double(vLoc(localIndices[j]-firstRow));
+    }
+    mpi::AllGather( values.data(), k, allValues.data(), k, comm );
+    mpi::AllGather( indices.data(), k, allIndices.data(), k, comm );
+
+    vector<Int> order( k*commSize );
+    for( Int j=0; j<k*commSize; ++j )
+        order[j] = j;
+    k = Min( k, v.Height() );
+    std::partial_sort
+    ( order.begin(), order.begin()+k, order.end(),
+      [&]( const Int& i, const Int& j )
+      { return allValues[i] > allValues[j] ||
+               (allValues[i] == allValues[j] && allIndices[i] < allIndices[j]);
+      } );
+    vector<Int> largest( k );
+    for( Int j=0; j<k; ++j )
+        largest[j] = allIndices[order[j]];
+    return largest;
+}
+
+// The partial Cholesky preconditioner
+//
+//   P = | C   | | C^T  L21^T | + | 0     |
+//       | L21 | |            |   |   D_S |,
+//
+// where, up to a symmetric permutation, [C; L21] C^T is equal to the k
+// columns of the normal matrix M with the largest diagonal entries, and D_S
+// is the diagonal of the Schur complement M_{22} - L21 L21^T. The rows of
+// C and L21 are respectively redundantly stored and distributed like v.
+template<typename Real>
+struct PartialCholesky
+{
+    vector<Int> localPivots;
+    Matrix<Real> C, L21, schurDiag;
+};
+
+template<typename Real,class SparseMatrixType,class VectorType>
+void FormPartialCholesky
+( const SparseMatrixType& A,
+  const VectorType& dSquared,
+        Real delta,
+  const VectorType& diagNormal,
+        Real diagFloor,
+        Int rank,
+        PartialCholesky<Real>& precond )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const auto& diagNormalLoc = LockedLocalPart( diagNormal );
+    const Int firstRow = FirstLocalRow( diagNormal );
+    const Int localHeight = diagNormalLoc.Height();
+    precond.schurDiag = diagNormalLoc;
+    precond.localPivots.clear();
+    if( rank <= 0 )
+        return;
+
+    const vector<Int> pivots = LargestEntries( diagNormal, rank );
+    const Int k = pivots.size();
+    precond.localPivots.resize( k );
+    for( Int j=0; j<k; ++j )
+    {
+        const Int iLoc = pivots[j] - firstRow;
+        precond.localPivots[j] =
+          ( iLoc >= 0 && iLoc < localHeight ? iLoc : -1 );
+    }
+
+    // M := (A D^2 A^T + delta^2 I) E, where E consists of the pivot columns
+    // of the identity
+    auto M = diagNormal;
+    Zeros( M, m, k );
+    auto& MLoc = LocalPart( M );
+    for( Int j=0; j<k; ++j )
+        if( precond.localPivots[j] >= 0 )
+            MLoc( precond.localPivots[j], j ) = Real(1);
+    auto T = dSquared;
+    Zeros( T, n, k );
+    Multiply( TRANSPOSE, Real(1), A, M, Real(0), T );
+    DiagonalScale( LEFT, NORMAL, dSquared, T );
+    M *= delta*delta;
+    Multiply( NORMAL, Real(1), A, T, Real(1), M );
+
+    // C C^T := M_{11}
+    Zeros( precond.C, k, k );
+    for( Int i=0; i<k; ++i )
+        if( precond.localPivots[i] >= 0 )
+            for( Int j=0; j<k; ++j )
+                precond.C(i,j) = MLoc( precond.localPivots[i], j );
+    SumOver( diagNormal, precond.C );
+    try { Cholesky( LOWER, precond.C ); }
+    catch( const NonHPDMatrixException& e )
+    {
+        // Every process fails together, so fall back to Jacobi
+        precond.localPivots.clear();
+        precond.C.Empty();
+        precond.L21.Empty();
+        return;
+    }
+
+    // L21 := M_{21} inv(C)^T, with zeroed pivot rows
+    precond.L21 = MLoc;
+    Trsm
+    ( RIGHT, LOWER, TRANSPOSE, NON_UNIT, Real(1), precond.C, precond.L21 );
+    for( Int j=0; j<k; ++j )
+    {
+        const Int iLoc = precond.localPivots[j];
+        if( iLoc >= 0 )
+        {
+            auto l21Row = precond.L21( IR(iLoc), ALL );
+            Zero( l21Row );
+        }
+    }
+
+    // D_S := diag(M_{22}) - diag(L21 L21^T)
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        Real schurValue = precond.schurDiag(iLoc);
+        for( Int j=0; j<k; ++j )
+            schurValue -= precond.L21(iLoc,j)*precond.L21(iLoc,j);
+        precond.schurDiag(iLoc) = Max( schurValue, diagFloor );
+    }
+}
+
+// b := inv(P) b
+template<typename Real,class VectorType>
+void ApplyPartialCholesky
+( const PartialCholesky<Real>& precond, VectorType& b )
+{
+    EL_DEBUG_CSE
+    auto& bLoc = LocalPart( b );
+    const Int k = precond.localPivots.size();
+    if( k == 0 )
+    {
+        DiagonalSolve( LEFT, NORMAL, precond.schurDiag, bLoc );
+        return;
+    }
+
+    // y1 := inv(C) b1
+    Matrix<Real> y1;
+    Zeros( y1, k, 1 );
+    for( Int j=0; j<k; ++j )
+        if( precond.localPivots[j] >= 0 )
+            y1(j) = bLoc( precond.localPivots[j] );
+    SumOver( b, y1 );
+    Trsv( LOWER, NORMAL, NON_UNIT, precond.C, y1 );
+
+    // x2 := inv(D_S) (b2 - L21 y1)
+    Gemv( NORMAL, Real(-1), precond.L21, y1, Real(1), bLoc );
+    DiagonalSolve( LEFT, NORMAL, precond.schurDiag, bLoc );
+
+    // x1 := inv(C)^T (y1 - L21^T x2)
+    Matrix<Real> w;
+    Zeros( w, k, 1 );
+    Gemv( TRANSPOSE, Real(1), precond.L21, bLoc, Real(0), w );
+    SumOver( b, w );
+    y1 -= w;
+    Trsv( LOWER, TRANSPOSE, NON_UNIT, precond.C, y1 );
+    for( Int j=0; j<k; ++j )
+        if( precond.localPivots[j] >= 0 )
+            bLoc( precond.localPivots[j] ) = y1(j);
+}
+
+template<typename Real,class SparseMatrixType,class VectorType>
+Int NormalPCG
+( const SparseMatrixType& A,
+  const SparseMatrixType& ASquared,
+        Real gamma,
+        Real delta,
+  const VectorType& x,
+  const VectorType& z,
+        VectorType& d,
+        Real relTol,
+        Int maxIts,
+        Int precondRank,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    function<Real(const Real&)> inverse =
+      []( const Real& alpha ) { return Real(1)/alpha; };
+
+    // dSquared := 1 ./ ( (z ./ x) .+ gamma^2 )
+    // ========================================
+    auto dSquared = z;
+    DiagonalSolve( LEFT, NORMAL, x, dSquared );
+    Shift( dSquared, gamma*gamma );
+    EntrywiseMap( dSquared, inverse );
+
+    // diagNormal := (A o A) dSquared + delta^2
+    // ========================================
+    auto diagNormal = d;
+    Multiply( NORMAL, Real(1), ASquared, dSquared, Real(0), diagNormal );
+    Shift( diagNormal, delta*delta );
+    const Real diagFloor =
+      Sqrt(limits::Epsilon<Real>())*Max(MaxNorm(diagNormal),Real(1));
+    LowerClip( diagNormal, diagFloor );
+
+    PartialCholesky<Real> partialChol;
+    FormPartialCholesky
+    ( A, dSquared, delta, diagNormal, diagFloor, precondRank, partialChol );
+
+    // q := alpha (A D^2 A^T + delta^2 I) p + beta q
+    // =============================================
+    auto t = dSquared;
+    auto applyA =
+      [&]( Real alpha, const VectorType& p, Real beta, VectorType& q )
+      {
+          Multiply( TRANSPOSE, Real(1), A, p, Real(0), t );
+          DiagonalScale( LEFT, NORMAL, dSquared, t );
+          q *= beta;
+          Multiply( NORMAL, alpha, A, t, Real(1), q );
+          Axpy( alpha*delta*delta, p, q );
+      };
+    auto precond =
+      [&]( VectorType& b ) { ApplyPartialCholesky( partialChol, b ); };
+    return PCG( applyA, precond, d, relTol, maxIts, progress );
+}
+
+// A matrix-free analogue of the initialization from Initialize.cpp, with
+// the (regularized) augmented systems for D = I replaced by
+//
+//   x := A^T inv(A A^T + delta^2 I) b,
+//   y := -inv(A A^T + delta^2 I) A c, and z := A^T y + c.
+//
+template<typename Real,class SparseMatrixType,class VectorType>
+void InitializeWithPCG
+( const SparseMatrixType& A,
+  const SparseMatrixType& ASquared,
+  const VectorType& b,
+  const VectorType& c,
+        VectorType& x,
+        VectorType& y,
+        VectorType& z,
+  bool primalInit,
+  bool dualInit,
+  bool standardShift,
+  Real relTol,
+  Int maxIts,
+  Int precondRank,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real delta = Pow(eps,Real(0.25));
+
+    if( primalInit )
+        if( x.Height() != n || x.Width() != 1 )
+            LogicError("x was of the wrong size");
+    if( dualInit )
+    {
+        if( y.Height() != m || y.Width() != 1 )
+            LogicError("y was of the wrong size");
+        if( z.Height() != n || z.Width() != 1 )
+            LogicError("z was of the wrong size");
+    }
+    if( primalInit && dualInit )
+        return;
+
+    auto ones = c;
+    Fill( ones, Real(1) );
+    if( !primalInit )
+    {
+        // Minimize || x ||^2, s.t. A x = b
+        auto u = b;
+        NormalPCG
+        ( A, ASquared, Real(0), delta, ones, ones, u,
+          relTol, maxIts, precondRank, progress );
+        Zeros( x, n, 1 );
+        Multiply( TRANSPOSE, Real(1), A, u, Real(0), x );
+    }
+    if( !dualInit )
+    {
+        // Minimize || z ||^2, s.t. A^T y - z + c = 0
+        Zeros( y, m, 1 );
+        Multiply( NORMAL, Real(-1), A, c, Real(0), y );
+        NormalPCG
+        ( A, ASquared, Real(0), delta, ones, ones, y,
+          relTol, maxIts, precondRank, progress );
+        z = c;
+        Multiply( TRANSPOSE, Real(1), A, y, Real(1), z );
+    }
+
+    const Real xNorm = Nrm2( x );
+    const Real zNorm = Nrm2( z );
+    const Real gammaPrimal = Sqrt(eps)*Max(xNorm,Real(1));
+    const Real gammaDual   = Sqrt(eps)*Max(zNorm,Real(1));
+    if( standardShift )
+    {
+        // alpha_p := min { alpha : x + alpha*e >= 0 }
+        // -------------------------------------------
+        const auto xMinPair = VectorMinLoc( x );
+        const Real alphaPrimal = -xMinPair.value;
+        if( alphaPrimal >= Real(0) && primalInit )
+            RuntimeError("initialized x was non-positive");
+
+        // alpha_d := min { alpha : z + alpha*e >= 0 }
+        // -------------------------------------------
+        const auto zMinPair = VectorMinLoc( z );
+        const Real alphaDual = -zMinPair.value;
+        if( alphaDual >= Real(0) && dualInit )
+            RuntimeError("initialized z was non-positive");
+
+        if( alphaPrimal >= -gammaPrimal )
+            Shift( x, alphaPrimal+1 );
+        if( alphaDual >= -gammaDual )
+            Shift( z, alphaDual+1 );
+    }
+    else
+    {
+        LowerClip( x, gammaPrimal );
+        LowerClip( z, gammaDual   );
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void MatrixFreeInitialize
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  const SparseMatrix<Real>& ASquared,
+        DirectLPSolution<Matrix<Real>>& solution,
+  bool primalInit,
+  bool dualInit,
+  bool standardShift,
+  Real relTol,
+  Int maxIts,
+  Int precondRank,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    InitializeWithPCG
+    ( problem.A, ASquared, problem.b, problem.c,
+      solution.x, solution.y, solution.z,
+      primalInit, dualInit, standardShift,
+      relTol, maxIts, precondRank, progress );
+}
+
+template<typename Real>
+void MatrixFreeInitialize
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+  const DistSparseMatrix<Real>& ASquared,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+  bool primalInit,
+  bool dualInit,
+  bool standardShift,
+  Real relTol,
+  Int maxIts,
+  Int precondRank,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = problem.A.Grid();
+    solution.x.SetGrid( grid );
+    solution.y.SetGrid( grid );
+    solution.z.SetGrid( grid );
+    InitializeWithPCG
+    ( problem.A, ASquared, problem.b, problem.c,
+      solution.x, solution.y, solution.z,
+      primalInit, dualInit, standardShift,
+      relTol, maxIts, precondRank, progress );
+}
+
+template<typename Real>
+Int MatrixFreeNormalSolve
+( const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& ASquared,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Matrix<Real>& d,
+        Real relTol,
+        Int maxIts,
+        Int precondRank,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    return NormalPCG
+    ( A, ASquared, gamma, delta, x, z, d,
+      relTol, maxIts, precondRank, progress );
+}
+
+template<typename Real>
+Int MatrixFreeNormalSolve
+( const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& ASquared,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& d,
+        Real relTol,
+        Int maxIts,
+        Int precondRank,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    if( !mpi::Congruent( grid.Comm(), x.Grid().Comm() ) )
+        LogicError("Communicators of A and x must match");
+    if( !mpi::Congruent( grid.Comm(), d.Grid().Comm() ) )
+        LogicError("Communicators of A and d must match");
+    return NormalPCG
+    ( A, ASquared, gamma, delta, x, z, d,
+      relTol, maxIts, precondRank, progress );
+}
+
+#define PROTO(Real) \
+  template void MatrixFreeInitialize \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+    const SparseMatrix<Real>& ASquared, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+    bool primalInit, \
+    bool dualInit, \
+    bool standardShift, \
+    Real relTol, \
+    Int maxIts, \
+    Int precondRank, \
+    bool progress ); \
+  template void MatrixFreeInitialize \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& \
+      problem, \
+    const DistSparseMatrix<Real>& ASquared, \
+          DirectLPSolution<DistMultiVec<Real>>& solution, \
+    bool primalInit, \
+    bool dualInit, \
+    bool standardShift, \
+    Real relTol, \
+    Int maxIts, \
+    Int precondRank, \
+    bool progress ); \
+  template Int MatrixFreeNormalSolve \
+  ( const SparseMatrix<Real>& A, \
+    const SparseMatrix<Real>& ASquared, \
+          Real gamma, \
+          Real delta, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& d, \
+          Real relTol, \
+          Int maxIts, \
+          Int precondRank, \
+          bool progress ); \
+  template Int MatrixFreeNormalSolve \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistSparseMatrix<Real>& ASquared, \
+          Real gamma, \
+          Real delta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistMultiVec<Real>& d, \
+          Real relTol, \
+          Int maxIts, \
+          Int precondRank, \
+          bool progress );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace lp
+} // namespace El
@@ -600,6 +600,276 @@ void ExpandNormalSolution
     dz += rc;
 }
 
+// Dense columns of A
+// ==================
+// A single dense column of A fills in the entirety of A D^2 A^T, and so the
+// normal equations are instead formed from the sparse columns of A, say
+// A_S D_S^2 A_S^T + delta^2 I, while the remaining low-rank term
+// A_D D_D^2 A_D^T, where A_D has k columns, is handled by running
+// Preconditioned Conjugate Gradient on the full normal operator, with the
+// factorization of the sparse part as the preconditioner. Since the
+// preconditioned operator is a rank-k perturbation of the identity, PCG
+// converges in at most k+1 iterations in exact arithmetic, which avoids
+// explicitly forming a Sherman-Morrison-Woodbury or product-form update.
+//
+// Since removing the dense columns can leave rows of A_S empty, the diagonal
+// of the sparse part is floored at sqrt(eps) times its maximum entry so that
+// the preconditioner remains definite.
+
+template<typename Real>
+Int SplitDenseColumns
+( const SparseMatrix<Real>& A,
+        SparseMatrix<Real>& ASparse,
+        Real denseColumnRatio,
+        Int denseColumnMinNonzeros )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    const Real maxNonzeros =
+      Max( denseColumnRatio*Real(m), Real(denseColumnMinNonzeros) );
+
+    vector<Int> columnCounts( n, 0 );
+    for( Int e=0; e<numEntries; ++e )
+        ++columnCounts[A.Col(e)];
+    vector<bool> dense( n, false );
+    Int numDense = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        if( Real(columnCounts[j]) > maxNonzeros )
+        {
+            dense[j] = true;
+            ++numDense;
+        }
+    }
+
+    Zeros( ASparse, m, n );
+    ASparse.Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+        if( !dense[A.Col(e)] )
+            ASparse.QueueUpdate( A.Row(e), A.Col(e), A.Value(e) );
+    ASparse.ProcessQueues();
+
+    return numDense;
+}
+
+template<typename Real>
+Int SplitDenseColumns
+( const DistSparseMatrix<Real>& A,
+        DistSparseMatrix<Real>& ASparse,
+        Real denseColumnRatio,
+        Int denseColumnMinNonzeros )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Real maxNonzeros =
+      Max( denseColumnRatio*Real(m), Real(denseColumnMinNonzeros) );
+
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+
+    // Accumulate the column counts within a distributed vector, with each
+    // process only contributing the counts of the columns it touches
+    std::map<Int,Int> localColumnCounts;
+    for( Int e=0; e<numLocalEntries; ++e )
+        ++localColumnCounts[A.Col(e)];
+    DistMultiVec<Int> columnCounts(grid);
+    Zeros( columnCounts, n, 1 );
+    columnCounts.Reserve( localColumnCounts.size() );
+    for( const auto& pair : localColumnCounts )
+        columnCounts.QueueUpdate( pair.first, 0, pair.second );
+    columnCounts.ProcessQueues();
+
+    // Since the columns are distributed in contiguous blocks, gathering the
+    // (few) locally-owned dense columns yields a sorted list on each process
+    vector<Int> localDense;
+    const auto& columnCountsLoc = columnCounts.LockedMatrix();
+    for( Int jLoc=0; jLoc<columnCounts.LocalHeight(); ++jLoc )
+        if( Real(columnCountsLoc(jLoc)) > maxNonzeros )
+            localDense.push_back( columnCounts.GlobalRow(jLoc) );
+    const int numLocalDense = localDense.size();
+    vector<int> denseSizes( commSize ), denseOffsets( commSize );
+    mpi::AllGather( &numLocalDense, 1, denseSizes.data(), 1, comm );
+    const Int numDense = Scan( denseSizes, denseOffsets );
+    vector<Int> dense( numDense );
+    mpi::AllGather
+    ( localDense.data(), numLocalDense,
+      dense.data(), denseSizes.data(), denseOffsets.data(), comm );
+
+    ASparse.SetGrid( grid );
+    Zeros( ASparse, m, n );
+    ASparse.Reserve( numLocalEntries );
+    const Int firstLocalRow = A.FirstLocalRow();
+    for( Int e=0; e<numLocalEntries; ++e )
+        if( !std::binary_search( dense.begin(), dense.end(), A.Col(e) ) )
+            ASparse.QueueLocalUpdate
+            ( A.Row(e)-firstLocalRow, A.Col(e), A.Value(e) );
+    ASparse.ProcessLocalQueues();
+
+    return numDense;
+}
+
+template<typename Real>
+void SplitNormalKKT
+( const SparseMatrix<Real>& ASparse,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    NormalKKT( ASparse, gamma, delta, x, z, J, onlyLower );
+
+    const Int m = J.Height();
+    Real* valBuf = J.ValueBuffer();
+    Real maxDiag = 0;
+    for( Int i=0; i<m; ++i )
+        maxDiag = Max( maxDiag, valBuf[J.Offset(i,i)] );
+    const Real diagFloor = Sqrt(limits::Epsilon<Real>())*maxDiag;
+    for( Int i=0; i<m; ++i )
+    {
+        const Int e = J.Offset( i, i );
+        valBuf[e] = Max( valBuf[e], diagFloor );
+    }
+}
+
+template<typename Real>
+void SplitNormalKKT
+( const DistSparseMatrix<Real>& ASparse,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    NormalKKT( ASparse, gamma, delta, x, z, J, onlyLower );
+
+    const Int JLocalHeight = J.LocalHeight();
+    Real* valBuf = J.ValueBuffer();
+    Real maxLocalDiag = 0;
+    for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
+    {
+        const Int i = J.GlobalRow(iLoc);
+        maxLocalDiag = Max( maxLocalDiag, valBuf[J.Offset(iLoc,i)] );
+    }
+    const Real maxDiag =
+      mpi::AllReduce( maxLocalDiag, mpi::MAX, J.Grid().Comm() );
+    const Real diagFloor = Sqrt(limits::Epsilon<Real>())*maxDiag;
+    for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
+    {
+        const Int i = J.GlobalRow(iLoc);
+        const Int e = J.Offset( iLoc, i );
+        valBuf[e] = Max( valBuf[e], diagFloor );
+    }
+}
+
+template<typename Real>
+Int SplitNormalSolve
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+  const SparseLDLFactorization<Real>& sparseLDLFact,
+        Matrix<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+
+    // dInv := sqrt( (z ./ x) .+ gamma^2 )
+    // ===================================
+    Matrix<Real> dInv;
+    dInv.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        dInv(i) = Sqrt(z(i)/x(i) + gamma*gamma);
+
+    // q := alpha (A D^2 A^T + delta^2 I) p + beta q
+    // =============================================
+    Matrix<Real> t;
+    auto applyA =
+      [&]( Real alpha, const Matrix<Real>& p, Real beta, Matrix<Real>& q )
+      {
+          Zeros( t, n, 1 );
+          Multiply( TRANSPOSE, Real(1), A, p, Real(0), t );
+          DiagonalSolve( LEFT, NORMAL, dInv, t );
+          DiagonalSolve( LEFT, NORMAL, dInv, t );
+          q *= beta;
+          Multiply( NORMAL, alpha, A, t, Real(1), q );
+          Axpy( alpha*delta*delta, p, q );
+      };
+    auto precond =
+      [&]( Matrix<Real>& b )
+      {
+          sparseLDLFact.Solve( b );
+      };
+    return PCG( applyA, precond, d, relTol, maxIts, progress );
+}
+
+template<typename Real>
+Int SplitNormalSolve
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+  const DistSparseLDLFactorization<Real>& sparseLDLFact,
+        DistMultiVec<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Grid& grid = A.Grid();
+    if( !mpi::Congruent( grid.Comm(), d.Grid().Comm() ) )
+        LogicError("Communicators of A and d must match");
+
+    auto& xLoc = x.LockedMatrix();
+    auto& zLoc = z.LockedMatrix();
+
+    // dInv := sqrt( (z ./ x) .+ gamma^2 )
+    // ===================================
+    DistMultiVec<Real> dInv(grid);
+    dInv.Resize( n, 1 );
+    auto& dInvLoc = dInv.Matrix();
+    const Int nLocal = dInv.LocalHeight();
+    for( Int iLoc=0; iLoc<nLocal; ++iLoc )
+        dInvLoc(iLoc) = Sqrt(zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
+
+    // q := alpha (A D^2 A^T + delta^2 I) p + beta q
+    // =============================================
+    DistMultiVec<Real> t(grid);
+    auto applyA =
+      [&]( Real alpha, const DistMultiVec<Real>& p,
+           Real beta, DistMultiVec<Real>& q )
+      {
+          Zeros( t, n, 1 );
+          Multiply( TRANSPOSE, Real(1), A, p, Real(0), t );
+          DiagonalSolve( LEFT, NORMAL, dInv, t );
+          DiagonalSolve( LEFT, NORMAL, dInv, t );
+          q *= beta;
+          Multiply( NORMAL, alpha, A, t, Real(1), q );
+          Axpy( alpha*delta*delta, p, q );
+      };
+    auto precond =
+      [&]( DistMultiVec<Real>& b )
+      {
+          sparseLDLFact.Solve( b );
+      };
+    return PCG( applyA, precond, d, relTol, maxIts, progress );
+}
+
 #define PROTO(Real) \
   template void NormalKKT \
   ( const Matrix<Real>& A, \
@@ -700,7 +970,53 @@ void ExpandNormalSolution
     const DistMultiVec<Real>& rmu, \
           DistMultiVec<Real>& dx, \
     const DistMultiVec<Real>& dy, \
-          DistMultiVec<Real>& dz );
+          DistMultiVec<Real>& dz ); \
+  template Int SplitDenseColumns \
+  ( const SparseMatrix<Real>& A, \
+          SparseMatrix<Real>& ASparse, \
+          Real denseColumnRatio, \
+          Int denseColumnMinNonzeros ); \
+  template Int SplitDenseColumns \
+  ( const DistSparseMatrix<Real>& A, \
+          DistSparseMatrix<Real>& ASparse, \
+          Real denseColumnRatio, \
+          Int denseColumnMinNonzeros ); \
+  template void SplitNormalKKT \
+  ( const SparseMatrix<Real>& ASparse, \
+          Real gamma, \
+          Real delta, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J, bool onlyLower ); \
+  template void SplitNormalKKT \
+  ( const DistSparseMatrix<Real>& ASparse, \
+          Real gamma, \
+          Real delta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template Int SplitNormalSolve \
+  ( const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+    const SparseLDLFactorization<Real>& sparseLDLFact, \
+          Matrix<Real>& d, \
+          Real relTol, \
+          Int maxIts, \
+          bool progress ); \
+  template Int SplitNormalSolve \
+  ( const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+    const DistSparseLDLFactorization<Real>& sparseLDLFact, \
+          DistMultiVec<Real>& d, \
+          Real relTol, \
+          Int maxIts, \
+          bool progress );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
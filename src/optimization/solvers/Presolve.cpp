@@ -0,0 +1,1348 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The reductions are those of Section 3 of
+//
+//   E.D. Andersen and K.D. Andersen,
+//   "Presolving in linear programming",
+//   Mathematical Programming, Vol. 71, pp. 221--245, 1995,
+//
+// restricted to those which do not require the (non-existent) upper bounds
+// of direct conic form. Each reduction removes a row and/or fixes a set of
+// variables, and the dual variables of each removed row are recovered during
+// postsolve by processing the reductions in reverse order: when a row is
+// removed, each of its remaining nonzeros lies in a column which is fixed by
+// the same reduction, so its dual variable can be chosen to make the reduced
+// costs of those columns consistent with complementarity.
+//
+// Distributed problems are gathered to the root process for the analysis
+// (which only involves a few passes over the nonzeros), but the reduced
+// problem is formed in parallel from the original distributed matrices.
+
+namespace El {
+namespace presolve {
+
+template<typename Real>
+struct State
+{
+    bool direct;
+    const PresolveCtrl<Real>& ctrl;
+    PresolveRecord<Real>& record;
+
+    // Transposes of the original A and G for column-wise access
+    SparseMatrix<Real> AT, GT;
+
+    vector<bool> rowActive, coneActive, colActive;
+    vector<Int> rowCount, coneCount, colCountA, colCountG, colCountQ;
+    vector<Real> QDiag;
+
+    // The right-hand sides and objective after substituting fixed variables
+    Matrix<Real> b, c, h;
+
+    State( bool isDirect, const PresolveCtrl<Real>& presolveCtrl,
+           PresolveRecord<Real>& presolveRecord )
+    : direct(isDirect), ctrl(presolveCtrl), record(presolveRecord)
+    { }
+};
+
+// Call 'func(j,value)' for each explicit nonzero in row i of A
+template<typename Real,class Function>
+void ForEachInRow( const SparseMatrix<Real>& A, Int i, Function func )
+{
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valueBuf = A.LockedValueBuffer();
+    for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+        if( valueBuf[e] != Real(0) )
+            func( colBuf[e], valueBuf[e] );
+}
+
+template<typename Real>
+void Initialize( State<Real>& state, const Matrix<Real>& b,
+  const Matrix<Real>& c, const Matrix<Real>& h )
+{
+    EL_DEBUG_CSE
+    const auto& record = state.record;
+    const Int m = record.numEqualities;
+    const Int k = record.numCones;
+    const Int n = record.numVariables;
+
+    Transpose( record.A, state.AT );
+    Transpose( record.G, state.GT );
+    state.b = b;
+    state.c = c;
+    state.h = h;
+
+    state.rowActive.assign( m, true );
+    state.coneActive.assign( k, true );
+    state.colActive.assign( n, true );
+    state.rowCount.assign( m, 0 );
+    state.coneCount.assign( k, 0 );
+    state.colCountA.assign( n, 0 );
+    state.colCountG.assign( n, 0 );
+    state.colCountQ.assign( n, 0 );
+    state.QDiag.assign( n, Real(0) );
+
+    for( Int i=0; i<m; ++i )
+        ForEachInRow
+        ( record.A, i,
+          [&]( Int j, Real value )
+          { ++state.rowCount[i]; ++state.colCountA[j]; } );
+    for( Int i=0; i<k; ++i )
+        ForEachInRow
+        ( record.G, i,
+          [&]( Int j, Real value )
+          { ++state.coneCount[i]; ++state.colCountG[j]; } );
+    for( Int i=0; i<n; ++i )
+        ForEachInRow
+        ( record.Q, i,
+          [&]( Int j, Real value )
+          {
+              if( i == j )
+                  state.QDiag[i] = value;
+              else
+                  ++state.colCountQ[i];
+          } );
+}
+
+template<typename Real>
+void RemoveEqualityRow( State<Real>& state, Int i )
+{
+    state.rowActive[i] = false;
+    ForEachInRow
+    ( state.record.A, i,
+      [&]( Int j, Real value )
+      { if( state.colActive[j] ) --state.colCountA[j]; } );
+}
+
+template<typename Real>
+void RemoveConeRow( State<Real>& state, Int i )
+{
+    state.coneActive[i] = false;
+    ForEachInRow
+    ( state.record.G, i,
+      [&]( Int j, Real value )
+      { if( state.colActive[j] ) --state.colCountG[j]; } );
+}
+
+// Fix x_j := value and substitute it into the remaining constraints and the
+// objective
+template<typename Real>
+void FixColumn( State<Real>& state, Int j, Real value )
+{
+    auto& record = state.record;
+    state.colActive[j] = false;
+    record.fixedValues(j) = value;
+    ForEachInRow
+    ( state.AT, j,
+      [&]( Int i, Real alpha )
+      {
+          if( state.rowActive[i] )
+          {
+              --state.rowCount[i];
+              state.b(i) -= alpha*value;
+          }
+      } );
+    ForEachInRow
+    ( state.GT, j,
+      [&]( Int i, Real alpha )
+      {
+          if( state.coneActive[i] )
+          {
+              --state.coneCount[i];
+              state.h(i) -= alpha*value;
+          }
+      } );
+    ForEachInRow
+    ( record.Q, j,
+      [&]( Int l, Real alpha )
+      {
+          if( l != j && state.colActive[l] )
+          {
+              --state.colCountQ[l];
+              state.c(l) += alpha*value;
+          }
+      } );
+}
+
+template<typename Real>
+Int EmptyRows( State<Real>& state )
+{
+    EL_DEBUG_CSE
+    const Real tol = state.ctrl.tol;
+    Int numRemoved = 0;
+    for( Int i=0; i<state.record.numEqualities; ++i )
+    {
+        if( !state.rowActive[i] || state.rowCount[i] != 0 )
+            continue;
+        if( Abs(state.b(i)) > tol )
+            RuntimeError
+            ("Presolve: equality row ",i," is empty but has a right-hand side "
+             "of ",state.b(i));
+        RemoveEqualityRow( state, i );
+        Reduction reduction;
+        reduction.type = EMPTY_EQUALITY_ROW;
+        reduction.row = i;
+        state.record.reductions.push_back( reduction );
+        ++numRemoved;
+    }
+    for( Int i=0; i<state.record.numCones; ++i )
+    {
+        if( !state.coneActive[i] || state.coneCount[i] != 0 )
+            continue;
+        if( state.h(i) < -tol )
+            RuntimeError
+            ("Presolve: cone row ",i," is empty but has a right-hand side of ",
+             state.h(i));
+        RemoveConeRow( state, i );
+        Reduction reduction;
+        reduction.type = EMPTY_CONE_ROW;
+        reduction.row = i;
+        state.record.reductions.push_back( reduction );
+        ++numRemoved;
+    }
+    return numRemoved;
+}
+
+template<typename Real>
+Int EmptyColumns( State<Real>& state )
+{
+    EL_DEBUG_CSE
+    const Real tol = state.ctrl.tol;
+    Int numRemoved = 0;
+    for( Int j=0; j<state.record.numVariables; ++j )
+    {
+        if( !state.colActive[j] || state.colCountA[j] != 0 ||
+            state.colCountG[j] != 0 || state.colCountQ[j] != 0 )
+            continue;
+
+        // Minimize (1/2) QDiag x_j^2 + c_j x_j (with x_j >= 0 if direct)
+        const Real gamma = state.c(j);
+        const Real delta = state.QDiag[j];
+        Real value;
+        if( delta > Real(0) )
+        {
+            value = -gamma/delta;
+            if( state.direct )
+                value = Max( value, Real(0) );
+        }
+        else if( delta == Real(0) )
+        {
+            if( gamma < -tol || (!state.direct && gamma > tol) )
+                RuntimeError
+                ("Presolve: the objective is unbounded in variable ",j);
+            value = 0;
+        }
+        else
+            continue;
+
+        FixColumn( state, j, value );
+        Reduction reduction;
+        reduction.type = EMPTY_COLUMN;
+        reduction.columns.push_back( j );
+        state.record.reductions.push_back( reduction );
+        ++numRemoved;
+    }
+    return numRemoved;
+}
+
+template<typename Real>
+Int SingletonRows( State<Real>& state )
+{
+    EL_DEBUG_CSE
+    const Real tol = state.ctrl.tol;
+    Int numRemoved = 0;
+    for( Int i=0; i<state.record.numEqualities; ++i )
+    {
+        if( !state.rowActive[i] || state.rowCount[i] != 1 )
+            continue;
+        Int j = -1;
+        Real alpha = 0;
+        ForEachInRow
+        ( state.record.A, i,
+          [&]( Int col, Real value )
+          { if( state.colActive[col] ) { j = col; alpha = value; } } );
+
+        Real value = state.b(i) / alpha;
+        if( state.direct )
+        {
+            if( value < -tol )
+                RuntimeError
+                ("Presolve: equality row ",i," forces variable ",j,
+                 " to equal ",value," < 0");
+            value = Max( value, Real(0) );
+        }
+        RemoveEqualityRow( state, i );
+        FixColumn( state, j, value );
+        Reduction reduction;
+        reduction.type = SINGLETON_ROW;
+        reduction.row = i;
+        reduction.columns.push_back( j );
+        state.record.reductions.push_back( reduction );
+        ++numRemoved;
+    }
+    return numRemoved;
+}
+
+// A row of 'A x = b, x >= 0' whose coefficients all have the same sign and
+// whose right-hand side is zero forces each of its variables to zero
+template<typename Real>
+Int ForcingRows( State<Real>& state )
+{
+    EL_DEBUG_CSE
+    if( !state.direct )
+        return 0;
+    const Real tol = state.ctrl.tol;
+    Int numRemoved = 0;
+    for( Int i=0; i<state.record.numEqualities; ++i )
+    {
+        if( !state.rowActive[i] || state.rowCount[i] < 2 )
+            continue;
+        bool allNonnegative = true, allNonpositive = true;
+        vector<Int> columns;
+        ForEachInRow
+        ( state.record.A, i,
+          [&]( Int j, Real value )
+          {
+              if( !state.colActive[j] )
+                  return;
+              columns.push_back( j );
+              if( value > Real(0) )
+                  allNonpositive = false;
+              else
+                  allNonnegative = false;
+          } );
+        if( !allNonnegative && !allNonpositive )
+            continue;
+
+        const Real beta = state.b(i);
+        if( (allNonnegative && beta < -tol) ||
+            (allNonpositive && beta > tol) )
+            RuntimeError
+            ("Presolve: equality row ",i," cannot be satisfied with "
+             "nonnegative variables");
+        if( Abs(beta) > tol )
+            continue;
+
+        RemoveEqualityRow( state, i );
+        for( const Int& j : columns )
+            FixColumn( state, j, Real(0) );
+        Reduction reduction;
+        reduction.type = FORCING_ROW;
+        reduction.row = i;
+        reduction.columns = columns;
+        state.record.reductions.push_back( reduction );
+        ++numRemoved;
+    }
+    return numRemoved;
+}
+
+template<typename Real>
+Int DuplicateRows( State<Real>& state )
+{
+    EL_DEBUG_CSE
+    const Real tol = state.ctrl.tol;
+    const Int m = state.record.numEqualities;
+
+    // Bucket the active rows by a hash of their sparsity patterns
+    std::map<size_t,vector<Int>> buckets;
+    for( Int i=0; i<m; ++i )
+    {
+        if( !state.rowActive[i] || state.rowCount[i] < 2 )
+            continue;
+        size_t hash = state.rowCount[i];
+        ForEachInRow
+        ( state.record.A, i,
+          [&]( Int j, Real value )
+          {
+              if( state.colActive[j] )
+                  hash ^= std::hash<Int>()(j) + 0x9e3779b9 + (hash<<6) +
+                    (hash>>2);
+          } );
+        buckets[hash].push_back( i );
+    }
+
+    auto activeRow =
+      [&]( Int i, vector<Int>& columns, vector<Real>& values )
+      {
+          columns.clear();
+          values.clear();
+          ForEachInRow
+          ( state.record.A, i,
+            [&]( Int j, Real value )
+            {
+                if( state.colActive[j] )
+                {
+                    columns.push_back( j );
+                    values.push_back( value );
+                }
+            } );
+      };
+
+    Int numRemoved = 0;
+    vector<Int> columns0, columns1;
+    vector<Real> values0, values1;
+    for( auto& bucket : buckets )
+    {
+        auto& rows = bucket.second;
+        for( Int s=0; s<Int(rows.size()); ++s )
+        {
+            const Int i = rows[s];
+            if( !state.rowActive[i] )
+                continue;
+            activeRow( i, columns0, values0 );
+            for( Int t=s+1; t<Int(rows.size()); ++t )
+            {
+                const Int k = rows[t];
+                if( !state.rowActive[k] )
+                    continue;
+                activeRow( k, columns1, values1 );
+                if( columns0 != columns1 )
+                    continue;
+
+                // Test if row k is a multiple of row i
+                const Real lambda = values1[0] / values0[0];
+                bool duplicate = true;
+                for( Int e=0; e<Int(values0.size()); ++e )
+                    if( Abs(values1[e]-lambda*values0[e]) >
+                        tol*Abs(values1[e]) )
+                    {
+                        duplicate = false;
+                        break;
+                    }
+                if( !duplicate )
+                    continue;
+
+                if( Abs(state.b(k)-lambda*state.b(i)) >
+                    tol*Max(Abs(state.b(k)),Real(1)) )
+                    RuntimeError
+                    ("Presolve: equality rows ",i," and ",k," are parallel "
+                     "but inconsistent");
+                RemoveEqualityRow( state, k );
+                Reduction reduction;
+                reduction.type = DUPLICATE_ROW;
+                reduction.row = k;
+                state.record.reductions.push_back( reduction );
+                ++numRemoved;
+            }
+        }
+    }
+    return numRemoved;
+}
+
+vector<Int> InverseMap( const vector<Int>& kept, Int size )
+{
+    vector<Int> map( size, -1 );
+    for( Int j=0; j<Int(kept.size()); ++j )
+        map[kept[j]] = j;
+    return map;
+}
+
+// Run the reductions on the original problem data stored within 'record' and
+// return the reduced right-hand sides and objective
+template<typename Real>
+void Analyze
+( const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        Matrix<Real>& hRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = record.numVariables;
+    const Int m = record.numEqualities;
+    const Int k = record.numCones;
+    Zeros( record.fixedValues, n, 1 );
+    record.reductions.clear();
+
+    State<Real> state( record.direct, ctrl, record );
+    Initialize( state, b, c, h );
+
+    for( Int pass=0; pass<ctrl.maxPasses; ++pass )
+    {
+        Int numReductions = 0;
+        if( ctrl.removeEmptyRows )
+            numReductions += EmptyRows( state );
+        if( ctrl.removeSingletonRows )
+            numReductions += SingletonRows( state );
+        if( ctrl.removeForcingRows )
+            numReductions += ForcingRows( state );
+        if( ctrl.removeDuplicateRows )
+            numReductions += DuplicateRows( state );
+        if( ctrl.removeEmptyColumns )
+            numReductions += EmptyColumns( state );
+        if( ctrl.progress )
+            Output("Presolve pass ",pass,": ",numReductions," reductions");
+        if( numReductions == 0 )
+            break;
+    }
+
+    record.keptVariables.clear();
+    record.keptEqualities.clear();
+    record.keptCones.clear();
+    for( Int j=0; j<n; ++j )
+        if( state.colActive[j] )
+            record.keptVariables.push_back( j );
+    for( Int i=0; i<m; ++i )
+        if( state.rowActive[i] )
+            record.keptEqualities.push_back( i );
+    for( Int i=0; i<k; ++i )
+        if( state.coneActive[i] )
+            record.keptCones.push_back( i );
+
+    const Int nRed = record.keptVariables.size();
+    const Int mRed = record.keptEqualities.size();
+    const Int kRed = record.keptCones.size();
+    bRed.Resize( mRed, 1 );
+    cRed.Resize( nRed, 1 );
+    hRed.Resize( kRed, 1 );
+    for( Int i=0; i<mRed; ++i )
+        bRed(i) = state.b(record.keptEqualities[i]);
+    for( Int j=0; j<nRed; ++j )
+        cRed(j) = state.c(record.keptVariables[j]);
+    for( Int i=0; i<kRed; ++i )
+        hRed(i) = state.h(record.keptCones[i]);
+
+    if( ctrl.progress )
+        Output
+        ("Presolve reduced ",m," x ",n," equalities to ",mRed," x ",nRed,
+         " and ",k," cone rows to ",kRed);
+}
+
+template<typename Real>
+void ReduceMatrix
+( const SparseMatrix<Real>& A,
+  const vector<Int>& rowMap,
+  const vector<Int>& colMap,
+        Int mRed,
+        Int nRed,
+        SparseMatrix<Real>& ARed )
+{
+    EL_DEBUG_CSE
+    Zeros( ARed, mRed, nRed );
+    const Int numEntries = A.NumEntries();
+    Int numKept = 0;
+    for( Int e=0; e<numEntries; ++e )
+        if( rowMap[A.Row(e)] >= 0 && colMap[A.Col(e)] >= 0 )
+            ++numKept;
+    ARed.Reserve( numKept );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = rowMap[A.Row(e)];
+        const Int j = colMap[A.Col(e)];
+        if( i >= 0 && j >= 0 )
+            ARed.QueueUpdate( i, j, A.Value(e) );
+    }
+    ARed.ProcessQueues();
+}
+
+template<typename Real>
+void ReduceMatrix
+( const DistSparseMatrix<Real>& A,
+  const vector<Int>& rowMap,
+  const vector<Int>& colMap,
+        Int mRed,
+        Int nRed,
+        DistSparseMatrix<Real>& ARed )
+{
+    EL_DEBUG_CSE
+    ARed.SetGrid( A.Grid() );
+    Zeros( ARed, mRed, nRed );
+    const Int numLocalEntries = A.NumLocalEntries();
+    Int numKept = 0;
+    for( Int e=0; e<numLocalEntries; ++e )
+        if( rowMap[A.Row(e)] >= 0 && colMap[A.Col(e)] >= 0 )
+            ++numKept;
+    ARed.Reserve( numKept, numKept );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int i = rowMap[A.Row(e)];
+        const Int j = colMap[A.Col(e)];
+        if( i >= 0 && j >= 0 )
+            ARed.QueueUpdate( i, j, A.Value(e), false );
+    }
+    ARed.ProcessQueues();
+}
+
+template<typename T>
+void BroadcastVector( vector<T>& v, int root, mpi::Comm comm )
+{
+    Int size = v.size();
+    mpi::Broadcast( size, root, comm );
+    v.resize( size );
+    mpi::Broadcast( v.data(), size, root, comm );
+}
+
+template<typename Real>
+void BroadcastVector( Matrix<Real>& v, int root, mpi::Comm comm )
+{
+    Int height = v.Height();
+    mpi::Broadcast( height, root, comm );
+    v.Resize( height, 1 );
+    mpi::Broadcast( v.Buffer(), height, root, comm );
+}
+
+// Fill a distributed vector using a copy of its entries stored on every
+// process
+template<typename Real>
+void FromRedundant
+( const Matrix<Real>& v, const Grid& grid, DistMultiVec<Real>& vDist )
+{
+    vDist.SetGrid( grid );
+    vDist.Resize( v.Height(), 1 );
+    const Int localHeight = vDist.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        vDist.SetLocal( iLoc, 0, v(vDist.GlobalRow(iLoc)) );
+}
+
+template<typename Real>
+void Gather( const DistMultiVec<Real>& vDist, Matrix<Real>& v, int root )
+{
+    if( vDist.Grid().Rank() == root )
+        CopyFromRoot( vDist, v );
+    else
+        CopyFromNonRoot( vDist, root );
+}
+
+template<typename Real>
+void Gather
+( const DistSparseMatrix<Real>& ADist, SparseMatrix<Real>& A, int root )
+{
+    if( ADist.Grid().Rank() == root )
+        CopyFromRoot( ADist, A );
+    else
+        CopyFromNonRoot( ADist, root );
+}
+
+// Sequential driver
+template<typename Real>
+void Presolve
+( bool direct,
+  const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        SparseMatrix<Real>& GRed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        Matrix<Real>& hRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    record.direct = direct;
+    record.numVariables = A.Width();
+    record.numEqualities = A.Height();
+    record.numCones = G.Height();
+    record.Q = Q;
+    record.A = A;
+    record.G = G;
+    record.c = c;
+    record.h = h;
+    Analyze( b, c, h, bRed, cRed, hRed, record, ctrl );
+
+    const Int nRed = record.keptVariables.size();
+    const Int mRed = record.keptEqualities.size();
+    const Int kRed = record.keptCones.size();
+    const auto colMap = InverseMap( record.keptVariables, record.numVariables );
+    const auto rowMap =
+      InverseMap( record.keptEqualities, record.numEqualities );
+    const auto coneMap = InverseMap( record.keptCones, record.numCones );
+    ReduceMatrix( Q, colMap, colMap, nRed, nRed, QRed );
+    ReduceMatrix( A, rowMap, colMap, mRed, nRed, ARed );
+    ReduceMatrix( G, coneMap, colMap, kRed, nRed, GRed );
+}
+
+// Distributed driver
+template<typename Real>
+void Presolve
+( bool direct,
+  const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& G,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& h,
+        DistSparseMatrix<Real>& QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistSparseMatrix<Real>& GRed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        DistMultiVec<Real>& hRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int root = 0;
+    const bool onRoot = ( grid.Rank() == root );
+
+    record.direct = direct;
+    record.numVariables = A.Width();
+    record.numEqualities = A.Height();
+    record.numCones = G.Height();
+    Gather( Q, record.Q, root );
+    Gather( A, record.A, root );
+    Gather( G, record.G, root );
+    Gather( c, record.c, root );
+    Gather( h, record.h, root );
+    Matrix<Real> bSeq;
+    Gather( b, bSeq, root );
+
+    // Infeasibility or unboundedness detected by the root must be raised on
+    // every process rather than leaving the others in the broadcasts below
+    Matrix<Real> bRedSeq, cRedSeq, hRedSeq;
+    string errorMessage;
+    if( onRoot )
+    {
+        try
+        {
+            Analyze
+            ( bSeq, record.c, record.h, bRedSeq, cRedSeq, hRedSeq, record,
+              ctrl );
+        }
+        catch( const std::exception& e )
+        {
+            errorMessage = e.what();
+            if( errorMessage.empty() )
+                errorMessage = "Presolve failed";
+        }
+    }
+    vector<byte> errorBytes( errorMessage.begin(), errorMessage.end() );
+    BroadcastVector( errorBytes, root, comm );
+    if( !errorBytes.empty() )
+    {
+        while( errorBytes.size() > 1 && errorBytes.back() == '\n' )
+            errorBytes.pop_back();
+        RuntimeError( string(errorBytes.begin(),errorBytes.end()) );
+    }
+    BroadcastVector( record.keptVariables, root, comm );
+    BroadcastVector( record.keptEqualities, root, comm );
+    BroadcastVector( record.keptCones, root, comm );
+    BroadcastVector( bRedSeq, root, comm );
+    BroadcastVector( cRedSeq, root, comm );
+    BroadcastVector( hRedSeq, root, comm );
+
+    const Int nRed = record.keptVariables.size();
+    const Int mRed = record.keptEqualities.size();
+    const Int kRed = record.keptCones.size();
+    const auto colMap = InverseMap( record.keptVariables, record.numVariables );
+    const auto rowMap =
+      InverseMap( record.keptEqualities, record.numEqualities );
+    const auto coneMap = InverseMap( record.keptCones, record.numCones );
+    ReduceMatrix( Q, colMap, colMap, nRed, nRed, QRed );
+    ReduceMatrix( A, rowMap, colMap, mRed, nRed, ARed );
+    ReduceMatrix( G, coneMap, colMap, kRed, nRed, GRed );
+    FromRedundant( bRedSeq, grid, bRed );
+    FromRedundant( cRedSeq, grid, cRed );
+    FromRedundant( hRedSeq, grid, hRed );
+}
+
+// Given the solution of the reduced problem, where 'zRed' is the dual of the
+// nonnegativity constraints in direct form and the dual of the cone rows in
+// affine form, recover a solution of the original problem
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+  const Matrix<Real>& sRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s )
+{
+    EL_DEBUG_CSE
+    const Int n = record.numVariables;
+    const Int m = record.numEqualities;
+    const Int k = record.numCones;
+    const Int nRed = record.keptVariables.size();
+    const Int mRed = record.keptEqualities.size();
+    const Int kRed = record.keptCones.size();
+
+    x = record.fixedValues;
+    for( Int j=0; j<nRed; ++j )
+        x(record.keptVariables[j]) = xRed(j);
+    Zeros( y, m, 1 );
+    for( Int i=0; i<mRed; ++i )
+        y(record.keptEqualities[i]) = yRed(i);
+    Matrix<Real> zCone;
+    if( !record.direct )
+    {
+        Zeros( zCone, k, 1 );
+        for( Int i=0; i<kRed; ++i )
+            zCone(record.keptCones[i]) = zRed(i);
+    }
+
+    // The reduced costs are r := c + Q x + A^T y (+ G^T z), where the terms
+    // not involving y are fixed now that x is known
+    SparseMatrix<Real> AT;
+    Transpose( record.A, AT );
+    Matrix<Real> g( record.c );
+    Multiply( NORMAL, Real(1), record.Q, x, Real(1), g );
+    if( !record.direct )
+        Multiply( TRANSPOSE, Real(1), record.G, zCone, Real(1), g );
+    auto reducedCost =
+      [&]( Int j )
+      {
+          Real gamma = g(j);
+          ForEachInRow
+          ( AT, j, [&]( Int i, Real alpha ) { gamma += alpha*y(i); } );
+          return gamma;
+      };
+
+    for( auto iter=record.reductions.rbegin();
+         iter!=record.reductions.rend(); ++iter )
+    {
+        const auto& reduction = *iter;
+        const Int i = reduction.row;
+        if( reduction.type == SINGLETON_ROW )
+        {
+            // Zero the reduced cost of the fixed variable
+            const Int j = reduction.columns[0];
+            y(i) = -reducedCost(j) / record.A.Get(i,j);
+        }
+        else if( reduction.type == FORCING_ROW )
+        {
+            // Choose the dual variable to make each reduced cost nonnegative,
+            // with at least one of them zero
+            bool first = true;
+            Real eta = 0;
+            for( const Int& j : reduction.columns )
+            {
+                const Real alpha = record.A.Get(i,j);
+                const Real candidate = -reducedCost(j) / alpha;
+                if( first )
+                    eta = candidate;
+                else if( alpha > Real(0) )
+                    eta = Max( eta, candidate );
+                else
+                    eta = Min( eta, candidate );
+                first = false;
+            }
+            y(i) = eta;
+        }
+        // The dual variables of empty and duplicate rows are zero
+    }
+
+    if( record.direct )
+    {
+        Zeros( z, n, 1 );
+        vector<bool> kept( n, false );
+        for( Int j=0; j<nRed; ++j )
+        {
+            kept[record.keptVariables[j]] = true;
+            z(record.keptVariables[j]) = zRed(j);
+        }
+        for( Int j=0; j<n; ++j )
+            if( !kept[j] )
+                z(j) = reducedCost(j);
+    }
+    else
+    {
+        z = zCone;
+        s = record.h;
+        Multiply( NORMAL, Real(-1), record.G, x, Real(1), s );
+        for( Int i=0; i<kRed; ++i )
+            s(record.keptCones[i]) = sRed(i);
+    }
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+  const DistMultiVec<Real>& sRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = xRed.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int root = 0;
+
+    Matrix<Real> xRedSeq, yRedSeq, zRedSeq, sRedSeq;
+    Gather( xRed, xRedSeq, root );
+    Gather( yRed, yRedSeq, root );
+    Gather( zRed, zRedSeq, root );
+    if( !record.direct )
+        Gather( sRed, sRedSeq, root );
+
+    Matrix<Real> xSeq, ySeq, zSeq, sSeq;
+    if( grid.Rank() == root )
+        Postsolve
+        ( record, xRedSeq, yRedSeq, zRedSeq, sRedSeq, xSeq, ySeq, zSeq, sSeq );
+    BroadcastVector( xSeq, root, comm );
+    BroadcastVector( ySeq, root, comm );
+    BroadcastVector( zSeq, root, comm );
+    FromRedundant( xSeq, grid, x );
+    FromRedundant( ySeq, grid, y );
+    FromRedundant( zSeq, grid, z );
+    if( !record.direct )
+    {
+        BroadcastVector( sSeq, root, comm );
+        FromRedundant( sSeq, grid, s );
+    }
+}
+
+} // namespace presolve
+
+template<typename Real>
+void Presolve
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& reducedProblem,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = problem.A.Width();
+    SparseMatrix<Real> Q, G, QRed, GRed;
+    Matrix<Real> h, hRed;
+    Zeros( Q, n, n );
+    Zeros( G, 0, n );
+    Zeros( h, 0, 1 );
+    presolve::Presolve
+    ( true, Q, problem.A, G, problem.b, problem.c, h,
+      QRed, reducedProblem.A, GRed, reducedProblem.b, reducedProblem.c, hRed,
+      record, ctrl );
+}
+
+template<typename Real>
+void Presolve
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>&
+          reducedProblem,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = problem.A.Grid();
+    const Int n = problem.A.Width();
+    DistSparseMatrix<Real> Q(grid), G(grid), QRed(grid), GRed(grid);
+    DistMultiVec<Real> h(grid), hRed(grid);
+    Zeros( Q, n, n );
+    Zeros( G, 0, n );
+    Zeros( h, 0, 1 );
+    ForceSimpleAlignments( reducedProblem, grid );
+    presolve::Presolve
+    ( true, Q, problem.A, G, problem.b, problem.c, h,
+      QRed, reducedProblem.A, GRed, reducedProblem.b, reducedProblem.c, hRed,
+      record, ctrl );
+}
+
+template<typename Real>
+void Presolve
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& reducedProblem,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = problem.A.Width();
+    SparseMatrix<Real> Q, QRed;
+    Zeros( Q, n, n );
+    presolve::Presolve
+    ( false, Q, problem.A, problem.G, problem.b, problem.c, problem.h,
+      QRed, reducedProblem.A, reducedProblem.G,
+      reducedProblem.b, reducedProblem.c, reducedProblem.h, record, ctrl );
+}
+
+template<typename Real>
+void Presolve
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>&
+          reducedProblem,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = problem.A.Grid();
+    const Int n = problem.A.Width();
+    DistSparseMatrix<Real> Q(grid), QRed(grid);
+    Zeros( Q, n, n );
+    ForceSimpleAlignments( reducedProblem, grid );
+    presolve::Presolve
+    ( false, Q, problem.A, problem.G, problem.b, problem.c, problem.h,
+      QRed, reducedProblem.A, reducedProblem.G,
+      reducedProblem.b, reducedProblem.c, reducedProblem.h, record, ctrl );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const DirectLPSolution<Matrix<Real>>& reducedSolution,
+        DirectLPSolution<Matrix<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> sRed, s;
+    presolve::Postsolve
+    ( record, reducedSolution.x, reducedSolution.y, reducedSolution.z, sRed,
+      solution.x, solution.y, solution.z, s );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const DirectLPSolution<DistMultiVec<Real>>& reducedSolution,
+        DirectLPSolution<DistMultiVec<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = reducedSolution.x.Grid();
+    DistMultiVec<Real> sRed(grid), s(grid);
+    presolve::Postsolve
+    ( record, reducedSolution.x, reducedSolution.y, reducedSolution.z, sRed,
+      solution.x, solution.y, solution.z, s );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const AffineLPSolution<Matrix<Real>>& reducedSolution,
+        AffineLPSolution<Matrix<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    presolve::Postsolve
+    ( record,
+      reducedSolution.x, reducedSolution.y, reducedSolution.z,
+      reducedSolution.s,
+      solution.x, solution.y, solution.z, solution.s );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const AffineLPSolution<DistMultiVec<Real>>& reducedSolution,
+        AffineLPSolution<DistMultiVec<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    presolve::Postsolve
+    ( record,
+      reducedSolution.x, reducedSolution.y, reducedSolution.z,
+      reducedSolution.s,
+      solution.x, solution.y, solution.z, solution.s );
+}
+
+namespace qp {
+namespace direct {
+
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseMatrix<Real> G, GRed;
+    Matrix<Real> h, hRed;
+    Zeros( G, 0, A.Width() );
+    Zeros( h, 0, 1 );
+    presolve::Presolve
+    ( true, Q, A, G, b, c, h, QRed, ARed, GRed, bRed, cRed, hRed,
+      record, ctrl );
+}
+
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    DistSparseMatrix<Real> G(grid), GRed(grid);
+    DistMultiVec<Real> h(grid), hRed(grid);
+    Zeros( G, 0, A.Width() );
+    Zeros( h, 0, 1 );
+    presolve::Presolve
+    ( true, Q, A, G, b, c, h, QRed, ARed, GRed, bRed, cRed, hRed,
+      record, ctrl );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> sRed, s;
+    presolve::Postsolve( record, xRed, yRed, zRed, sRed, x, y, z, s );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Real> sRed(xRed.Grid()), s(xRed.Grid());
+    presolve::Postsolve( record, xRed, yRed, zRed, sRed, x, y, z, s );
+}
+
+} // namespace direct
+
+namespace affine {
+
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        SparseMatrix<Real>& GRed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        Matrix<Real>& hRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    presolve::Presolve
+    ( false, Q, A, G, b, c, h, QRed, ARed, GRed, bRed, cRed, hRed,
+      record, ctrl );
+}
+
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& G,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& h,
+        DistSparseMatrix<Real>& QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistSparseMatrix<Real>& GRed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        DistMultiVec<Real>& hRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    presolve::Presolve
+    ( false, Q, A, G, b, c, h, QRed, ARed, GRed, bRed, cRed, hRed,
+      record, ctrl );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+  const Matrix<Real>& sRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s )
+{
+    EL_DEBUG_CSE
+    presolve::Postsolve( record, xRed, yRed, zRed, sRed, x, y, z, s );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveRecord<Real>& record,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+  const DistMultiVec<Real>& sRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s )
+{
+    EL_DEBUG_CSE
+    presolve::Postsolve( record, xRed, yRed, zRed, sRed, x, y, z, s );
+}
+
+} // namespace affine
+} // namespace qp
+
+#define PROTO(Real) \
+  template void Presolve \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& reducedProblem, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void Presolve \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& \
+      problem, \
+          DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& \
+            reducedProblem, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void Presolve \
+  ( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& reducedProblem, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void Presolve \
+  ( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& \
+      problem, \
+          AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& \
+            reducedProblem, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void Postsolve \
+  ( const PresolveRecord<Real>& record, \
+    const DirectLPSolution<Matrix<Real>>& reducedSolution, \
+          DirectLPSolution<Matrix<Real>>& solution ); \
+  template void Postsolve \
+  ( const PresolveRecord<Real>& record, \
+    const DirectLPSolution<DistMultiVec<Real>>& reducedSolution, \
+          DirectLPSolution<DistMultiVec<Real>>& solution ); \
+  template void Postsolve \
+  ( const PresolveRecord<Real>& record, \
+    const AffineLPSolution<Matrix<Real>>& reducedSolution, \
+          AffineLPSolution<Matrix<Real>>& solution ); \
+  template void Postsolve \
+  ( const PresolveRecord<Real>& record, \
+    const AffineLPSolution<DistMultiVec<Real>>& reducedSolution, \
+          AffineLPSolution<DistMultiVec<Real>>& solution ); \
+  template void qp::direct::Presolve \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          SparseMatrix<Real>& QRed, \
+          SparseMatrix<Real>& ARed, \
+          Matrix<Real>& bRed, \
+          Matrix<Real>& cRed, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void qp::direct::Presolve \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistSparseMatrix<Real>& QRed, \
+          DistSparseMatrix<Real>& ARed, \
+          DistMultiVec<Real>& bRed, \
+          DistMultiVec<Real>& cRed, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void qp::direct::Postsolve \
+  ( const PresolveRecord<Real>& record, \
+    const Matrix<Real>& xRed, \
+    const Matrix<Real>& yRed, \
+    const Matrix<Real>& zRed, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z ); \
+  template void qp::direct::Postsolve \
+  ( const PresolveRecord<Real>& record, \
+    const DistMultiVec<Real>& xRed, \
+    const DistMultiVec<Real>& yRed, \
+    const DistMultiVec<Real>& zRed, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z ); \
+  template void qp::affine::Presolve \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const SparseMatrix<Real>& G, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Real>& h, \
+          SparseMatrix<Real>& QRed, \
+          SparseMatrix<Real>& ARed, \
+          SparseMatrix<Real>& GRed, \
+          Matrix<Real>& bRed, \
+          Matrix<Real>& cRed, \
+          Matrix<Real>& hRed, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void qp::affine::Presolve \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistSparseMatrix<Real>& G, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+    const DistMultiVec<Real>& h, \
+          DistSparseMatrix<Real>& QRed, \
+          DistSparseMatrix<Real>& ARed, \
+          DistSparseMatrix<Real>& GRed, \
+          DistMultiVec<Real>& bRed, \
+          DistMultiVec<Real>& cRed, \
+          DistMultiVec<Real>& hRed, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void qp::affine::Postsolve \
+  ( const PresolveRecord<Real>& record, \
+    const Matrix<Real>& xRed, \
+    const Matrix<Real>& yRed, \
+    const Matrix<Real>& zRed, \
+    const Matrix<Real>& sRed, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          Matrix<Real>& s ); \
+  template void qp::affine::Postsolve \
+  ( const PresolveRecord<Real>& record, \
+    const DistMultiVec<Real>& xRed, \
+    const DistMultiVec<Real>& yRed, \
+    const DistMultiVec<Real>& zRed, \
+    const DistMultiVec<Real>& sRed, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+          DistMultiVec<Real>& s );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -62,10 +62,33 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+    if( ctrl.presolve )
+    {
+        SparseMatrix<Real> QRed, ARed;
+        Matrix<Real> bRed, cRed, xRed, yRed, zRed;
+        PresolveRecord<Real> record;
+        qp::direct::Presolve
+        ( Q, A, b, c, QRed, ARed, bRed, cRed, record, ctrl.presolveCtrl );
+        if( ARed.Width() > 0 )
+        {
+            auto mehrotraCtrl = ctrl.mehrotraCtrl;
+            mehrotraCtrl.primalInit = false;
+            mehrotraCtrl.dualInit = false;
+            qp::direct::Mehrotra
+            ( QRed, ARed, bRed, cRed, xRed, yRed, zRed, mehrotraCtrl );
+        }
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+            Zeros( zRed, 0, 1 );
+        }
+        qp::direct::Postsolve( record, xRed, yRed, zRed, x, y, z );
+    }
+    else
+        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
 }
 
 template<typename Real>
@@ -80,10 +103,35 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+    if( ctrl.presolve )
+    {
+        const Grid& grid = A.Grid();
+        DistSparseMatrix<Real> QRed(grid), ARed(grid);
+        DistMultiVec<Real> bRed(grid), cRed(grid),
+          xRed(grid), yRed(grid), zRed(grid);
+        PresolveRecord<Real> record;
+        qp::direct::Presolve
+        ( Q, A, b, c, QRed, ARed, bRed, cRed, record, ctrl.presolveCtrl );
+        if( ARed.Width() > 0 )
+        {
+            auto mehrotraCtrl = ctrl.mehrotraCtrl;
+            mehrotraCtrl.primalInit = false;
+            mehrotraCtrl.dualInit = false;
+            qp::direct::Mehrotra
+            ( QRed, ARed, bRed, cRed, xRed, yRed, zRed, mehrotraCtrl );
+        }
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+            Zeros( zRed, 0, 1 );
+        }
+        qp::direct::Postsolve( record, xRed, yRed, zRed, x, y, z );
+    }
+    else
+        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
 }
 
 // Affine conic form
@@ -145,10 +193,37 @@ void QP
   const qp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::affine::Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+    if( ctrl.presolve )
+    {
+        SparseMatrix<Real> QRed, ARed, GRed;
+        Matrix<Real> bRed, cRed, hRed, xRed, yRed, zRed, sRed;
+        PresolveRecord<Real> record;
+        qp::affine::Presolve
+        ( Q, A, G, b, c, h, QRed, ARed, GRed, bRed, cRed, hRed, record,
+          ctrl.presolveCtrl );
+        if( ARed.Width() > 0 )
+        {
+            auto mehrotraCtrl = ctrl.mehrotraCtrl;
+            mehrotraCtrl.primalInit = false;
+            mehrotraCtrl.dualInit = false;
+            qp::affine::Mehrotra
+            ( QRed, ARed, GRed, bRed, cRed, hRed, xRed, yRed, zRed, sRed,
+              mehrotraCtrl );
+        }
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+            Zeros( zRed, GRed.Height(), 1 );
+            sRed = hRed;
+        }
+        qp::affine::Postsolve
+        ( record, xRed, yRed, zRed, sRed, x, y, z, s );
+    }
+    else
+        qp::affine::Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
 }
 
 template<typename Real>
@@ -166,10 +241,219 @@ void QP
   const qp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::affine::Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+    if( ctrl.presolve )
+    {
+        const Grid& grid = A.Grid();
+        DistSparseMatrix<Real> QRed(grid), ARed(grid), GRed(grid);
+        DistMultiVec<Real> bRed(grid), cRed(grid), hRed(grid),
+          xRed(grid), yRed(grid), zRed(grid), sRed(grid);
+        PresolveRecord<Real> record;
+        qp::affine::Presolve
+        ( Q, A, G, b, c, h, QRed, ARed, GRed, bRed, cRed, hRed, record,
+          ctrl.presolveCtrl );
+        if( ARed.Width() > 0 )
+        {
+            auto mehrotraCtrl = ctrl.mehrotraCtrl;
+            mehrotraCtrl.primalInit = false;
+            mehrotraCtrl.dualInit = false;
+            qp::affine::Mehrotra
+            ( QRed, ARed, GRed, bRed, cRed, hRed, xRed, yRed, zRed, sRed,
+              mehrotraCtrl );
+        }
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+            Zeros( zRed, GRed.Height(), 1 );
+            sRed = hRed;
+        }
+        qp::affine::Postsolve
+        ( record, xRed, yRed, zRed, sRed, x, y, z, s );
+    }
+    else
+        qp::affine::Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
+}
+
+// Warm-started re-solves
+// ======================
+namespace qp {
+
+namespace direct {
+
+template<typename Real,class MatrixType,class VectorType,class SessionType>
+void WarmStartedMehrotra
+( const MatrixType& Q,
+  const MatrixType& A,
+  const VectorType& b,
+  const VectorType& c,
+        VectorType& x,
+        VectorType& y,
+        VectorType& z,
+        SessionType& session,
+  const Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach != QP_MEHROTRA )
+        LogicError("Warm-started re-solves require the Mehrotra IPM");
+    if( ctrl.presolve )
+        LogicError("Presolve is not supported for warm-started re-solves");
+    const bool patternChanged = session.ProblemPatternChanged( Q, A );
+    if( session.haveSolution &&
+        (session.x.Height() != A.Width() || session.y.Height() != A.Height() ||
+         patternChanged) )
+        session.Reset();
+
+    auto mehrotraCtrl = ctrl.mehrotraCtrl;
+    if( session.haveSolution )
+    {
+        x = session.x;
+        y = session.y;
+        z = session.z;
+        session.LiftConeVariable( x );
+        session.LiftConeVariable( z );
+        mehrotraCtrl.primalInit = true;
+        mehrotraCtrl.dualInit = true;
+    }
+    Mehrotra( Q, A, b, c, x, y, z, mehrotraCtrl, &session );
+
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.haveSolution = true;
+    if( mehrotraCtrl.print )
+        PrintSessionSummary( session );
+}
+
+} // namespace direct
+
+namespace affine {
+
+template<typename Real,class MatrixType,class VectorType,class SessionType>
+void WarmStartedMehrotra
+( const MatrixType& Q,
+  const MatrixType& A,
+  const MatrixType& G,
+  const VectorType& b,
+  const VectorType& c,
+  const VectorType& h,
+        VectorType& x,
+        VectorType& y,
+        VectorType& z,
+        VectorType& s,
+        SessionType& session,
+  const Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach != QP_MEHROTRA )
+        LogicError("Warm-started re-solves require the Mehrotra IPM");
+    if( ctrl.presolve )
+        LogicError("Presolve is not supported for warm-started re-solves");
+    const bool patternChanged = session.ProblemPatternChanged( Q, A, G );
+    if( session.haveSolution &&
+        (session.x.Height() != A.Width() ||
+         session.y.Height() != A.Height() ||
+         session.z.Height() != G.Height() || patternChanged) )
+        session.Reset();
+
+    auto mehrotraCtrl = ctrl.mehrotraCtrl;
+    if( session.haveSolution )
+    {
+        x = session.x;
+        y = session.y;
+        z = session.z;
+        s = session.s;
+        session.LiftConeVariable( s );
+        session.LiftConeVariable( z );
+        mehrotraCtrl.primalInit = true;
+        mehrotraCtrl.dualInit = true;
+    }
+    Mehrotra( Q, A, G, b, c, h, x, y, z, s, mehrotraCtrl, &session );
+
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.s = s;
+    session.haveSolution = true;
+    if( mehrotraCtrl.print )
+        PrintSessionSummary( session );
+}
+
+} // namespace affine
+
+} // namespace qp
+
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        SparseMehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    qp::direct::WarmStartedMehrotra( Q, A, b, c, x, y, z, session, ctrl );
+}
+
+template<typename Real>
+void QP
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistSparseMehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    qp::direct::WarmStartedMehrotra( Q, A, b, c, x, y, z, session, ctrl );
+}
+
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+        SparseMehrotraSession<Real>& session,
+  const qp::affine::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    qp::affine::WarmStartedMehrotra
+    ( Q, A, G, b, c, h, x, y, z, s, session, ctrl );
+}
+
+template<typename Real>
+void QP
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& G,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& h,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s,
+        DistSparseMehrotraSession<Real>& session,
+  const qp::affine::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    qp::affine::WarmStartedMehrotra
+    ( Q, A, G, b, c, h, x, y, z, s, session, ctrl );
 }
 
 #define PROTO(Real) \
@@ -256,6 +540,52 @@ void QP
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
           DistMultiVec<Real>& s, \
+    const qp::affine::Ctrl<Real>& ctrl ); \
+  template void QP \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          SparseMehrotraSession<Real>& session, \
+    const qp::direct::Ctrl<Real>& ctrl ); \
+  template void QP \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+          DistSparseMehrotraSession<Real>& session, \
+    const qp::direct::Ctrl<Real>& ctrl ); \
+  template void QP \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const SparseMatrix<Real>& G, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Real>& h, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          Matrix<Real>& s, \
+          SparseMehrotraSession<Real>& session, \
+    const qp::affine::Ctrl<Real>& ctrl ); \
+  template void QP \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistSparseMatrix<Real>& G, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+    const DistMultiVec<Real>& h, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+          DistMultiVec<Real>& s, \
+          DistSparseMehrotraSession<Real>& session, \
     const qp::affine::Ctrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
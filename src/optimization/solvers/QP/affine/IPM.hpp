@@ -65,6 +65,37 @@ void Mehrotra
         DistMultiVec<Real>& s,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
+// Variants which reuse the symbolic analysis and equilibration stored in a
+// session between calls
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session );
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& G,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& h,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s,
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session );
+
 } // namespace affine
 } // namespace qp
 } // namespace El
@@ -118,6 +118,26 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const Matrix<Real>& rc,
+           const Matrix<Real>& rb,
+           const Matrix<Real>& rh,
+           const Matrix<Real>& rmu,
+                 Matrix<Real>& dx,
+                 Matrix<Real>& dy,
+                 Matrix<Real>& dz,
+                 Matrix<Real>& ds )
+      {
+        // Compute the proposed step from the KKT system
+        // ---------------------------------------------
+        KKTRHS( rc, rb, rh, rmu, z, d );
+        ldl::SolveAfter( J, dSub, p, d, false );
+        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        return true;
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -293,11 +313,8 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        ldl::SolveAfter( J, dSub, p, d, false );
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        if( !solveWithFactorization( rc, rb, rh, rmu, dx, dy, dz, ds ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -308,6 +325,57 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            Matrix<Real> rcCent, rbCent, rhCent, rmuCent, dxCent, dyCent,
+              dzCent, dsCent, dxTrial, dyTrial, dzTrial, dsTrial;
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            Zeros( rhCent, k, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( s, z, ds, dz, rmuCent,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rhCent, rmuCent,
+                         dxCent, dyCent, dzCent, dsCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dsTrial = ds;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  dsTrial += dsCent;
+                  alphaPriNew =
+                    pos_orth::MaxStep( s, dsTrial, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep( z, dzTrial, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+                  ds = dsTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -467,6 +535,43 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DistMatrix<Real>& rc,
+           const DistMatrix<Real>& rb,
+           const DistMatrix<Real>& rh,
+           const DistMatrix<Real>& rmu,
+                 DistMatrix<Real>& dx,
+                 DistMatrix<Real>& dy,
+                 DistMatrix<Real>& dz,
+                 DistMatrix<Real>& ds )
+      {
+        // Form the new KKT RHS
+        // --------------------
+        KKTRHS( rc, rb, rh, rmu, z, d );
+        // Solve for the new direction
+        // ---------------------------
+        try
+        {
+            if( ctrl.time && commRank == 0 )
+                timer.Start();
+            ldl::SolveAfter( J, dSub, p, d, false );
+            if( ctrl.time && commRank == 0 )
+                Output("Combined solve: ",timer.Stop()," secs");
+        }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                return false;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        return true;
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -653,28 +758,8 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Form the new KKT RHS
-        // --------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the new direction
-        // ---------------------------
-        try
-        {
-            if( ctrl.time && commRank == 0 )
-                timer.Start();
-            ldl::SolveAfter( J, dSub, p, d, false );
-            if( ctrl.time && commRank == 0 )
-                Output("Combined solve: ",timer.Stop()," secs");
-        }
-        catch(...)
-        {
-            if( relError <= ctrl.minTol )
-                break;
-            else
-                RuntimeError
-                ("Could not achieve minimum tolerance of ",ctrl.minTol);
-        }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        if( !solveWithFactorization( rc, rb, rh, rmu, dx, dy, dz, ds ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -685,6 +770,59 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DistMatrix<Real> rcCent(grid), rbCent(grid), rhCent(grid),
+              rmuCent(grid), dxCent(grid), dyCent(grid), dzCent(grid),
+              dsCent(grid), dxTrial(grid), dyTrial(grid), dzTrial(grid),
+              dsTrial(grid);
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            Zeros( rhCent, k, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( s, z, ds, dz, rmuCent,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rhCent, rmuCent,
+                         dxCent, dyCent, dzCent, dsCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dsTrial = ds;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  dsTrial += dsCent;
+                  alphaPriNew =
+                    pos_orth::MaxStep( s, dsTrial, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep( z, dzTrial, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+                  ds = dsTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -723,7 +861,8 @@ void Mehrotra
         Matrix<Real>& y,
         Matrix<Real>& z,
         Matrix<Real>& s,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session )
 {
     EL_DEBUG_CSE
 
@@ -738,10 +877,35 @@ void Mehrotra
     const Int k = G.Height();
     const Int n = A.Width();
     const Int degree = k;
+    const bool reuseScaling =
+      session && session->reuseEquilibration && session->equilibrated &&
+      session->rowScaleA.Height() == m && session->rowScaleG.Height() == k &&
+      session->colScale.Height() == n;
     Matrix<Real> dRowA, dRowG, dCol;
     if( ctrl.outerEquil )
     {
-        StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
+        if( reuseScaling )
+        {
+            // Apply the scalings of the session's first equilibration
+            dRowA = session->rowScaleA;
+            dRowG = session->rowScaleG;
+            dCol = session->colScale;
+            DiagonalSolve( LEFT, NORMAL, dRowA, A );
+            DiagonalSolve( LEFT, NORMAL, dRowG, G );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, G );
+        }
+        else
+        {
+            StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
+            if( session )
+            {
+                session->rowScaleA = dRowA;
+                session->rowScaleG = dRowG;
+                session->colScale = dCol;
+                session->equilibrated = true;
+            }
+        }
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
         DiagonalSolve( LEFT, NORMAL, dCol,  c );
@@ -802,7 +966,11 @@ void Mehrotra
     StaticKKT
     ( Q, A, G, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, JStatic, false );
 
-    SparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the factorization (and, when possible, its symbolic analysis)
+    // stored in the session, if there is one
+    SparseLDLFactorization<Real> localSparseLDLFact;
+    SparseLDLFactorization<Real>& sparseLDLFact =
+      ( session ? session->factorization : localSparseLDLFact );
 
     Initialize
     ( JStatic, regTmp, b, c, h, x, y, z, s,
@@ -819,8 +987,50 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const Matrix<Real>& rc,
+           const Matrix<Real>& rb,
+           const Matrix<Real>& rh,
+           const Matrix<Real>& rmu,
+                 Matrix<Real>& dx,
+                 Matrix<Real>& dy,
+                 Matrix<Real>& dz,
+                 Matrix<Real>& ds )
+      {
+        // Set up the new KKT RHS
+        // ----------------------
+        KKTRHS( rc, rb, rh, rmu, z, d );
+        // Solve for the new direction
+        // ---------------------------
+        try
+        {
+            if( ctrl.resolveReg )
+                reg_ldl::SolveAfter
+                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+            else
+                reg_ldl::RegularizedSolveAfter
+                ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                  ctrl.solveCtrl.relTol,
+                  ctrl.solveCtrl.maxRefineIts,
+                  ctrl.solveCtrl.progress );
+        }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                return false;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        return true;
+      };
+
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts = 0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that s and z are in the cone
         // ===================================
@@ -934,7 +1144,8 @@ void Mehrotra
             else
                 Ones( dInner, n+m+k, 1 );
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
+            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit &&
+                !(session && session->CanReuseAnalysis(J,FULL_KKT)) )
             {
                 const bool hermitian = true;
                 const BisectCtrl bisectCtrl;
@@ -944,6 +1155,8 @@ void Mehrotra
             {
                 sparseLDLFact.ChangeNonzeroValues( J );
             }
+            if( session && numIts == 0 )
+                session->RecordAnalysis( J, FULL_KKT );
 
             sparseLDLFact.Factor();
 
@@ -1035,32 +1248,8 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Set up the new KKT RHS
-        // ----------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the new direction
-        // ---------------------------
-        try
-        {
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
-        }
-        catch(...)
-        {
-            if( relError <= ctrl.minTol )
-                break;
-            else
-                RuntimeError
-                ("Could not achieve minimum tolerance of ",ctrl.minTol);
-        }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        if( !solveWithFactorization( rc, rb, rh, rmu, dx, dy, dz, ds ) )
+            break;
 
         // Update the current estimates
         // ============================
@@ -1070,6 +1259,57 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            Matrix<Real> rcCent, rbCent, rhCent, rmuCent, dxCent, dyCent,
+              dzCent, dsCent, dxTrial, dyTrial, dzTrial, dsTrial;
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            Zeros( rhCent, k, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( s, z, ds, dz, rmuCent,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rhCent, rmuCent,
+                         dxCent, dyCent, dzCent, dsCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dsTrial = ds;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  dsTrial += dsCent;
+                  alphaPriNew =
+                    pos_orth::MaxStep( s, dsTrial, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep( z, dzTrial, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+                  ds = dsTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -1086,6 +1326,8 @@ void Mehrotra
         }
     }
     SetIndent( indent );
+    if( session )
+        session->RecordIterations( numIts );
 
     if( ctrl.outerEquil )
     {
@@ -1096,6 +1338,25 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseMehrotraSession<Real>* session = nullptr;
+    Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl, session );
+}
+
 template<typename Real>
 void Mehrotra
 ( const DistSparseMatrix<Real>& QPre,
@@ -1108,7 +1369,8 @@ void Mehrotra
         DistMultiVec<Real>& y,
         DistMultiVec<Real>& z,
         DistMultiVec<Real>& s,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session )
 {
     EL_DEBUG_CSE
 
@@ -1130,12 +1392,37 @@ void Mehrotra
     const Int k = G.Height();
     const Int n = A.Width();
     const Int degree = k;
+    const bool reuseScaling =
+      session && session->reuseEquilibration && session->equilibrated &&
+      session->rowScaleA.Height() == m && session->rowScaleG.Height() == k &&
+      session->colScale.Height() == n;
     DistMultiVec<Real> dRowA(grid), dRowG(grid), dCol(grid);
     if( ctrl.outerEquil )
     {
         if( commRank == 0 && ctrl.time )
             timer.Start();
-        StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
+        if( reuseScaling )
+        {
+            // Apply the scalings of the session's first equilibration
+            dRowA = session->rowScaleA;
+            dRowG = session->rowScaleG;
+            dCol = session->colScale;
+            DiagonalSolve( LEFT, NORMAL, dRowA, A );
+            DiagonalSolve( LEFT, NORMAL, dRowG, G );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, G );
+        }
+        else
+        {
+            StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
+            if( session )
+            {
+                session->rowScaleA = dRowA;
+                session->rowScaleG = dRowG;
+                session->colScale = dCol;
+                session->equilibrated = true;
+            }
+        }
         if( commRank == 0 && ctrl.time )
             Output("RuizEquil: ",timer.Stop()," secs");
 
@@ -1220,7 +1507,11 @@ void Mehrotra
 
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    DistSparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the factorization (and, when possible, its symbolic analysis)
+    // stored in the session, if there is one
+    DistSparseLDLFactorization<Real> localSparseLDLFact;
+    DistSparseLDLFactorization<Real>& sparseLDLFact =
+      ( session ? session->factorization : localSparseLDLFact );
     Initialize
     ( JStatic, regTmp, b, c, h, x, y, z, s,
       sparseLDLFact,
@@ -1237,8 +1528,54 @@ void Mehrotra
     Real relError = 1;
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid), dzError(grid);
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DistMultiVec<Real>& rc,
+           const DistMultiVec<Real>& rb,
+           const DistMultiVec<Real>& rh,
+           const DistMultiVec<Real>& rmu,
+                 DistMultiVec<Real>& dx,
+                 DistMultiVec<Real>& dy,
+                 DistMultiVec<Real>& dz,
+                 DistMultiVec<Real>& ds )
+      {
+        // Set up the new RHS
+        // ------------------
+        KKTRHS( rc, rb, rh, rmu, z, d );
+        // Compute the new direction
+        // -------------------------
+        try
+        {
+            if( commRank == 0 && ctrl.time )
+                timer.Start();
+            if( ctrl.resolveReg )
+                reg_ldl::SolveAfter
+                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+            else
+                reg_ldl::RegularizedSolveAfter
+                ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                  ctrl.solveCtrl.relTol,
+                  ctrl.solveCtrl.maxRefineIts,
+                  ctrl.solveCtrl.progress );
+            if( commRank == 0 && ctrl.time )
+                Output("Corrector solver: ",timer.Stop()," secs");
+        }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                return false;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        return true;
+      };
+
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts = 0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         if( ctrl.time && commRank == 0 )
             iterTimer.Start();
@@ -1363,7 +1700,8 @@ void Mehrotra
             if( commRank == 0 && ctrl.time )
                 Output("Equilibration: ",timer.Stop()," secs");
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
+            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit &&
+                !(session && session->CanReuseAnalysis(J,FULL_KKT)) )
             {
                 const bool hermitian = true;
                 const BisectCtrl bisectCtrl;
@@ -1373,6 +1711,8 @@ void Mehrotra
             {
                 sparseLDLFact.ChangeNonzeroValues( J );
             }
+            if( session && numIts == 0 )
+                session->RecordAnalysis( J, FULL_KKT );
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
@@ -1476,36 +1816,8 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Set up the new RHS
-        // ------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Compute the new direction
-        // -------------------------
-        try
-        {
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Corrector solver: ",timer.Stop()," secs");
-        }
-        catch(...)
-        {
-            if( relError <= ctrl.minTol )
-                break;
-            else
-                RuntimeError
-                ("Could not achieve minimum tolerance of ",ctrl.minTol);
-        }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        if( !solveWithFactorization( rc, rb, rh, rmu, dx, dy, dz, ds ) )
+            break;
 
         // Update the current estimates
         // ============================
@@ -1515,6 +1827,59 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DistMultiVec<Real> rcCent(grid), rbCent(grid), rhCent(grid),
+              rmuCent(grid), dxCent(grid), dyCent(grid), dzCent(grid),
+              dsCent(grid), dxTrial(grid), dyTrial(grid), dzTrial(grid),
+              dsTrial(grid);
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            Zeros( rhCent, k, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( s, z, ds, dz, rmuCent,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rhCent, rmuCent,
+                         dxCent, dyCent, dzCent, dsCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dsTrial = ds;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  dsTrial += dsCent;
+                  alphaPriNew =
+                    pos_orth::MaxStep( s, dsTrial, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep( z, dzTrial, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+                  ds = dsTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -1533,6 +1898,8 @@ void Mehrotra
         }
     }
     SetIndent( indent );
+    if( session )
+        session->RecordIterations( numIts );
 
     if( ctrl.outerEquil )
     {
@@ -1543,6 +1910,25 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& G,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& h,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseMehrotraSession<Real>* session = nullptr;
+    Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl, session );
+}
+
 #define PROTO(Real) \
   template void Mehrotra \
   ( const Matrix<Real>& Q, \
@@ -1581,6 +1967,31 @@ void Mehrotra
           Matrix<Real>& s, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const SparseMatrix<Real>& G, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Real>& h, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          Matrix<Real>& s, \
+    const MehrotraCtrl<Real>& ctrl, \
+          SparseMehrotraSession<Real>* session ); \
+  template void Mehrotra \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistSparseMatrix<Real>& G, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+    const DistMultiVec<Real>& h, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+          DistMultiVec<Real>& s, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const DistSparseMatrix<Real>& Q, \
     const DistSparseMatrix<Real>& A, \
     const DistSparseMatrix<Real>& G, \
@@ -1591,7 +2002,8 @@ void Mehrotra
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
           DistMultiVec<Real>& s, \
-    const MehrotraCtrl<Real>& ctrl );
+    const MehrotraCtrl<Real>& ctrl, \
+          DistSparseMehrotraSession<Real>* session );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -25,117 +25,118 @@ namespace El {
 namespace qp {
 namespace box {
 
-template<typename Real,
-         typename/*=EnableIf<IsReal<Real>>*/>
-Int
-ADMM
-( const Matrix<Real>& Q,
-  const Matrix<Real>& C,
+namespace {
+
+template<typename Real,class MatrixType>
+Int BoxADMM
+( const MatrixType& Q,
+  const MatrixType& C,
         Real lb,
         Real ub,
-        Matrix<Real>& Z,
+        MatrixType& Z,
   const ADMMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
     const Int n = Q.Height();
     const Int k = C.Width();
 
-    // Cache the factorization of Q + rho*I
-    Matrix<Real> LMod( Q );
-    ShiftDiagonal( LMod, ctrl.rho );
-    if( ctrl.inv )
-    {
-        HPDInverse( LOWER, LMod );
-    }
-    else
-    {
-        Cholesky( LOWER, LMod );
-        MakeTrapezoidal( LOWER, LMod );
-    }
+    // Cache the factorization of Q + rho*I (which is only reformed when rho
+    // is adapted)
+    MatrixType LMod( Q );
+    Real factoredRho = 0;
+    auto factor =
+      [&]( Real rho )
+      {
+          LMod = Q;
+          ShiftDiagonal( LMod, rho );
+          if( ctrl.inv )
+          {
+              HPDInverse( LOWER, LMod );
+          }
+          else
+          {
+              Cholesky( LOWER, LMod );
+              MakeTrapezoidal( LOWER, LMod );
+          }
+          factoredRho = rho;
+      };
 
-    // Start the ADMM
-    Int numIter=0;
-    Matrix<Real> X, U, T, ZOld, XHat;
     Zeros( Z, n, k );
-    Zeros( U, n, k );
-    Zeros( T, n, k );
-    while( numIter < ctrl.maxIter )
-    {
-        ZOld = Z;
-
-        // x := (Q+rho*I)^{-1} (rho(z-u)-q)
-        X = Z;
-        X -= U;
-        X *= ctrl.rho;
-        X -= C;
-        if( ctrl.inv )
-        {
-            auto Y( X );
-            Hemm( LEFT, LOWER, Real(1), LMod, Y, Real(0), X );
-        }
-        else
-        {
-            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), LMod, X );
-            Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Real(1), LMod, X );
-        }
-
-        // xHat := alpha*x + (1-alpha)*zOld
-        XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
-
-        // z := Clip(xHat+u,lb,ub)
-        Z = XHat;
-        Z += U;
-        Clip( Z, lb, ub );
-
-        // u := u + (xHat-z)
-        U += XHat;
-        U -= Z;
-
-        // rNorm := || x - z ||_2
-        T = X;
-        T -= Z;
-        const Real rNorm = FrobeniusNorm( T );
-
-        // sNorm := |rho| || z - zOld ||_2
-        T = Z;
-        T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( T );
-
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
-
-        if( ctrl.print )
-        {
-            // Form (1/2) x' Q x + c' x
-            Zeros( T, n, k );
-            Hemm( LEFT, LOWER, Real(1), Q, X, Real(0), T );
-            const Real objective = HilbertSchmidt(X,T)/2 + HilbertSchmidt(C,X);
-
-            T = X;
-            Clip( T, lb, ub );
-            T -= X;
-            const Real clipDist = FrobeniusNorm( T );
-            cout << numIter << ": "
-              << "||X-Z||_F=" << rNorm << ", "
-              << "epsPri=" << epsPri << ", "
-              << "|rho| ||Z-ZOld||_F=" << sNorm << ", "
-              << "epsDual=" << epsDual << ", "
-              << "||X-Clip(X,lb,ub)||_F=" << clipDist << ", "
-              << "(1/2) <X,Q X> + <C,X>=" << objective << endl;
-        }
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+    auto X = Z;
+    auto U = Z;
+    auto T = Z;
+
+    // x := (Q+rho*I)^{-1} (rho v - c)
+    auto xUpdate =
+      [&]( Real rho, const MatrixType& V, MatrixType& W )
+      {
+          if( rho != factoredRho )
+              factor( rho );
+          W = V;
+          W *= rho;
+          W -= C;
+          if( ctrl.inv )
+          {
+              T = W;
+              Hemm( LEFT, LOWER, Real(1), LMod, T, Real(0), W );
+          }
+          else
+          {
+              Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), LMod, W );
+              Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Real(1), LMod, W );
+          }
+      };
+
+    // z := Clip(v,lb,ub)
+    auto zUpdate =
+      [&]( Real rho, const MatrixType& V, MatrixType& W )
+      {
+          W = V;
+          Clip( W, lb, ub );
+      };
+
+    auto monitor =
+      [&]( Int, const MatrixType&, const MatrixType& )
+      {
+          // Form (1/2) x' Q x + c' x
+          Zeros( T, n, k );
+          Hemm( LEFT, LOWER, Real(1), Q, X, Real(0), T );
+          const Real objective = HilbertSchmidt(X,T)/2 + HilbertSchmidt(C,X);
+
+          T = X;
+          Clip( T, lb, ub );
+          T -= X;
+          const Real clipDist = FrobeniusNorm( T );
+          if( admm::IsRoot(X) )
+              Output
+              ("  ||X-Clip(X,lb,ub)||_F=",clipDist,
+               ", (1/2) <X,Q X> + <C,X>=",objective);
+      };
+
+    const Int numIter =
+      El::ADMM<Real>( xUpdate, zUpdate, monitor, X, Z, U, ctrl );
     if( ctrl.maxIter == numIter )
         RuntimeError("ADMM failed to converge");
     return numIter;
 }
 
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Int
+ADMM
+( const Matrix<Real>& Q,
+  const Matrix<Real>& C,
+        Real lb,
+        Real ub,
+        Matrix<Real>& Z,
+  const ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    return BoxADMM( Q, C, lb, ub, Z, ctrl );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsReal<Real>>*/>
 Int
@@ -158,105 +159,7 @@ ADMM
     auto& C = CProx.GetLocked();
     auto& Z = ZProx.Get();
 
-    const Grid& grid = Q.Grid();
-    const Int n = Q.Height();
-    const Int k = C.Width();
-
-    // Cache the factorization of Q + rho*I
-    DistMatrix<Real> LMod( Q );
-    ShiftDiagonal( LMod, ctrl.rho );
-    if( ctrl.inv )
-    {
-        HPDInverse( LOWER, LMod );
-    }
-    else
-    {
-        Cholesky( LOWER, LMod );
-        MakeTrapezoidal( LOWER, LMod );
-    }
-
-    // Start the ADMM
-    Int numIter=0;
-    DistMatrix<Real> X(grid), U(grid), T(grid), ZOld(grid), XHat(grid);
-    Zeros( Z, n, k );
-    Zeros( U, n, k );
-    Zeros( T, n, k );
-    while( numIter < ctrl.maxIter )
-    {
-        ZOld = Z;
-
-        // x := (Q+rho*I)^{-1} (rho(z-u)-q)
-        X = Z;
-        X -= U;
-        X *= ctrl.rho;
-        X -= C;
-        if( ctrl.inv )
-        {
-            auto Y( X );
-            Hemm( LEFT, LOWER, Real(1), LMod, Y, Real(0), X );
-        }
-        else
-        {
-            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), LMod, X );
-            Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Real(1), LMod, X );
-        }
-
-        // xHat := alpha*x + (1-alpha)*zOld
-        XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
-
-        // z := Clip(xHat+u,lb,ub)
-        Z = XHat;
-        Z += U;
-        Clip( Z, lb, ub );
-
-        // u := u + (xHat-z)
-        U += XHat;
-        U -= Z;
-
-        // rNorm := || x - z ||_2
-        T = X;
-        T -= Z;
-        const Real rNorm = FrobeniusNorm( T );
-
-        // sNorm := |rho| || z - zOld ||_2
-        T = Z;
-        T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( T );
-
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
-
-        if( ctrl.print )
-        {
-            // Form (1/2) x' Q x + c' x
-            Zeros( T, n, k );
-            Hemm( LEFT, LOWER, Real(1), Q, X, Real(0), T );
-            const Real objective = HilbertSchmidt(X,T)/2 + HilbertSchmidt(C,X);
-
-            T = X;
-            Clip( T, lb, ub );
-            T -= X;
-            const Real clipDist = FrobeniusNorm( T );
-            if( grid.Rank() == 0 )
-                cout << numIter << ": "
-                  << "||X-Z||_F=" << rNorm << ", "
-                  << "epsPri=" << epsPri << ", "
-                  << "|rho| ||Z-ZOld||_F=" << sNorm << ", "
-                  << "epsDual=" << epsDual << ", "
-                  << "||X-Clip(X,lb,ub)||_2=" << clipDist << ", "
-                  << "(1/2) <X,Q X> + <C,X>=" << objective << endl;
-        }
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
-    if( ctrl.maxIter == numIter )
-        RuntimeError("ADMM failed to converge");
-    return numIter;
+    return BoxADMM( Q, C, lb, ub, Z, ctrl );
 }
 
 #define PROTO(Real) \
@@ -53,6 +53,31 @@ void Mehrotra
         DistMultiVec<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
+// Variants which reuse the symbolic analysis and equilibration stored in a
+// session between calls
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session );
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session );
+
 } // namespace direct
 } // namespace qp
 } // namespace El
@@ -103,6 +103,59 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const Matrix<Real>& rc,
+           const Matrix<Real>& rb,
+           const Matrix<Real>& rmu,
+                 Matrix<Real>& dx,
+                 Matrix<Real>& dy,
+                 Matrix<Real>& dz )
+      {
+        if( ctrl.system == FULL_KKT )
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS( rc, rb, rmu, z, d );
+
+            // Solve for the direction
+            // -----------------------
+            try { ldl::SolveAfter( J, dSub, p, d, false ); }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandSolution( m, n, d, dx, dy, dz );
+        }
+        else if( ctrl.system == AUGMENTED_KKT )
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            AugmentedKKTRHS( x, rc, rb, rmu, d );
+
+            // Solve for the direction
+            // -----------------------
+            try { ldl::SolveAfter( J, dSub, p, d, false ); }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+        }
+        else
+            LogicError("Invalid KKT system choice");
+        return true;
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -299,46 +352,8 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-            LogicError("Invalid KKT system choice");
+        if( !solveWithFactorization( rc, rb, rmu, dx, dy, dz ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -349,6 +364,52 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            Matrix<Real> rcCent, rbCent, rmuCent, dxCent, dyCent, dzCent,
+              dxTrial, dyTrial, dzTrial;
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( x, z, dx, dz, rmuCent,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rmuCent, dxCent, dyCent, dzCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  alphaPriNew =
+                    pos_orth::MaxStep( x, dxTrial, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep( z, dzTrial, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -480,6 +541,59 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DistMatrix<Real>& rc,
+           const DistMatrix<Real>& rb,
+           const DistMatrix<Real>& rmu,
+                 DistMatrix<Real>& dx,
+                 DistMatrix<Real>& dy,
+                 DistMatrix<Real>& dz )
+      {
+        if( ctrl.system == FULL_KKT )
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS( rc, rb, rmu, z, d );
+
+            // Solve for the direction
+            // -----------------------
+            try { ldl::SolveAfter( J, dSub, p, d, false ); }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandSolution( m, n, d, dx, dy, dz );
+        }
+        else if( ctrl.system == AUGMENTED_KKT )
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            AugmentedKKTRHS( x, rc, rb, rmu, d );
+
+            // Solve for the direction
+            // -----------------------
+            try { ldl::SolveAfter( J, dSub, p, d, false ); }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+        }
+        else
+            LogicError("Invalid KKT system choice");
+        return true;
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -678,46 +792,8 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-            LogicError("Invalid KKT system choice");
+        if( !solveWithFactorization( rc, rb, rmu, dx, dy, dz ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -728,6 +804,53 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DistMatrix<Real> rcCent(grid), rbCent(grid), rmuCent(grid),
+              dxCent(grid), dyCent(grid), dzCent(grid), dxTrial(grid),
+              dyTrial(grid), dzTrial(grid);
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( x, z, dx, dz, rmuCent,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rmuCent, dxCent, dyCent, dzCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  alphaPriNew =
+                    pos_orth::MaxStep( x, dxTrial, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep( z, dzTrial, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -761,7 +884,8 @@ void Mehrotra
         Matrix<Real>& x,
         Matrix<Real>& y,
         Matrix<Real>& z,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        SparseMehrotraSession<Real>* session )
 {
     EL_DEBUG_CSE
 
@@ -773,10 +897,30 @@ void Mehrotra
     const Int m = A.Height();
     const Int n = A.Width();
     const Int degree = n;
+    const bool reuseScaling =
+      session && session->reuseEquilibration && session->equilibrated &&
+      session->rowScaleA.Height() == m && session->colScale.Height() == n;
     Matrix<Real> dRow, dCol;
     if( ctrl.outerEquil )
     {
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( reuseScaling )
+        {
+            // Apply the scalings of the session's first equilibration
+            dRow = session->rowScaleA;
+            dCol = session->colScale;
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            if( session )
+            {
+                session->rowScaleA = dRow;
+                session->colScale = dCol;
+                session->equilibrated = true;
+            }
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b );
         DiagonalSolve( LEFT, NORMAL, dCol, c );
@@ -812,7 +956,11 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    SparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the factorization (and, when possible, its symbolic analysis)
+    // stored in the session, if there is one
+    SparseLDLFactorization<Real> localSparseLDLFact;
+    SparseLDLFactorization<Real>& sparseLDLFact =
+      ( session ? session->factorization : localSparseLDLFact );
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -867,8 +1015,82 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const Matrix<Real>& rc,
+           const Matrix<Real>& rb,
+           const Matrix<Real>& rmu,
+                 Matrix<Real>& dx,
+                 Matrix<Real>& dy,
+                 Matrix<Real>& dz )
+      {
+        if( ctrl.system == FULL_KKT )
+        {
+            // Form the new KKT RHS
+            // --------------------
+            KKTRHS( rc, rb, rmu, z, d );
+            // Solve for the direction
+            // -----------------------
+            try
+            {
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandSolution( m, n, d, dx, dy, dz );
+        }
+        else if( ctrl.system == AUGMENTED_KKT )
+        {
+            // Form the new KKT RHS
+            // --------------------
+            AugmentedKKTRHS( x, rc, rb, rmu, d );
+            // Solve for the direction
+            // -----------------------
+            try
+            {
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+        }
+        else
+            LogicError("Invalid KKT system choice");
+        return true;
+      };
+
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts = 0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -984,7 +1206,8 @@ void Mehrotra
 
                 if( numIts == 0 &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit) ) )
+                     (ctrl.primalInit && ctrl.dualInit) ) &&
+                    !(session && session->CanReuseAnalysis(J,ctrl.system)) )
                 {
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
@@ -994,6 +1217,8 @@ void Mehrotra
                 {
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
+                if( session && numIts == 0 )
+                    session->RecordAnalysis( J, ctrl.system );
 
                 sparseLDLFact.Factor( LDL_2D );
                 if( ctrl.resolveReg )
@@ -1090,66 +1315,8 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            // Form the new KKT RHS
-            // --------------------
-            KKTRHS( rc, rb, rmu, z, d );
-            // Solve for the direction
-            // -----------------------
-            try
-            {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Form the new KKT RHS
-            // --------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            // Solve for the direction
-            // -----------------------
-            try
-            {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-            LogicError("Invalid KKT system choice");
+        if( !solveWithFactorization( rc, rb, rmu, dx, dy, dz ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -1160,6 +1327,52 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            Matrix<Real> rcCent, rbCent, rmuCent, dxCent, dyCent, dzCent,
+              dxTrial, dyTrial, dzTrial;
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( x, z, dx, dz, rmuCent,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rmuCent, dxCent, dyCent, dzCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  alphaPriNew =
+                    pos_orth::MaxStep( x, dxTrial, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep( z, dzTrial, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -1175,6 +1388,8 @@ void Mehrotra
         }
     }
     SetIndent( indent );
+    if( session )
+        session->RecordIterations( numIts );
 
     if( ctrl.outerEquil )
     {
@@ -1184,6 +1399,22 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseMehrotraSession<Real>* session = nullptr;
+    Mehrotra( Q, A, b, c, x, y, z, ctrl, session );
+}
+
 template<typename Real>
 void Mehrotra
 ( const DistSparseMatrix<Real>& QPre,
@@ -1193,7 +1424,8 @@ void Mehrotra
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y,
         DistMultiVec<Real>& z,
-  const MehrotraCtrl<Real>& ctrl )
+  const MehrotraCtrl<Real>& ctrl,
+        DistSparseMehrotraSession<Real>* session )
 {
     EL_DEBUG_CSE
     const Grid& grid = APre.Grid();
@@ -1208,12 +1440,32 @@ void Mehrotra
     const Int m = A.Height();
     const Int n = A.Width();
     const Int degree = n;
+    const bool reuseScaling =
+      session && session->reuseEquilibration && session->equilibrated &&
+      session->rowScaleA.Height() == m && session->colScale.Height() == n;
     DistMultiVec<Real> dRow(grid), dCol(grid);
     if( ctrl.outerEquil )
     {
         if( commRank == 0 && ctrl.time )
             timer.Start();
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( reuseScaling )
+        {
+            // Apply the scalings of the session's first equilibration
+            dRow = session->rowScaleA;
+            dCol = session->colScale;
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            if( session )
+            {
+                session->rowScaleA = dRow;
+                session->colScale = dCol;
+                session->equilibrated = true;
+            }
+        }
         if( commRank == 0 && ctrl.time )
             Output("RuizEquil: ",timer.Stop()," secs");
 
@@ -1258,7 +1510,11 @@ void Mehrotra
         }
     }
 
-    DistSparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the factorization (and, when possible, its symbolic analysis)
+    // stored in the session, if there is one
+    DistSparseLDLFactorization<Real> localSparseLDLFact;
+    DistSparseLDLFactorization<Real>& sparseLDLFact =
+      ( session ? session->factorization : localSparseLDLFact );
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -1322,8 +1578,90 @@ void Mehrotra
     Real relError = 1;
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DistMultiVec<Real>& rc,
+           const DistMultiVec<Real>& rb,
+           const DistMultiVec<Real>& rmu,
+                 DistMultiVec<Real>& dx,
+                 DistMultiVec<Real>& dy,
+                 DistMultiVec<Real>& dz )
+      {
+        if( ctrl.system == FULL_KKT )
+        {
+            // Form the KKT system
+            // -------------------
+            KKTRHS( rc, rb, rmu, z, d );
+            // Solve for the direction
+            // -----------------------
+            try
+            {
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+                if( commRank == 0 && ctrl.time )
+                    Output("Corrector: ",timer.Stop()," secs");
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandSolution( m, n, d, dx, dy, dz );
+        }
+        else if( ctrl.system == AUGMENTED_KKT )
+        {
+            // Form the KKT system
+            // -------------------
+            AugmentedKKTRHS( x, rc, rb, rmu, d );
+            // Solve for the direction
+            // -----------------------
+            try
+            {
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+                if( commRank == 0 && ctrl.time )
+                    Output("Corrector: ",timer.Stop()," secs");
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    return false;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+        }
+        else
+            LogicError("Invalid KKT system choice");
+        return true;
+      };
+
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts = 0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -1457,7 +1795,8 @@ void Mehrotra
 
                 if( numIts == 0 &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                     (ctrl.primalInit && ctrl.dualInit)) &&
+                    !(session && session->CanReuseAnalysis(J,ctrl.system)) )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
@@ -1469,6 +1808,8 @@ void Mehrotra
                 }
                 else
                     sparseLDLFact.ChangeNonzeroValues( J );
+                if( session && numIts == 0 )
+                    session->RecordAnalysis( J, ctrl.system );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -1575,74 +1916,8 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            // Form the KKT system
-            // -------------------
-            KKTRHS( rc, rb, rmu, z, d );
-            // Solve for the direction
-            // -----------------------
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Form the KKT system
-            // -------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            // Solve for the direction
-            // -----------------------
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-            LogicError("Invalid KKT system choice");
+        if( !solveWithFactorization( rc, rb, rmu, dx, dy, dz ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -1653,6 +1928,53 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DistMultiVec<Real> rcCent(grid), rbCent(grid), rmuCent(grid),
+              dxCent(grid), dyCent(grid), dzCent(grid), dxTrial(grid),
+              dyTrial(grid), dzTrial(grid);
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  pos_orth::CentralityCorrector
+                  ( x, z, dx, dz, rmuCent,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rmuCent, dxCent, dyCent, dzCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  alphaPriNew =
+                    pos_orth::MaxStep( x, dxTrial, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    pos_orth::MaxStep( z, dzTrial, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -1668,6 +1990,8 @@ void Mehrotra
         }
     }
     SetIndent( indent );
+    if( session )
+        session->RecordIterations( numIts );
 
     if( ctrl.outerEquil )
     {
@@ -1677,6 +2001,22 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseMehrotraSession<Real>* session = nullptr;
+    Mehrotra( Q, A, b, c, x, y, z, ctrl, session );
+}
+
 #define PROTO(Real) \
   template void Mehrotra \
   ( const Matrix<Real>& Q, \
@@ -1706,6 +2046,25 @@ void Mehrotra
           Matrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl, \
+          SparseMehrotraSession<Real>* session ); \
+  template void Mehrotra \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const DistSparseMatrix<Real>& Q, \
     const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
@@ -1713,7 +2072,8 @@ void Mehrotra
           DistMultiVec<Real>& x, \
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
-    const MehrotraCtrl<Real>& ctrl );
+    const MehrotraCtrl<Real>& ctrl, \
+          DistSparseMehrotraSession<Real>* session );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./SDP/direct/IPM.hpp"
+
+namespace El {
+
+template<typename Real>
+void SDP
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Int>& orders,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const sdp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == SDP_MEHROTRA )
+        sdp::direct::Mehrotra( A, b, c, orders, x, y, z, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
+template<typename Real>
+void SDP
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const AbstractDistMatrix<Real>& c,
+  const Matrix<Int>& orders,
+        AbstractDistMatrix<Real>& x,
+        AbstractDistMatrix<Real>& y,
+        AbstractDistMatrix<Real>& z,
+  const sdp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == SDP_MEHROTRA )
+        sdp::direct::Mehrotra
+        ( A, b, c, orders, x, y, z, ctrl.mehrotraCtrl, ctrl.cutoff );
+    else
+        LogicError("Unsupported solver");
+}
+
+#define PROTO(Real) \
+  template void SDP \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Int>& orders, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const sdp::direct::Ctrl<Real>& ctrl ); \
+  template void SDP \
+  ( const AbstractDistMatrix<Real>& A, \
+    const AbstractDistMatrix<Real>& b, \
+    const AbstractDistMatrix<Real>& c, \
+    const Matrix<Int>& orders, \
+          AbstractDistMatrix<Real>& x, \
+          AbstractDistMatrix<Real>& y, \
+          AbstractDistMatrix<Real>& z, \
+    const sdp::direct::Ctrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
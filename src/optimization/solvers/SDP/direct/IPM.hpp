@@ -0,0 +1,39 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace sdp {
+namespace direct {
+
+template<typename Real>
+void Mehrotra
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Int>& orders,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+template<typename Real>
+void Mehrotra
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const AbstractDistMatrix<Real>& c,
+  const Matrix<Int>& orders,
+        AbstractDistMatrix<Real>& x,
+        AbstractDistMatrix<Real>& y,
+        AbstractDistMatrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(),
+  Int cutoff=1000 );
+
+} // namespace direct
+} // namespace sdp
+} // namespace El
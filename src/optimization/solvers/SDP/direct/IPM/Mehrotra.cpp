@@ -0,0 +1,709 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace sdp {
+namespace direct {
+
+// The following solves a pair of semidefinite programs in "direct" conic
+// form:
+//
+//   min c^T x
+//   s.t. A x = b, x in K,
+//
+//   max -b^T y
+//   s.t. A^T y - z + c = 0, z in K,
+//
+// where K is a product of positive semidefinite cones, using a Mehrotra
+// Predictor-Corrector scheme with Nesterov-Todd search directions. Given the
+// scaling matrices G and W = G G^T from psd::NesterovTodd, the scaled
+// iterates satisfy inv(G) X inv(G)^T = G^T Z G = Lambda, and the search
+// direction is the solution of
+//
+//   A dx = -r_b,  A^T dy - dz = -r_c,  inv(G) dX inv(G)^T + G^T dZ G = H,
+//
+// where H is the solution of the Lyapunov equation Lambda o H = R, with 'o'
+// denoting the Jordan product and R the (scaled) complementarity target.
+// Eliminating dx and dz yields the Schur complement system
+//
+//   (A (W kron W) A^T) dy = A (G H G^T - W R_c W) + r_b,
+//
+// where the (i,j) entry of the Schur complement is <A_i, W A_j W>. See, e.g.,
+//
+//   M.J. Todd, K.C. Toh, and R.H. Tutuncu,
+//   "On the Nesterov-Todd direction in semidefinite programming",
+//   SIAM Journal on Optimization, Vol. 8, No. 3, pp. 769--796, 1998.
+//
+
+namespace {
+
+Int MaxOrder( const Matrix<Int>& orders )
+{
+    Int maxOrder = 0;
+    for( Int i=0; i<orders.Height(); ++i )
+        maxOrder = Max( maxOrder, orders(i) );
+    return maxOrder;
+}
+
+// Replace each row of A with its symmetric part, returning its transpose
+template<typename Real>
+void SymmetrizeRows
+( Matrix<Real>& A, Matrix<Real>& AT, const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    Transpose( A, AT );
+    for( Int i=0; i<AT.Width(); ++i )
+    {
+        auto a = AT( ALL, IR(i) );
+        psd::Symmetrize( a, orders );
+    }
+    Transpose( AT, A );
+}
+
+// The (local contributions to the) scales of the initial points
+//
+//   x := xi I, y := 0, z := eta I,
+//
+// with xi = max(10, sqrt(n), max_i (1 + |b_i|) / (1 + || A_i ||_F)) and
+// eta = max(10, sqrt(n), || c ||_F, max_i || A_i ||_F), where n is the
+// maximum order of the blocks, as in, e.g., SDPT3.
+template<typename Real>
+void InitialScales
+( const Matrix<Real>& rowNorms,
+  const Matrix<Real>& b,
+        Real cNrm2,
+        Int maxOrder,
+        Real& primalScale,
+        Real& dualScale )
+{
+    EL_DEBUG_CSE
+    primalScale = Max( Real(10), Sqrt(Real(maxOrder)) );
+    dualScale = Max( primalScale, cNrm2 );
+    for( Int i=0; i<rowNorms.Height(); ++i )
+    {
+        const Real rowNorm = rowNorms(i);
+        primalScale = Max( primalScale, (1+Abs(b(i)))/(1+rowNorm) );
+        dualScale = Max( dualScale, rowNorm );
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void Mehrotra
+( const Matrix<Real>& APre,
+  const Matrix<Real>& b,
+  const Matrix<Real>& cPre,
+  const Matrix<Int>& orders,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int degree = psd::Degree( orders );
+    if( n != psd::Height( orders ) )
+        LogicError("The width of A did not match the block orders");
+
+    auto A = APre;
+    auto c = cPre;
+    Matrix<Real> AT;
+    SymmetrizeRows( A, AT, orders );
+    psd::Symmetrize( c, orders );
+
+    const Real bNrm2 = Nrm2( b );
+    const Real cNrm2 = Nrm2( c );
+    if( ctrl.print )
+    {
+        const Real ANrm1 = OneNorm( A );
+        Output("|| A ||_1 = ",ANrm1);
+        Output("|| b ||_2 = ",bNrm2);
+        Output("|| c ||_2 = ",cNrm2);
+    }
+
+    // Initialize the primal and dual points
+    // =====================================
+    if( ctrl.primalInit && psd::NumOutside( x, orders ) > 0 )
+        LogicError("The initial x was not positive-definite");
+    if( ctrl.dualInit )
+    {
+        if( y.Height() != m || y.Width() != 1 )
+            LogicError("y was of the wrong size");
+        if( psd::NumOutside( z, orders ) > 0 )
+            LogicError("The initial z was not positive-definite");
+    }
+    {
+        Matrix<Real> rowNorms;
+        RowTwoNorms( A, rowNorms );
+        Real primalScale, dualScale;
+        InitialScales
+        ( rowNorms, b, cNrm2, MaxOrder(orders), primalScale, dualScale );
+        if( !ctrl.primalInit )
+        {
+            psd::Identity( x, orders );
+            x *= primalScale;
+        }
+        if( !ctrl.dualInit )
+        {
+            Zeros( y, m, 1 );
+            psd::Identity( z, orders );
+            z *= dualScale;
+        }
+    }
+
+    Real relError = 1;
+    Matrix<Real> w, g, lambda, lambdaTarget,
+                 WAT, S,
+                 rb,    rc,
+                 hAff,  h,
+                 dxAff, dyAff, dzAff,
+                 dx,    dy,    dz,
+                 dxAffScaled, dzAffScaled,
+                 u, t;
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const Matrix<Real>& rb,
+           const Matrix<Real>& rc,
+           const Matrix<Real>& h,
+                 Matrix<Real>& dx,
+                 Matrix<Real>& dy,
+                 Matrix<Real>& dz )
+      {
+        // u := G H G^T - W r_c W
+        psd::Congruence( NORMAL, g, h, dx, orders );
+        psd::Congruence( NORMAL, w, rc, u, orders );
+        u *= -1;
+        u += dx;
+
+        // dy := inv(A (W kron W) A^T) (A u + r_b)
+        dy = rb;
+        Gemv( NORMAL, Real(1), A, u, Real(1), dy );
+        cholesky::SolveAfter( LOWER, NORMAL, S, dy );
+
+        // dz := A^T dy + r_c and dx := G H G^T - W dz W
+        dz = rc;
+        Gemv( TRANSPOSE, Real(1), A, dy, Real(1), dz );
+        psd::Congruence( NORMAL, w, dz, t, orders );
+        dx -= t;
+      };
+
+    const Int indent = PushIndent();
+    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    {
+        // Compute the Nesterov-Todd scaling
+        // =================================
+        psd::NesterovTodd( x, z, w, g, lambda, orders );
+
+        // Check for convergence
+        // =====================
+        // |c^T x - (-b^T y)| / (1 + |c^T x|) <= tol ?
+        // -------------------------------------------
+        const Real primObj = Dot(c,x);
+        const Real dualObj = -Dot(b,y);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        // || r_b ||_2 / (1 + || b ||_2) <= tol ?
+        // --------------------------------------
+        rb = b;
+        rb *= -1;
+        Gemv( NORMAL, Real(1), A, x, Real(1), rb );
+        const Real rbNrm2 = Nrm2( rb );
+        const Real rbConv = rbNrm2 / (1+bNrm2);
+        // || r_c ||_2 / (1 + || c ||_2) <= tol ?
+        // --------------------------------------
+        rc = c;
+        Gemv( TRANSPOSE, Real(1), A, y, Real(1), rc );
+        rc -= z;
+        const Real rcNrm2 = Nrm2( rc );
+        const Real rcConv = rcNrm2 / (1+cNrm2);
+
+        // Now check the pieces
+        // --------------------
+        relError = Max(Max(objConv,rbConv),rcConv);
+        if( ctrl.print )
+        {
+            const Real xNrm2 = Nrm2( x );
+            const Real yNrm2 = Nrm2( y );
+            const Real zNrm2 = Nrm2( z );
+            Output
+            ("iter ",numIts,":\n",Indent(),
+             "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
+             "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+             "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
+             "  || r_b ||_2 = ",rbNrm2,"\n",Indent(),
+             "  || r_c ||_2 = ",rcNrm2,"\n",Indent(),
+             "  || r_b ||_2 / (1 + || b ||_2) = ",rbConv,"\n",Indent(),
+             "  || r_c ||_2 / (1 + || c ||_2) = ",rcConv,"\n",Indent(),
+             "  primal = ",primObj,"\n",Indent(),
+             "  dual   = ",dualObj,"\n",Indent(),
+             "  |primal - dual| / (1 + |primal|) = ",objConv);
+        }
+        if( relError <= ctrl.targetTol )
+            break;
+        if( numIts == ctrl.maxIts && relError > ctrl.minTol )
+            RuntimeError
+            ("Reached maximum number of iterations, ",ctrl.maxIts,
+             ", with rel. error ",relError," which does not meet the minimum ",
+             "tolerance of ",ctrl.minTol);
+        const Real mu = Dot(x,z) / degree;
+
+        // Form and factor the Schur complement, A (W kron W) A^T
+        // ======================================================
+        Zeros( WAT, n, m );
+        for( Int i=0; i<m; ++i )
+        {
+            auto a = AT( ALL, IR(i) );
+            auto wa = WAT( ALL, IR(i) );
+            psd::Congruence( NORMAL, w, a, wa, orders );
+        }
+        Gemm( NORMAL, NORMAL, Real(1), A, WAT, S );
+        try { Cholesky( LOWER, S ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Factorization failed with rel. error ",relError,
+                 " which does not meet the minimum tolerance of ",ctrl.minTol);
+        }
+
+        // Compute the affine search direction
+        // ===================================
+        // H_aff := -Lambda
+        // ----------------
+        lambdaTarget = lambda;
+        lambdaTarget *= -1;
+        psd::Diagonal( lambdaTarget, hAff, orders );
+        solveWithFactorization( rb, rc, hAff, dxAff, dyAff, dzAff );
+
+        // Compute a centrality parameter
+        // ==============================
+        Real alphaAffPri = psd::MaxStep( x, dxAff, orders, Real(1) );
+        Real alphaAffDual = psd::MaxStep( z, dzAff, orders, Real(1) );
+        if( ctrl.forceSameStep )
+            alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
+        if( ctrl.print )
+            Output
+            ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
+        // NOTE: dx and dz are used as temporaries
+        dx = x;
+        dz = z;
+        Axpy( alphaAffPri,  dxAff, dx );
+        Axpy( alphaAffDual, dzAff, dz );
+        const Real muAff = Dot(dx,dz) / degree;
+        if( ctrl.print )
+            Output("muAff = ",muAff,", mu = ",mu);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        if( ctrl.print )
+            Output("sigma=",sigma);
+
+        // Solve for the combined direction
+        // ================================
+        rb *= 1-sigma;
+        rc *= 1-sigma;
+        // R := sigma mu I - Lambda^2
+        // --------------------------
+        lambdaTarget = lambda;
+        DiagonalScale( LEFT, NORMAL, lambda, lambdaTarget );
+        lambdaTarget *= -1;
+        Shift( lambdaTarget, sigma*mu );
+        psd::Diagonal( lambdaTarget, h, orders );
+        if( ctrl.mehrotra )
+        {
+            // R -= (inv(G) dxAff inv(G)^T) o (G^T dzAff G)
+            // --------------------------------------------
+            psd::Congruence( TRANSPOSE, g, dzAff, dzAffScaled, orders );
+            dxAffScaled = hAff;
+            dxAffScaled -= dzAffScaled;
+            psd::JordanProduct( dxAffScaled, dzAffScaled, t, orders );
+            h -= t;
+        }
+        psd::LyapunovSolve( lambda, h, orders );
+        solveWithFactorization( rb, rc, h, dx, dy, dz );
+
+        // Update the current estimates
+        // ============================
+        Real alphaPri = psd::MaxStep( x, dx, orders, 1/ctrl.maxStepRatio );
+        Real alphaDual = psd::MaxStep( z, dz, orders, 1/ctrl.maxStepRatio );
+        alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
+        alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.print )
+            Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
+        Axpy( alphaPri,  dx, x );
+        Axpy( alphaDual, dy, y );
+        Axpy( alphaDual, dz, z );
+        psd::Symmetrize( x, orders );
+        psd::Symmetrize( z, orders );
+        if( alphaPri == Real(0) && alphaDual == Real(0) )
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Zero step length computed before reaching minimum tolerance "
+                 "of ",ctrl.minTol);
+        }
+    }
+    SetIndent( indent );
+}
+
+template<typename Real>
+void Mehrotra
+( const AbstractDistMatrix<Real>& APre,
+  const AbstractDistMatrix<Real>& bPre,
+  const AbstractDistMatrix<Real>& cPre,
+  const Matrix<Int>& orders,
+        AbstractDistMatrix<Real>& xPre,
+        AbstractDistMatrix<Real>& yPre,
+        AbstractDistMatrix<Real>& zPre,
+  const MehrotraCtrl<Real>& ctrl,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = APre.Grid();
+    const int commRank = grid.Rank();
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int degree = psd::Degree( orders );
+    if( n != psd::Height( orders ) )
+        LogicError("The width of A did not match the block orders");
+
+    // Each process redundantly stores the members of the product cone (and
+    // the quantities derived from them) so that the cone operations do not
+    // require redistributions, whereas the remaining vectors are distributed
+    // over the grid
+    DistMatrix<Real> A(grid), b(grid), c(grid);
+    A.Align(0,0);
+    b.Align(0,0);
+    A = APre;
+    b = bPre;
+    DistMatrix<Real,STAR,STAR> cRep( cPre );
+    psd::Symmetrize( cRep, orders );
+
+    DistMatrixReadWriteProxy<Real,Real,MC,MR> yProx( yPre );
+    auto& y = yProx.Get();
+    DistMatrix<Real,STAR,STAR> x(grid), z(grid);
+    if( ctrl.primalInit )
+        x = xPre;
+    if( ctrl.dualInit )
+        z = zPre;
+
+    // Since each process needs entire rows of A to form its contribution to
+    // the Schur complement, A is symmetrized in a [VC,STAR] distribution
+    DistMatrix<Real,VC,STAR> A_VC_STAR( A );
+    Matrix<Real> ATLoc;
+    SymmetrizeRows( A_VC_STAR.Matrix(), ATLoc, orders );
+    A = A_VC_STAR;
+
+    const Real bNrm2 = Nrm2( b );
+    const Real cNrm2 = Nrm2( cRep );
+    if( ctrl.print )
+    {
+        const Real ANrm1 = OneNorm( A );
+        if( commRank == 0 )
+        {
+            Output("|| A ||_1 = ",ANrm1);
+            Output("|| b ||_2 = ",bNrm2);
+            Output("|| c ||_2 = ",cNrm2);
+        }
+    }
+
+    // Initialize the primal and dual points
+    // =====================================
+    if( ctrl.primalInit && psd::NumOutside( x, orders, cutoff ) > 0 )
+        LogicError("The initial x was not positive-definite");
+    if( ctrl.dualInit )
+    {
+        if( y.Height() != m || y.Width() != 1 )
+            LogicError("y was of the wrong size");
+        if( psd::NumOutside( z, orders, cutoff ) > 0 )
+            LogicError("The initial z was not positive-definite");
+    }
+    {
+        DistMatrix<Real,VC,STAR> rowNorms(grid), b_VC_STAR(grid);
+        RowTwoNorms( A_VC_STAR, rowNorms );
+        b_VC_STAR.AlignWith( rowNorms );
+        b_VC_STAR = b;
+        Real primalScale, dualScale;
+        InitialScales
+        ( rowNorms.LockedMatrix(), b_VC_STAR.LockedMatrix(), cNrm2,
+          MaxOrder(orders), primalScale, dualScale );
+        primalScale = mpi::AllReduce( primalScale, mpi::MAX, grid.Comm() );
+        dualScale = mpi::AllReduce( dualScale, mpi::MAX, grid.Comm() );
+        if( !ctrl.primalInit )
+        {
+            psd::Identity( x, orders );
+            x *= primalScale;
+        }
+        if( !ctrl.dualInit )
+        {
+            Zeros( y, m, 1 );
+            psd::Identity( z, orders );
+            z *= dualScale;
+        }
+    }
+
+    Real relError = 1;
+    DistMatrix<Real> S(grid), WA(grid),
+                     rb(grid), dyAff(grid), dy(grid);
+    DistMatrix<Real,STAR,STAR>
+      w(grid),     g(grid),     lambda(grid), lambdaTarget(grid),
+      rc(grid),
+      hAff(grid),  h(grid),
+      dxAff(grid), dzAff(grid),
+      dx(grid),    dz(grid),
+      dxAffScaled(grid), dzAffScaled(grid),
+      u(grid), t(grid);
+    DistMatrix<Real,VC,STAR> WA_VC_STAR(grid);
+    WA_VC_STAR.AlignWith( A_VC_STAR );
+    Matrix<Real> WATLoc;
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DistMatrix<Real>& rb,
+           const DistMatrix<Real,STAR,STAR>& rc,
+           const DistMatrix<Real,STAR,STAR>& h,
+                 DistMatrix<Real,STAR,STAR>& dx,
+                 DistMatrix<Real>& dy,
+                 DistMatrix<Real,STAR,STAR>& dz )
+      {
+        // u := G H G^T - W r_c W
+        psd::Congruence( NORMAL, g, h, dx, orders, cutoff );
+        psd::Congruence( NORMAL, w, rc, u, orders, cutoff );
+        u *= -1;
+        u += dx;
+
+        // dy := inv(A (W kron W) A^T) (A u + r_b)
+        dy = rb;
+        Gemv( NORMAL, Real(1), A, u, Real(1), dy );
+        cholesky::SolveAfter( LOWER, NORMAL, S, dy );
+
+        // dz := A^T dy + r_c and dx := G H G^T - W dz W
+        dz = rc;
+        Gemv( TRANSPOSE, Real(1), A, dy, Real(1), dz );
+        psd::Congruence( NORMAL, w, dz, t, orders, cutoff );
+        dx -= t;
+      };
+
+    const Int indent = PushIndent();
+    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    {
+        // Compute the Nesterov-Todd scaling
+        // =================================
+        psd::NesterovTodd( x, z, w, g, lambda, orders, cutoff );
+
+        // Check for convergence
+        // =====================
+        // |c^T x - (-b^T y)| / (1 + |c^T x|) <= tol ?
+        // -------------------------------------------
+        const Real primObj = Dot(cRep,x);
+        const Real dualObj = -Dot(b,y);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        // || r_b ||_2 / (1 + || b ||_2) <= tol ?
+        // --------------------------------------
+        rb = b;
+        rb *= -1;
+        Gemv( NORMAL, Real(1), A, x, Real(1), rb );
+        const Real rbNrm2 = Nrm2( rb );
+        const Real rbConv = rbNrm2 / (1+bNrm2);
+        // || r_c ||_2 / (1 + || c ||_2) <= tol ?
+        // --------------------------------------
+        rc = cRep;
+        Gemv( TRANSPOSE, Real(1), A, y, Real(1), rc );
+        rc -= z;
+        const Real rcNrm2 = Nrm2( rc );
+        const Real rcConv = rcNrm2 / (1+cNrm2);
+
+        // Now check the pieces
+        // --------------------
+        relError = Max(Max(objConv,rbConv),rcConv);
+        if( ctrl.print )
+        {
+            const Real xNrm2 = Nrm2( x );
+            const Real yNrm2 = Nrm2( y );
+            const Real zNrm2 = Nrm2( z );
+            if( commRank == 0 )
+                Output
+                ("iter ",numIts,":\n",Indent(),
+                 "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
+                 "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+                 "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
+                 "  || r_b ||_2 = ",rbNrm2,"\n",Indent(),
+                 "  || r_c ||_2 = ",rcNrm2,"\n",Indent(),
+                 "  || r_b ||_2 / (1 + || b ||_2) = ",rbConv,"\n",Indent(),
+                 "  || r_c ||_2 / (1 + || c ||_2) = ",rcConv,"\n",Indent(),
+                 "  primal = ",primObj,"\n",Indent(),
+                 "  dual   = ",dualObj,"\n",Indent(),
+                 "  |primal - dual| / (1 + |primal|) = ",objConv);
+        }
+        if( relError <= ctrl.targetTol )
+            break;
+        if( numIts == ctrl.maxIts && relError > ctrl.minTol )
+            RuntimeError
+            ("Reached maximum number of iterations, ",ctrl.maxIts,
+             ", with rel. error ",relError," which does not meet the minimum ",
+             "tolerance of ",ctrl.minTol);
+        const Real mu = Dot(x,z) / degree;
+
+        // Form and factor the Schur complement, A (W kron W) A^T
+        // ======================================================
+        // Each process forms W A_i W for its local rows of A
+        const Int localHeight = A_VC_STAR.LocalHeight();
+        Zeros( WATLoc, n, localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            auto a = ATLoc( ALL, IR(iLoc) );
+            auto wa = WATLoc( ALL, IR(iLoc) );
+            psd::Congruence( NORMAL, w.LockedMatrix(), a, wa, orders );
+        }
+        WA_VC_STAR.Resize( m, n );
+        Transpose( WATLoc, WA_VC_STAR.Matrix() );
+        WA = WA_VC_STAR;
+        Gemm( NORMAL, TRANSPOSE, Real(1), A, WA, S );
+        try { Cholesky( LOWER, S ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Factorization failed with rel. error ",relError,
+                 " which does not meet the minimum tolerance of ",ctrl.minTol);
+        }
+
+        // Compute the affine search direction
+        // ===================================
+        // H_aff := -Lambda
+        // ----------------
+        lambdaTarget = lambda;
+        lambdaTarget *= -1;
+        psd::Diagonal( lambdaTarget, hAff, orders );
+        solveWithFactorization( rb, rc, hAff, dxAff, dyAff, dzAff );
+
+        // Compute a centrality parameter
+        // ==============================
+        Real alphaAffPri =
+          psd::MaxStep( x, dxAff, orders, Real(1), cutoff );
+        Real alphaAffDual =
+          psd::MaxStep( z, dzAff, orders, Real(1), cutoff );
+        if( ctrl.forceSameStep )
+            alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
+        if( ctrl.print && commRank == 0 )
+            Output
+            ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
+        // NOTE: dx and dz are used as temporaries
+        dx = x;
+        dz = z;
+        Axpy( alphaAffPri,  dxAff, dx );
+        Axpy( alphaAffDual, dzAff, dz );
+        const Real muAff = Dot(dx,dz) / degree;
+        if( ctrl.print && commRank == 0 )
+            Output("muAff = ",muAff,", mu = ",mu);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        if( ctrl.print && commRank == 0 )
+            Output("sigma=",sigma);
+
+        // Solve for the combined direction
+        // ================================
+        rb *= 1-sigma;
+        rc *= 1-sigma;
+        // R := sigma mu I - Lambda^2
+        // --------------------------
+        lambdaTarget = lambda;
+        DiagonalScale( LEFT, NORMAL, lambda, lambdaTarget );
+        lambdaTarget *= -1;
+        Shift( lambdaTarget, sigma*mu );
+        psd::Diagonal( lambdaTarget, h, orders );
+        if( ctrl.mehrotra )
+        {
+            // R -= (inv(G) dxAff inv(G)^T) o (G^T dzAff G)
+            // --------------------------------------------
+            psd::Congruence
+            ( TRANSPOSE, g, dzAff, dzAffScaled, orders, cutoff );
+            dxAffScaled = hAff;
+            dxAffScaled -= dzAffScaled;
+            psd::JordanProduct( dxAffScaled, dzAffScaled, t, orders, cutoff );
+            h -= t;
+        }
+        psd::LyapunovSolve( lambda, h, orders );
+        solveWithFactorization( rb, rc, h, dx, dy, dz );
+
+        // Update the current estimates
+        // ============================
+        Real alphaPri =
+          psd::MaxStep( x, dx, orders, 1/ctrl.maxStepRatio, cutoff );
+        Real alphaDual =
+          psd::MaxStep( z, dz, orders, 1/ctrl.maxStepRatio, cutoff );
+        alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
+        alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.print && commRank == 0 )
+            Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
+        Axpy( alphaPri,  dx, x );
+        Axpy( alphaDual, dy, y );
+        Axpy( alphaDual, dz, z );
+        psd::Symmetrize( x, orders );
+        psd::Symmetrize( z, orders );
+        if( alphaPri == Real(0) && alphaDual == Real(0) )
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Zero step length computed before reaching minimum tolerance "
+                 "of ",ctrl.minTol);
+        }
+    }
+    SetIndent( indent );
+
+    Copy( x, xPre );
+    Copy( z, zPre );
+}
+
+#define PROTO(Real) \
+  template void Mehrotra \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Int>& orders, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
+  ( const AbstractDistMatrix<Real>& A, \
+    const AbstractDistMatrix<Real>& b, \
+    const AbstractDistMatrix<Real>& c, \
+    const Matrix<Int>& orders, \
+          AbstractDistMatrix<Real>& x, \
+          AbstractDistMatrix<Real>& y, \
+          AbstractDistMatrix<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace sdp
+} // namespace El
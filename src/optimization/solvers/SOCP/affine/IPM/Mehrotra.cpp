@@ -115,6 +115,36 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, dmuError;
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const Matrix<Real>& rc,
+           const Matrix<Real>& rb,
+           const Matrix<Real>& rh,
+           const Matrix<Real>& rmu,
+                 Matrix<Real>& dx,
+                 Matrix<Real>& dy,
+                 Matrix<Real>& dz,
+                 Matrix<Real>& ds )
+      {
+        // Compute the proposed step from the KKT system
+        // ---------------------------------------------
+        KKTRHS( rc, rb, rh, rmu, wRoot, orders, firstInds, d );
+        try { ldl::SolveAfter( J, dSub, p, d, false ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                return false;
+            else
+                RuntimeError
+                ("Solve failed with rel. error ",relError,
+                 " which does not meet the minimum tolerance of ",ctrl.minTol);
+        }
+        ExpandSolution
+        ( m, n, d, rmu, wRoot, orders, firstInds, dx, dy, dz, ds );
+        return true;
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -316,22 +346,8 @@ void Mehrotra
             Axpy( -sigma*mu, lInv, rmu );
         }
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS( rc, rb, rh, rmu, wRoot, orders, firstInds, d );
-        try { ldl::SolveAfter( J, dSub, p, d, false ); }
-        catch(...)
-        {
-            if( relError <= ctrl.minTol )
-                break;
-            else
-                RuntimeError
-                ("Solve failed with rel. error ",relError,
-                 " which does not meet the minimum tolerance of ",ctrl.minTol);
-        }
-        ExpandSolution
-        ( m, n, d, rmu, wRoot, orders, firstInds, dx, dy, dz, ds );
-
+        if( !solveWithFactorization( rc, rb, rh, rmu, dx, dy, dz, ds ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -344,6 +360,65 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            Matrix<Real> rcCent, rbCent, rhCent, rmuCent, dxCent, dyCent,
+              dzCent, dsCent, dxTrial, dyTrial, dzTrial, dsTrial;
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            Zeros( rhCent, k, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  // NOTE: dsAffScaled and dzAffScaled are used as temporaries
+                  soc::ApplyQuadratic
+                  ( wRootInv, ds, dsAffScaled, orders, firstInds );
+                  soc::ApplyQuadratic
+                  ( wRoot, dz, dzAffScaled, orders, firstInds );
+                  soc::CentralityCorrector
+                  ( l, l, dsAffScaled, dzAffScaled, rmuCent, orders, firstInds,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  soc::Apply( lInv, rmuCent, orders, firstInds );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rhCent, rmuCent,
+                         dxCent, dyCent, dzCent, dsCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dsTrial = ds;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  dsTrial += dsCent;
+                  alphaPriNew =
+                    soc::MaxStep
+                    ( s, dsTrial, orders, firstInds, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    soc::MaxStep
+                    ( z, dzTrial, orders, firstInds, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+                  ds = dsTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -485,6 +560,38 @@ void Mehrotra
     DistMatrix<Real>
       dxError(grid), dyError(grid), dzError(grid), dmuError(grid);
     dzError.AlignWith( s );
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DistMatrix<Real>& rc,
+           const DistMatrix<Real>& rb,
+           const DistMatrix<Real>& rh,
+           const DistMatrix<Real>& rmu,
+                 DistMatrix<Real>& dx,
+                 DistMatrix<Real>& dy,
+                 DistMatrix<Real>& dz,
+                 DistMatrix<Real>& ds )
+      {
+        // Compute the proposed step from the KKT system
+        // ---------------------------------------------
+        KKTRHS
+        ( rc, rb, rh, rmu, wRoot, orders, firstInds, d, cutoffPar );
+        try { ldl::SolveAfter( J, dSub, p, d, false ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                return false;
+            else
+                RuntimeError
+                ("Solve failed with rel. error ",relError,
+                 " which does not meet the minimum tolerance of ",ctrl.minTol);
+        }
+        ExpandSolution
+        ( m, n, d, rmu, wRoot, orders, firstInds, dx, dy, dz, ds,
+          cutoffPar );
+        return true;
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -691,23 +798,8 @@ void Mehrotra
             Axpy( -sigma*mu, lInv, rmu );
         }
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS
-        ( rc, rb, rh, rmu, wRoot, orders, firstInds, d, cutoffPar );
-        try { ldl::SolveAfter( J, dSub, p, d, false ); }
-        catch(...)
-        {
-            if( relError <= ctrl.minTol )
-                break;
-            else
-                RuntimeError
-                ("Solve failed with rel. error ",relError,
-                 " which does not meet the minimum tolerance of ",ctrl.minTol);
-        }
-        ExpandSolution
-        ( m, n, d, rmu, wRoot, orders, firstInds, dx, dy, dz, ds,
-          cutoffPar );
+        if( !solveWithFactorization( rc, rb, rh, rmu, dx, dy, dz, ds ) )
+            break;
         // TODO(poulson): Residual checks
 
         // Update the current estimates
@@ -722,6 +814,73 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DistMatrix<Real> rcCent(grid), rbCent(grid), rhCent(grid),
+              rmuCent(grid), dxCent(grid), dyCent(grid), dzCent(grid),
+              dsCent(grid), dxTrial(grid), dyTrial(grid), dzTrial(grid),
+              dsTrial(grid);
+            rmuCent.AlignWith( s );
+            dsCent.AlignWith( s );
+            dzCent.AlignWith( s );
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            Zeros( rhCent, k, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  // NOTE: dsAffScaled and dzAffScaled are used as temporaries
+                  soc::ApplyQuadratic
+                  ( wRootInv, ds, dsAffScaled, orders, firstInds, cutoffPar );
+                  soc::ApplyQuadratic
+                  ( wRoot, dz, dzAffScaled, orders, firstInds, cutoffPar );
+                  soc::CentralityCorrector
+                  ( l, l, dsAffScaled, dzAffScaled, rmuCent, orders, firstInds,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio,
+                    cutoffPar );
+                  soc::Apply( lInv, rmuCent, orders, firstInds, cutoffPar );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rhCent, rmuCent,
+                         dxCent, dyCent, dzCent, dsCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dsTrial = ds;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  dsTrial += dsCent;
+                  alphaPriNew =
+                    soc::MaxStep
+                    ( s, dsTrial, orders, firstInds, 1/ctrl.maxStepRatio,
+                      cutoffPar );
+                  alphaDualNew =
+                    soc::MaxStep
+                    ( z, dzTrial, orders, firstInds, 1/ctrl.maxStepRatio,
+                      cutoffPar );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+                  ds = dsTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -895,6 +1054,54 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, dmuError;
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const Matrix<Real>& rc,
+           const Matrix<Real>& rb,
+           const Matrix<Real>& rh,
+           const Matrix<Real>& rmu,
+                 Matrix<Real>& dx,
+                 Matrix<Real>& dy,
+                 Matrix<Real>& dz,
+                 Matrix<Real>& ds )
+      {
+        // Compute the proposed step from the KKT system
+        // ---------------------------------------------
+        KKTRHS
+        ( rc, rb, rh, rmu, wRoot,
+          orders, firstInds, origToSparseFirstInds, kSparse, d );
+        try
+        {
+            // TODO(poulson): Make use of a better interface to these routines.
+            if( ctrl.resolveReg )
+                reg_ldl::SolveAfter
+                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+            else
+                reg_ldl::RegularizedSolveAfter
+                ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                  ctrl.solveCtrl.relTol,
+                  ctrl.solveCtrl.maxRefineIts,
+                  ctrl.solveCtrl.progress );
+        }
+        catch(...)
+        {
+            if( relError < ctrl.minTol )
+                return false;
+            else
+                RuntimeError
+                ("Solve failed with rel. error ",relError,
+                 " which does not meet the minimum tolerance of ",ctrl.minTol);
+        }
+        ExpandSolution
+        ( m, n, d, rmu, wRoot,
+          orders, firstInds,
+          sparseOrders, sparseFirstInds,
+          sparseToOrigOrders, sparseToOrigFirstInds,
+          dx, dy, dz, ds );
+        return true;
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1129,39 +1336,8 @@ void Mehrotra
             Axpy( -sigma*mu, lInv, rmu );
         }
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS
-        ( rc, rb, rh, rmu, wRoot,
-          orders, firstInds, origToSparseFirstInds, kSparse, d );
-        try
-        {
-            // TODO(poulson): Make use of a better interface to these routines.
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
-        }
-        catch(...)
-        {
-            if( relError < ctrl.minTol )
-                break;
-            else
-                RuntimeError
-                ("Solve failed with rel. error ",relError,
-                 " which does not meet the minimum tolerance of ",ctrl.minTol);
-        }
-        ExpandSolution
-        ( m, n, d, rmu, wRoot,
-          orders, firstInds,
-          sparseOrders, sparseFirstInds,
-          sparseToOrigOrders, sparseToOrigFirstInds,
-          dx, dy, dz, ds );
+        if( !solveWithFactorization( rc, rb, rh, rmu, dx, dy, dz, ds ) )
+            break;
 
         // Update the current estimates
         // ============================
@@ -1173,6 +1349,65 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            Matrix<Real> rcCent, rbCent, rhCent, rmuCent, dxCent, dyCent,
+              dzCent, dsCent, dxTrial, dyTrial, dzTrial, dsTrial;
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            Zeros( rhCent, k, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  // NOTE: dsAffScaled and dzAffScaled are used as temporaries
+                  soc::ApplyQuadratic
+                  ( wRootInv, ds, dsAffScaled, orders, firstInds );
+                  soc::ApplyQuadratic
+                  ( wRoot, dz, dzAffScaled, orders, firstInds );
+                  soc::CentralityCorrector
+                  ( l, l, dsAffScaled, dzAffScaled, rmuCent, orders, firstInds,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio );
+                  soc::Apply( lInv, rmuCent, orders, firstInds );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rhCent, rmuCent,
+                         dxCent, dyCent, dzCent, dsCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dsTrial = ds;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  dsTrial += dsCent;
+                  alphaPriNew =
+                    soc::MaxStep
+                    ( s, dsTrial, orders, firstInds, 1/ctrl.maxStepRatio );
+                  alphaDualNew =
+                    soc::MaxStep
+                    ( z, dzTrial, orders, firstInds, 1/ctrl.maxStepRatio );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+                  ds = dsTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -1389,6 +1624,63 @@ void Mehrotra
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid),
                        dzError(grid), dmuError(grid);
+
+    // Solve for a direction using the existing factorization
+    auto solveWithFactorization =
+      [&]( const DistMultiVec<Real>& rc,
+           const DistMultiVec<Real>& rb,
+           const DistMultiVec<Real>& rh,
+           const DistMultiVec<Real>& rmu,
+                 DistMultiVec<Real>& dx,
+                 DistMultiVec<Real>& dy,
+                 DistMultiVec<Real>& dz,
+                 DistMultiVec<Real>& ds )
+      {
+        // Compute the proposed step from the KKT system
+        // ---------------------------------------------
+        KKTRHS
+        ( rc, rb, rh, rmu, wRoot,
+          orders, firstInds, origToSparseFirstInds, kSparse,
+          d, cutoffPar );
+        try
+        {
+            if( commRank == 0 && ctrl.time )
+                timer.Start();
+            // TODO(poulson): Make use of a better interface to these routines.
+            if( ctrl.resolveReg )
+                reg_ldl::SolveAfter
+                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+            else
+                reg_ldl::RegularizedSolveAfter
+                ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                  ctrl.solveCtrl.relTol,
+                  ctrl.solveCtrl.maxRefineIts,
+                  ctrl.solveCtrl.progress );
+            if( commRank == 0 && ctrl.time )
+                Output("Corrector solver: ",timer.Stop()," secs");
+        }
+        catch(...)
+        {
+            if( relError < ctrl.minTol )
+                return false;
+            else
+                RuntimeError
+                ("Solve failed with rel. error ",relError,
+                 " which does not meet the minimum tolerance of ",ctrl.minTol);
+        }
+        if( ctrl.time && commRank == 0 )
+            timer.Start();
+        ExpandSolution
+        ( m, n, d, rmu, wRoot,
+          orders, firstInds,
+          sparseOrders, sparseFirstInds,
+          sparseToOrigOrders, sparseToOrigFirstInds,
+          dx, dy, dz, ds, cutoffPar );
+        if( ctrl.time && commRank == 0 )
+            Output("ExpandSolution: ",timer.Stop()," secs");
+        return true;
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1689,48 +1981,8 @@ void Mehrotra
         if( ctrl.time && commRank == 0 )
             Output("r_mu formation: ",timer.Stop()," secs");
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS
-        ( rc, rb, rh, rmu, wRoot,
-          orders, firstInds, origToSparseFirstInds, kSparse,
-          d, cutoffPar );
-        try
-        {
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
-            // TODO(poulson): Make use of a better interface to these routines.
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Corrector solver: ",timer.Stop()," secs");
-        }
-        catch(...)
-        {
-            if( relError < ctrl.minTol )
-                break;
-            else
-                RuntimeError
-                ("Solve failed with rel. error ",relError,
-                 " which does not meet the minimum tolerance of ",ctrl.minTol);
-        }
-        if( ctrl.time && commRank == 0 )
-            timer.Start();
-        ExpandSolution
-        ( m, n, d, rmu, wRoot,
-          orders, firstInds,
-          sparseOrders, sparseFirstInds,
-          sparseToOrigOrders, sparseToOrigFirstInds,
-          dx, dy, dz, ds, cutoffPar );
-        if( ctrl.time && commRank == 0 )
-            Output("ExpandSolution: ",timer.Stop()," secs");
+        if( !solveWithFactorization( rc, rb, rh, rmu, dx, dy, dz, ds ) )
+            break;
 
         // Update the current estimates
         // ============================
@@ -1748,6 +2000,70 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxCentralityCorrectors > 0 )
+        {
+            // Add Gondzio's multiple centrality correctors
+            // --------------------------------------------
+            DistMultiVec<Real> rcCent(grid), rbCent(grid), rhCent(grid),
+              rmuCent(grid), dxCent(grid), dyCent(grid), dzCent(grid),
+              dsCent(grid), dxTrial(grid), dyTrial(grid), dzTrial(grid),
+              dsTrial(grid);
+            Zeros( rcCent, n, 1 );
+            Zeros( rbCent, m, 1 );
+            Zeros( rhCent, k, 1 );
+            auto tryCorrector =
+              [&]( Real alphaPriTarget, Real alphaDualTarget,
+                   Real& alphaPriNew, Real& alphaDualNew )
+              {
+                  // NOTE: dsAffScaled and dzAffScaled are used as temporaries
+                  soc::ApplyQuadratic
+                  ( wRootInv, ds, dsAffScaled, orders, firstInds, cutoffPar );
+                  soc::ApplyQuadratic
+                  ( wRoot, dz, dzAffScaled, orders, firstInds, cutoffPar );
+                  soc::CentralityCorrector
+                  ( l, l, dsAffScaled, dzAffScaled, rmuCent, orders, firstInds,
+                    alphaPriTarget, alphaDualTarget, sigma*mu,
+                    ctrl.centralityLowerRatio, ctrl.centralityUpperRatio,
+                    cutoffPar );
+                  soc::Apply( lInv, rmuCent, orders, firstInds, cutoffPar );
+                  if( !solveWithFactorization
+                       ( rcCent, rbCent, rhCent, rmuCent,
+                         dxCent, dyCent, dzCent, dsCent ) )
+                      return false;
+                  dxTrial = dx;
+                  dyTrial = dy;
+                  dzTrial = dz;
+                  dsTrial = ds;
+                  dxTrial += dxCent;
+                  dyTrial += dyCent;
+                  dzTrial += dzCent;
+                  dsTrial += dsCent;
+                  alphaPriNew =
+                    soc::MaxStep
+                    ( s, dsTrial, orders, firstInds, 1/ctrl.maxStepRatio,
+                      cutoffPar );
+                  alphaDualNew =
+                    soc::MaxStep
+                    ( z, dzTrial, orders, firstInds, 1/ctrl.maxStepRatio,
+                      cutoffPar );
+                  alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+                  alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+                  return true;
+              };
+            auto acceptCorrector =
+              [&]()
+              {
+                  dx = dxTrial;
+                  dy = dyTrial;
+                  dz = dzTrial;
+                  ds = dsTrial;
+              };
+            const Int numCorrectors =
+              CentralityCorrectors
+              ( alphaPri, alphaDual, tryCorrector, acceptCorrector, ctrl );
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted ",numCorrectors," centrality correctors");
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
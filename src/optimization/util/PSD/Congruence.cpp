@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./util.hpp"
+
+namespace El {
+namespace psd {
+
+namespace {
+
+template<typename Real,class BlockType>
+void CongruenceBlock
+( Orientation orientation,
+  const BlockType& G,
+  const BlockType& X,
+        BlockType& Y )
+{
+    BlockType T( X );
+    if( orientation == NORMAL )
+    {
+        Gemm( NORMAL, NORMAL, Real(1), G, X, T );
+        Gemm( NORMAL, TRANSPOSE, Real(1), T, G, Y );
+    }
+    else
+    {
+        Gemm( TRANSPOSE, NORMAL, Real(1), G, X, T );
+        Gemm( NORMAL, NORMAL, Real(1), T, G, Y );
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Congruence
+(       Orientation orientation,
+  const Matrix<Real>& g,
+  const Matrix<Real>& x,
+        Matrix<Real>& y,
+  const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    const BlockLayout layout( orders );
+    if( g.Height() != layout.height || g.Width() != 1 )
+        LogicError("g was of the wrong size");
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+    Zeros( y, layout.height, 1 );
+
+    Matrix<Real> G, X, Y, YBlock;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        if( layout.orders[block] == 0 )
+            continue;
+        LockedBlock( g, layout, block, G );
+        LockedBlock( x, layout, block, X );
+        CongruenceBlock<Real>( orientation, G, X, Y );
+        Block( y, layout, block, YBlock );
+        YBlock = Y;
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Congruence
+(       Orientation orientation,
+  const AbstractDistMatrix<Real>& gPre,
+  const AbstractDistMatrix<Real>& xPre,
+        AbstractDistMatrix<Real>& yPre,
+  const Matrix<Int>& orders,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,STAR,STAR> gProx( gPre ), xProx( xPre );
+    auto& g = gProx.GetLocked();
+    auto& x = xProx.GetLocked();
+    const Grid& grid = g.Grid();
+    const BlockLayout layout( orders );
+    if( g.Height() != layout.height || g.Width() != 1 )
+        LogicError("g was of the wrong size");
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+
+    DistMatrix<Real,STAR,STAR> y( grid );
+    Zeros( y, layout.height, 1 );
+
+    // Handle the small blocks assigned to this process
+    Matrix<Real> G, X, Y, YBlock;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        if( order == 0 || order > cutoff || !OwnsBlock(block,grid) )
+            continue;
+        LockedBlock( g.LockedMatrix(), layout, block, G );
+        LockedBlock( x.LockedMatrix(), layout, block, X );
+        CongruenceBlock<Real>( orientation, G, X, Y );
+        Block( y.Matrix(), layout, block, YBlock );
+        YBlock = Y;
+    }
+    SumOverGrid( y );
+
+    // Handle the large blocks using the entire grid
+    DistMatrix<Real> GDist(grid), XDist(grid), YDist(grid);
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        if( layout.orders[block] <= cutoff )
+            continue;
+        BlockToGrid( g.LockedMatrix(), layout, block, GDist );
+        BlockToGrid( x.LockedMatrix(), layout, block, XDist );
+        CongruenceBlock<Real>( orientation, GDist, XDist, YDist );
+        BlockFromGrid( YDist, layout, block, y.Matrix() );
+    }
+
+    Copy( y, yPre );
+}
+
+#define PROTO(Real) \
+  template void Congruence \
+  (       Orientation orientation, \
+    const Matrix<Real>& g, \
+    const Matrix<Real>& x, \
+          Matrix<Real>& y, \
+    const Matrix<Int>& orders ); \
+  template void Congruence \
+  (       Orientation orientation, \
+    const AbstractDistMatrix<Real>& g, \
+    const AbstractDistMatrix<Real>& x, \
+          AbstractDistMatrix<Real>& y, \
+    const Matrix<Int>& orders, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
@@ -0,0 +1,35 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace psd {
+
+Int Degree( const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    const Int numBlocks = orders.Height();
+    Int degree = 0;
+    for( Int block=0; block<numBlocks; ++block )
+        degree += orders(block);
+    return degree;
+}
+
+Int Height( const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    const Int numBlocks = orders.Height();
+    Int height = 0;
+    for( Int block=0; block<numBlocks; ++block )
+        height += orders(block)*orders(block);
+    return height;
+}
+
+} // namespace psd
+} // namespace El
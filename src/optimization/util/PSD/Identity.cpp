@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./util.hpp"
+
+namespace El {
+namespace psd {
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Diagonal
+( const Matrix<Real>& d,
+        Matrix<Real>& x,
+  const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    const BlockLayout layout( orders );
+    if( d.Height() != layout.degree || d.Width() != 1 )
+        LogicError("d was of the wrong size");
+    Zeros( x, layout.height, 1 );
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        const Int offset = layout.offsets[block];
+        const Int eigOffset = layout.eigOffsets[block];
+        for( Int i=0; i<order; ++i )
+            x(offset+i+i*order) = d(eigOffset+i);
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Diagonal
+( const AbstractDistMatrix<Real>& dPre,
+        AbstractDistMatrix<Real>& xPre,
+  const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,STAR,STAR> dProx( dPre );
+    auto& d = dProx.GetLocked();
+
+    DistMatrix<Real,STAR,STAR> x( d.Grid() );
+    Zeros( x, Height(orders), 1 );
+    Diagonal( d.LockedMatrix(), x.Matrix(), orders );
+    Copy( x, xPre );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Identity( Matrix<Real>& x, const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> d;
+    Ones( d, Degree(orders), 1 );
+    Diagonal( d, x, orders );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Identity( AbstractDistMatrix<Real>& x, const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Real,STAR,STAR> d( x.Grid() );
+    Ones( d, Degree(orders), 1 );
+    Diagonal( d, x, orders );
+}
+
+#define PROTO(Real) \
+  template void Diagonal \
+  ( const Matrix<Real>& d, \
+          Matrix<Real>& x, \
+    const Matrix<Int>& orders ); \
+  template void Diagonal \
+  ( const AbstractDistMatrix<Real>& d, \
+          AbstractDistMatrix<Real>& x, \
+    const Matrix<Int>& orders ); \
+  template void Identity \
+  ( Matrix<Real>& x, const Matrix<Int>& orders ); \
+  template void Identity \
+  ( AbstractDistMatrix<Real>& x, const Matrix<Int>& orders );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./util.hpp"
+
+namespace El {
+namespace psd {
+
+namespace {
+
+template<typename Real,class BlockType>
+void JordanProductBlock
+( const BlockType& X,
+  const BlockType& Y,
+        BlockType& R )
+{
+    // R := (X Y + (X Y)^T) / 2 since X and Y are symmetric
+    BlockType T( X );
+    Gemm( NORMAL, NORMAL, Real(1), X, Y, T );
+    Transpose( T, R );
+    R += T;
+    R *= Real(1)/Real(2);
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void JordanProduct
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+        Matrix<Real>& r,
+  const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    const BlockLayout layout( orders );
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+    if( y.Height() != layout.height || y.Width() != 1 )
+        LogicError("y was of the wrong size");
+    Zeros( r, layout.height, 1 );
+
+    Matrix<Real> X, Y, R, RBlock;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        if( layout.orders[block] == 0 )
+            continue;
+        LockedBlock( x, layout, block, X );
+        LockedBlock( y, layout, block, Y );
+        JordanProductBlock<Real>( X, Y, R );
+        Block( r, layout, block, RBlock );
+        RBlock = R;
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void JordanProduct
+( const AbstractDistMatrix<Real>& xPre,
+  const AbstractDistMatrix<Real>& yPre,
+        AbstractDistMatrix<Real>& rPre,
+  const Matrix<Int>& orders,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,STAR,STAR> xProx( xPre ), yProx( yPre );
+    auto& x = xProx.GetLocked();
+    auto& y = yProx.GetLocked();
+    const Grid& grid = x.Grid();
+    const BlockLayout layout( orders );
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+    if( y.Height() != layout.height || y.Width() != 1 )
+        LogicError("y was of the wrong size");
+
+    DistMatrix<Real,STAR,STAR> r( grid );
+    Zeros( r, layout.height, 1 );
+
+    // Handle the small blocks assigned to this process
+    Matrix<Real> X, Y, R, RBlock;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        if( order == 0 || order > cutoff || !OwnsBlock(block,grid) )
+            continue;
+        LockedBlock( x.LockedMatrix(), layout, block, X );
+        LockedBlock( y.LockedMatrix(), layout, block, Y );
+        JordanProductBlock<Real>( X, Y, R );
+        Block( r.Matrix(), layout, block, RBlock );
+        RBlock = R;
+    }
+    SumOverGrid( r );
+
+    // Handle the large blocks using the entire grid
+    DistMatrix<Real> XDist(grid), YDist(grid), RDist(grid);
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        if( layout.orders[block] <= cutoff )
+            continue;
+        BlockToGrid( x.LockedMatrix(), layout, block, XDist );
+        BlockToGrid( y.LockedMatrix(), layout, block, YDist );
+        JordanProductBlock<Real>( XDist, YDist, RDist );
+        BlockFromGrid( RDist, layout, block, r.Matrix() );
+    }
+
+    Copy( r, rPre );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void LyapunovSolve
+( const Matrix<Real>& lambda,
+        Matrix<Real>& r,
+  const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    const BlockLayout layout( orders );
+    if( lambda.Height() != layout.degree || lambda.Width() != 1 )
+        LogicError("lambda was of the wrong size");
+    if( r.Height() != layout.height || r.Width() != 1 )
+        LogicError("r was of the wrong size");
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        const Int offset = layout.offsets[block];
+        const Int eigOffset = layout.eigOffsets[block];
+        for( Int j=0; j<order; ++j )
+        {
+            const Real lambda_j = lambda(eigOffset+j);
+            for( Int i=0; i<order; ++i )
+            {
+                const Real lambda_i = lambda(eigOffset+i);
+                r(offset+i+j*order) *= Real(2)/(lambda_i+lambda_j);
+            }
+        }
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void LyapunovSolve
+( const AbstractDistMatrix<Real>& lambdaPre,
+        AbstractDistMatrix<Real>& rPre,
+  const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,STAR,STAR> lambdaProx( lambdaPre );
+    DistMatrixReadWriteProxy<Real,Real,STAR,STAR> rProx( rPre );
+    auto& lambda = lambdaProx.GetLocked();
+    auto& r = rProx.Get();
+    LyapunovSolve( lambda.LockedMatrix(), r.Matrix(), orders );
+}
+
+#define PROTO(Real) \
+  template void JordanProduct \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& y, \
+          Matrix<Real>& r, \
+    const Matrix<Int>& orders ); \
+  template void JordanProduct \
+  ( const AbstractDistMatrix<Real>& x, \
+    const AbstractDistMatrix<Real>& y, \
+          AbstractDistMatrix<Real>& r, \
+    const Matrix<Int>& orders, \
+    Int cutoff ); \
+  template void LyapunovSolve \
+  ( const Matrix<Real>& lambda, \
+          Matrix<Real>& r, \
+    const Matrix<Int>& orders ); \
+  template void LyapunovSolve \
+  ( const AbstractDistMatrix<Real>& lambda, \
+          AbstractDistMatrix<Real>& r, \
+    const Matrix<Int>& orders );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
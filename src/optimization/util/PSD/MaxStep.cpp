@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./util.hpp"
+
+namespace El {
+namespace psd {
+
+namespace {
+
+// Since X = L L^T is positive-definite, X + alpha dX is positive semidefinite
+// if and only if I + alpha inv(L) dX inv(L)^T is, and so the maximum step is
+// determined by the smallest eigenvalue of inv(L) dX inv(L)^T.
+template<typename Real,class BlockType,class EigType>
+Real MaxStepBlock
+( const BlockType& X,
+  const BlockType& dX,
+        EigType& eigs,
+        Real upperBound )
+{
+    BlockType L( X );
+    Cholesky( LOWER, L );
+    BlockType M( dX );
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), L, M );
+    Trsm( RIGHT, LOWER, TRANSPOSE, NON_UNIT, Real(1), L, M );
+    HermitianEig( LOWER, M, eigs );
+    const Real minEig = VectorMinLoc( eigs ).value;
+    if( minEig < Real(0) )
+        return Min( upperBound, -1/minEig );
+    else
+        return upperBound;
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real MaxStep
+( const Matrix<Real>& x,
+  const Matrix<Real>& dx,
+  const Matrix<Int>& orders,
+  Real upperBound )
+{
+    EL_DEBUG_CSE
+    const BlockLayout layout( orders );
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+    if( dx.Height() != layout.height || dx.Width() != 1 )
+        LogicError("dx was of the wrong size");
+
+    Real alpha = upperBound;
+    Matrix<Real> X, dX, eigs;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        if( layout.orders[block] == 0 )
+            continue;
+        LockedBlock( x, layout, block, X );
+        LockedBlock( dx, layout, block, dX );
+        alpha = MaxStepBlock( X, dX, eigs, alpha );
+    }
+    return alpha;
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real MaxStep
+( const AbstractDistMatrix<Real>& xPre,
+  const AbstractDistMatrix<Real>& dxPre,
+  const Matrix<Int>& orders,
+  Real upperBound,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,STAR,STAR> xProx( xPre ), dxProx( dxPre );
+    auto& x = xProx.GetLocked();
+    auto& dx = dxProx.GetLocked();
+    const Grid& grid = x.Grid();
+    const BlockLayout layout( orders );
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+    if( dx.Height() != layout.height || dx.Width() != 1 )
+        LogicError("dx was of the wrong size");
+
+    // Handle the small blocks assigned to this process
+    Real alpha = upperBound;
+    Matrix<Real> X, dX, eigs;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        if( order == 0 || order > cutoff || !OwnsBlock(block,grid) )
+            continue;
+        LockedBlock( x.LockedMatrix(), layout, block, X );
+        LockedBlock( dx.LockedMatrix(), layout, block, dX );
+        alpha = MaxStepBlock( X, dX, eigs, alpha );
+    }
+    alpha = mpi::AllReduce( alpha, mpi::MIN, grid.Comm() );
+
+    // Handle the large blocks using the entire grid
+    DistMatrix<Real> XDist(grid), dXDist(grid);
+    DistMatrix<Real,VR,STAR> eigsDist(grid);
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        if( layout.orders[block] <= cutoff )
+            continue;
+        BlockToGrid( x.LockedMatrix(), layout, block, XDist );
+        BlockToGrid( dx.LockedMatrix(), layout, block, dXDist );
+        alpha = MaxStepBlock( XDist, dXDist, eigsDist, alpha );
+    }
+    return alpha;
+}
+
+#define PROTO(Real) \
+  template Real MaxStep \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& dx, \
+    const Matrix<Int>& orders, \
+    Real upperBound ); \
+  template Real MaxStep \
+  ( const AbstractDistMatrix<Real>& x, \
+    const AbstractDistMatrix<Real>& dx, \
+    const Matrix<Int>& orders, \
+    Real upperBound, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
@@ -0,0 +1,204 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./util.hpp"
+
+// See, e.g., Section 4 of
+//
+//   M.J. Todd, K.C. Toh, and R.H. Tutuncu,
+//   "On the Nesterov-Todd direction in semidefinite programming",
+//   SIAM Journal on Optimization, Vol. 8, No. 3, pp. 769--796, 1998.
+//
+
+namespace El {
+namespace psd {
+
+namespace {
+
+template<typename Real,class BlockType,class EigType>
+void NesterovToddBlock
+( const BlockType& X,
+  const BlockType& Z,
+        BlockType& W,
+        BlockType& G,
+        EigType& lambda )
+{
+    // X = L L^T
+    // =========
+    BlockType L( X );
+    Cholesky( LOWER, L );
+    MakeTrapezoidal( LOWER, L );
+
+    // L^T Z L = Q Lambda^2 Q^T
+    // ========================
+    BlockType M( Z );
+    Trmm( LEFT, LOWER, TRANSPOSE, NON_UNIT, Real(1), L, M );
+    Trmm( RIGHT, LOWER, NORMAL, NON_UNIT, Real(1), L, M );
+    BlockType Q( M );
+    HermitianEig( LOWER, M, lambda, Q );
+    if( VectorMinLoc( lambda ).value <= Real(0) )
+        RuntimeError("Nesterov-Todd scaling requires positive-definite blocks");
+    auto sqrtMap = []( const Real& alpha ) { return Sqrt(alpha); };
+    EntrywiseMap( lambda, function<Real(const Real&)>(sqrtMap) );
+
+    // G := L Q Lambda^{-1/2} and W := G G^T
+    // =====================================
+    auto invSqrtLambda = lambda;
+    auto invSqrtMap = []( const Real& alpha ) { return 1/Sqrt(alpha); };
+    EntrywiseMap( invSqrtLambda, function<Real(const Real&)>(invSqrtMap) );
+    Gemm( NORMAL, NORMAL, Real(1), L, Q, G );
+    DiagonalScale( RIGHT, NORMAL, invSqrtLambda, G );
+    Gemm( NORMAL, TRANSPOSE, Real(1), G, G, W );
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void NesterovTodd
+( const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Matrix<Real>& w,
+        Matrix<Real>& g,
+        Matrix<Real>& lambda,
+  const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    const BlockLayout layout( orders );
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+    if( z.Height() != layout.height || z.Width() != 1 )
+        LogicError("z was of the wrong size");
+    Zeros( w, layout.height, 1 );
+    Zeros( g, layout.height, 1 );
+    Zeros( lambda, layout.degree, 1 );
+
+    Matrix<Real> X, Z, W, G, blockLambda, WBlock, GBlock;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        if( order == 0 )
+            continue;
+        LockedBlock( x, layout, block, X );
+        LockedBlock( z, layout, block, Z );
+        NesterovToddBlock<Real>( X, Z, W, G, blockLambda );
+        Block( w, layout, block, WBlock );
+        Block( g, layout, block, GBlock );
+        WBlock = W;
+        GBlock = G;
+        auto lambdaBlock =
+          lambda( IR(0,order)+layout.eigOffsets[block], ALL );
+        lambdaBlock = blockLambda;
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void NesterovTodd
+( const AbstractDistMatrix<Real>& xPre,
+  const AbstractDistMatrix<Real>& zPre,
+        AbstractDistMatrix<Real>& wPre,
+        AbstractDistMatrix<Real>& gPre,
+        AbstractDistMatrix<Real>& lambdaPre,
+  const Matrix<Int>& orders,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,STAR,STAR> xProx( xPre ), zProx( zPre );
+    auto& x = xProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    const Grid& grid = x.Grid();
+    const BlockLayout layout( orders );
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+    if( z.Height() != layout.height || z.Width() != 1 )
+        LogicError("z was of the wrong size");
+
+    DistMatrix<Real,STAR,STAR> w(grid), g(grid), lambda(grid);
+    Zeros( w, layout.height, 1 );
+    Zeros( g, layout.height, 1 );
+    Zeros( lambda, layout.degree, 1 );
+    auto& wLoc = w.Matrix();
+    auto& gLoc = g.Matrix();
+    auto& lambdaLoc = lambda.Matrix();
+
+    // Handle the small blocks assigned to this process
+    Matrix<Real> X, Z, W, G, blockLambda, WBlock, GBlock;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        if( order == 0 || order > cutoff || !OwnsBlock(block,grid) )
+            continue;
+        LockedBlock( x.LockedMatrix(), layout, block, X );
+        LockedBlock( z.LockedMatrix(), layout, block, Z );
+        NesterovToddBlock<Real>( X, Z, W, G, blockLambda );
+        Block( wLoc, layout, block, WBlock );
+        Block( gLoc, layout, block, GBlock );
+        WBlock = W;
+        GBlock = G;
+        auto lambdaBlock =
+          lambdaLoc( IR(0,order)+layout.eigOffsets[block], ALL );
+        lambdaBlock = blockLambda;
+    }
+    SumOverGrid( w );
+    SumOverGrid( g );
+    SumOverGrid( lambda );
+
+    // Handle the large blocks using the entire grid
+    DistMatrix<Real> XDist(grid), ZDist(grid), WDist(grid), GDist(grid);
+    DistMatrix<Real,VR,STAR> lambdaDist(grid);
+    DistMatrix<Real,STAR,STAR> lambdaBlock_STAR_STAR(grid);
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        if( order <= cutoff )
+            continue;
+        BlockToGrid( x.LockedMatrix(), layout, block, XDist );
+        BlockToGrid( z.LockedMatrix(), layout, block, ZDist );
+        NesterovToddBlock<Real>( XDist, ZDist, WDist, GDist, lambdaDist );
+        BlockFromGrid( WDist, layout, block, wLoc );
+        BlockFromGrid( GDist, layout, block, gLoc );
+        lambdaBlock_STAR_STAR = lambdaDist;
+        auto lambdaBlock =
+          lambdaLoc( IR(0,order)+layout.eigOffsets[block], ALL );
+        lambdaBlock = lambdaBlock_STAR_STAR.LockedMatrix();
+    }
+
+    Copy( w, wPre );
+    Copy( g, gPre );
+    Copy( lambda, lambdaPre );
+}
+
+#define PROTO(Real) \
+  template void NesterovTodd \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& w, \
+          Matrix<Real>& g, \
+          Matrix<Real>& lambda, \
+    const Matrix<Int>& orders ); \
+  template void NesterovTodd \
+  ( const AbstractDistMatrix<Real>& x, \
+    const AbstractDistMatrix<Real>& z, \
+          AbstractDistMatrix<Real>& w, \
+          AbstractDistMatrix<Real>& g, \
+          AbstractDistMatrix<Real>& lambda, \
+    const Matrix<Int>& orders, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
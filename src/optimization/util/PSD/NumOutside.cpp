@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./util.hpp"
+
+namespace El {
+namespace psd {
+
+namespace {
+
+template<typename Real,class BlockType,class EigType>
+bool OutsideBlock( const BlockType& X, EigType& eigs )
+{
+    BlockType XCopy( X );
+    HermitianEig( LOWER, XCopy, eigs );
+    return VectorMinLoc( eigs ).value <= Real(0);
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Int NumOutside( const Matrix<Real>& x, const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    const BlockLayout layout( orders );
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+
+    Int numOutside = 0;
+    Matrix<Real> X, eigs;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        if( layout.orders[block] == 0 )
+            continue;
+        LockedBlock( x, layout, block, X );
+        if( OutsideBlock<Real>( X, eigs ) )
+            ++numOutside;
+    }
+    return numOutside;
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Int NumOutside
+( const AbstractDistMatrix<Real>& xPre,
+  const Matrix<Int>& orders,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,STAR,STAR> xProx( xPre );
+    auto& x = xProx.GetLocked();
+    const Grid& grid = x.Grid();
+    const BlockLayout layout( orders );
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+
+    // Handle the small blocks assigned to this process
+    Int numOutside = 0;
+    Matrix<Real> X, eigs;
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        if( order == 0 || order > cutoff || !OwnsBlock(block,grid) )
+            continue;
+        LockedBlock( x.LockedMatrix(), layout, block, X );
+        if( OutsideBlock<Real>( X, eigs ) )
+            ++numOutside;
+    }
+    numOutside = mpi::AllReduce( numOutside, grid.Comm() );
+
+    // Handle the large blocks using the entire grid
+    DistMatrix<Real> XDist(grid);
+    DistMatrix<Real,VR,STAR> eigsDist(grid);
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        if( layout.orders[block] <= cutoff )
+            continue;
+        BlockToGrid( x.LockedMatrix(), layout, block, XDist );
+        if( OutsideBlock<Real>( XDist, eigsDist ) )
+            ++numOutside;
+    }
+    return numOutside;
+}
+
+#define PROTO(Real) \
+  template Int NumOutside \
+  ( const Matrix<Real>& x, \
+    const Matrix<Int>& orders ); \
+  template Int NumOutside \
+  ( const AbstractDistMatrix<Real>& x, \
+    const Matrix<Int>& orders, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
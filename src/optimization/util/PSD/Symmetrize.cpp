@@ -0,0 +1,65 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./util.hpp"
+
+namespace El {
+namespace psd {
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Symmetrize( Matrix<Real>& x, const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    const BlockLayout layout( orders );
+    if( x.Height() != layout.height || x.Width() != 1 )
+        LogicError("x was of the wrong size");
+    for( Int block=0; block<layout.NumBlocks(); ++block )
+    {
+        const Int order = layout.orders[block];
+        const Int offset = layout.offsets[block];
+        for( Int j=0; j<order; ++j )
+        {
+            for( Int i=j+1; i<order; ++i )
+            {
+                Real& xij = x(offset+i+j*order);
+                Real& xji = x(offset+j+i*order);
+                const Real average = (xij+xji)/Real(2);
+                xij = xji = average;
+            }
+        }
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Symmetrize( AbstractDistMatrix<Real>& xPre, const Matrix<Int>& orders )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<Real,Real,STAR,STAR> xProx( xPre );
+    auto& x = xProx.Get();
+    Symmetrize( x.Matrix(), orders );
+}
+
+#define PROTO(Real) \
+  template void Symmetrize \
+  ( Matrix<Real>& x, const Matrix<Int>& orders ); \
+  template void Symmetrize \
+  ( AbstractDistMatrix<Real>& x, const Matrix<Int>& orders );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_UTIL_PSD_UTIL_HPP
+#define EL_OPTIMIZATION_UTIL_PSD_UTIL_HPP
+
+namespace El {
+namespace psd {
+
+// The offsets of each block within the vectorization of a member of the
+// product cone and within the concatenation of the eigenvalues of each block
+struct BlockLayout
+{
+    vector<Int> orders, offsets, eigOffsets;
+    Int height=0, degree=0;
+
+    BlockLayout( const Matrix<Int>& ordersMat )
+    {
+        const Int numBlocks = ordersMat.Height();
+        orders.resize( numBlocks );
+        offsets.resize( numBlocks );
+        eigOffsets.resize( numBlocks );
+        for( Int block=0; block<numBlocks; ++block )
+        {
+            const Int order = ordersMat(block);
+            if( order < 0 )
+                LogicError("Block orders must be non-negative");
+            orders[block] = order;
+            offsets[block] = height;
+            eigOffsets[block] = degree;
+            height += order*order;
+            degree += order;
+        }
+    }
+
+    Int NumBlocks() const { return orders.size(); }
+};
+
+// Views of a block of the (local) vectorization
+template<typename Real>
+void LockedBlock
+( const Matrix<Real>& x, const BlockLayout& layout, Int block,
+  Matrix<Real>& X )
+{
+    const Int order = layout.orders[block];
+    X.LockedAttach
+    ( order, order, x.LockedBuffer(layout.offsets[block],0), Max(order,1) );
+}
+
+template<typename Real>
+void Block
+( Matrix<Real>& x, const BlockLayout& layout, Int block, Matrix<Real>& X )
+{
+    const Int order = layout.orders[block];
+    X.Attach( order, order, x.Buffer(layout.offsets[block],0), Max(order,1) );
+}
+
+// Redistribute a block of a replicated vectorization over the entire grid
+// (which only requires local copies) and back (which requires an AllGather)
+template<typename Real>
+void BlockToGrid
+( const Matrix<Real>& x, const BlockLayout& layout, Int block,
+  DistMatrix<Real>& X )
+{
+    const Int order = layout.orders[block];
+    const Int offset = layout.offsets[block];
+    X.Resize( order, order );
+    const Int localHeight = X.LocalHeight();
+    const Int localWidth = X.LocalWidth();
+    auto& XLoc = X.Matrix();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = X.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = X.GlobalRow(iLoc);
+            XLoc(iLoc,jLoc) = x(offset+i+j*order);
+        }
+    }
+}
+
+template<typename Real>
+void BlockFromGrid
+( const DistMatrix<Real>& X, const BlockLayout& layout, Int block,
+  Matrix<Real>& x )
+{
+    DistMatrix<Real,STAR,STAR> X_STAR_STAR( X );
+    Matrix<Real> XBlock;
+    Block( x, layout, block, XBlock );
+    XBlock = X_STAR_STAR.LockedMatrix();
+}
+
+// Whether or not the given (small) block is assigned to this process
+inline bool OwnsBlock( Int block, const Grid& grid )
+{ return block % grid.Size() == grid.Rank(); }
+
+// Sum the contributions of each process to a replicated vectorization
+template<typename Real>
+void SumOverGrid( DistMatrix<Real,STAR,STAR>& x )
+{
+    auto& xLoc = x.Matrix();
+    mpi::AllReduce( xLoc.Buffer(), xLoc.Height(), x.Grid().Comm() );
+}
+
+} // namespace psd
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_UTIL_PSD_UTIL_HPP
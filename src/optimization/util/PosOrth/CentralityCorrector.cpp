@@ -0,0 +1,199 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+// Following J. Gondzio, "Multiple centrality corrections in a primal-dual
+// method for linear programming", Computational Optimization and
+// Applications, 6, pp. 137--156, 1996, each complementarity product v_i of
+// the trial point is projected onto [lowerRatio*target,upperRatio*target],
+// with the decrease of the large products bounded by upperRatio*target, and
+// the residual v_i - t_i of the projection t_i is returned.
+
+namespace {
+
+template<typename Real>
+Real CorrectorResidual( Real v, Real lowerBound, Real upperBound )
+{
+    if( v < lowerBound )
+        return v - lowerBound;
+    else if( v > upperBound )
+        return Min( v - upperBound, upperBound );
+    else
+        return Real(0);
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityCorrector
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& dz,
+        Matrix<Real>& r,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    const Real lowerBound = lowerRatio*target;
+    const Real upperBound = upperRatio*target;
+    r.Resize( k, 1 );
+
+    const Real* sBuf = s.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+    const Real* dsBuf = ds.LockedBuffer();
+    const Real* dzBuf = dz.LockedBuffer();
+          Real* rBuf = r.Buffer();
+    for( Int i=0; i<k; ++i )
+    {
+        const Real v =
+          (sBuf[i]+alphaPri*dsBuf[i])*(zBuf[i]+alphaDual*dzBuf[i]);
+        rBuf[i] = CorrectorResidual( v, lowerBound, upperBound );
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityCorrector
+( const AbstractDistMatrix<Real>& sPre,
+  const AbstractDistMatrix<Real>& zPre,
+  const AbstractDistMatrix<Real>& dsPre,
+  const AbstractDistMatrix<Real>& dzPre,
+        AbstractDistMatrix<Real>& rPre,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( sPre, zPre, dsPre, dzPre, rPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      zProx( zPre, ctrl ),
+      dsProx( dsPre, ctrl ),
+      dzProx( dzPre, ctrl );
+    DistMatrixWriteProxy<Real,Real,VC,STAR>
+      rProx( rPre, ctrl );
+    auto& s = sProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    auto& ds = dsProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+    auto& r = rProx.Get();
+
+    const Real lowerBound = lowerRatio*target;
+    const Real upperBound = upperRatio*target;
+    r.Resize( s.Height(), 1 );
+
+    const Int localHeight = s.LocalHeight();
+    const Real* sBuf = s.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+    const Real* dsBuf = ds.LockedBuffer();
+    const Real* dzBuf = dz.LockedBuffer();
+          Real* rBuf = r.Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real v =
+          (sBuf[iLoc]+alphaPri*dsBuf[iLoc])*(zBuf[iLoc]+alphaDual*dzBuf[iLoc]);
+        rBuf[iLoc] = CorrectorResidual( v, lowerBound, upperBound );
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityCorrector
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& dz,
+        DistMultiVec<Real>& r,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio )
+{
+    EL_DEBUG_CSE
+    const Real lowerBound = lowerRatio*target;
+    const Real upperBound = upperRatio*target;
+    r.SetGrid( s.Grid() );
+    r.Resize( s.Height(), 1 );
+
+    const Int localHeight = s.LocalHeight();
+    const Real* sBuf = s.LockedMatrix().LockedBuffer();
+    const Real* zBuf = z.LockedMatrix().LockedBuffer();
+    const Real* dsBuf = ds.LockedMatrix().LockedBuffer();
+    const Real* dzBuf = dz.LockedMatrix().LockedBuffer();
+          Real* rBuf = r.Matrix().Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real v =
+          (sBuf[iLoc]+alphaPri*dsBuf[iLoc])*(zBuf[iLoc]+alphaDual*dzBuf[iLoc]);
+        rBuf[iLoc] = CorrectorResidual( v, lowerBound, upperBound );
+    }
+}
+
+#define PROTO(Real) \
+  template void CentralityCorrector \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& dz, \
+          Matrix<Real>& r, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real target, \
+    Real lowerRatio, \
+    Real upperRatio ); \
+  template void CentralityCorrector \
+  ( const AbstractDistMatrix<Real>& s, \
+    const AbstractDistMatrix<Real>& z, \
+    const AbstractDistMatrix<Real>& ds, \
+    const AbstractDistMatrix<Real>& dz, \
+          AbstractDistMatrix<Real>& r, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real target, \
+    Real lowerRatio, \
+    Real upperRatio ); \
+  template void CentralityCorrector \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& dz, \
+          DistMultiVec<Real>& r, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real target, \
+    Real lowerRatio, \
+    Real upperRatio );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
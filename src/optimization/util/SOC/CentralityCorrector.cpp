@@ -0,0 +1,274 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace soc {
+
+// The SOC analogue of pos_orth::CentralityCorrector: the Jordan product
+// v = (s + alphaPri ds) o (z + alphaDual dz) is spectrally decomposed as
+//
+//   v = lambda_+ f_+ + lambda_- f_-,
+//
+// with lambda_{+-} = v_0 +- || v_1 ||_2 and f_{+-} = [1; +-v_1/|| v_1 ||_2]/2,
+// and each eigenvalue is projected onto [lowerRatio*target,upperRatio*target]
+// (with the decrease of large eigenvalues bounded by upperRatio*target) to
+// form the residual r = rho_+ f_+ + rho_- f_-.
+
+namespace {
+
+template<typename Real>
+Real CorrectorResidual( Real lambda, Real lowerBound, Real upperBound )
+{
+    if( lambda < lowerBound )
+        return lambda - lowerBound;
+    else if( lambda > upperBound )
+        return Min( lambda - upperBound, upperBound );
+    else
+        return Real(0);
+}
+
+template<typename Real>
+Real CorrectorEntry
+( bool isRoot, Real v, Real vRoot, Real lowerNorm,
+  Real lowerBound, Real upperBound )
+{
+    const Real rhoPlus =
+      CorrectorResidual( vRoot+lowerNorm, lowerBound, upperBound );
+    const Real rhoMinus =
+      CorrectorResidual( vRoot-lowerNorm, lowerBound, upperBound );
+    if( isRoot )
+        return (rhoPlus+rhoMinus)/2;
+    else if( lowerNorm > Real(0) )
+        return ((rhoPlus-rhoMinus)/(2*lowerNorm))*v;
+    else
+        return Real(0);
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityCorrector
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& dz,
+        Matrix<Real>& r,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio )
+{
+    EL_DEBUG_CSE
+    const Real lowerBound = lowerRatio*target;
+    const Real upperBound = upperRatio*target;
+
+    auto sTrial = s;
+    auto zTrial = z;
+    Axpy( alphaPri, ds, sTrial );
+    Axpy( alphaDual, dz, zTrial );
+    Matrix<Real> v, vRoots, lowerNorms;
+    soc::Apply( sTrial, zTrial, v, orders, firstInds );
+    vRoots = v;
+    cone::Broadcast( vRoots, orders, firstInds );
+    soc::LowerNorms( v, lowerNorms, orders, firstInds );
+    cone::Broadcast( lowerNorms, orders, firstInds );
+
+    const Int height = s.Height();
+    r.Resize( height, 1 );
+    for( Int i=0; i<height; ++i )
+        r(i) =
+          CorrectorEntry
+          ( i == firstInds(i), v(i), vRoots(i), lowerNorms(i),
+            lowerBound, upperBound );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityCorrector
+( const AbstractDistMatrix<Real>& sPre,
+  const AbstractDistMatrix<Real>& zPre,
+  const AbstractDistMatrix<Real>& dsPre,
+  const AbstractDistMatrix<Real>& dzPre,
+        AbstractDistMatrix<Real>& rPre,
+  const AbstractDistMatrix<Int>& ordersPre,
+  const AbstractDistMatrix<Int>& firstIndsPre,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( sPre, zPre, dsPre, dzPre, rPre, ordersPre, firstIndsPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      zProx( zPre, ctrl ),
+      dsProx( dsPre, ctrl ),
+      dzProx( dzPre, ctrl );
+    DistMatrixWriteProxy<Real,Real,VC,STAR>
+      rProx( rPre, ctrl );
+    DistMatrixReadProxy<Int,Int,VC,STAR>
+      ordersProx( ordersPre, ctrl ),
+      firstIndsProx( firstIndsPre, ctrl );
+    auto& s = sProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    auto& ds = dsProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+    auto& r = rProx.Get();
+    auto& orders = ordersProx.GetLocked();
+    auto& firstInds = firstIndsProx.GetLocked();
+
+    const Real lowerBound = lowerRatio*target;
+    const Real upperBound = upperRatio*target;
+
+    auto sTrial = s;
+    auto zTrial = z;
+    Axpy( alphaPri, ds, sTrial );
+    Axpy( alphaDual, dz, zTrial );
+    DistMatrix<Real,VC,STAR> v(s.Grid()), vRoots(s.Grid()),
+      lowerNorms(s.Grid());
+    soc::Apply( sTrial, zTrial, v, orders, firstInds, cutoff );
+    vRoots = v;
+    cone::Broadcast( vRoots, orders, firstInds, cutoff );
+    soc::LowerNorms( v, lowerNorms, orders, firstInds, cutoff );
+    cone::Broadcast( lowerNorms, orders, firstInds, cutoff );
+
+    r.Resize( s.Height(), 1 );
+    const Int localHeight = s.LocalHeight();
+    const Real* vBuf = v.LockedBuffer();
+    const Real* vRootBuf = vRoots.LockedBuffer();
+    const Real* lowerNormBuf = lowerNorms.LockedBuffer();
+          Real* rBuf = r.Buffer();
+    const Int* firstIndBuf = firstInds.LockedBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = s.GlobalRow(iLoc);
+        rBuf[iLoc] =
+          CorrectorEntry
+          ( i == firstIndBuf[iLoc], vBuf[iLoc], vRootBuf[iLoc],
+            lowerNormBuf[iLoc], lowerBound, upperBound );
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityCorrector
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& dz,
+        DistMultiVec<Real>& r,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real lowerRatio,
+  Real upperRatio,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = s.Grid();
+    const Real lowerBound = lowerRatio*target;
+    const Real upperBound = upperRatio*target;
+
+    auto sTrial = s;
+    auto zTrial = z;
+    Axpy( alphaPri, ds, sTrial );
+    Axpy( alphaDual, dz, zTrial );
+    DistMultiVec<Real> v(grid), vRoots(grid), lowerNorms(grid);
+    soc::Apply( sTrial, zTrial, v, orders, firstInds, cutoff );
+    vRoots = v;
+    cone::Broadcast( vRoots, orders, firstInds, cutoff );
+    soc::LowerNorms( v, lowerNorms, orders, firstInds, cutoff );
+    cone::Broadcast( lowerNorms, orders, firstInds, cutoff );
+
+    r.SetGrid( grid );
+    r.Resize( s.Height(), 1 );
+    const Int firstLocalRow = s.FirstLocalRow();
+    const Int localHeight = s.LocalHeight();
+    const Real* vBuf = v.LockedMatrix().LockedBuffer();
+    const Real* vRootBuf = vRoots.LockedMatrix().LockedBuffer();
+    const Real* lowerNormBuf = lowerNorms.LockedMatrix().LockedBuffer();
+          Real* rBuf = r.Matrix().Buffer();
+    const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = iLoc + firstLocalRow;
+        rBuf[iLoc] =
+          CorrectorEntry
+          ( i == firstIndBuf[iLoc], vBuf[iLoc], vRootBuf[iLoc],
+            lowerNormBuf[iLoc], lowerBound, upperBound );
+    }
+}
+
+#define PROTO(Real) \
+  template void CentralityCorrector \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& dz, \
+          Matrix<Real>& r, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real target, \
+    Real lowerRatio, \
+    Real upperRatio ); \
+  template void CentralityCorrector \
+  ( const AbstractDistMatrix<Real>& s, \
+    const AbstractDistMatrix<Real>& z, \
+    const AbstractDistMatrix<Real>& ds, \
+    const AbstractDistMatrix<Real>& dz, \
+          AbstractDistMatrix<Real>& r, \
+    const AbstractDistMatrix<Int>& orders, \
+    const AbstractDistMatrix<Int>& firstInds, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real target, \
+    Real lowerRatio, \
+    Real upperRatio, \
+    Int cutoff ); \
+  template void CentralityCorrector \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& dz, \
+          DistMultiVec<Real>& r, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real target, \
+    Real lowerRatio, \
+    Real upperRatio, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace soc
+} // namespace El
@@ -0,0 +1,299 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Returns max_b || A[b] - B[b] ||_max / max(1,|| B[b] ||_max)
+template<typename Field>
+Base<Field> BatchMaxDifference
+( const BatchMatrix<Field>& A, const vector<Matrix<Field>>& B )
+{
+    typedef Base<Field> Real;
+    Real maxDiff = 0;
+    for( Int b=0; b<A.BatchSize(); ++b )
+    {
+        Real diff = 0;
+        for( Int j=0; j<A.Width(); ++j )
+            for( Int i=0; i<A.Height(); ++i )
+                diff = Max( diff, Abs(A(i,j,b)-B[b](i,j)) );
+        maxDiff = Max( maxDiff, diff/Max(Real(1),MaxNorm(B[b])) );
+    }
+    return maxDiff;
+}
+
+template<typename Field>
+void TestBatchedGemm
+( BatchLayout layout, Int n, Int batchSize, bool print )
+{
+    typedef Base<Field> Real;
+    Output("Testing batched Gemm");
+    PushIndent();
+
+    BatchMatrix<Field> A(n,n,batchSize,layout), B(n,n,batchSize,layout),
+                       C(n,n,batchSize,layout);
+    vector<Matrix<Field>> AList(batchSize), BList(batchSize), CList(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Uniform( AList[b], n, n );
+        Uniform( BList[b], n, n );
+        Uniform( CList[b], n, n );
+        A.SetBatch( b, AList[b] );
+        B.SetBatch( b, BList[b] );
+        C.SetBatch( b, CList[b] );
+    }
+
+    Timer timer;
+    timer.Start();
+    Gemm( NORMAL, ADJOINT, Field(2), A, B, Field(-1), C );
+    const double runTime = timer.Stop();
+    const double realGFlops = 2.*double(n)*n*n*batchSize/1.e9;
+    const double gFlops = ( IsComplex<Field>::value ? 4 : 1 )*realGFlops;
+    Output("Batched: ",runTime," seconds (",gFlops/runTime," GFlop/s)");
+
+    timer.Start();
+    for( Int b=0; b<batchSize; ++b )
+        Gemm
+        ( NORMAL, ADJOINT,
+          Field(2), AList[b], BList[b], Field(-1), CList[b] );
+    const double loopTime = timer.Stop();
+    Output("Looped:  ",loopTime," seconds (",gFlops/loopTime," GFlop/s)");
+
+    const Real diff = BatchMaxDifference( C, CList );
+    Output("max relative |C_batched - C_looped| = ",diff);
+    if( print )
+        Print( CList[0], "C[0]" );
+    if( diff > n*10*limits::Epsilon<Real>() )
+        LogicError("Batched Gemm disagreed with Gemm");
+    PopIndent();
+}
+
+template<typename Field>
+void TestBatchedLU
+( BatchLayout layout, Int n, Int batchSize, Int numRHS )
+{
+    typedef Base<Field> Real;
+    Output("Testing batched LU");
+    PushIndent();
+
+    BatchMatrix<Field> A(n,n,batchSize,layout), X(n,numRHS,batchSize,layout);
+    vector<Matrix<Field>> AList(batchSize), XList(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Uniform( AList[b], n, n );
+        Uniform( XList[b], n, numRHS );
+        A.SetBatch( b, AList[b] );
+        X.SetBatch( b, XList[b] );
+    }
+
+    Timer timer;
+    timer.Start();
+    Matrix<Int> swapDests;
+    LU( A, swapDests );
+    lu::SolveAfter( NORMAL, A, swapDests, X );
+    const double runTime = timer.Stop();
+    Output("Batched: ",runTime," seconds");
+
+    timer.Start();
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Permutation P;
+        LU( AList[b], P );
+        lu::SolveAfter( NORMAL, AList[b], P, XList[b] );
+    }
+    const double loopTime = timer.Stop();
+    Output("Looped:  ",loopTime," seconds");
+
+    const Real diff = BatchMaxDifference( X, XList );
+    Output("max relative |X_batched - X_looped| = ",diff);
+    if( diff > Sqrt(limits::Epsilon<Real>()) )
+        LogicError("Batched LU solve disagreed with LU solve");
+    PopIndent();
+}
+
+template<typename Field>
+void TestBatchedCholesky
+( BatchLayout layout, UpperOrLower uplo, Int n, Int batchSize, Int numRHS )
+{
+    typedef Base<Field> Real;
+    Output("Testing batched Cholesky");
+    PushIndent();
+
+    BatchMatrix<Field> A(n,n,batchSize,layout), X(n,numRHS,batchSize,layout);
+    vector<Matrix<Field>> AList(batchSize), XList(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        HermitianUniformSpectrum( AList[b], n, 1, 10 );
+        Uniform( XList[b], n, numRHS );
+        A.SetBatch( b, AList[b] );
+        X.SetBatch( b, XList[b] );
+    }
+
+    Timer timer;
+    timer.Start();
+    Cholesky( uplo, A );
+    cholesky::SolveAfter( uplo, NORMAL, A, X );
+    const double runTime = timer.Stop();
+    Output("Batched: ",runTime," seconds");
+
+    timer.Start();
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Cholesky( uplo, AList[b] );
+        cholesky::SolveAfter( uplo, NORMAL, AList[b], XList[b] );
+    }
+    const double loopTime = timer.Stop();
+    Output("Looped:  ",loopTime," seconds");
+
+    const Real diff = BatchMaxDifference( X, XList );
+    Output("max relative |X_batched - X_looped| = ",diff);
+    if( diff > Sqrt(limits::Epsilon<Real>()) )
+        LogicError("Batched Cholesky solve disagreed with Cholesky solve");
+    PopIndent();
+}
+
+template<typename Field>
+void TestBatchedQR
+( BatchLayout layout, Int m, Int n, Int batchSize, Int numRHS )
+{
+    typedef Base<Field> Real;
+    Output("Testing batched QR");
+    PushIndent();
+
+    BatchMatrix<Field> A(m,n,batchSize,layout), B(m,numRHS,batchSize,layout);
+    vector<Matrix<Field>> AList(batchSize), BList(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Uniform( AList[b], m, n );
+        Uniform( BList[b], m, numRHS );
+        A.SetBatch( b, AList[b] );
+        B.SetBatch( b, BList[b] );
+    }
+
+    Timer timer;
+    timer.Start();
+    Matrix<Field> householderScalars;
+    Matrix<Real> signature;
+    QR( A, householderScalars, signature );
+    BatchMatrix<Field> X(layout);
+    qr::SolveAfter( A, householderScalars, signature, B, X );
+    const double runTime = timer.Stop();
+    Output("Batched: ",runTime," seconds");
+
+    timer.Start();
+    vector<Matrix<Field>> XList(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<Field> t;
+        Matrix<Real> d;
+        QR( AList[b], t, d );
+        qr::SolveAfter( NORMAL, AList[b], t, d, BList[b], XList[b] );
+    }
+    const double loopTime = timer.Stop();
+    Output("Looped:  ",loopTime," seconds");
+
+    const Real diff = BatchMaxDifference( X, XList );
+    Output("max relative |X_batched - X_looped| = ",diff);
+    if( diff > Sqrt(limits::Epsilon<Real>()) )
+        LogicError("Batched QR solve disagreed with QR solve");
+    PopIndent();
+}
+
+template<typename Field>
+void TestBatchedHermitianEig
+( BatchLayout layout, UpperOrLower uplo, Int n, Int batchSize )
+{
+    typedef Base<Field> Real;
+    Output("Testing batched HermitianEig");
+    PushIndent();
+
+    BatchMatrix<Field> A(n,n,batchSize,layout);
+    vector<Matrix<Field>> AList(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        HermitianUniformSpectrum( AList[b], n, -10, 10 );
+        A.SetBatch( b, AList[b] );
+    }
+
+    Timer timer;
+    timer.Start();
+    Matrix<Real> w;
+    HermitianEig( uplo, A, w );
+    Output("Batched: ",timer.Stop()," seconds");
+
+    Real maxDiff = 0;
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<Real> wMember;
+        HermitianEig( uplo, AList[b], wMember );
+        for( Int i=0; i<n; ++i )
+            maxDiff = Max( maxDiff, Abs(w(i,b)-wMember(i)) );
+    }
+    Output("max |w_batched - w_looped| = ",maxDiff);
+    if( maxDiff > n*1000*limits::Epsilon<Real>() )
+        LogicError("Batched HermitianEig disagreed with HermitianEig");
+    PopIndent();
+}
+
+template<typename Field>
+void TestBatched
+( BatchLayout layout, UpperOrLower uplo,
+  Int n, Int batchSize, Int numRHS, bool print )
+{
+    Output("Testing with ",TypeName<Field>()," and ",
+      ( layout == BATCH_STRIDED ? "strided" : "interleaved" )," batches");
+    PushIndent();
+    TestBatchedGemm<Field>( layout, n, batchSize, print );
+    TestBatchedLU<Field>( layout, n, batchSize, numRHS );
+    TestBatchedCholesky<Field>( layout, uplo, n, batchSize, numRHS );
+    TestBatchedQR<Field>( layout, n+2, n, batchSize, numRHS );
+    TestBatchedHermitianEig<Field>( layout, uplo, n, batchSize );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","size of each matrix",8);
+        const Int batchSize = Input("--batchSize","number of matrices",1000);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        ComplainIfDebug();
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+
+        if( mpi::Rank() == 0 )
+        {
+            for( auto layout : { BATCH_STRIDED, BATCH_INTERLEAVED } )
+            {
+                TestBatched<float>
+                ( layout, uplo, n, batchSize, numRHS, print );
+                TestBatched<Complex<float>>
+                ( layout, uplo, n, batchSize, numRHS, print );
+                TestBatched<double>
+                ( layout, uplo, n, batchSize, numRHS, print );
+                TestBatched<Complex<double>>
+                ( layout, uplo, n, batchSize, numRHS, print );
+#ifdef EL_HAVE_QD
+                TestBatched<DoubleDouble>
+                ( layout, uplo, n, batchSize, numRHS, print );
+#endif
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
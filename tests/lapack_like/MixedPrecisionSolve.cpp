@@ -0,0 +1,289 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void CheckResidual
+( const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Field>& X,
+  Int numIts )
+{
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    auto R( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    const Real relError =
+      InfinityNorm(R) / (eps*n*Max(OneNorm(A)*InfinityNorm(X),OneNorm(B)));
+    Output
+    ("|| B - A X ||_oo / (eps n Max(||A||_1 ||X||_oo,||B||_1)) = ",relError,
+     " after ",numIts," iterations");
+    if( relError > Real(100) )
+        LogicError("Relative error was unacceptably large");
+}
+
+template<typename Field>
+void CheckResidual
+( const DistMatrix<Field>& A,
+  const DistMatrix<Field>& B,
+  const DistMatrix<Field>& X,
+  Int numIts )
+{
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    auto R( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    const Real relError =
+      InfinityNorm(R) / (eps*n*Max(OneNorm(A)*InfinityNorm(X),OneNorm(B)));
+    OutputFromRoot
+    (A.Grid().Comm(),
+     "|| B - A X ||_oo / (eps n Max(||A||_1 ||X||_oo,||B||_1)) = ",relError,
+     " after ",numIts," iterations");
+    if( relError > Real(100) )
+        LogicError("Relative error was unacceptably large");
+}
+
+template<typename Field>
+void TestSequential
+( Int n, Int numRHS, UpperOrLower uplo,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    Output("Testing with ",TypeName<Field>()," (factoring with ",
+      TypeName<Demote<Field>>(),")");
+    PushIndent();
+    Timer timer;
+
+    Matrix<Field> A, B, X;
+    Uniform( A, n, n );
+    ShiftDiagonal( A, Field(2*n) );
+    Uniform( B, n, numRHS );
+
+    X = B;
+    timer.Start();
+    LinearSolve( A, X );
+    Output("LinearSolve: ",timer.Stop()," seconds");
+    X = B;
+    timer.Start();
+    const Int linearIts = MixedPrecisionLinearSolve( A, X, ctrl );
+    Output("MixedPrecisionLinearSolve: ",timer.Stop()," seconds");
+    CheckResidual( A, B, X, linearIts );
+
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    X = B;
+    timer.Start();
+    HPDSolve( uplo, NORMAL, A, X );
+    Output("HPDSolve: ",timer.Stop()," seconds");
+    X = B;
+    timer.Start();
+    const Int hpdIts = MixedPrecisionHPDSolve( uplo, A, X, ctrl );
+    Output("MixedPrecisionHPDSolve: ",timer.Stop()," seconds");
+    CheckResidual( A, B, X, hpdIts );
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestDistributed
+( const Grid& grid, Int n, Int numRHS, UpperOrLower uplo,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing with ",TypeName<Field>()," (factoring with ",
+     TypeName<Demote<Field>>(),")");
+    PushIndent();
+    Timer timer;
+
+    DistMatrix<Field> A(grid), B(grid), X(grid);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, Field(2*n) );
+    Uniform( B, n, numRHS );
+
+    X = B;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    LinearSolve( A, X );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot(grid.Comm(),"LinearSolve: ",timer.Stop()," seconds");
+    X = B;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    const Int linearIts = MixedPrecisionLinearSolve( A, X, ctrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),"MixedPrecisionLinearSolve: ",timer.Stop()," seconds");
+    CheckResidual( A, B, X, linearIts );
+
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    X = B;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    HPDSolve( uplo, NORMAL, A, X );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot(grid.Comm(),"HPDSolve: ",timer.Stop()," seconds");
+    X = B;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    const Int hpdIts = MixedPrecisionHPDSolve( uplo, A, X, ctrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),"MixedPrecisionHPDSolve: ",timer.Stop()," seconds");
+    CheckResidual( A, B, X, hpdIts );
+
+    PopIndent();
+}
+
+// Form A = U diag(sigma) V^H, with U and V unitary and with singular values
+// decaying geometrically from one to 1/condition
+template<typename Field>
+void IllConditioned( Matrix<Field>& A, Int n, Base<Field> condition )
+{
+    typedef Base<Field> Real;
+    Matrix<Field> U, V;
+    Gaussian( U, n, n );
+    Gaussian( V, n, n );
+    qr::ExplicitUnitary( U );
+    qr::ExplicitUnitary( V );
+    Matrix<Real> sigma;
+    Zeros( sigma, n, 1 );
+    for( Int j=0; j<n; ++j )
+        sigma(j) = Pow(condition,-Real(j)/Real(Max(n-1,1)));
+    DiagonalScale( RIGHT, NORMAL, sigma, U );
+    Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
+}
+
+template<typename Field>
+void IllConditioned( DistMatrix<Field>& A, Int n, Base<Field> condition )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    DistMatrix<Field> U(grid), V(grid);
+    Gaussian( U, n, n );
+    Gaussian( V, n, n );
+    qr::ExplicitUnitary( U );
+    qr::ExplicitUnitary( V );
+    DistMatrix<Real,MR,STAR> sigma(grid);
+    Zeros( sigma, n, 1 );
+    for( Int j=0; j<n; ++j )
+        sigma.Set( j, 0, Pow(condition,-Real(j)/Real(Max(n-1,1))) );
+    DiagonalScale( RIGHT, NORMAL, sigma, U );
+    Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
+}
+
+// Classical refinement stagnates once the condition number exceeds the
+// inverse of the unit roundoff of the factorization, whereas GMRES-IR
+// should still recover a backward stable solution
+template<typename Field>
+void TestIllConditionedSequential
+( Int n, Int numRHS, Base<Field> condition,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    Output
+    ("Testing GMRES-IR with ",TypeName<Field>()," and condition number ",
+     condition);
+    PushIndent();
+
+    Matrix<Field> A, B, X;
+    IllConditioned( A, n, condition );
+    Uniform( B, n, numRHS );
+    X = B;
+    const Int its = MixedPrecisionLinearSolve( A, X, ctrl );
+    CheckResidual( A, B, X, its );
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestIllConditionedDistributed
+( const Grid& grid, Int n, Int numRHS, Base<Field> condition,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing GMRES-IR with ",TypeName<Field>(),
+     " and condition number ",condition);
+    PushIndent();
+
+    DistMatrix<Field> A(grid), B(grid), X(grid);
+    IllConditioned( A, n, condition );
+    Uniform( B, n, numRHS );
+    X = B;
+    const Int its = MixedPrecisionLinearSolve( A, X, ctrl );
+    CheckResidual( A, B, X, its );
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestMixedPrecision
+( const Grid& grid, Int n, Int numRHS, UpperOrLower uplo,
+  bool gmres, bool sequential, bool distributed, bool progress )
+{
+    MixedPrecisionCtrl<Base<Field>> ctrl;
+    ctrl.alg =
+      ( gmres ? MIXED_PRECISION_GMRES_REFINE : MIXED_PRECISION_REFINE );
+    ctrl.progress = progress;
+
+    if( sequential && grid.Rank() == 0 )
+        TestSequential<Field>( n, numRHS, uplo, ctrl );
+    if( distributed )
+        TestDistributed<Field>( grid, n, numRHS, uplo, ctrl );
+
+    // Classical refinement fails beyond roughly the inverse of the unit
+    // roundoff of the factorization (somewhat earlier for complex fields)
+    typedef Base<Field> Real;
+    ctrl.alg = MIXED_PRECISION_GMRES_REFINE;
+    const Real condition = Real(IsComplex<Field>::value ? 1 : 4) /
+      Real(limits::Epsilon<Base<Demote<Field>>>());
+    if( sequential && grid.Rank() == 0 )
+        TestIllConditionedSequential<Field>( n, numRHS, condition, ctrl );
+    if( distributed )
+        TestIllConditionedDistributed<Field>
+        ( grid, n, numRHS, condition, ctrl );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrix",500);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const bool gmres = Input("--gmres","use GMRES-IR?",false);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool distributed =
+          Input("--distributed","test distributed?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        ComplainIfDebug();
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        const Grid grid( comm );
+
+        TestMixedPrecision<double>
+        ( grid, n, numRHS, uplo, gmres, sequential, distributed, progress );
+        TestMixedPrecision<Complex<double>>
+        ( grid, n, numRHS, uplo, gmres, sequential, distributed, progress );
+#ifdef EL_HAVE_QD
+        TestMixedPrecision<DoubleDouble>
+        ( grid, n, numRHS, uplo, gmres, sequential, distributed, progress );
+        TestMixedPrecision<QuadDouble>
+        ( grid, n, numRHS, uplo, gmres, sequential, distributed, progress );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field,class SparseMatrixType,class VectorType>
+Base<Field> RelativeResidual
+( const SparseMatrixType& A, const VectorType& B, const VectorType& X )
+{
+    auto R( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    return FrobeniusNorm( R ) / FrobeniusNorm( B );
+}
+
+// Solve A X = B from a zero initial guess (with both interfaces), from a
+// perturbation of the solution, and from the solution itself
+template<typename Field,class SparseMatrixType,class VectorType>
+void TestInitialGuesses
+( const SparseMatrixType& A, const VectorType& B,
+  Base<Field> relTol, Int maxIts, bool onRoot )
+{
+    typedef Base<Field> Real;
+    auto applyA =
+      [&]( Field alpha, const VectorType& x, Field beta, VectorType& y )
+      { Multiply( NORMAL, alpha, A, x, beta, y ); };
+    auto precond = []( VectorType& b ) { };
+    auto report = [&]( const string& msg, Int its, Real relResid )
+      {
+          if( onRoot )
+              Output
+              (msg,": ",its," iterations, || B - A X ||_F / || B ||_F = ",
+               relResid);
+          if( relResid > relTol*Sqrt(Real(B.Width())) )
+              LogicError("PCG did not achieve the requested tolerance");
+      };
+
+    auto X( B );
+    Zero( X );
+    const Int zeroIts = PCG( applyA, precond, B, X, relTol, maxIts, false );
+    report("Zero initial guess",zeroIts,RelativeResidual<Field>(A,B,X));
+
+    auto XOverwrite( B );
+    const Int overwriteIts =
+      PCG( applyA, precond, XOverwrite, relTol, maxIts, false );
+    XOverwrite -= X;
+    if( overwriteIts != zeroIts || FrobeniusNorm(XOverwrite) != Real(0) )
+        LogicError("Overwriting PCG did not match a zero initial guess");
+
+    auto XPerturb( X );
+    Uniform( XPerturb, X.Height(), X.Width() );
+    XPerturb *= Field(Sqrt(relTol));
+    XPerturb += X;
+    const Int perturbIts =
+      PCG( applyA, precond, B, XPerturb, relTol, maxIts, false );
+    report
+    ("Perturbed initial guess",perturbIts,
+     RelativeResidual<Field>(A,B,XPerturb));
+    if( perturbIts >= zeroIts )
+        LogicError("A good initial guess did not reduce the iterations");
+
+    const Int exactIts = PCG( applyA, precond, B, X, relTol, maxIts, false );
+    if( exactIts != 0 )
+        LogicError("PCG did not immediately accept the solution");
+}
+
+template<typename Field>
+void TestSequential( Int nx, Int ny, Int numRHS, Base<Field> relTol )
+{
+    Output("Testing sequential PCG with ",TypeName<Field>());
+    PushIndent();
+
+    // Form the (positive-definite) negative Laplacian
+    SparseMatrix<Field> A;
+    Helmholtz( A, nx, ny, Field(0) );
+    Matrix<Field> B;
+    Uniform( B, nx*ny, numRHS );
+    TestInitialGuesses<Field>( A, B, relTol, 10*nx*ny, true );
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestDistributed
+( Int nx, Int ny, Int numRHS, Base<Field> relTol, const Grid& grid )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing distributed PCG with ",TypeName<Field>());
+    PushIndent();
+
+    DistSparseMatrix<Field> A(grid);
+    Helmholtz( A, nx, ny, Field(0) );
+    DistMultiVec<Field> B(grid);
+    Uniform( B, nx*ny, numRHS );
+    TestInitialGuesses<Field>
+    ( A, B, relTol, 10*nx*ny, grid.Rank() == 0 );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","number of x grid points",30);
+        const Int ny = Input("--ny","number of y grid points",30);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const double relTol = Input("--relTol","relative tolerance",1e-10);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool distributed =
+          Input("--distributed","test distributed?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        if( sequential && mpi::Rank() == 0 )
+        {
+            TestSequential<double>( nx, ny, numRHS, relTol );
+            TestSequential<Complex<double>>( nx, ny, numRHS, relTol );
+        }
+        if( distributed )
+        {
+            TestDistributed<double>( nx, ny, numRHS, relTol, grid );
+            TestDistributed<Complex<double>>( nx, ny, numRHS, relTol, grid );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
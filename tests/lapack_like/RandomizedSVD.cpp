@@ -0,0 +1,196 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form A = X diag(sigma) Y^H + noise E, where X and Y have orthonormal columns
+// and the singular values sigma_j = 2^{-j/4} decay geometrically
+template<typename Field>
+void LowRankPlusNoise
+( DistMatrix<Field>& A, Int m, Int n, Int numNonzeroSingVals,
+  Base<Field> noise )
+{
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    DistMatrix<Field> X(g), Y(g);
+    Gaussian( X, m, numNonzeroSingVals );
+    Gaussian( Y, n, numNonzeroSingVals );
+    qr::ExplicitUnitary( X );
+    qr::ExplicitUnitary( Y );
+
+    DistMatrix<Real,MR,STAR> sigma(g);
+    Zeros( sigma, numNonzeroSingVals, 1 );
+    for( Int j=0; j<numNonzeroSingVals; ++j )
+        sigma.Set( j, 0, Pow(Real(2),-Real(j)/Real(4)) );
+    DiagonalScale( RIGHT, NORMAL, sigma, X );
+
+    Gaussian( A, m, n, Field(0), noise );
+    Gemm( NORMAL, ADJOINT, Field(1), X, Y, Field(1), A );
+}
+
+template<typename Field>
+void TestCorrectness
+( const DistMatrix<Field>& A,
+  const DistMatrix<Field>& U,
+  const DistMatrix<Base<Field>,VR,STAR>& s,
+  const DistMatrix<Field>& V,
+  Int rank )
+{
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Real eps = limits::Epsilon<Real>();
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // Compare against the leading singular values from a full SVD
+    DistMatrix<Real,VR,STAR> sFull(g);
+    SVD( A, sFull );
+    auto sFullT = sFull( IR(0,rank), ALL );
+    DistMatrix<Real,VR,STAR> sDiff( s );
+    sDiff -= sFullT;
+    const Real relSingValError = MaxNorm( sDiff ) / MaxNorm( sFull );
+    OutputFromRoot
+    (g.Comm(),"|| s - sFull(0:rank) ||_max / || sFull ||_max = ",
+     relSingValError);
+
+    // Check the orthonormality of U and V
+    DistMatrix<Field> Z(g);
+    Identity( Z, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real orthogUError = HermitianMaxNorm( LOWER, Z ) / (eps*m);
+    Identity( Z, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), V, Real(1), Z );
+    const Real orthogVError = HermitianMaxNorm( LOWER, Z ) / (eps*n);
+    OutputFromRoot
+    (g.Comm(),"|| I - U^H U ||_max / (eps m) = ",orthogUError,", ",
+     "|| I - V^H V ||_max / (eps n) = ",orthogVError);
+
+    // The low-rank approximation error should be close to sigma_{rank}
+    auto E( A );
+    auto UScaled( U );
+    DiagonalScale( RIGHT, NORMAL, s, UScaled );
+    Gemm( NORMAL, ADJOINT, Field(-1), UScaled, V, Field(1), E );
+    const Real approxError = TwoNormEstimate( E );
+    const Real optimalError = sFull.Get(rank,0);
+    OutputFromRoot
+    (g.Comm(),"|| A - U diag(s) V^H ||_2 ~= ",approxError,
+     " (optimal is ",optimalError,")");
+
+    if( relSingValError > Real(1e-2) )
+        LogicError("Singular value error was unacceptably large");
+    if( orthogUError > Real(100) || orthogVError > Real(100) )
+        LogicError("Singular vectors were not sufficiently orthonormal");
+    if( approxError > Real(2)*optimalError )
+        LogicError("Low-rank approximation error was unacceptably large");
+}
+
+template<typename Field>
+void TestRandomizedSVD
+( const Grid& g, Int m, Int n, Int rank, const RandomizedSVDCtrl& ctrl )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(g), U(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    const Int numNonzeroSingVals = Min( Min(m,n), 4*rank );
+    LowRankPlusNoise( A, m, n, numNonzeroSingVals, Real(1e-6) );
+
+    Timer timer;
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    RandomizedSVD( A, U, s, V, rank, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"RandomizedSVD: ",timer.Stop()," seconds");
+    TestCorrectness( A, U, s, V, rank );
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestSparseRandomizedSVD
+( Int m, Int n, Int rank, const RandomizedSVDCtrl& ctrl )
+{
+    typedef Base<Field> Real;
+    Output("Testing sparse diagonal with ",TypeName<Field>());
+    PushIndent();
+
+    // A rectangular diagonal matrix has known singular values and vectors
+    const Int minDim = Min(m,n);
+    SparseMatrix<Field> A;
+    Zeros( A, m, n );
+    A.Reserve( minDim );
+    for( Int i=0; i<minDim; ++i )
+        A.QueueUpdate( i, i, Pow(Real(2),-Real(i)/Real(4)) );
+    A.ProcessQueues();
+
+    Matrix<Field> U, V;
+    Matrix<Real> s;
+    RandomizedSVD( A, U, s, V, rank, ctrl );
+
+    Real maxError = 0;
+    for( Int j=0; j<rank; ++j )
+    {
+        const Real sigma = Pow(Real(2),-Real(j)/Real(4));
+        maxError = Max( maxError, Abs(s(j)-sigma) );
+    }
+    Output("max_j |s(j) - sigma_j| = ",maxError);
+    if( maxError > Real(1e-2) )
+        LogicError("Sparse singular value error was unacceptably large");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",500);
+        const Int n = Input("--width","width of matrix",300);
+        const Int rank = Input("--rank","number of singular triplets",20);
+        const Int oversample = Input("--oversample","oversampling",10);
+        const Int numPower = Input("--numPower","number of power its",2);
+        const bool blockKrylov = Input("--blockKrylov","block Krylov?",false);
+        const bool sparseSign =
+          Input("--sparseSign","use a sparse sign sketch?",false);
+        const bool sequential = Input("--sequential","test sparse?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        ComplainIfDebug();
+        const Grid g( comm );
+
+        RandomizedSVDCtrl ctrl;
+        ctrl.oversample = oversample;
+        ctrl.numPower = numPower;
+        ctrl.blockKrylov = blockKrylov;
+        ctrl.sketch =
+          ( sparseSign ? RANDOMIZED_SPARSE_SIGN_SKETCH
+                       : RANDOMIZED_GAUSSIAN_SKETCH );
+
+        TestRandomizedSVD<float>( g, m, n, rank, ctrl );
+        TestRandomizedSVD<Complex<float>>( g, m, n, rank, ctrl );
+        TestRandomizedSVD<double>( g, m, n, rank, ctrl );
+        TestRandomizedSVD<Complex<double>>( g, m, n, rank, ctrl );
+
+        if( sequential && g.Rank() == 0 )
+        {
+            TestSparseRandomizedSVD<double>( m, n, rank, ctrl );
+            TestSparseRandomizedSVD<Complex<double>>( m, n, rank, ctrl );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -134,6 +134,40 @@ void TestRandom
     TestRandomHelper( A, ctrl, print );
 }
 
+// Force the distributed AED to use deflation windows which are large enough
+// to be computed on a subgrid of processes (which requires at least four
+// processes) rather than redundantly
+template<typename F>
+void TestSubgridAED
+( Int n, const Grid& grid, const HessenbergSchurCtrl& ctrl, bool print )
+{
+    EL_DEBUG_CSE
+    auto subgridCtrl( ctrl );
+    subgridCtrl.alg = HESSENBERG_SCHUR_AED;
+    subgridCtrl.blockHeight = 4;
+    subgridCtrl.minMultiBulgeSize = 32;
+    subgridCtrl.minDistMultiBulgeSize = 32;
+    subgridCtrl.minDistAEDSize = 16*subgridCtrl.blockHeight;
+    subgridCtrl.deflationSize =
+      []( Int n, Int winSize, Int numShifts )
+      {
+          const Int deflationSize = Min( winSize, (n-1)/3 );
+          return Max( Int(2), deflationSize-Mod(deflationSize,Int(2)) );
+      };
+
+    if( grid.Rank() == 0 )
+    {
+        Output("Testing subgrid AED with ",TypeName<F>());
+        if( grid.Size() < 4 )
+            Output("  (at least four processes are needed for a subgrid)");
+    }
+    DistMatrix<F> A(grid);
+    Uniform( A, n, n );
+    if( print )
+        Print( A, "A" );
+    TestRandomHelper( A, subgridCtrl, print );
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -146,10 +180,18 @@ int main( int argc, char* argv[] )
           Input
           ("--minMultiBulgeSize",
            "minimum size for using a multi-bulge algorithm",75);
+        const Int minDistAEDSize =
+          Input
+          ("--minDistAEDSize",
+           "minimum AED window size for using a subgrid",1000);
         const bool accumulate =
           Input("--accumulate","accumulate reflections?",true);
         const bool sortShifts =
           Input("--sortShifts","sort shifts for AED?",true);
+        const bool subgridAED =
+          Input("--subgridAED","test AED windows on a subgrid?",true);
+        const Int subgridN =
+          Input("--subgridN","matrix size for the subgrid AED test",200);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool distributed =
           Input("--distributed","test distributed?",true);
@@ -161,6 +203,7 @@ int main( int argc, char* argv[] )
         HessenbergSchurCtrl ctrl;
         ctrl.alg = static_cast<HessenbergSchurAlg>(algInt);
         ctrl.minMultiBulgeSize = minMultiBulgeSize;
+        ctrl.minDistAEDSize = minDistAEDSize;
         ctrl.accumulateReflections = accumulate;
         ctrl.sortShifts = sortShifts;
         ctrl.progress = progress;
@@ -210,6 +253,11 @@ int main( int argc, char* argv[] )
             TestRandom<Complex<BigFloat>>( n, grid, ctrl, print );
 #endif
         }
+        if( distributed && subgridAED )
+        {
+            TestSubgridAED<double>( subgridN, grid, ctrl, print );
+            TestSubgridAED<Complex<double>>( subgridN, grid, ctrl, print );
+        }
     }
     catch( std::exception& e ) { ReportException(e); }
 
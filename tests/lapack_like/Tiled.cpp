@@ -0,0 +1,234 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestTiledCholesky
+( UpperOrLower uplo,
+  Int m,
+  const TiledCtrl& ctrl,
+  bool correctness )
+{
+    typedef Base<Field> Real;
+    Output("Testing tiled Cholesky with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> A, AOrig;
+    HermitianUniformSpectrum( A, m, 1e-3, 10 );
+    AOrig = A;
+
+    Timer timer;
+    timer.Start();
+    Cholesky( uplo, A );
+    const double runTime = timer.Stop();
+
+    auto ATiled( AOrig );
+    timer.Start();
+    cholesky::Tiled( uplo, ATiled, ctrl );
+    const double tiledTime = timer.Stop();
+
+    const double realGFlops = (1./3.)*Pow(double(m),3.)/1.e9;
+    const double gFlops = ( IsComplex<Field>::value ? 4 : 1 )*realGFlops;
+    Output("Cholesky:       ",runTime," seconds (",gFlops/runTime," GFlop/s)");
+    Output
+    ("Tiled Cholesky: ",tiledTime," seconds (",gFlops/tiledTime," GFlop/s)");
+
+    if( correctness )
+    {
+        const Real eps = limits::Epsilon<Real>();
+        Matrix<Field> X, Y;
+        Uniform( X, m, 10 );
+        Zeros( Y, m, 10 );
+        Hemm( LEFT, uplo, Field(1), AOrig, X, Field(0), Y );
+        const Real oneNormY = OneNorm( Y );
+        cholesky::SolveAfter( uplo, NORMAL, ATiled, Y );
+        X -= Y;
+        const Real relError = InfinityNorm(X) / (eps*m*oneNormY);
+        Output("||X - A \\ Y ||_oo / (eps n || Y ||_1) = ",relError);
+        if( relError > Real(100) )
+            LogicError("Relative error was unacceptably large");
+    }
+    PopIndent();
+}
+
+template<typename Field>
+void TestTiledLU
+( Int m,
+  const TiledCtrl& ctrl,
+  bool correctness )
+{
+    typedef Base<Field> Real;
+    Output("Testing tiled LU with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> A, AOrig;
+    Uniform( A, m, m );
+    AOrig = A;
+
+    Permutation P;
+    Timer timer;
+    timer.Start();
+    LU( A, P );
+    const double runTime = timer.Stop();
+
+    auto ATiled( AOrig );
+    Permutation PTiled;
+    timer.Start();
+    lu::Tiled( ATiled, PTiled, ctrl );
+    const double tiledTime = timer.Stop();
+
+    const double realGFlops = (2./3.)*Pow(double(m),3.)/1.e9;
+    const double gFlops = ( IsComplex<Field>::value ? 4 : 1 )*realGFlops;
+    Output("LU:       ",runTime," seconds (",gFlops/runTime," GFlop/s)");
+    Output("Tiled LU: ",tiledTime," seconds (",gFlops/tiledTime," GFlop/s)");
+
+    if( correctness )
+    {
+        const Real eps = limits::Epsilon<Real>();
+        const Real oneNormA = OneNorm( AOrig );
+        Matrix<Field> X;
+        Uniform( X, m, 10 );
+        auto Y( X );
+        const Real oneNormY = OneNorm( Y );
+        lu::SolveAfter( NORMAL, ATiled, PTiled, Y );
+        Gemm( NORMAL, NORMAL, Field(-1), AOrig, Y, Field(1), X );
+        const Real relError =
+          InfinityNorm(X) / (eps*m*Max(oneNormA,oneNormY));
+        Output
+        ("|| Y - A X ||_oo / (eps n Max(||A||_1,||Y||_1)) = ",relError);
+        if( relError > Real(100) )
+            LogicError("Relative error was unacceptably large");
+    }
+    PopIndent();
+}
+
+template<typename Field>
+void TestTiledQR
+( Int m,
+  Int n,
+  const TiledCtrl& ctrl,
+  bool correctness )
+{
+    typedef Base<Field> Real;
+    Output("Testing tiled QR with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> A, AOrig;
+    Uniform( A, m, n );
+    AOrig = A;
+
+    Matrix<Field> householderScalars;
+    Matrix<Real> signature;
+    Timer timer;
+    timer.Start();
+    QR( A, householderScalars, signature );
+    const double runTime = timer.Stop();
+
+    auto ATiled( AOrig );
+    qr::TiledData<Field> data;
+    timer.Start();
+    qr::Tiled( ATiled, data, ctrl );
+    const double tiledTime = timer.Stop();
+
+    const double realGFlops =
+      (2.*double(m)*double(n)*double(n) - (2./3.)*Pow(double(n),3.))/1.e9;
+    const double gFlops = ( IsComplex<Field>::value ? 4 : 1 )*realGFlops;
+    Output("QR:       ",runTime," seconds (",gFlops/runTime," GFlop/s)");
+    Output("Tiled QR: ",tiledTime," seconds (",gFlops/tiledTime," GFlop/s)");
+
+    if( correctness )
+    {
+        const Real eps = limits::Epsilon<Real>();
+        const Int maxDim = Max(m,n);
+        const Real oneNormA = OneNorm( AOrig );
+
+        // Test the orthogonality of Q
+        Matrix<Field> Z;
+        Identity( Z, m, Min(m,n) );
+        qr::tiled::ApplyQ( NORMAL, ATiled, data, Z );
+        Matrix<Field> X;
+        Identity( X, Min(m,n), Min(m,n) );
+        Herk( LOWER, ADJOINT, Real(-1), Z, Real(1), X );
+        MakeHermitian( LOWER, X );
+        const Real relOrthogError = InfinityNorm(X) / (eps*maxDim);
+        Output("||Q^H Q - I||_oo / (eps Max(m,n)) = ",relOrthogError);
+
+        // Test A ~= Q R
+        auto U( ATiled );
+        MakeTrapezoidal( UPPER, U );
+        qr::tiled::ApplyQ( NORMAL, ATiled, data, U );
+        U -= AOrig;
+        const Real relError = InfinityNorm(U) / (eps*maxDim*oneNormA);
+        Output("||A - Q R||_oo / (eps Max(m,n) ||A||_1) = ",relError);
+
+        if( relOrthogError > Real(10) )
+            LogicError("Relative orthogonality error was unacceptably large");
+        if( relError > Real(10) )
+            LogicError("Relative error was unacceptably large");
+    }
+    PopIndent();
+}
+
+template<typename Field>
+void TestTiled
+( UpperOrLower uplo,
+  Int m,
+  Int n,
+  const TiledCtrl& ctrl,
+  bool correctness )
+{
+    TestTiledCholesky<Field>( uplo, m, ctrl, correctness );
+    TestTiledLU<Field>( m, ctrl, correctness );
+    TestTiledQR<Field>( m, n, ctrl, correctness );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const Int m = Input("--m","height of matrix",300);
+        const Int n = Input("--n","width of matrix for QR",200);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int tileSize = Input("--tileSize","tile size",64);
+        const bool parallel =
+          Input("--parallel","dynamically schedule the tasks?",true);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+
+        TiledCtrl ctrl;
+        ctrl.tileSize = tileSize;
+        ctrl.parallel = parallel;
+
+        if( mpi::Rank() == 0 )
+        {
+            TestTiled<float>( uplo, m, n, ctrl, correctness );
+            TestTiled<Complex<float>>( uplo, m, n, ctrl, correctness );
+            TestTiled<double>( uplo, m, n, ctrl, correctness );
+            TestTiled<Complex<double>>( uplo, m, n, ctrl, correctness );
+#ifdef EL_HAVE_QD
+            TestTiled<DoubleDouble>( uplo, m, n, ctrl, correctness );
+            TestTiled<QuadDouble>( uplo, m, n, ctrl, correctness );
+#endif
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
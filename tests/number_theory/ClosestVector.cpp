@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void RandomIntegerBasis( Matrix<F>& B, Int m, Int n, Base<F> entryBound )
+{
+    Uniform( B, m, n, F(0), entryBound );
+    Round( B );
+}
+
+template<typename F>
+Base<F> SquaredDistance
+( const Matrix<F>& Y, const Matrix<F>& T, Int j )
+{
+    Base<F> dist = 0;
+    for( Int i=0; i<T.Height(); ++i )
+        dist += Abs(Y(i,j)-T(i,j))*Abs(Y(i,j)-T(i,j));
+    return dist;
+}
+
+// The blocked, batched Babai points should be those of NearestPlane applied
+// with the same LLL control structure, independent of the blocksize and the
+// batch size, and should equal BRed X for integer coordinates X
+template<typename F>
+void TestBabai( Int m, Int n, Int numTargets, Base<F> entryBound )
+{
+    typedef Base<F> Real;
+    Output("Testing Babai points with ",TypeName<F>());
+    PushIndent();
+
+    Matrix<F> B, T;
+    RandomIntegerBasis( B, m, n, entryBound );
+    Gaussian( T, m, numTargets, F(0), 2*entryBound );
+
+    LLLCtrl<Real> lllCtrl;
+    ClosestVectorSolver<F> solver( B, lllCtrl );
+    const auto& BRed = solver.ReducedBasis();
+
+    Matrix<F> Y, X;
+    solver.Solve( T, Y, X );
+
+    Matrix<F> E( Y );
+    Gemm( NORMAL, NORMAL, F(-1), BRed, X, F(1), E );
+    const Real coordError = FrobeniusNorm( E ) / FrobeniusNorm( Y );
+    Matrix<F> XRound( X );
+    Round( XRound );
+    XRound -= X;
+    const Real roundError = MaxNorm( XRound );
+    Output
+    ("|| Y - BRed X ||_F / || Y ||_F = ",coordError,
+     ", || X - round(X) ||_max = ",roundError);
+    if( coordError > Real(1e-10) || roundError != Real(0) )
+        LogicError("Babai points did not match their coordinates");
+
+    Matrix<F> YRef;
+    NearestPlane( B, T, YRef, lllCtrl );
+    Int numMismatches = 0;
+    for( Int j=0; j<numTargets; ++j )
+    {
+        const Real dist = SquaredDistance( Y, T, j );
+        const Real distRef = SquaredDistance( YRef, T, j );
+        if( Abs(dist-distRef) > Real(1e-8)*Max(distRef,Real(1)) )
+            ++numMismatches;
+    }
+    Output(numMismatches," of ",numTargets," differ from NearestPlane");
+    if( numMismatches != 0 )
+        LogicError("Babai points did not match NearestPlane");
+
+    for( const Int blocksize : {1,7,64} )
+    {
+        CVPCtrl ctrl;
+        ctrl.blocksize = blocksize;
+        ctrl.batchSize = 17;
+        Matrix<F> YBlock;
+        solver.Solve( T, YBlock, ctrl );
+        YBlock -= Y;
+        const Real blockError = FrobeniusNorm( YBlock );
+        Output("blocksize=",blocksize,": || Y - YBlock ||_F = ",blockError);
+        if( blockError != Real(0) )
+            LogicError("Babai points depended upon the blocksize");
+    }
+
+    PopIndent();
+}
+
+// The enumeration should never be worse than Babai and, given enough nodes,
+// should find the exact closest vector of a small lattice, which is verified
+// by searching all small perturbations of the coefficients
+template<typename Real>
+void TestEnumeration
+( Int n, Int numTargets, Real entryBound, Int coeffBound )
+{
+    Output("Testing enumeration with ",TypeName<Real>());
+    PushIndent();
+
+    Matrix<Real> B, T;
+    RandomIntegerBasis( B, n, n, entryBound );
+    Gaussian( T, n, numTargets, Real(0), 2*entryBound );
+
+    ClosestVectorSolver<Real> solver( B );
+    const auto& BRed = solver.ReducedBasis();
+    const Int rank = solver.Rank();
+
+    Matrix<Real> YBabai, Y;
+    solver.Solve( T, YBabai );
+    CVPCtrl ctrl;
+    ctrl.maxEnumNodes = 1000000;
+    const Int numImproved = solver.Solve( T, Y, ctrl );
+    Output(numImproved," of ",numTargets," Babai points were improved");
+
+    Int numWorse=0, numInexact=0;
+    vector<Int> coeffs(rank);
+    Matrix<Real> z;
+    for( Int j=0; j<numTargets; ++j )
+    {
+        const Real dist = SquaredDistance( Y, T, j );
+        const Real distBabai = SquaredDistance( YBabai, T, j );
+        if( dist > distBabai*(1+Real(1e-12)) )
+            ++numWorse;
+
+        // Brute-force search over Babai + BRed c for |c_i| <= coeffBound
+        Real bestDist = distBabai;
+        std::fill( coeffs.begin(), coeffs.end(), -coeffBound );
+        while( true )
+        {
+            z = YBabai( ALL, IR(j) );
+            for( Int k=0; k<rank; ++k )
+                Axpy( Real(coeffs[k]), BRed(ALL,IR(k)), z );
+            z -= T( ALL, IR(j) );
+            const Real candDist = Dot( z, z );
+            bestDist = Min( bestDist, candDist );
+
+            Int k=0;
+            for( ; k<rank && coeffs[k] == coeffBound; ++k )
+                coeffs[k] = -coeffBound;
+            if( k == rank )
+                break;
+            ++coeffs[k];
+        }
+        if( dist > bestDist*(1+Real(1e-12)) + Real(1e-8) )
+            ++numInexact;
+    }
+    Output
+    (numWorse," were worse than Babai and ",numInexact,
+     " were not the closest vector");
+    if( numWorse != 0 || numInexact != 0 )
+        LogicError("Enumeration did not find the closest vectors");
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of basis",40);
+        const Int n = Input("--n","width of basis",30);
+        const Int numTargets = Input("--numTargets","number of targets",500);
+        const double entryBound =
+          Input("--entryBound","bound on basis entries",100.);
+        const Int smallDim =
+          Input("--smallDim","dimension of brute-forced lattice",4);
+        const Int coeffBound =
+          Input("--coeffBound","brute-force coefficient bound",4);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestBabai<double>( m, n, numTargets, entryBound );
+            TestBabai<Complex<double>>( m, n, numTargets, entryBound );
+            TestEnumeration<double>( smallDim, 200, 20., coeffBound );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <random>
+using namespace El;
+
+// A fixed seed is used so that every process generates the same basis
+template<typename Real>
+void RandomIntegerBasis( Matrix<Real>& B, Int n, Real entryBound )
+{
+    std::mt19937 generator( 37 );
+    std::uniform_int_distribution<Int> entryDist
+    ( -Int(entryBound), Int(entryBound) );
+    Zeros( B, n, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            B(i,j) = Real(entryDist(generator));
+}
+
+template<typename Real>
+Real LatticeNorm( const Matrix<Real>& B, const Matrix<Real>& v )
+{
+    Matrix<Real> b;
+    Zeros( b, B.Height(), 1 );
+    Gemv( NORMAL, Real(1), B, v, Real(0), b );
+    return FrobeniusNorm( b );
+}
+
+// Ensure that v is a nonzero integer vector, that the returned norm is
+// (up to the precision that the enumeration may have dropped to) that of
+// B v, and that B v is as short as the vector found serially
+template<typename Real>
+void CheckShortVector
+( const Matrix<Real>& B, const Matrix<Real>& v, Real norm, Real normRef,
+  const string& name, bool onRoot )
+{
+    const Real bNorm = LatticeNorm( B, v );
+    if( onRoot )
+        Output
+        (name,": || B v ||_2 = ",bNorm," (returned ",norm,", serial ",normRef,
+         ")");
+    auto vRound( v );
+    Round( vRound );
+    vRound -= v;
+    if( bNorm == Real(0) || FrobeniusNorm(vRound) != Real(0) )
+        LogicError(name," did not return a nonzero lattice vector");
+    const Real eps = limits::Epsilon<Real>();
+    if( Abs(bNorm-norm) > Pow(eps,Real(0.25))*bNorm )
+        LogicError(name," returned an incorrect norm");
+    if( Abs(bNorm-normRef) > Pow(eps,Real(0.5))*normRef )
+        LogicError(name," did not match the serial shortest vector");
+}
+
+// Every process reduces the same basis and compares the serial search for
+// the shortest vector against the parallel search over 'comm', both called
+// directly and through ShortestVectorEnumeration
+template<typename Real>
+void TestParallel
+( Int n, Real entryBound, Int parallelMinDim, mpi::Comm comm )
+{
+    const bool onRoot = ( mpi::Rank(comm) == 0 );
+    OutputFromRoot
+    (comm,"Testing parallel enumeration over ",mpi::Size(comm),
+     " processes with ",TypeName<Real>());
+    PushIndent();
+
+    Matrix<Real> B, R;
+    RandomIntegerBasis( B, n, entryBound );
+    LLL( B, R );
+
+    EnumCtrl<Real> ctrl;
+    ctrl.enumType = FULL_ENUM;
+    Matrix<Real> vRef;
+    ShortestVectorEnumeration( B, R, vRef, ctrl );
+    const Real normRef = LatticeNorm( B, vRef );
+
+    ctrl.parallel = true;
+    ctrl.parallelMinDim = parallelMinDim;
+    ctrl.comm = comm;
+    Matrix<Real> v;
+    const Real norm = ShortestVectorEnumeration( B, R, v, ctrl );
+    CheckShortVector
+    ( B, v, norm, normRef, "ShortestVectorEnumeration", onRoot );
+
+    // Search beneath a bound slightly larger than || b_0 ||_2 so that the
+    // parallel search itself, rather than the serial fallback for a single
+    // unthreaded process, is exercised
+    auto d = GetRealPartOfDiagonal( R );
+    auto N( R );
+    DiagonalSolve( LEFT, NORMAL, d, N );
+    Matrix<Real> upperBounds;
+    Zeros( upperBounds, n, 1 );
+    Fill( upperBounds, R(0,0)*(1+Real(1)/100) );
+    const Real parNorm = svp::ParallelEnumeration( d, N, upperBounds, v, ctrl );
+    CheckShortVector( B, v, parNorm, normRef, "ParallelEnumeration", onRoot );
+
+    PopIndent();
+}
+
+// Since BKZ only uses the norms of the shortest vectors of its blocks, a BKZ
+// reduction whose enumerations are parallelized over 'comm' should produce
+// the same Gram-Schmidt norms as a serial reduction
+template<typename Real>
+void TestBKZ
+( Int n, Real entryBound, Int blocksize, Int parallelMinDim, mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,"Testing parallel BKZ(",blocksize,") over ",mpi::Size(comm),
+     " processes with ",TypeName<Real>());
+    PushIndent();
+
+    Matrix<Real> B;
+    RandomIntegerBasis( B, n, entryBound );
+
+    BKZCtrl<Real> ctrl;
+    ctrl.blocksize = blocksize;
+    ctrl.parallelEnum = false;
+    Matrix<Real> BRef( B ), RRef;
+    BKZ( BRef, RRef, ctrl );
+
+    ctrl.parallelEnum = true;
+    ctrl.enumCtrl.parallelMinDim = parallelMinDim;
+    ctrl.enumCtrl.comm = comm;
+    Matrix<Real> BPar( B ), RPar;
+    BKZ( BPar, RPar, ctrl );
+
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    Real maxError = 0;
+    for( Int j=0; j<n; ++j )
+        maxError =
+          Max( maxError,
+               Abs(Abs(RPar(j,j))-Abs(RRef(j,j)))/Abs(RRef(j,j)) );
+    OutputFromRoot
+    (comm,"|| b_0 ||_2 = ",FrobeniusNorm(BPar(ALL,IR(0)))," (serial ",
+     FrobeniusNorm(BRef(ALL,IR(0))),"), max relative Gram-Schmidt norm "
+     "difference: ",maxError);
+    if( maxError > tol )
+        LogicError("Parallel BKZ did not match the serial reduction");
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","dimension of lattice",24);
+        const double entryBound =
+          Input("--entryBound","bound on random basis entries",1000.);
+        const Int parallelMinDim =
+          Input("--parallelMinDim","minimum dimension of parallel search",2);
+        const Int blocksize = Input("--blocksize","BKZ blocksize",10);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool distributed =
+          Input("--distributed","test distributed?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( sequential && mpi::Rank() == 0 )
+        {
+            TestParallel<double>
+            ( n, entryBound, parallelMinDim, mpi::COMM_SELF );
+            TestBKZ<double>
+            ( n, entryBound, blocksize, parallelMinDim, mpi::COMM_SELF );
+        }
+        if( distributed )
+        {
+            TestParallel<double>( n, entryBound, parallelMinDim, comm );
+            TestBKZ<double>( n, entryBound, blocksize, parallelMinDim, comm );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+void RandomIntegerBasis( Matrix<Real>& B, Int n, Real entryBound )
+{
+    Uniform( B, n, n, Real(0), entryBound );
+    Round( B );
+}
+
+// The (n+1) x n basis [I; a^T] of a knapsack problem with random weights a
+template<typename Real>
+void KnapsackBasis( Matrix<Real>& B, Int n, Real weightBound )
+{
+    Identity( B, n+1, n );
+    auto aT = B( IR(n), ALL );
+    Uniform( aT, 1, n, weightBound/2, weightBound/2 );
+    Round( aT );
+}
+
+// Check the LLL(delta) conditions, with size reduction relative to 'eta',
+// by recomputing the R factor of the reduced basis
+template<typename Real>
+void CheckConditions( const Matrix<Real>& BRed, Real delta, Real eta )
+{
+    Matrix<Real> R( BRed );
+    qr::ExplicitTriang( R );
+    const Int n = R.Width();
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    Real lovaszViolation=0, sizeViolation=0;
+    for( Int i=0; i<n; ++i )
+    {
+        const Real rho_i_i = Abs(R(i,i));
+        for( Int j=i+1; j<n; ++j )
+            sizeViolation =
+              Max( sizeViolation, Abs(R(i,j))/rho_i_i - eta );
+        if( i < n-1 )
+        {
+            const Real rho_i_ip1 = R(i,i+1);
+            const Real rho_ip1_ip1 = R(i+1,i+1);
+            lovaszViolation =
+              Max
+              ( lovaszViolation,
+                delta -
+                (rho_ip1_ip1*rho_ip1_ip1+rho_i_ip1*rho_i_ip1) /
+                (rho_i_i*rho_i_i) );
+        }
+    }
+    Output
+    ("Lovasz violation: ",lovaszViolation,", size violation: ",sizeViolation);
+    if( lovaszViolation > tol || sizeViolation > tol )
+        LogicError("Reduced basis did not satisfy the LLL conditions");
+}
+
+// Reduce the basis with and without the integer fast path and ensure that
+// both results satisfy the LLL conditions, are unimodular transformations of
+// the original basis, and have the same volume as the original lattice
+template<typename Real>
+void TestFastPath( const Matrix<Real>& B, const string& name )
+{
+    Output("Testing integer fast path on ",name," lattice");
+    PushIndent();
+
+    Matrix<Real> R( B );
+    qr::ExplicitTriang( R );
+    Real logVol = 0;
+    for( Int j=0; j<R.Width(); ++j )
+        logVol += Log(Abs(R(j,j)));
+
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    LLLCtrl<Real> ctrl;
+    for( const bool integerFastPath : {true,false} )
+    {
+        ctrl.integerFastPath = integerFastPath;
+        Matrix<Real> BRed( B ), U, RRed;
+        Timer timer;
+        timer.Start();
+        const auto info = LLL( BRed, U, RRed, ctrl );
+        Output
+        ("integerFastPath=",integerFastPath,": ",timer.Stop()," seconds, ",
+         info.numSwaps," swaps, delta=",info.delta,", eta=",info.eta,
+         ", log(vol)=",info.logVol);
+
+        if( info.rank != B.Width() )
+            LogicError("Reduction did not preserve the rank");
+        if( Abs(info.logVol-logVol) > tol*Max(Abs(logVol),Real(1)) )
+            LogicError("Reduction did not preserve the volume");
+
+        Matrix<Real> E( BRed );
+        Gemm( NORMAL, NORMAL, Real(-1), B, U, Real(1), E );
+        if( FrobeniusNorm(E) != Real(0) )
+            LogicError("Reduced basis was not B U");
+
+        const Real eta =
+          integerFastPath ? Max(ctrl.eta,Real(0.51)) : ctrl.eta;
+        CheckConditions( BRed, ctrl.delta, eta );
+    }
+
+    PopIndent();
+}
+
+// Reduce the basis with LLL_SEGMENTED for several segment sizes and ensure
+// that each result satisfies the LLL conditions, is a unimodular
+// transformation of the original basis, and has the original volume
+template<typename Real>
+void TestSegmented( const Matrix<Real>& B, const string& name )
+{
+    Output("Testing segmented LLL on ",name," lattice");
+    PushIndent();
+
+    Matrix<Real> R( B );
+    qr::ExplicitTriang( R );
+    Real logVol = 0;
+    for( Int j=0; j<R.Width(); ++j )
+        logVol += Log(Abs(R(j,j)));
+
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    LLLCtrl<Real> ctrl;
+    ctrl.variant = LLL_SEGMENTED;
+    for( const Int segmentSize : {Int(2),Int(8),B.Width()/2,B.Width()} )
+    {
+        ctrl.segmentSize = segmentSize;
+        Matrix<Real> BRed( B ), U, RRed;
+        const auto info = LLL( BRed, U, RRed, ctrl );
+        Output
+        ("segmentSize=",segmentSize,": ",info.segmentTime," seconds in "
+         "segments, ",info.mergeTime," seconds merging, ",info.numSwaps,
+         " swaps");
+
+        if( info.rank != B.Width() )
+            LogicError("Reduction did not preserve the rank");
+        if( Abs(info.logVol-logVol) > tol*Max(Abs(logVol),Real(1)) )
+            LogicError("Reduction did not preserve the volume");
+
+        Matrix<Real> E( BRed );
+        Gemm( NORMAL, NORMAL, Real(-1), B, U, Real(1), E );
+        if( FrobeniusNorm(E) != Real(0) )
+            LogicError("Reduced basis was not B U");
+
+        // The outer pass over these integer bases takes the fast path
+        CheckConditions( BRed, ctrl.delta, Max(ctrl.eta,Real(0.51)) );
+    }
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","dimension of lattices",40);
+        const double entryBound =
+          Input("--entryBound","bound on random basis entries",1000.);
+        const double weightBound =
+          Input("--weightBound","bound on knapsack weights",1e9);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            Matrix<double> B;
+            RandomIntegerBasis( B, n, entryBound );
+            TestFastPath( B, "random" );
+            TestSegmented( B, "random" );
+            KnapsackBasis( B, n, weightBound );
+            TestFastPath( B, "knapsack" );
+            TestSegmented( B, "knapsack" );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,551 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <random>
+using namespace El;
+
+// Each case solves a random direct-form LP (or QP) with and without one of
+// the features of the sparse IPM and compares the results. Every problem is
+// generated sequentially from a fixed seed, so that every process generates
+// the same problem, and is then imported into either the sequential or the
+// distributed data structures.
+
+struct TestParams
+{
+    Int m, n, numNonzerosPerRow;
+    Int numDenseColumns, maxCorrectors, precondRank;
+    bool print;
+};
+
+// Form a random feasible and bounded direct-form LP whose rows each have a
+// unit diagonal (so that A has full row rank), 'numNonzerosPerRow' distinct
+// off-diagonal nonzeros, and an entry in each of the last 'numDenseColumns'
+// columns. Different seeds thus yield different sparsity patterns with the
+// same dimensions and number of nonzeros.
+template<typename Real>
+void RandomSparseLP
+( Int m, Int n, Int numNonzerosPerRow, Int numDenseColumns, unsigned seed,
+  DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem )
+{
+    std::mt19937 generator( seed );
+    std::uniform_real_distribution<double> entryDist( -1, 1 );
+    std::uniform_real_distribution<double> positiveDist( 0.5, 1.5 );
+
+    const Int numSparseColumns = n - numDenseColumns;
+    vector<Int> cols( numSparseColumns );
+    for( Int j=0; j<numSparseColumns; ++j )
+        cols[j] = j;
+    auto& A = problem.A;
+    Zeros( A, m, n );
+    A.Reserve( m*(numNonzerosPerRow+numDenseColumns+1) );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i, Real(1) );
+        std::shuffle( cols.begin(), cols.end(), generator );
+        for( Int e=0, numQueued=0; numQueued<numNonzerosPerRow; ++e )
+        {
+            if( cols[e] == i )
+                continue;
+            A.QueueUpdate( i, cols[e], entryDist(generator) );
+            ++numQueued;
+        }
+        for( Int j=numSparseColumns; j<n; ++j )
+            A.QueueUpdate( i, j, entryDist(generator) );
+    }
+    A.ProcessQueues();
+
+    // Choose b = A x for a positive x and c = A^T y + z for a random y and a
+    // positive z so that the primal and dual are feasible
+    Matrix<Real> xFeas, y;
+    Zeros( xFeas, n, 1 );
+    for( Int j=0; j<n; ++j )
+        xFeas(j) = positiveDist( generator );
+    Zeros( problem.b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xFeas, Real(0), problem.b );
+
+    Zeros( y, m, 1 );
+    for( Int i=0; i<m; ++i )
+        y(i) = entryDist( generator );
+    Zeros( problem.c, n, 1 );
+    for( Int j=0; j<n; ++j )
+        problem.c(j) = positiveDist( generator );
+    Multiply( TRANSPOSE, Real(1), A, y, Real(1), problem.c );
+}
+
+// Form an LP with a sparse core augmented by an empty column, a singleton
+// row, a forcing row, and a duplicate row, so that each of the reductions of
+// the presolve is exercised. If 'infeasible' is true, an inconsistent empty
+// row is also appended.
+template<typename Real>
+void PresolvableLP
+( Int m, Int n, Int numNonzerosPerRow, bool infeasible,
+  DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem )
+{
+    std::mt19937 generator( 17 );
+    std::uniform_real_distribution<double> entryDist( -1, 1 );
+    std::uniform_real_distribution<double> positiveDist( 0.5, 1.5 );
+    std::uniform_int_distribution<Int> colDist( 0, n-1 );
+
+    // Columns n, n+1, and n+2 are the empty, singleton, and forcing columns
+    // (with the forcing row also fixing column n+3), while rows m, m+1, and
+    // m+2 are the singleton, forcing, and duplicate rows
+    const Int nTotal = n + 4;
+    const Int mTotal = m + 3 + (infeasible ? 1 : 0);
+    const Int emptyCol = n;
+    const Int singletonCol = n+1;
+    const Real singletonValue = 1.5;
+
+    vector<Real> xFeas(nTotal,Real(0));
+    for( Int j=0; j<n; ++j )
+        xFeas[j] = positiveDist( generator );
+    xFeas[singletonCol] = singletonValue;
+
+    auto& A = problem.A;
+    Zeros( A, mTotal, nTotal );
+    A.Reserve( (m+1)*(numNonzerosPerRow+3) + 3 );
+    for( Int i=0; i<m; ++i )
+    {
+        // Ensure that every core column has a nonzero
+        A.QueueUpdate( i, i % n, Real(1) );
+        for( Int e=1; e<numNonzerosPerRow; ++e )
+            A.QueueUpdate( i, colDist(generator), entryDist(generator) );
+    }
+    for( Int j=m; j<n; ++j )
+        A.QueueUpdate( j % m, j, Real(1) );
+    A.QueueUpdate( 0, singletonCol, Real(1) );
+    A.QueueUpdate( 1, n+2, Real(1) );
+    A.QueueUpdate( 1, n+3, Real(-1) );
+    A.QueueUpdate( m, singletonCol, Real(2) );
+    A.QueueUpdate( m+1, n+2, Real(1) );
+    A.QueueUpdate( m+1, n+3, Real(3) );
+    A.ProcessQueues();
+
+    // Duplicate (twice) the first row
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valueBuf = A.LockedValueBuffer();
+    vector<Entry<Real>> duplicate;
+    for( Int e=offsetBuf[0]; e<offsetBuf[1]; ++e )
+        duplicate.push_back( Entry<Real>{m+2,colBuf[e],2*valueBuf[e]} );
+    A.Reserve( duplicate.size() );
+    for( const auto& entry : duplicate )
+        A.QueueUpdate( entry );
+    A.ProcessQueues();
+
+    auto& b = problem.b;
+    Zeros( b, mTotal, 1 );
+    for( Int e=0; e<A.NumEntries(); ++e )
+        b(A.Row(e)) += A.Value(e)*xFeas[A.Col(e)];
+    if( infeasible )
+        b(mTotal-1) = Real(1);
+
+    Matrix<Real> y;
+    Zeros( y, mTotal, 1 );
+    for( Int i=0; i<m; ++i )
+        y(i) = entryDist( generator );
+    auto& c = problem.c;
+    Zeros( c, nTotal, 1 );
+    for( Int j=0; j<nTotal; ++j )
+        c(j) = positiveDist( generator );
+    Multiply( TRANSPOSE, Real(1), A, y, Real(1), c );
+    c(emptyCol) = Real(1);
+}
+
+// A random positive diagonal quadratic term
+template<typename Real>
+void RandomDiagonalQ( Int n, unsigned seed, SparseMatrix<Real>& Q )
+{
+    std::mt19937 generator( seed );
+    std::uniform_real_distribution<double> positiveDist( 0.5, 1.5 );
+    Zeros( Q, n, n );
+    Q.Reserve( n );
+    for( Int j=0; j<n; ++j )
+        Q.QueueUpdate( j, j, Real(positiveDist(generator))/10 );
+    Q.ProcessQueues();
+}
+
+template<typename Real>
+void Import
+( const SparseMatrix<Real>& A, SparseMatrix<Real>& ACopy, const Grid& grid )
+{ ACopy = A; }
+
+template<typename Real>
+void Import
+( const SparseMatrix<Real>& A, DistSparseMatrix<Real>& ADist,
+  const Grid& grid )
+{
+    ADist.SetGrid( grid );
+    ADist.Resize( A.Height(), A.Width() );
+    const Int localHeight = ADist.LocalHeight();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int firstRow = ADist.FirstLocalRow();
+    ADist.Reserve( offsetBuf[firstRow+localHeight]-offsetBuf[firstRow] );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = ADist.GlobalRow(iLoc);
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+            ADist.QueueLocalUpdate( iLoc, A.Col(e), A.Value(e) );
+    }
+    ADist.ProcessLocalQueues();
+}
+
+template<typename Real>
+void Import( const Matrix<Real>& v, Matrix<Real>& vCopy, const Grid& grid )
+{ vCopy = v; }
+
+template<typename Real>
+void Import
+( const Matrix<Real>& v, DistMultiVec<Real>& vDist, const Grid& grid )
+{
+    vDist.SetGrid( grid );
+    vDist.Resize( v.Height(), 1 );
+    for( Int iLoc=0; iLoc<vDist.LocalHeight(); ++iLoc )
+        vDist.SetLocal( iLoc, 0, v(vDist.GlobalRow(iLoc)) );
+}
+
+template<typename Real,class SparseMatrixType,class VectorType>
+void Import
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPProblem<SparseMatrixType,VectorType>& problemCopy,
+  const Grid& grid )
+{
+    ForceSimpleAlignments( problemCopy, grid );
+    Import( problem.A, problemCopy.A, grid );
+    Import( problem.b, problemCopy.b, grid );
+    Import( problem.c, problemCopy.c, grid );
+}
+
+template<typename Real>
+void CheckObjective
+( const Real& objective, const Real& objectiveRef, const Real& tol,
+  const string& feature, bool onRoot )
+{
+    const Real objectiveError =
+      Abs(objective-objectiveRef) / Max(Abs(objectiveRef),Real(1));
+    if( onRoot )
+        Output("objective = ",objective," (",objectiveRef," for reference)");
+    if( objectiveError > tol )
+        LogicError(feature," changed the objective");
+}
+
+// Presolve should reproduce the solution of the original LP and detect an
+// inconsistent empty row (on every process)
+template<typename Real,class SparseMatrixType,class VectorType>
+void TestPresolve( const TestParams& params, const Grid& grid, bool onRoot )
+{
+    if( onRoot )
+        Output("Testing presolve");
+    PushIndent();
+
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> seqProblem;
+    PresolvableLP
+    ( params.m, params.n, params.numNonzerosPerRow, false, seqProblem );
+    DirectLPProblem<SparseMatrixType,VectorType> problem, reducedProblem;
+    Import( seqProblem, problem, grid );
+    ForceSimpleAlignments( reducedProblem, grid );
+    PresolveRecord<Real> record;
+    Presolve( problem, reducedProblem, record );
+    if( onRoot )
+        Output
+        ("Reduced from ",problem.A.Height()," x ",problem.A.Width()," to ",
+         reducedProblem.A.Height()," x ",reducedProblem.A.Width()," with ",
+         record.reductions.size()," reductions");
+    if( reducedProblem.A.Height() > params.m ||
+        reducedProblem.A.Width() > params.n )
+        LogicError("Presolve did not perform the expected reductions");
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = params.print;
+    DirectLPSolution<VectorType> solution, solutionRef;
+    ForceSimpleAlignments( solution, grid );
+    ForceSimpleAlignments( solutionRef, grid );
+    LP( problem, solutionRef, ctrl );
+    ctrl.presolve = true;
+    LP( problem, solution, ctrl );
+
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+    CheckObjective
+    ( Dot(problem.c,solution.x), Dot(problem.c,solutionRef.x), tol*tol,
+      "Presolve", onRoot );
+    const Real xRefNorm = FrobeniusNorm( solutionRef.x );
+    Axpy( Real(-1), solutionRef.x, solution.x );
+    const Real xRelError = FrobeniusNorm(solution.x) / Max(xRefNorm,Real(1));
+    if( onRoot )
+        Output("|| x - xRef ||_2 / || xRef ||_2 = ",xRelError);
+    if( xRelError > tol )
+        LogicError("Presolve changed the solution");
+
+    PresolvableLP
+    ( params.m, params.n, params.numNonzerosPerRow, true, seqProblem );
+    Import( seqProblem, problem, grid );
+    bool detected = false;
+    try { Presolve( problem, reducedProblem, record ); }
+    catch( const std::runtime_error& e ) { detected = true; }
+    if( !detected )
+        LogicError("Presolve did not detect infeasibility");
+
+    PopIndent();
+}
+
+// Solve a sequence of LPs whose last member has a different sparsity pattern
+// (but the same dimensions and number of nonzeros) than the others, so that
+// the session must detect that neither its symbolic analysis nor its previous
+// solution can be reused
+template<typename Real,class SparseMatrixType,class VectorType,
+         class SessionType>
+void TestSessions( const TestParams& params, const Grid& grid, bool onRoot )
+{
+    if( onRoot )
+        Output("Testing sessions");
+    PushIndent();
+
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> seqProblem0, seqProblem1;
+    RandomSparseLP
+    ( params.m, params.n, params.numNonzerosPerRow, 0, 1, seqProblem0 );
+    RandomSparseLP
+    ( params.m, params.n, params.numNonzerosPerRow, 0, 2, seqProblem1 );
+    DirectLPProblem<SparseMatrixType,VectorType> problem0, problem1;
+    Import( seqProblem0, problem0, grid );
+    Import( seqProblem1, problem1, grid );
+
+    SessionType session;
+    session.RecordAnalysis( problem0.A, AUGMENTED_KKT );
+    if( !session.CanReuseAnalysis( problem0.A, AUGMENTED_KKT ) ||
+        session.CanReuseAnalysis( problem1.A, AUGMENTED_KKT ) )
+        LogicError("Session did not compare the sparsity patterns");
+    session.Reset();
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = params.print;
+    DirectLPSolution<VectorType> solution, solutionRef;
+    ForceSimpleAlignments( solution, grid );
+    ForceSimpleAlignments( solutionRef, grid );
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    for( const auto* problem : { &problem0, &problem0, &problem1 } )
+    {
+        LP( *problem, solution, session, ctrl );
+        PrintSessionSummary( session );
+        LP( *problem, solutionRef, ctrl );
+        CheckObjective
+        ( Dot(problem->c,solution.x), Dot(problem->c,solutionRef.x), tol,
+          "The session", onRoot );
+    }
+    if( session.numSolves != 1 )
+        LogicError("Session was not reset after the pattern changed");
+
+    PopIndent();
+}
+
+// The correctors should not change the objective nor increase the number of
+// IPM iterations (as recorded by a fresh session)
+template<typename Real,class SparseMatrixType,class VectorType,
+         class SessionType>
+void TestCorrectors
+( const TestParams& params, bool quadratic, const Grid& grid, bool onRoot )
+{
+    if( onRoot )
+        Output("Testing ",(quadratic ? "QP" : "LP")," centrality correctors");
+    PushIndent();
+
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> seqProblem;
+    RandomSparseLP
+    ( params.m, params.n, params.numNonzerosPerRow, 0, 29, seqProblem );
+    SparseMatrix<Real> seqQ;
+    if( quadratic )
+        RandomDiagonalQ( params.n, 29, seqQ );
+    else
+        Zeros( seqQ, params.n, params.n );
+    DirectLPProblem<SparseMatrixType,VectorType> problem;
+    Import( seqProblem, problem, grid );
+    SparseMatrixType Q;
+    Import( seqQ, Q, grid );
+
+    Real objectives[2];
+    Int numIts[2];
+    for( const Int numCorrectors : {Int(0),params.maxCorrectors} )
+    {
+        MehrotraCtrl<Real> mehrotraCtrl;
+        mehrotraCtrl.system = AUGMENTED_KKT;
+        mehrotraCtrl.mehrotra = true;
+        mehrotraCtrl.print = params.print;
+        mehrotraCtrl.maxCentralityCorrectors = numCorrectors;
+
+        SessionType session;
+        DirectLPSolution<VectorType> solution;
+        ForceSimpleAlignments( solution, grid );
+        if( quadratic )
+        {
+            qp::direct::Ctrl<Real> ctrl;
+            ctrl.mehrotraCtrl = mehrotraCtrl;
+            QP
+            ( Q, problem.A, problem.b, problem.c,
+              solution.x, solution.y, solution.z, session, ctrl );
+        }
+        else
+        {
+            lp::direct::Ctrl<Real> ctrl(true);
+            ctrl.mehrotraCtrl = mehrotraCtrl;
+            LP( problem, solution, session, ctrl );
+        }
+        VectorType xQ( solution.x );
+        Multiply( NORMAL, Real(1), Q, solution.x, Real(0), xQ );
+        const Int index = ( numCorrectors == 0 ? 0 : 1 );
+        objectives[index] =
+          Dot(problem.c,solution.x) + Dot(solution.x,xQ)/2;
+        numIts[index] = session.coldIterations;
+    }
+    if( onRoot )
+        Output
+        (numIts[1]," iterations with ",params.maxCorrectors," correctors and ",
+         numIts[0]," without");
+    CheckObjective
+    ( objectives[1], objectives[0],
+      Pow(limits::Epsilon<Real>(),Real(0.25)), "Correctors", onRoot );
+    if( numIts[1] > numIts[0] )
+        LogicError("Correctors increased the number of iterations");
+
+    PopIndent();
+}
+
+// Splitting the dense columns off from the normal equations should not
+// change the solution
+template<typename Real,class SparseMatrixType,class VectorType>
+void TestDenseColumns
+( const TestParams& params, const Grid& grid, bool onRoot )
+{
+    if( onRoot )
+        Output("Testing ",params.numDenseColumns," dense columns");
+    PushIndent();
+
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> seqProblem;
+    RandomSparseLP
+    ( params.m, params.n, params.numNonzerosPerRow, params.numDenseColumns,
+      31, seqProblem );
+    DirectLPProblem<SparseMatrixType,VectorType> problem;
+    Import( seqProblem, problem, grid );
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = params.print;
+    ctrl.mehrotraCtrl.system = NORMAL_KKT;
+    DirectLPSolution<VectorType> solution, solutionRef;
+    ForceSimpleAlignments( solution, grid );
+    ForceSimpleAlignments( solutionRef, grid );
+    LP( problem, solutionRef, ctrl );
+    ctrl.mehrotraCtrl.system = SPLIT_NORMAL_KKT;
+    LP( problem, solution, ctrl );
+    // Both solves only target a relative duality gap of roughly sqrt(eps)
+    CheckObjective
+    ( Dot(problem.c,solution.x), Dot(problem.c,solutionRef.x),
+      Pow(limits::Epsilon<Real>(),Real(0.25)), "SPLIT_NORMAL_KKT", onRoot );
+
+    PopIndent();
+}
+
+// Matrix-free solves with both the Jacobi (rank zero) and partial Cholesky
+// preconditioners should match a factorization of the normal equations
+template<typename Real,class SparseMatrixType,class VectorType>
+void TestMatrixFree( const TestParams& params, const Grid& grid, bool onRoot )
+{
+    if( onRoot )
+        Output("Testing matrix-free normal equations");
+    PushIndent();
+
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> seqProblem;
+    RandomSparseLP
+    ( params.m, params.n, params.numNonzerosPerRow, 0, 23, seqProblem );
+    DirectLPProblem<SparseMatrixType,VectorType> problem;
+    Import( seqProblem, problem, grid );
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = params.print;
+    ctrl.mehrotraCtrl.system = NORMAL_KKT;
+    DirectLPSolution<VectorType> solution, solutionRef;
+    ForceSimpleAlignments( solution, grid );
+    ForceSimpleAlignments( solutionRef, grid );
+    LP( problem, solutionRef, ctrl );
+
+    ctrl.mehrotraCtrl.system = MATRIX_FREE_NORMAL_KKT;
+    for( const Int rank : {Int(0),params.precondRank} )
+    {
+        if( onRoot )
+            Output("krylovPrecondRank=",rank);
+        ctrl.mehrotraCtrl.krylovPrecondRank = rank;
+        LP( problem, solution, ctrl );
+        CheckObjective
+        ( Dot(problem.c,solution.x), Dot(problem.c,solutionRef.x),
+          Pow(limits::Epsilon<Real>(),Real(0.25)), "MATRIX_FREE_NORMAL_KKT",
+          onRoot );
+    }
+
+    PopIndent();
+}
+
+template<typename Real,class SparseMatrixType,class VectorType,
+         class SessionType>
+void TestFeatures
+( const string& label, const TestParams& params, const Grid& grid,
+  bool onRoot )
+{
+    if( onRoot )
+        Output("Testing ",label," LP features with ",TypeName<Real>());
+    PushIndent();
+
+    TestPresolve<Real,SparseMatrixType,VectorType>( params, grid, onRoot );
+    TestSessions<Real,SparseMatrixType,VectorType,SessionType>
+    ( params, grid, onRoot );
+    for( const bool quadratic : {false,true} )
+        TestCorrectors<Real,SparseMatrixType,VectorType,SessionType>
+        ( params, quadratic, grid, onRoot );
+    TestDenseColumns<Real,SparseMatrixType,VectorType>( params, grid, onRoot );
+    TestMatrixFree<Real,SparseMatrixType,VectorType>( params, grid, onRoot );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        TestParams params;
+        params.m = Input("--m","height of A",100);
+        params.n = Input("--n","width of A",200);
+        params.numNonzerosPerRow =
+          Input("--numNonzerosPerRow","off-diagonal nonzeros per row",4);
+        params.numDenseColumns =
+          Input("--numDenseColumns","number of dense columns",3);
+        params.maxCorrectors =
+          Input("--maxCorrectors","maximum number of correctors",3);
+        params.precondRank =
+          Input("--precondRank","rank of partial Cholesky preconditioner",20);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool distributed =
+          Input("--distributed","test distributed?",true);
+        params.print = Input("--print","print IPM progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        if( sequential && mpi::Rank() == 0 )
+            TestFeatures
+            <double,SparseMatrix<double>,Matrix<double>,
+             SparseMehrotraSession<double>>
+            ( "sequential", params, grid, true );
+        if( distributed )
+            TestFeatures
+            <double,DistSparseMatrix<double>,DistMultiVec<double>,
+             DistSparseMehrotraSession<double>>
+            ( "distributed", params, grid, grid.Rank() == 0 );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}